@@ -21,7 +21,9 @@
 
 #include <loco.h>
 
+#include <functional>
 #include <memory>
+#include <ostream>
 
 namespace luci
 {
@@ -44,6 +46,17 @@ public:
     // Exporter calls store for export data
     // Notice: Please DO NOT STORE ptr and size when implementing this in Client
     virtual bool store(const char *ptr, const size_t size) const = 0;
+
+  public: // Exporter -> Client (optional)
+    using Writer = std::function<bool(std::ostream &)>;
+
+    // Client returns true if it accepts export data as a stream with storeStream
+    virtual bool streamable(void) const { return false; }
+
+    // Exporter calls storeStream instead of store if Client is streamable.
+    // Client provides a stream and writer writes export data into it piece by piece,
+    // so that export data with large constants is not held in memory as a whole.
+    virtual bool storeStream(const Writer &) const { return false; }
   };
 
 public:
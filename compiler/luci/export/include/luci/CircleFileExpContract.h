@@ -54,6 +54,17 @@ public:
     return fs.good();
   }
 
+  bool streamable(void) const final { return true; }
+
+  bool storeStream(const Writer &writer) const final
+  {
+    std::ofstream fs(_filepath, std::ofstream::binary);
+    if (!writer(fs))
+      return false;
+
+    return fs.good();
+  }
+
 private:
   luci::Module *_module;
   const std::string _filepath;
@@ -38,6 +38,10 @@ bool CircleExporter::invoke(Contract *contract) const
   {
     CircleExporterImpl impl(module);
 
+    // constant data is written directly from the module, without a copy in memory
+    if (contract->streamable())
+      return contract->storeStream([&impl](std::ostream &os) { return impl.write(os); });
+
     const char *ptr = impl.getBufferPointer();
     const size_t size = impl.getBufferSize();
 
@@ -17,6 +17,8 @@
 #include "luci/CircleExporter.h"
 
 #include <luci/Plan/CircleNodeExecutionPlan.h>
+#include <luci/IR/Nodes/CircleAdd.h>
+#include <luci/IR/Nodes/CircleConst.h>
 #include <luci/IR/Nodes/CircleInput.h>
 #include <luci/IR/Nodes/CircleOutput.h>
 #include <luci/IR/Nodes/CircleRelu.h>
@@ -27,6 +29,8 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+
 class SampleGraphContract : public luci::CircleExporter::Contract
 {
 public:
@@ -138,3 +142,111 @@ TEST(CircleExport, export_execution_plan_nosetting_NEG)
   ASSERT_NE(model.get(), nullptr);
   ASSERT_EQ(model->metadata.size(), 0);
 }
+
+namespace
+{
+
+class ConstGraphContract : public SampleGraphContract
+{
+public:
+  ConstGraphContract()
+  {
+    // input -> add(input, const) -> relu -> output
+    auto g = module()->graph();
+    input_node->shape({1, 2, 3, 4});
+    const_node = g->nodes()->create<luci::CircleConst>();
+    add_node = g->nodes()->create<luci::CircleAdd>();
+
+    const_node->name("const");
+    const_node->dtype(loco::DataType::FLOAT32);
+    const_node->shape({1, 2, 3, 4});
+    const_node->shape_status(luci::ShapeStatus::VALID);
+    const_node->size<loco::DataType::FLOAT32>(24);
+    for (uint32_t i = 0; i < 24; ++i)
+      const_node->at<loco::DataType::FLOAT32>(i) = static_cast<float>(i);
+
+    add_node->name("add");
+    add_node->x(input_node);
+    add_node->y(const_node);
+    add_node->fusedActivationFunction(luci::FusedActFunc::NONE);
+    relu_node->features(add_node);
+  }
+
+public:
+  luci::CircleConst *const_node;
+  luci::CircleAdd *add_node;
+};
+
+class StreamGraphContract : public ConstGraphContract
+{
+public:
+  bool streamable(void) const override { return true; }
+
+  bool storeStream(const Writer &writer) const override
+  {
+    std::ostringstream os;
+    if (!writer(os))
+      return false;
+
+    auto data = os.str();
+    return store(data.data(), data.size());
+  }
+};
+
+} // namespace
+
+TEST(CircleExport, export_ext_buffer_stream)
+{
+  ConstGraphContract contract;
+  StreamGraphContract stream_contract;
+  contract.module()->ext_buffer(true);
+  stream_contract.module()->ext_buffer(true);
+
+  luci::UserSettings::settings()->set(luci::UserSettings::ExecutionPlanGen, false);
+  luci::CircleExporter exporter;
+
+  ASSERT_TRUE(exporter.invoke(&contract));
+  ASSERT_TRUE(exporter.invoke(&stream_contract));
+
+  // Streamed data is same as data in memory
+  ASSERT_EQ(contract.get_buffer(), stream_contract.get_buffer());
+  ASSERT_EQ(stream_contract.get_buffer().size() % 16, 0);
+
+  const auto &data = stream_contract.get_buffer();
+  auto model = circle::GetModel(data.data());
+  ASSERT_NE(model, nullptr);
+
+  uint32_t num_ext_buffers = 0;
+  for (auto buffer : *model->buffers())
+  {
+    if (buffer->offset() <= 1)
+      continue;
+
+    ASSERT_EQ(buffer->offset() % 16, 0);
+    ASSERT_EQ(buffer->size(), 24 * sizeof(float));
+    ASSERT_LE(buffer->offset() + buffer->size(), data.size());
+
+    auto values = reinterpret_cast<const float *>(data.data() + buffer->offset());
+    for (uint32_t i = 0; i < 24; ++i)
+      ASSERT_EQ(values[i], static_cast<float>(i));
+    num_ext_buffers++;
+  }
+  ASSERT_EQ(num_ext_buffers, 1);
+}
+
+TEST(CircleExport, export_stream_no_ext_buffer)
+{
+  StreamGraphContract contract;
+
+  luci::UserSettings::settings()->set(luci::UserSettings::ExecutionPlanGen, false);
+  luci::CircleExporter exporter;
+
+  ASSERT_TRUE(exporter.invoke(&contract));
+
+  // Without extended buffer, constant data is in flatbuffers area
+  const auto &data = contract.get_buffer();
+  std::unique_ptr<circle::ModelT> model(circle::GetModel(data.data())->UnPack());
+  ASSERT_NE(model.get(), nullptr);
+  for (auto &buffer : model->buffers)
+    ASSERT_EQ(buffer->offset, 0);
+}
@@ -107,6 +107,51 @@ encodeOperatorCodes(FlatBufferBuilder &builder, std::unordered_map<luci::OpCode,
 namespace
 {
 
+// Bytes of constant data in the module, to choose extended buffer before export
+// NOTE This is an upper bound as buffers with same values are shared in export
+uint64_t const_data_size(luci::Module *module)
+{
+  uint64_t total = 0;
+  for (size_t g = 0; g < module->size(); ++g)
+  {
+    for (auto node : loco::all_nodes(module->graph(g)))
+    {
+      auto const_node = dynamic_cast<luci::CircleConst *>(node);
+      if (const_node == nullptr)
+        continue;
+
+      uint64_t num_elements = 1;
+      for (uint32_t i = 0; i < const_node->rank(); ++i)
+      {
+        if (const_node->dim(i).known())
+          num_elements *= const_node->dim(i).value();
+      }
+
+      switch (const_node->dtype())
+      {
+        case loco::DataType::FLOAT32:
+        case loco::DataType::S8:
+        case loco::DataType::S16:
+        case loco::DataType::S32:
+        case loco::DataType::S64:
+        case loco::DataType::U8:
+        case loco::DataType::BOOL:
+          total += num_elements * loco::size(const_node->dtype());
+          break;
+        default:
+          // other types, e.g. STRING, S4 and U4, are not put in extended buffer
+          break;
+      }
+    }
+  }
+  return total;
+}
+
+} // namespace
+
+namespace
+{
+
 void optimize(loco::Graph *g)
 {
   logo::Phase phase;
@@ -162,6 +207,12 @@ void CircleExporterImpl::exportModule(Module *module)
   // if source is extended buffer mode, force export to use extended buffer
   md._ext_buffer = module->ext_buffer();
 
+  // use extended buffer from the start if constants cannot fit in flatbuffers area,
+  // not to find it out in the middle of export and run again
+  if (!md._ext_buffer && check_size_limit(_builder, const_data_size(module)))
+    md._ext_buffer = true;
+
+  // NOTE run again with extended buffer if metadata makes flatbuffers area exceed the limit
   if (!exportModuleData(module, md) && md._require_ext_buffer)
   {
     assert(md._ext_buffer == false);
@@ -250,76 +301,93 @@ bool CircleExporterImpl::exportModuleData(Module *module, SerializedModelData &m
 void CircleExporterImpl::finalizeWithExtendedBuffer(SerializedModelData &md)
 {
   _ext_buffer = md._ext_buffer;
+  _ext_buffer_data.clear();
+  _fb_data_with_ext.clear();
   if (!_ext_buffer)
     return;
 
-  _fb_data_with_ext.clear();
-
-  auto align16 = [](size_t &v) {
-    while (v % 16 != 0)
-      v++;
-  };
-
-  // get total memory for flatbuffer + all buffer_data
-  size_t result_size = _builder.GetSize();
-  align16(result_size);
-  for (auto &it : md._buffer_data_map)
-  {
-    SerializedModelData::BufferData &buffer_data = it.second;
-    result_size += buffer_data.size();
-    align16(result_size);
-  }
-  align16(result_size);
-  result_size += 16; // for safety
-
-  std::string result;
-  const char *buff_ptr = reinterpret_cast<const char *>(_builder.GetBufferPointer());
-
-  auto padalign16 = [](std::string &str) {
-    while (str.size() % 16 != 0)
-      str += '\0';
-  };
-
-  result.reserve(result_size);
-  result.append(buff_ptr, _builder.GetSize());
+  auto align16 = [](uint64_t v) { return (v + 15) / 16 * 16; };
 
-  auto mutable_model = circle::GetMutableModel(result.data());
+  // set offset and size of buffers in place, as flatbuffers area does not change in size
+  auto mutable_model = circle::GetMutableModel(_builder.GetBufferPointer());
   auto mutable_buffers = mutable_model->mutable_buffers();
 
-  // pad to be 16 bytes aligned
-  padalign16(result);
+  uint64_t offset = align16(_builder.GetSize());
   for (auto &it : md._buffer_data_map)
   {
     int32_t buffer_index = it.first;
-    SerializedModelData::BufferData &buffer_data = it.second;
-    uint64_t offset = result.size();
-    uint64_t size = buffer_data.size();
+    const SerializedModelData::BufferData &buffer_data = it.second;
 
     circle::Buffer *mutable_buffer = mutable_buffers->GetMutableObject(buffer_index);
     mutable_buffer->mutate_offset(offset);
-    mutable_buffer->mutate_size(size);
+    mutable_buffer->mutate_size(buffer_data.size);
 
-    result.append(buffer_data.begin(), buffer_data.end());
-    padalign16(result);
+    _ext_buffer_data.emplace_back(offset, buffer_data);
+    offset = align16(offset + buffer_data.size);
   }
-  padalign16(result);
-
-  // use final result
-  _fb_data_with_ext = result;
+  _ext_buffer_size = offset;
 }
 
-const char *CircleExporterImpl::getBufferPointer() const
+const char *CircleExporterImpl::getBufferPointer()
 {
-  if (_ext_buffer)
-    return reinterpret_cast<const char *>(_fb_data_with_ext.data());
-  return reinterpret_cast<const char *>(_builder.GetBufferPointer());
+  if (!_ext_buffer)
+    return reinterpret_cast<const char *>(_builder.GetBufferPointer());
+
+  if (_fb_data_with_ext.empty())
+  {
+    const char *buff_ptr = reinterpret_cast<const char *>(_builder.GetBufferPointer());
+
+    _fb_data_with_ext.reserve(_ext_buffer_size);
+    _fb_data_with_ext.append(buff_ptr, _builder.GetSize());
+    for (const auto &it : _ext_buffer_data)
+    {
+      const auto *data = reinterpret_cast<const char *>(it.second.data);
+
+      // pad with zeros to be 16 bytes aligned
+      _fb_data_with_ext.resize(it.first, '\0');
+      _fb_data_with_ext.append(data, it.second.size);
+    }
+    _fb_data_with_ext.resize(_ext_buffer_size, '\0');
+  }
+  return _fb_data_with_ext.data();
 }
 
 size_t CircleExporterImpl::getBufferSize() const
 {
   if (_ext_buffer)
-    return _fb_data_with_ext.size();
+    return _ext_buffer_size;
   return _builder.GetSize();
 }
 
+bool CircleExporterImpl::write(std::ostream &os) const
+{
+  os.write(reinterpret_cast<const char *>(_builder.GetBufferPointer()), _builder.GetSize());
+  if (!_ext_buffer)
+    return os.good();
+
+  // pad with zeros up to the offset of next data, which is 16 bytes aligned
+  const char zeros[16] = {0};
+  uint64_t written = _builder.GetSize();
+  auto pad_to = [&](uint64_t offset) {
+    assert(offset >= written && offset - written < sizeof(zeros));
+    os.write(zeros, offset - written);
+    written = offset;
+  };
+
+  for (const auto &it : _ext_buffer_data)
+  {
+    const uint64_t offset = it.first;
+    const SerializedModelData::BufferData &buffer_data = it.second;
+
+    pad_to(offset);
+    os.write(reinterpret_cast<const char *>(buffer_data.data), buffer_data.size);
+    written += buffer_data.size;
+    if (!os.good())
+      return false;
+  }
+  pad_to(_ext_buffer_size);
+
+  return os.good();
+}
+
 } // namespace luci
@@ -26,6 +26,11 @@
 
 #include <loco.h>
 
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace luci
 {
 
@@ -42,14 +47,22 @@ public:
 
   /**
    * @return pointer to buffer with serialized graph
+   * @note   With extended buffer, this puts flatbuffers area and all constant data
+   *         into one memory block. Use write() instead not to hold them in memory.
    */
-  const char *getBufferPointer() const;
+  const char *getBufferPointer();
 
   /**
    * @return size of buffer with serialized graph
    */
   size_t getBufferSize() const;
 
+  /**
+   * @brief write serialized graph into os, constant data of extended buffer directly from nodes
+   * @return false if writing failed
+   */
+  bool write(std::ostream &os) const;
+
 private:
   /**
    * @brief create Subgraph using data stored in SerializedGraphData
@@ -70,13 +83,16 @@ private:
   bool exportModuleData(Module *module, SerializedModelData &md);
 
   /**
-   * @brief finalizes file stream with extended buffer from internal buffer
+   * @brief lays out extended buffer after flatbuffers area and sets offsets of buffers
    */
   void finalizeWithExtendedBuffer(SerializedModelData &md);
 
 private:
   flatbuffers::FlatBufferBuilder _builder;
   bool _ext_buffer = false;
+  // constant data of extended buffer and its offset from the beginning of the file
+  std::vector<std::pair<uint64_t, SerializedModelData::BufferData>> _ext_buffer_data;
+  size_t _ext_buffer_size = 0;
   std::string _fb_data_with_ext;
 };
 
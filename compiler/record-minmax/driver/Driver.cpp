@@ -83,7 +83,18 @@ int entry(const int argc, char **argv)
     .help("Hyperparameter (C) to compute moving average (default: 0.1). Update equation: avg <- "
           "avg + C * (curr_batch_avg - avg)");
 
-  arser.add_argument("--mode").help("Record mode. percentile (default) or moving_average");
+  arser.add_argument("--mode").help(
+    "Record mode. percentile (default), moving_average or entropy (KL divergence)");
+
+  arser.add_argument("--num_histogram_bins")
+    .type(arser::DataType::INT32)
+    .help("Number of histogram bins for entropy mode (default: 2048)");
+
+  arser.add_argument("--runtime").help(
+    "Runtime to run the model. luci-interpreter (default) or onert (cpu backend)");
+
+  arser.add_argument("--onert_library")
+    .help("Path of onert library used with '--runtime onert' (default: libonert.so)");
 
   arser.add_argument("--input_data_format")
     .help("Input data format. h5/hdf5 (default) or list/filelist");
@@ -124,10 +135,16 @@ int entry(const int argc, char **argv)
   std::string mode = ::get_values_from<std::string>(arser, "--mode", "percentile");
   uint32_t moving_avg_batch = ::get_values_from<int>(arser, "--moving_avg_batch", 16);
   float moving_avg_const = ::get_values_from<float>(arser, "--moving_avg_const", 0.1);
-  if (mode != "percentile" && mode != "moving_average")
+  uint32_t num_histogram_bins = ::get_values_from<int>(arser, "--num_histogram_bins", 2048);
+  if (num_histogram_bins < 1)
+    throw std::runtime_error("The number of histogram bins must be greater than zero");
+  if (mode != "percentile" && mode != "moving_average" && mode != "entropy")
     throw std::runtime_error("Unsupported mode");
   std::string input_data_format =
     ::get_values_from<std::string>(arser, "--input_data_format", "h5");
+  std::string runtime = ::get_values_from<std::string>(arser, "--runtime", "luci-interpreter");
+  if (runtime != "luci-interpreter" && runtime != "onert")
+    throw std::runtime_error("Unsupported runtime");
   if (arser["--generate_profile_data"])
     settings->set(luci::UserSettings::Key::ProfilingDataGen, true);
 
@@ -141,6 +158,10 @@ int entry(const int argc, char **argv)
     {
       computer = make_moving_avg_computer(moving_avg_batch, moving_avg_const);
     }
+    else if (mode == "entropy")
+    {
+      computer = make_entropy_computer(num_histogram_bins);
+    }
     else
     {
       assert(false);
@@ -149,8 +170,17 @@ int entry(const int argc, char **argv)
 
   RecordMinMax rmm(num_threads, std::move(computer));
 
+  // onert runs kernels in parallel, instead of records
+  const bool parallel_record = num_threads > 1 and runtime != "onert";
+  if (runtime == "onert")
+  {
+    rmm.setRuntime(RecordMinMax::Runtime::ONERT);
+    if (arser["--onert_library"])
+      rmm.setOnertLibraryPath(arser.get<std::string>("--onert_library"));
+  }
+
   // TODO: support parallel record for profile with random data
-  if (num_threads > 1 and not arser["--input_data"])
+  if (parallel_record and not arser["--input_data"])
   {
     throw std::runtime_error("Input data must be given for parallel recording");
   }
@@ -165,7 +195,7 @@ int entry(const int argc, char **argv)
     rmm.setInputDataPath(input_data_path);
 
     // TODO: support parallel record from file and dir input data format
-    if (num_threads > 1 and not(input_data_format == "h5") and not(input_data_format == "hdf5"))
+    if (parallel_record and not(input_data_format == "h5") and not(input_data_format == "hdf5"))
     {
       throw std::runtime_error("Parallel recording is used only for h5 now");
     }
@@ -173,7 +203,7 @@ int entry(const int argc, char **argv)
     if (input_data_format == "h5" || input_data_format == "hdf5")
     {
       // Profile min/max while executing the H5 data
-      if (num_threads == 1)
+      if (not parallel_record)
       {
         rmm.setDataSetFormat(DataSetFormat::H5);
       }
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_MINMAXACCUMULATOR_H__
+#define __RECORD_MINMAX_MINMAXACCUMULATOR_H__
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace record_minmax
+{
+
+/**
+ * @brief  Statistics to collect for each tensor while recording
+ */
+struct AccumulatorOptions
+{
+  // Number of exact values (and max number of centroids) of the sketches of per-record min/max
+  uint32_t num_bins = 1024;
+  // Batch size and update constant of moving average
+  uint32_t moving_avg_batch = 16;
+  float moving_avg_const = 0.1;
+  // Number of bins of the histogram of absolute values (0 to disable)
+  uint32_t num_value_bins = 0;
+};
+
+/**
+ * @brief  Equal-width bins whose range is doubled to cover new values
+ */
+class HistogramBins
+{
+public:
+  HistogramBins() = default;
+  explicit HistogramBins(uint32_t num_bins);
+
+  // Set the range of bins. Bins must be empty.
+  void reset(double lo, double width);
+
+  // Double the bin width until value is in the range
+  void cover(double value);
+
+  void add(double value, double count = 1.0);
+
+  // Add absolute values of data except NaN and lowest(). Range must cover them already.
+  void addAbs(const float *data, uint32_t size);
+
+  // Add bins of other, spreading each bin of other over overlapping bins
+  void merge(const HistogramBins &other);
+
+  double lo() const { return _lo; }
+  double hi() const { return _lo + _width * _counts.size(); }
+  double width() const { return _width; }
+  const std::vector<double> &counts() const { return _counts; }
+
+private:
+  void growUp();
+  void growDown();
+
+private:
+  double _lo = 0.0;
+  double _width = 0.0;
+  std::vector<double> _counts;
+};
+
+/**
+ * @brief  StreamingHistogram computes percentiles of a stream of values in bounded memory
+ *
+ * Values are kept as they are until num_bins values are added, so percentiles of short streams
+ * are exact. After that, values are merged into centroids of t-digest (Dunning, "Computing
+ * Extremely Accurate Quantiles Using t-Digests"), whose sizes shrink towards both ends. Tail
+ * percentiles stay accurate even if a few outliers stretch the range of values.
+ */
+class StreamingHistogram
+{
+public:
+  explicit StreamingHistogram(uint32_t num_bins);
+
+  void add(float value);
+
+  void merge(const StreamingHistogram &other);
+
+  // n'th percentile (0.0 <= n <= 100.0) with linear interpolation
+  float percentile(float n) const;
+
+  uint64_t count() const { return _count; }
+  float min() const { return _min; }
+  float max() const { return _max; }
+
+private:
+  struct Centroid
+  {
+    double mean;
+    double weight;
+  };
+
+  // Merge buffered values into centroids
+  void compress();
+
+private:
+  uint32_t _num_bins = 0;
+  uint64_t _count = 0;
+  float _min = std::numeric_limits<float>::max();
+  float _max = std::numeric_limits<float>::lowest();
+  // Values not merged into centroids yet
+  std::vector<float> _values;
+  // Centroids sorted by mean. Empty until more than num_bins values are added.
+  std::vector<Centroid> _centroids;
+};
+
+/**
+ * @brief  StreamingMovingAverage computes the weighted moving average of per-batch min (or max)
+ *         values as values come, same as getMovingAverage
+ */
+class StreamingMovingAverage
+{
+public:
+  StreamingMovingAverage(uint32_t batch_size, float alpha, bool is_min);
+
+  void add(float value);
+
+  // Merge other, whose values come after values of this
+  // NOTE The result is the same as sequential adds only if this ends at a batch boundary
+  void merge(const StreamingMovingAverage &other);
+
+  // Moving average including the last partial batch
+  float average() const;
+
+private:
+  void fold(float batch_value);
+
+private:
+  uint32_t _batch_size = 0;
+  double _alpha = 0.0;
+  bool _is_min = true;
+
+  uint64_t _num_batches = 0;
+  double _average = 0.0;
+  // Value of the first batch, used to merge
+  float _first = 0.0;
+
+  uint32_t _num_pending = 0;
+  float _pending = 0.0;
+};
+
+/**
+ * @brief  AbsHistogram is a histogram of absolute values used for entropy calibration
+ *         Bins start from zero
+ */
+class AbsHistogram
+{
+public:
+  explicit AbsHistogram(uint32_t num_bins);
+
+  // Add values except NaN and lowest(). amax is the largest absolute value of them.
+  void add(const float *data, uint32_t size, float amax);
+
+  void merge(const AbsHistogram &other);
+
+  const HistogramBins &bins() const { return _bins; }
+
+private:
+  HistogramBins _bins;
+  // Number of values counted while all values are zero
+  double _zeros = 0.0;
+};
+
+/**
+ * @brief  MinMaxAccumulator collects min/max statistics of a tensor over records
+ *         Memory usage does not depend on the number of records
+ */
+class MinMaxAccumulator
+{
+public:
+  explicit MinMaxAccumulator(const AccumulatorOptions &options);
+
+  // Record min/max of a record
+  void record(float min, float max);
+
+  // Record values of a record. Do nothing if histogram of values is disabled.
+  void recordValues(const float *data, uint32_t size, float amax);
+
+  // Merge statistics of other, whose records come after records of this
+  void merge(const MinMaxAccumulator &other);
+
+  uint64_t numRecords() const { return _min_histogram.count(); }
+
+  // Min of min values, max of max values
+  float min() const { return _min_histogram.min(); }
+  float max() const { return _max_histogram.max(); }
+
+  const StreamingHistogram &minHistogram() const { return _min_histogram; }
+  const StreamingHistogram &maxHistogram() const { return _max_histogram; }
+  const StreamingMovingAverage &minMovingAverage() const { return _min_moving_avg; }
+  const StreamingMovingAverage &maxMovingAverage() const { return _max_moving_avg; }
+
+  // Return nullptr if histogram of values is disabled
+  const AbsHistogram *valueHistogram() const { return _value_histogram.get(); }
+
+private:
+  StreamingHistogram _min_histogram;
+  StreamingHistogram _max_histogram;
+  StreamingMovingAverage _min_moving_avg;
+  StreamingMovingAverage _max_moving_avg;
+  std::unique_ptr<AbsHistogram> _value_histogram;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_MINMAXACCUMULATOR_H__
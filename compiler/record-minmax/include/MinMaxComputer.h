@@ -17,7 +17,7 @@
 #ifndef __RECORD_MINMAX_MINMAXCOMPUTER_H__
 #define __RECORD_MINMAX_MINMAXCOMPUTER_H__
 
-#include "MinMaxVectors.h"
+#include "MinMaxAccumulator.h"
 
 #include <luci/IR/CircleNode.h>
 
@@ -27,6 +27,8 @@
 namespace record_minmax
 {
 
+using MinMaxAccumulatorMap = std::unordered_map<const luci::CircleNode *, MinMaxAccumulator>;
+
 class MinMaxComputer
 {
 public:
@@ -37,9 +39,11 @@ public:
 
   virtual ~MinMaxComputer() = default;
 
+  // Statistics that update_qparam needs
+  virtual AccumulatorOptions options() const { return AccumulatorOptions(); }
+
   // Child class must implement this
-  virtual void
-  update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map) = 0;
+  virtual void update_qparam(const MinMaxAccumulatorMap *minmax_map) = 0;
 };
 
 class PercentileComputer : public MinMaxComputer
@@ -50,8 +54,7 @@ public:
   {
   }
 
-  virtual void
-  update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map);
+  virtual void update_qparam(const MinMaxAccumulatorMap *minmax_map);
 
 private:
   float _min_percentile = 0.0;
@@ -66,20 +69,38 @@ public:
   {
   }
 
-  virtual void
-  update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map);
+  virtual AccumulatorOptions options() const;
+
+  virtual void update_qparam(const MinMaxAccumulatorMap *minmax_map);
 
 private:
   uint32_t _batch_size = 0;
   float _update_const = 0.0;
 };
 
+// Computes min/max with the clipping threshold which minimizes KL divergence between
+// the distribution of values and its quantized version
+class EntropyComputer : public MinMaxComputer
+{
+public:
+  explicit EntropyComputer(uint32_t num_bins) : _num_bins(num_bins) {}
+
+  virtual AccumulatorOptions options() const;
+
+  virtual void update_qparam(const MinMaxAccumulatorMap *minmax_map);
+
+private:
+  uint32_t _num_bins = 0;
+};
+
 std::unique_ptr<MinMaxComputer> make_percentile_computer(float min_percentile,
                                                          float max_percentile);
 
 std::unique_ptr<MinMaxComputer> make_moving_avg_computer(uint32_t batch_size,
                                                          float moving_avg_const);
 
+std::unique_ptr<MinMaxComputer> make_entropy_computer(uint32_t num_bins);
+
 } // namespace record_minmax
 
 #endif // __RECORD_MINMAX_MINMAXCOMPUTER_H__
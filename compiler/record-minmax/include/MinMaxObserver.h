@@ -20,7 +20,7 @@
 #include <luci_interpreter/Interpreter.h>
 #include <luci_interpreter/core/Tensor.h>
 
-#include "MinMaxVectors.h"
+#include "MinMaxAccumulator.h"
 
 #include <vector>
 #include <unordered_map>
@@ -31,36 +31,56 @@ namespace record_minmax
 class MinMaxMap
 {
 public:
+  explicit MinMaxMap(const AccumulatorOptions &options) : _options(options)
+  {
+    // Do nothing
+  }
+
   // Record min/max of node
   void recordMinMax(const luci::CircleNode *node, float min, float max)
   {
-    MinMaxVectors &vectors = _minmax_map[node];
-    vectors.min_vector.push_back(min);
-    vectors.max_vector.push_back(max);
+    accumulator(node).record(min, max);
+  }
+
+  // Record values of node for histogram, if needed
+  void recordValues(const luci::CircleNode *node, const float *data, uint32_t size, float amax)
+  {
+    if (_options.num_value_bins > 0)
+      accumulator(node).recordValues(data, size, amax);
   }
 
-  void appendMinMaxVector(const luci::CircleNode *node, const MinMaxVectors &minmax_vector)
+  // Merge min/max of other, whose records come after records of this
+  void merge(const MinMaxMap &other)
   {
-    MinMaxVectors &vectors = _minmax_map[node];
-    vectors.min_vector.insert(vectors.min_vector.end(), minmax_vector.min_vector.begin(),
-                              minmax_vector.min_vector.end());
-    vectors.max_vector.insert(vectors.max_vector.end(), minmax_vector.max_vector.begin(),
-                              minmax_vector.max_vector.end());
+    for (const auto &iter : other._minmax_map)
+      accumulator(iter.first).merge(iter.second);
   }
 
-  const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *getMap() const
+  const AccumulatorOptions &options() const { return _options; }
+
+  const std::unordered_map<const luci::CircleNode *, MinMaxAccumulator> *getMap() const
   {
     return &_minmax_map;
   }
 
 private:
-  std::unordered_map<const luci::CircleNode *, MinMaxVectors> _minmax_map;
+  MinMaxAccumulator &accumulator(const luci::CircleNode *node)
+  {
+    auto iter = _minmax_map.find(node);
+    if (iter == _minmax_map.end())
+      iter = _minmax_map.emplace(node, MinMaxAccumulator(_options)).first;
+    return iter->second;
+  }
+
+private:
+  AccumulatorOptions _options;
+  std::unordered_map<const luci::CircleNode *, MinMaxAccumulator> _minmax_map;
 };
 
 class MinMaxObserver : public luci_interpreter::ExecutionObserver
 {
 public:
-  MinMaxObserver()
+  explicit MinMaxObserver(const AccumulatorOptions &options) : _minmax_data(options)
   {
     // Do nothing
   }
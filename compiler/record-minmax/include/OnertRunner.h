@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_ONERT_RUNNER_H__
+#define __RECORD_MINMAX_ONERT_RUNNER_H__
+
+#include "RawMinMaxReader.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+struct nnfw_session;
+
+namespace record_minmax
+{
+
+/**
+ * @brief  OnertRunner runs a circle model on onert cpu backend with min/max recording
+ *
+ * onert library is loaded at runtime, so record-minmax does not depend on onert at build time.
+ * Min/max of each run is appended to minMaxFilePath() by onert. Read them with readMinMax() after
+ * runs, so the file does not grow with the number of runs.
+ */
+class OnertRunner
+{
+public:
+  OnertRunner(const std::string &library_path, const std::string &model_path,
+              uint32_t num_threads);
+  ~OnertRunner();
+
+  OnertRunner(const OnertRunner &) = delete;
+  OnertRunner &operator=(const OnertRunner &) = delete;
+
+  uint32_t numInputs() const;
+
+  // data must be alive until run() returns
+  void setInput(uint32_t index, const void *data, size_t size);
+
+  void run();
+
+  // Read min/max of runs since the last call, and remove them from minMaxFilePath()
+  void readMinMax(const std::function<void(const RawMinMax &)> &on_op,
+                  const std::function<void(const RawMinMax &)> &on_input);
+
+  std::string minMaxFilePath() const;
+
+private:
+  struct API;
+
+  void release();
+
+  void *_handle = nullptr;
+  std::unique_ptr<API> _api;
+  nnfw_session *_session = nullptr;
+  std::string _workspace_dir;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_ONERT_RUNNER_H__
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_RAW_MINMAX_READER_H__
+#define __RECORD_MINMAX_RAW_MINMAX_READER_H__
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace record_minmax
+{
+
+// Min/max of an operation output or a subgraph input recorded by onert
+struct RawMinMax
+{
+  uint32_t model_index;
+  uint32_t subgraph_index;
+  // Operation index for operation outputs, input index for subgraph inputs
+  uint32_t index;
+  float min;
+  float max;
+};
+
+/**
+ * @brief  readRawMinMax reads min/max file dumped by onert (MINMAX_DUMP) and calls on_op and
+ *         on_input in the order of runs
+ *
+ * File structure (runtime/onert/core/src/exec/MinMaxData.h)
+ *   uint32_t magic code, uint32_t version, uint32_t num of runs
+ *   For each run
+ *     uint32_t num of operations, uint32_t num of inputs
+ *     For each operation and then for each input
+ *       uint32_t model id, uint32_t subgraph id, uint32_t operation (or input) id
+ *       float min, float max
+ */
+void readRawMinMax(const std::string &path, const std::function<void(const RawMinMax &)> &on_op,
+                   const std::function<void(const RawMinMax &)> &on_input);
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_RAW_MINMAX_READER_H__
@@ -36,6 +36,19 @@ float getNthPercentile(std::vector<float> &vector, float percentile);
 float getMovingAverage(const std::vector<float> &vector, const float alpha,
                        const uint8_t batch_size, bool is_min);
 
+/**
+ * @brief  getMinMax calculates min/max of data except NaN and lowest() with SIMD instructions
+ *         Return false if there is no such value
+ */
+bool getMinMax(const float *data, uint32_t size, float &min, float &max);
+
+/**
+ * @brief  getKLDivergenceThreshold returns the number of leading bins of histogram to keep, which
+ *         minimizes KL divergence between the clipped histogram and its quantized version with
+ *         num_quant_bins levels (entropy calibration)
+ */
+uint32_t getKLDivergenceThreshold(const std::vector<double> &histogram, uint32_t num_quant_bins);
+
 } // namespace record_minmax
 
 #endif // __RECORD_MINMAX_RECORD_FUNCTION_H__
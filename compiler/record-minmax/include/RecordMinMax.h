@@ -46,6 +46,12 @@ public:
     LIST_FILE,
   };
 
+  enum Runtime
+  {
+    LUCI_INTERPRETER,
+    ONERT, // onert cpu backend loaded from onert library
+  };
+
   explicit RecordMinMax(uint32_t num_threads, std::unique_ptr<MinMaxComputer> &&minmax_computer)
     : _threads_size(num_threads), _minmax_computer(std::move(minmax_computer))
   {
@@ -67,6 +73,11 @@ public:
 
   void setInputDataPath(const std::string &input_data_path) { _input_data_path = input_data_path; }
 
+  // Must be called before initialize()
+  void setRuntime(Runtime runtime) { _runtime = runtime; }
+
+  void setOnertLibraryPath(const std::string &path) { _onert_library_path = path; }
+
   void profileData();
 
   void profileDataInParallel(const std::string &input_data_path);
@@ -88,7 +99,10 @@ private:
 
   WholeOutput importH5Data(const std::string &input_data_path);
 
+  void profileDataOnOnert();
+
   std::unique_ptr<luci::Module> _module;
+  std::string _input_model_path;
 
   // Multiple interpreters are used for parallel execution
   std::vector<std::unique_ptr<luci_interpreter::Interpreter>> _interpreters;
@@ -99,6 +113,9 @@ private:
 
   DataSetFormat _data_set_format = UNKNOWN;
   std::string _input_data_path;
+
+  Runtime _runtime = LUCI_INTERPRETER;
+  std::string _onert_library_path = "libonert.so";
 };
 
 } // namespace record_minmax
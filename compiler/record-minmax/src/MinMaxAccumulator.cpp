@@ -0,0 +1,468 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxAccumulator.h"
+#include "RecordFunction.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+
+// Infinite values are counted as the largest finite values not to grow bins forever
+float clampFinite(float value)
+{
+  return std::min(std::max(value, std::numeric_limits<float>::lowest()),
+                  std::numeric_limits<float>::max());
+}
+
+} // namespace
+
+namespace record_minmax
+{
+
+HistogramBins::HistogramBins(uint32_t num_bins)
+  // Bins are merged by pairs to double the range
+  : _counts(std::max<uint32_t>(2, num_bins + num_bins % 2), 0.0)
+{
+}
+
+void HistogramBins::reset(double lo, double width)
+{
+  assert(width > 0.0);
+
+  _lo = lo;
+  _width = width;
+  std::fill(_counts.begin(), _counts.end(), 0.0);
+}
+
+void HistogramBins::growUp()
+{
+  const auto half = _counts.size() / 2;
+  for (size_t i = 0; i < half; ++i)
+    _counts[i] = _counts[2 * i] + _counts[2 * i + 1];
+  std::fill(_counts.begin() + half, _counts.end(), 0.0);
+
+  _width *= 2.0;
+}
+
+void HistogramBins::growDown()
+{
+  const auto size = _counts.size();
+  std::vector<double> counts(size, 0.0);
+  for (size_t i = 0; i < size; ++i)
+    counts[(size + i) / 2] += _counts[i];
+  _counts.swap(counts);
+
+  _lo -= _width * size;
+  _width *= 2.0;
+}
+
+void HistogramBins::cover(double value)
+{
+  assert(_width > 0.0);
+  assert(std::isfinite(value));
+
+  while (value < _lo)
+    growDown();
+  while (value > hi())
+    growUp();
+}
+
+void HistogramBins::add(double value, double count)
+{
+  cover(value);
+
+  const auto last = static_cast<int64_t>(_counts.size()) - 1;
+  const auto index = static_cast<int64_t>(std::floor((value - _lo) / _width));
+  _counts[std::min(std::max<int64_t>(index, 0), last)] += count;
+}
+
+void HistogramBins::addAbs(const float *data, uint32_t size)
+{
+  assert(_width > 0.0);
+
+  // Bin index is computed with a multiplication, not to call cover() for each value
+  const double scale = 1.0 / _width;
+  const double last = static_cast<double>(_counts.size() - 1);
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    const float value = data[i];
+    if (std::isnan(value) || value == std::numeric_limits<float>::lowest())
+      continue;
+
+    const double position = std::max(0.0, (std::abs(value) - _lo) * scale);
+    _counts[static_cast<size_t>(std::min(position, last))] += 1.0;
+  }
+}
+
+void HistogramBins::merge(const HistogramBins &other)
+{
+  if (other._width == 0.0)
+    return;
+
+  if (_width == 0.0)
+  {
+    *this = other;
+    return;
+  }
+
+  cover(other.lo());
+  cover(other.hi());
+  while (_width < other._width)
+    growUp();
+
+  // Each bin of other overlaps at most two bins of this
+  const auto last = static_cast<int64_t>(_counts.size()) - 1;
+  for (size_t j = 0; j < other._counts.size(); ++j)
+  {
+    const double count = other._counts[j];
+    if (count == 0.0)
+      continue;
+
+    const double begin = other._lo + other._width * j;
+    const double end = begin + other._width;
+
+    auto index = static_cast<int64_t>(std::floor((begin - _lo) / _width));
+    index = std::min(std::max<int64_t>(index, 0), last);
+
+    const double edge = _lo + _width * (index + 1);
+    if (end <= edge || index == last)
+    {
+      _counts[index] += count;
+      continue;
+    }
+
+    const double fraction = (edge - begin) / other._width;
+    _counts[index] += count * fraction;
+    _counts[index + 1] += count * (1.0 - fraction);
+  }
+}
+
+StreamingHistogram::StreamingHistogram(uint32_t num_bins)
+  : _num_bins(std::max<uint32_t>(1, num_bins))
+{
+  // DO NOTHING
+}
+
+void StreamingHistogram::compress()
+{
+  if (_centroids.empty() && _values.empty())
+    return;
+
+  std::vector<Centroid> items;
+  items.reserve(_centroids.size() + _values.size());
+  items.insert(items.end(), _centroids.begin(), _centroids.end());
+  for (auto value : _values)
+    items.push_back({value, 1.0});
+  std::stable_sort(items.begin(), items.end(),
+                   [](const Centroid &a, const Centroid &b) { return a.mean < b.mean; });
+
+  double total = 0.0;
+  for (const auto &item : items)
+    total += item.weight;
+
+  // Scale function k1 of t-digest. A centroid spans at most 1 in k, so centroids near both ends
+  // hold only a few values and there are at most about num_bins centroids.
+  const double pi = std::acos(-1.0);
+  const double compression = _num_bins;
+  auto scale = [&](double q) {
+    return compression / (2.0 * pi) * std::asin(std::min(1.0, std::max(-1.0, 2.0 * q - 1.0)));
+  };
+
+  _centroids.clear();
+  Centroid current = items.front();
+  double before = 0.0;
+  double k_lo = scale(0.0);
+  for (size_t i = 1; i < items.size(); ++i)
+  {
+    const auto &item = items[i];
+    const double weight = current.weight + item.weight;
+    if (scale((before + weight) / total) - k_lo <= 1.0)
+    {
+      current.mean += (item.mean - current.mean) * item.weight / weight;
+      current.weight = weight;
+      continue;
+    }
+
+    _centroids.push_back(current);
+    before += current.weight;
+    k_lo = scale(before / total);
+    current = item;
+  }
+  _centroids.push_back(current);
+
+  _values.clear();
+}
+
+void StreamingHistogram::add(float value)
+{
+  value = clampFinite(value);
+
+  _count++;
+  _min = std::min(_min, value);
+  _max = std::max(_max, value);
+
+  _values.push_back(value);
+  if (_values.size() > _num_bins)
+    compress();
+}
+
+void StreamingHistogram::merge(const StreamingHistogram &other)
+{
+  if (other._count == 0)
+    return;
+
+  _count += other._count;
+  _min = std::min(_min, other._min);
+  _max = std::max(_max, other._max);
+
+  if (other._centroids.empty() && _centroids.empty() &&
+      _values.size() + other._values.size() <= _num_bins)
+  {
+    _values.insert(_values.end(), other._values.begin(), other._values.end());
+    return;
+  }
+
+  // Centroids of both are merged again, as a centroid of other could be merged with one of this
+  _centroids.insert(_centroids.end(), other._centroids.begin(), other._centroids.end());
+  _values.insert(_values.end(), other._values.begin(), other._values.end());
+  compress();
+}
+
+float StreamingHistogram::percentile(float n) const
+{
+  if (n < 0 || n > 100)
+    throw std::runtime_error("Percentile must be ranged from 0 to 100");
+
+  if (_count == 0)
+    throw std::runtime_error("Percentile must take a non-empty histogram");
+
+  if (_centroids.empty())
+  {
+    auto values = _values;
+    return getNthPercentile(values, n);
+  }
+
+  auto sketch = *this;
+  sketch.compress();
+  const auto &centroids = sketch._centroids;
+
+  // A centroid is regarded as values evenly spread around its mean, so the mean is at the middle
+  // rank of them. Single-value centroids are exact, same as getNthPercentile.
+  const double rank = (_count - 1) * n / 100.0;
+  double prev_rank = 0.0;
+  double prev_value = _min;
+  double before = 0.0;
+  for (const auto &centroid : centroids)
+  {
+    const double center = before + (centroid.weight - 1.0) / 2.0;
+    if (rank <= center)
+    {
+      double value = centroid.mean;
+      if (center > prev_rank)
+        value += (prev_value - centroid.mean) * (center - rank) / (center - prev_rank);
+      return std::min(std::max(static_cast<float>(value), _min), _max);
+    }
+    prev_rank = center;
+    prev_value = centroid.mean;
+    before += centroid.weight;
+  }
+
+  const double last = static_cast<double>(_count - 1);
+  if (last <= prev_rank)
+    return _max;
+
+  const double value = prev_value + (_max - prev_value) * (rank - prev_rank) / (last - prev_rank);
+  return std::min(std::max(static_cast<float>(value), _min), _max);
+}
+
+StreamingMovingAverage::StreamingMovingAverage(uint32_t batch_size, float alpha, bool is_min)
+  : _batch_size(batch_size), _alpha(alpha), _is_min(is_min)
+{
+  if (batch_size == 0)
+    throw std::runtime_error("Batch size of moving average must be greater than zero");
+
+  assert(alpha >= 0.0 && alpha <= 1.0);
+}
+
+void StreamingMovingAverage::fold(float batch_value)
+{
+  if (_num_batches == 0)
+  {
+    _average = batch_value;
+    _first = batch_value;
+  }
+  else
+  {
+    _average = _average * _alpha + batch_value * (1.0 - _alpha);
+  }
+  _num_batches++;
+}
+
+void StreamingMovingAverage::add(float value)
+{
+  if (_num_pending == 0)
+    _pending = value;
+  else
+    _pending = _is_min ? std::min(_pending, value) : std::max(_pending, value);
+
+  if (++_num_pending == _batch_size)
+  {
+    fold(_pending);
+    _num_pending = 0;
+  }
+}
+
+void StreamingMovingAverage::merge(const StreamingMovingAverage &other)
+{
+  assert(_batch_size == other._batch_size);
+  assert(_alpha == other._alpha);
+
+  if (other._num_batches == 0 && other._num_pending == 0)
+    return;
+
+  if (_num_pending > 0)
+  {
+    fold(_pending);
+    _num_pending = 0;
+  }
+
+  if (other._num_batches > 0)
+  {
+    if (_num_batches == 0)
+    {
+      _average = other._average;
+      _first = other._first;
+    }
+    else
+    {
+      // other._average starts from other._first, which should have been an update instead
+      const double decay = std::pow(_alpha, static_cast<double>(other._num_batches));
+      _average = other._average + decay * (_average - other._first);
+    }
+    _num_batches += other._num_batches;
+  }
+
+  _num_pending = other._num_pending;
+  _pending = other._pending;
+}
+
+float StreamingMovingAverage::average() const
+{
+  if (_num_batches == 0 && _num_pending == 0)
+    throw std::runtime_error("Moving average must take at least one value");
+
+  if (_num_pending == 0)
+    return _average;
+
+  auto last = *this;
+  last.fold(_pending);
+  return last._average;
+}
+
+AbsHistogram::AbsHistogram(uint32_t num_bins) : _bins(num_bins)
+{
+  // DO NOTHING
+}
+
+void AbsHistogram::add(const float *data, uint32_t size, float amax)
+{
+  amax = clampFinite(amax);
+
+  if (_bins.width() == 0.0)
+  {
+    // Range of bins is unknown until a non-zero value comes
+    if (not(amax > 0.0f))
+    {
+      for (uint32_t i = 0; i < size; ++i)
+      {
+        if (not std::isnan(data[i]) && data[i] != std::numeric_limits<float>::lowest())
+          _zeros += 1.0;
+      }
+      return;
+    }
+
+    _bins.reset(0.0, static_cast<double>(amax) / _bins.counts().size());
+    _bins.add(0.0, _zeros);
+    _zeros = 0.0;
+  }
+
+  _bins.cover(amax);
+  _bins.addAbs(data, size);
+}
+
+void AbsHistogram::merge(const AbsHistogram &other)
+{
+  if (other._bins.width() == 0.0)
+  {
+    if (_bins.width() == 0.0)
+      _zeros += other._zeros;
+    else
+      _bins.add(0.0, other._zeros);
+    return;
+  }
+
+  if (_bins.width() == 0.0)
+  {
+    const double zeros = _zeros;
+    _bins = other._bins;
+    _bins.add(0.0, zeros);
+    _zeros = 0.0;
+    return;
+  }
+
+  _bins.merge(other._bins);
+}
+
+MinMaxAccumulator::MinMaxAccumulator(const AccumulatorOptions &options)
+  : _min_histogram(options.num_bins), _max_histogram(options.num_bins),
+    _min_moving_avg(options.moving_avg_batch, 1 - options.moving_avg_const, true),
+    _max_moving_avg(options.moving_avg_batch, 1 - options.moving_avg_const, false)
+{
+  if (options.num_value_bins > 0)
+    _value_histogram = std::make_unique<AbsHistogram>(options.num_value_bins);
+}
+
+void MinMaxAccumulator::record(float min, float max)
+{
+  _min_histogram.add(min);
+  _max_histogram.add(max);
+  _min_moving_avg.add(min);
+  _max_moving_avg.add(max);
+}
+
+void MinMaxAccumulator::recordValues(const float *data, uint32_t size, float amax)
+{
+  if (_value_histogram)
+    _value_histogram->add(data, size, amax);
+}
+
+void MinMaxAccumulator::merge(const MinMaxAccumulator &other)
+{
+  _min_histogram.merge(other._min_histogram);
+  _max_histogram.merge(other._max_histogram);
+  _min_moving_avg.merge(other._min_moving_avg);
+  _max_moving_avg.merge(other._max_moving_avg);
+
+  if (_value_histogram && other._value_histogram)
+    _value_histogram->merge(*other._value_histogram);
+}
+
+} // namespace record_minmax
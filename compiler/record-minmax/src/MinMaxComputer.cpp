@@ -19,11 +19,12 @@
 
 #include <luci/IR/CircleQuantParam.h>
 
+#include <algorithm>
+
 namespace record_minmax
 {
 
-void PercentileComputer::update_qparam(
-  const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map)
+void PercentileComputer::update_qparam(const MinMaxAccumulatorMap *minmax_map)
 {
   if (minmax_map == nullptr)
     throw std::invalid_argument("minmax_map is nullptr");
@@ -31,10 +32,10 @@ void PercentileComputer::update_qparam(
   for (auto iter = minmax_map->begin(); iter != minmax_map->end(); ++iter)
   {
     auto node = iter->first;
-    auto minmax = iter->second;
+    const auto &minmax = iter->second;
 
-    auto min = getNthPercentile(minmax.min_vector, _min_percentile);
-    auto max = getNthPercentile(minmax.max_vector, _max_percentile);
+    auto min = minmax.minHistogram().percentile(_min_percentile);
+    auto max = minmax.maxHistogram().percentile(_max_percentile);
 
     auto quantparam = std::make_unique<luci::CircleQuantParam>();
     quantparam->min.push_back(min);
@@ -47,8 +48,15 @@ void PercentileComputer::update_qparam(
   }
 }
 
-void MovingAvgComputer::update_qparam(
-  const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map)
+AccumulatorOptions MovingAvgComputer::options() const
+{
+  AccumulatorOptions options;
+  options.moving_avg_batch = _batch_size;
+  options.moving_avg_const = _update_const;
+  return options;
+}
+
+void MovingAvgComputer::update_qparam(const MinMaxAccumulatorMap *minmax_map)
 {
   if (minmax_map == nullptr)
     throw std::invalid_argument("minmax_map is nullptr");
@@ -56,10 +64,53 @@ void MovingAvgComputer::update_qparam(
   for (auto iter = minmax_map->begin(); iter != minmax_map->end(); ++iter)
   {
     auto node = iter->first;
-    auto minmax = iter->second;
+    const auto &minmax = iter->second;
 
-    auto min = getMovingAverage(minmax.min_vector, 1 - _update_const, _batch_size, true);
-    auto max = getMovingAverage(minmax.max_vector, 1 - _update_const, _batch_size, false);
+    auto min = minmax.minMovingAverage().average();
+    auto max = minmax.maxMovingAverage().average();
+
+    auto quantparam = std::make_unique<luci::CircleQuantParam>();
+    quantparam->min.push_back(min);
+    quantparam->max.push_back(max);
+
+    assert(node->quantparam() == nullptr);
+
+    auto mutable_node = const_cast<luci::CircleNode *>(node);
+    mutable_node->quantparam(std::move(quantparam));
+  }
+}
+
+AccumulatorOptions EntropyComputer::options() const
+{
+  AccumulatorOptions options;
+  options.num_value_bins = _num_bins;
+  return options;
+}
+
+void EntropyComputer::update_qparam(const MinMaxAccumulatorMap *minmax_map)
+{
+  if (minmax_map == nullptr)
+    throw std::invalid_argument("minmax_map is nullptr");
+
+  for (auto iter = minmax_map->begin(); iter != minmax_map->end(); ++iter)
+  {
+    auto node = iter->first;
+    const auto &minmax = iter->second;
+
+    const auto histogram = minmax.valueHistogram();
+    if (histogram == nullptr)
+      throw std::runtime_error("Histogram of values is not recorded for " + node->name());
+
+    // Non-negative values use all levels of 8 bits, otherwise a half of them is for magnitude
+    const uint32_t num_quant_bins = minmax.min() >= 0.0f ? 255 : 128;
+
+    const auto &bins = histogram->bins();
+    float threshold = 0.0f;
+    if (bins.width() > 0.0)
+      threshold = getKLDivergenceThreshold(bins.counts(), num_quant_bins) * bins.width();
+
+    auto min = std::max(minmax.min(), -threshold);
+    auto max = std::max(std::min(minmax.max(), threshold), min);
 
     auto quantparam = std::make_unique<luci::CircleQuantParam>();
     quantparam->min.push_back(min);
@@ -83,4 +134,9 @@ std::unique_ptr<MinMaxComputer> make_moving_avg_computer(uint32_t batch_size,
   return std::make_unique<MovingAvgComputer>(batch_size, moving_avg_const);
 }
 
+std::unique_ptr<MinMaxComputer> make_entropy_computer(uint32_t num_bins)
+{
+  return std::make_unique<EntropyComputer>(num_bins);
+}
+
 } // namespace record_minmax
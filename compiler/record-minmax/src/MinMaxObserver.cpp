@@ -15,11 +15,12 @@
  */
 
 #include "MinMaxObserver.h"
+#include "RecordFunction.h"
 
 #include <luci/IR/CircleOpcode.h>
 
-#include <limits>
-#include <math.h>
+#include <algorithm>
+#include <cmath>
 
 using DataType = luci_interpreter::DataType;
 
@@ -83,34 +84,15 @@ void MinMaxObserver::postTensorWrite(const luci::CircleNode *node,
   const auto data = tensor->data<float>();
   const auto num_elements = tensor->shape().num_elements();
 
-  std::vector<float> buf(data, data + num_elements);
+  float min = 0.0f;
+  float max = 0.0f;
 
-  float max = std::numeric_limits<float>::lowest();
-  float min = std::numeric_limits<float>::max();
-
-  bool all_nan = true;
-  for (auto number : buf)
-  {
-    if (isnan(number))
-      continue;
-
-    // TODO use metadata hints to detect such cases
-    if (number == std::numeric_limits<float>::lowest())
-      continue;
-
-    all_nan = false;
-
-    if (number > max)
-      max = number;
-
-    if (number < min)
-      min = number;
-  }
-
-  if (all_nan)
+  // TODO use metadata hints to detect lowest() values
+  if (not getMinMax(data, num_elements, min, max))
     throw std::runtime_error("All values are NaN(Not a Number)");
 
   _minmax_data.recordMinMax(node, min, max);
+  _minmax_data.recordValues(node, data, num_elements, std::max(std::abs(min), std::abs(max)));
 }
 
 } // namespace record_minmax
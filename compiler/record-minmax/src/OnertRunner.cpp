@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OnertRunner.h"
+
+#include <nnfw.h>
+#include <nnfw_experimental.h>
+#include <nnfw_internal.h>
+
+#include <dlfcn.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+namespace record_minmax
+{
+
+// nnfw API functions used by OnertRunner
+struct OnertRunner::API
+{
+  decltype(&nnfw_create_session) create_session;
+  decltype(&nnfw_close_session) close_session;
+  decltype(&nnfw_load_model_from_file) load_model_from_file;
+  decltype(&nnfw_set_available_backends) set_available_backends;
+  decltype(&nnfw_set_workspace) set_workspace;
+  decltype(&nnfw_set_config) set_config;
+  decltype(&nnfw_set_prepare_config) set_prepare_config;
+  decltype(&nnfw_set_execute_config) set_execute_config;
+  decltype(&nnfw_prepare) prepare;
+  decltype(&nnfw_input_size) input_size;
+  decltype(&nnfw_input_tensorinfo) input_tensorinfo;
+  decltype(&nnfw_set_input) set_input;
+  decltype(&nnfw_run) run;
+};
+
+namespace
+{
+
+template <typename T> void loadSymbol(void *handle, const char *name, T &fn)
+{
+  fn = reinterpret_cast<T>(dlsym(handle, name));
+  if (fn == nullptr)
+    throw std::runtime_error(std::string("Failed to find ") + name + " in onert library");
+}
+
+void check(NNFW_STATUS status, const std::string &what)
+{
+  if (status != NNFW_STATUS_NO_ERROR)
+    throw std::runtime_error("onert: failed to " + what);
+}
+
+} // namespace
+
+OnertRunner::OnertRunner(const std::string &library_path, const std::string &model_path,
+                         uint32_t num_threads)
+  : _api(std::make_unique<API>())
+{
+  _handle = dlopen(library_path.c_str(), RTLD_LAZY | RTLD_LOCAL);
+  if (_handle == nullptr)
+    throw std::runtime_error("Failed to load onert library '" + library_path + "': " + dlerror());
+
+  try
+  {
+    loadSymbol(_handle, "nnfw_create_session", _api->create_session);
+    loadSymbol(_handle, "nnfw_close_session", _api->close_session);
+    loadSymbol(_handle, "nnfw_load_model_from_file", _api->load_model_from_file);
+    loadSymbol(_handle, "nnfw_set_available_backends", _api->set_available_backends);
+    loadSymbol(_handle, "nnfw_set_workspace", _api->set_workspace);
+    loadSymbol(_handle, "nnfw_set_config", _api->set_config);
+    loadSymbol(_handle, "nnfw_set_prepare_config", _api->set_prepare_config);
+    loadSymbol(_handle, "nnfw_set_execute_config", _api->set_execute_config);
+    loadSymbol(_handle, "nnfw_prepare", _api->prepare);
+    loadSymbol(_handle, "nnfw_input_size", _api->input_size);
+    loadSymbol(_handle, "nnfw_input_tensorinfo", _api->input_tensorinfo);
+    loadSymbol(_handle, "nnfw_set_input", _api->set_input);
+    loadSymbol(_handle, "nnfw_run", _api->run);
+
+    // onert writes min/max file into the workspace
+    char workspace_template[] = "/tmp/record-minmax-XXXXXX";
+    if (mkdtemp(workspace_template) == nullptr)
+      throw std::runtime_error("Failed to create workspace for onert");
+    _workspace_dir = workspace_template;
+
+    check(_api->create_session(&_session), "create session");
+    check(_api->load_model_from_file(_session, model_path.c_str()),
+          "load model '" + model_path + "'");
+    check(_api->set_workspace(_session, _workspace_dir.c_str()), "set workspace");
+
+    // onert records min/max only with cpu backend
+    check(_api->set_available_backends(_session, "cpu"), "set backends");
+    check(_api->set_config(_session, "NUM_THREADS", std::to_string(num_threads).c_str()),
+          "set the number of threads");
+
+    // Outputs are not used
+    check(_api->set_prepare_config(_session, NNFW_ENABLE_INTERNAL_OUTPUT_ALLOC, "true"),
+          "enable internal output allocation");
+    check(_api->prepare(_session), "prepare");
+    check(_api->set_execute_config(_session, NNFW_RUN_CONFIG_DUMP_MINMAX, nullptr),
+          "enable min/max recording");
+  }
+  catch (...)
+  {
+    release();
+    throw;
+  }
+}
+
+OnertRunner::~OnertRunner() { release(); }
+
+void OnertRunner::release()
+{
+  if (_session != nullptr)
+  {
+    _api->close_session(_session);
+    _session = nullptr;
+  }
+
+  if (not _workspace_dir.empty())
+  {
+    std::remove(minMaxFilePath().c_str());
+    rmdir(_workspace_dir.c_str());
+    _workspace_dir.clear();
+  }
+
+  if (_handle != nullptr)
+  {
+    dlclose(_handle);
+    _handle = nullptr;
+  }
+}
+
+uint32_t OnertRunner::numInputs() const
+{
+  uint32_t num_inputs = 0;
+  check(_api->input_size(_session, &num_inputs), "get the number of inputs");
+  return num_inputs;
+}
+
+void OnertRunner::setInput(uint32_t index, const void *data, size_t size)
+{
+  nnfw_tensorinfo info;
+  check(_api->input_tensorinfo(_session, index, &info), "get input tensor info");
+  check(_api->set_input(_session, index, info.dtype, data, size), "set input");
+}
+
+void OnertRunner::run() { check(_api->run(_session), "run"); }
+
+void OnertRunner::readMinMax(const std::function<void(const RawMinMax &)> &on_op,
+                             const std::function<void(const RawMinMax &)> &on_input)
+{
+  const auto path = minMaxFilePath();
+  readRawMinMax(path, on_op, on_input);
+
+  // onert creates a new file at the next run
+  if (std::remove(path.c_str()) != 0)
+    throw std::runtime_error("Failed to remove min/max file " + path);
+}
+
+std::string OnertRunner::minMaxFilePath() const { return _workspace_dir + "/minmax.bin"; }
+
+} // namespace record_minmax
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RawMinMaxReader.h"
+
+#include <fstream>
+#include <stdexcept>
+
+namespace
+{
+
+// Match with runtime/onert/core/src/exec/MinMaxData.cc
+const uint32_t MAGIC_CODE = 0x4F4D4D44;
+const uint32_t VERSION = 1;
+
+template <typename T> T read(std::ifstream &file)
+{
+  T value;
+  if (not file.read(reinterpret_cast<char *>(&value), sizeof(T)))
+    throw std::runtime_error("Min/max file is truncated");
+  return value;
+}
+
+record_minmax::RawMinMax readEntry(std::ifstream &file)
+{
+  record_minmax::RawMinMax entry;
+  entry.model_index = read<uint32_t>(file);
+  entry.subgraph_index = read<uint32_t>(file);
+  entry.index = read<uint32_t>(file);
+  entry.min = read<float>(file);
+  entry.max = read<float>(file);
+  return entry;
+}
+
+} // namespace
+
+namespace record_minmax
+{
+
+void readRawMinMax(const std::string &path, const std::function<void(const RawMinMax &)> &on_op,
+                   const std::function<void(const RawMinMax &)> &on_input)
+{
+  std::ifstream file(path, std::ios::binary);
+  if (not file.is_open())
+    throw std::runtime_error("Failed to open min/max file " + path);
+
+  if (read<uint32_t>(file) != MAGIC_CODE)
+    throw std::runtime_error("Wrong magic code of min/max file " + path);
+  if (read<uint32_t>(file) != VERSION)
+    throw std::runtime_error("Unsupported version of min/max file " + path);
+
+  const auto num_runs = read<uint32_t>(file);
+  for (uint32_t run = 0; run < num_runs; ++run)
+  {
+    const auto num_ops = read<uint32_t>(file);
+    const auto num_inputs = read<uint32_t>(file);
+
+    for (uint32_t i = 0; i < num_ops; ++i)
+      on_op(readEntry(file));
+
+    for (uint32_t i = 0; i < num_inputs; ++i)
+      on_input(readEntry(file));
+  }
+}
+
+} // namespace record_minmax
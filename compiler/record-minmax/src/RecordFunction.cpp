@@ -24,6 +24,12 @@
 #include <limits>
 #include <stdexcept>
 
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
 namespace record_minmax
 {
 
@@ -94,4 +100,191 @@ float getMovingAverage(const std::vector<float> &vector, const float alpha,
   return curr_avg;
 }
 
+bool getMinMax(const float *data, uint32_t size, float &min, float &max)
+{
+  const float lowest = std::numeric_limits<float>::lowest();
+  const float highest = std::numeric_limits<float>::max();
+
+  float res_min = highest;
+  float res_max = lowest;
+  bool valid = false;
+  uint32_t i = 0;
+
+  // Invalid values (NaN, lowest) are replaced with identities of min/max
+#if defined(__ARM_NEON)
+  {
+    float32x4_t vmin = vdupq_n_f32(highest);
+    float32x4_t vmax = vdupq_n_f32(lowest);
+    uint32x4_t vvalid = vdupq_n_u32(0);
+    const float32x4_t vlowest = vdupq_n_f32(lowest);
+    for (; i + 4 <= size; i += 4)
+    {
+      const float32x4_t v = vld1q_f32(data + i);
+      const uint32x4_t mask = vandq_u32(vceqq_f32(v, v), vmvnq_u32(vceqq_f32(v, vlowest)));
+      vmin = vminq_f32(vmin, vbslq_f32(mask, v, vdupq_n_f32(highest)));
+      vmax = vmaxq_f32(vmax, vbslq_f32(mask, v, vlowest));
+      vvalid = vorrq_u32(vvalid, mask);
+    }
+    float lanes_min[4], lanes_max[4];
+    uint32_t lanes_valid[4];
+    vst1q_f32(lanes_min, vmin);
+    vst1q_f32(lanes_max, vmax);
+    vst1q_u32(lanes_valid, vvalid);
+    for (int l = 0; l < 4; ++l)
+    {
+      res_min = std::min(res_min, lanes_min[l]);
+      res_max = std::max(res_max, lanes_max[l]);
+      valid = valid || lanes_valid[l] != 0;
+    }
+  }
+#elif defined(__AVX__)
+  {
+    __m256 vmin = _mm256_set1_ps(highest);
+    __m256 vmax = _mm256_set1_ps(lowest);
+    __m256 vvalid = _mm256_setzero_ps();
+    const __m256 vlowest = _mm256_set1_ps(lowest);
+    for (; i + 8 <= size; i += 8)
+    {
+      const __m256 v = _mm256_loadu_ps(data + i);
+      const __m256 mask =
+        _mm256_and_ps(_mm256_cmp_ps(v, v, _CMP_EQ_OQ), _mm256_cmp_ps(v, vlowest, _CMP_NEQ_OQ));
+      vmin = _mm256_min_ps(vmin, _mm256_blendv_ps(_mm256_set1_ps(highest), v, mask));
+      vmax = _mm256_max_ps(vmax, _mm256_blendv_ps(vlowest, v, mask));
+      vvalid = _mm256_or_ps(vvalid, mask);
+    }
+    float lanes_min[8], lanes_max[8];
+    _mm256_storeu_ps(lanes_min, vmin);
+    _mm256_storeu_ps(lanes_max, vmax);
+    for (int l = 0; l < 8; ++l)
+    {
+      res_min = std::min(res_min, lanes_min[l]);
+      res_max = std::max(res_max, lanes_max[l]);
+    }
+    valid = _mm256_movemask_ps(vvalid) != 0;
+  }
+#elif defined(__SSE2__)
+  {
+    __m128 vmin = _mm_set1_ps(highest);
+    __m128 vmax = _mm_set1_ps(lowest);
+    __m128 vvalid = _mm_setzero_ps();
+    const __m128 vhighest = _mm_set1_ps(highest);
+    const __m128 vlowest = _mm_set1_ps(lowest);
+    for (; i + 4 <= size; i += 4)
+    {
+      const __m128 v = _mm_loadu_ps(data + i);
+      const __m128 mask = _mm_and_ps(_mm_cmpord_ps(v, v), _mm_cmpneq_ps(v, vlowest));
+      const __m128 masked = _mm_and_ps(mask, v);
+      vmin = _mm_min_ps(vmin, _mm_or_ps(masked, _mm_andnot_ps(mask, vhighest)));
+      vmax = _mm_max_ps(vmax, _mm_or_ps(masked, _mm_andnot_ps(mask, vlowest)));
+      vvalid = _mm_or_ps(vvalid, mask);
+    }
+    float lanes_min[4], lanes_max[4];
+    _mm_storeu_ps(lanes_min, vmin);
+    _mm_storeu_ps(lanes_max, vmax);
+    for (int l = 0; l < 4; ++l)
+    {
+      res_min = std::min(res_min, lanes_min[l]);
+      res_max = std::max(res_max, lanes_max[l]);
+    }
+    valid = _mm_movemask_ps(vvalid) != 0;
+  }
+#endif
+
+  for (; i < size; ++i)
+  {
+    const float number = data[i];
+    if (std::isnan(number) || number == lowest)
+      continue;
+
+    valid = true;
+    res_min = std::min(res_min, number);
+    res_max = std::max(res_max, number);
+  }
+
+  min = res_min;
+  max = res_max;
+  return valid;
+}
+
+uint32_t getKLDivergenceThreshold(const std::vector<double> &histogram, uint32_t num_quant_bins)
+{
+  assert(num_quant_bins > 0);
+
+  const auto num_bins = static_cast<uint32_t>(histogram.size());
+  if (num_bins <= num_quant_bins)
+    return num_bins;
+
+  double total = 0.0;
+  for (auto count : histogram)
+    total += count;
+  if (total == 0.0)
+    return num_bins;
+
+  // Limit the number of candidates to bound the search time
+  const uint32_t stride = std::max<uint32_t>(1, (num_bins - num_quant_bins) / 512);
+
+  uint32_t best_threshold = num_bins;
+  double best_divergence = std::numeric_limits<double>::max();
+
+  std::vector<double> p(num_bins);
+  std::vector<double> q(num_bins);
+  for (uint32_t threshold = num_quant_bins; threshold <= num_bins; threshold += stride)
+  {
+    // Reference distribution: values over threshold are clipped to the last bin
+    std::copy(histogram.begin(), histogram.begin() + threshold, p.begin());
+    for (uint32_t i = threshold; i < num_bins; ++i)
+      p[threshold - 1] += histogram[i];
+
+    // Quantized distribution: merge bins into num_quant_bins levels and expand them back
+    // to non-empty bins
+    const uint32_t merged = threshold / num_quant_bins;
+    for (uint32_t level = 0; level < num_quant_bins; ++level)
+    {
+      const uint32_t begin = level * merged;
+      const uint32_t end = (level == num_quant_bins - 1) ? threshold : begin + merged;
+
+      double sum = 0.0;
+      uint32_t non_empty = 0;
+      for (uint32_t i = begin; i < end; ++i)
+      {
+        sum += histogram[i];
+        non_empty += (histogram[i] != 0.0);
+      }
+      for (uint32_t i = begin; i < end; ++i)
+        q[i] = (histogram[i] != 0.0) ? sum / non_empty : 0.0;
+    }
+
+    double p_sum = 0.0;
+    double q_sum = 0.0;
+    for (uint32_t i = 0; i < threshold; ++i)
+    {
+      p_sum += p[i];
+      q_sum += q[i];
+    }
+
+    // Empty quantized bins of non-empty reference bins are smoothed with a small probability
+    const double epsilon = 1e-10;
+    double divergence = 0.0;
+    for (uint32_t i = 0; i < threshold; ++i)
+    {
+      if (p[i] == 0.0)
+        continue;
+      const double p_i = p[i] / p_sum;
+      const double q_i = q_sum > 0.0 ? std::max(q[i] / q_sum, epsilon) : epsilon;
+      divergence += p_i * std::log(p_i / q_i);
+    }
+
+    if (divergence < best_divergence)
+    {
+      best_divergence = divergence;
+      best_threshold = threshold;
+    }
+
+    if (threshold < num_bins && threshold + stride > num_bins)
+      threshold = num_bins - stride;
+  }
+
+  return best_threshold;
+}
+
 } // namespace record_minmax
@@ -21,13 +21,18 @@
 #include "RandomIterator.h"
 #include "DirectoryIterator.h"
 #include "ListFileIterator.h"
+#include "OnertRunner.h"
+#include "RawMinMaxReader.h"
 #include "Utils.h"
 
 #include <luci/ImporterEx.h>
 #include <luci/CircleExporter.h>
 #include <luci/CircleFileExpContract.h>
 #include <luci/Log.h>
+#include <luci/Profile/CircleNodeID.h>
 
+#include <functional>
+#include <map>
 #include <stdexcept>
 
 using Shape = std::vector<loco::Dimension>;
@@ -84,6 +89,12 @@ void RecordMinMax::initialize(const std::string &input_model_path)
     throw std::runtime_error("Failed to load '" + input_model_path + "'");
   }
 
+  _input_model_path = input_model_path;
+
+  // onert runs the model by itself
+  if (_runtime == Runtime::ONERT)
+    return;
+
   // Create and initialize interpreters and observers
   _interpreters.resize(_threads_size);
   _observers.resize(_threads_size);
@@ -91,7 +102,7 @@ void RecordMinMax::initialize(const std::string &input_model_path)
   for (uint32_t thread_idx = 0; thread_idx < _threads_size; ++thread_idx)
   {
     auto interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get());
-    auto observer = std::make_unique<MinMaxObserver>();
+    auto observer = std::make_unique<MinMaxObserver>(_minmax_computer->options());
 
     interpreter->attachObserver(observer.get());
 
@@ -191,6 +202,12 @@ void RecordMinMax::profileData()
 {
   assert(getDataSetFormat() != DataSetFormat::UNKNOWN); // FIX_CALLER_UNLESS
 
+  if (_runtime == Runtime::ONERT)
+  {
+    profileDataOnOnert();
+    return;
+  }
+
   const auto input_nodes = loco::input_nodes(_module->graph());
   for (auto input_node : input_nodes)
   {
@@ -245,6 +262,115 @@ void RecordMinMax::profileData()
   _minmax_computer->update_qparam(getObserver()->minMaxData()->getMap());
 }
 
+void RecordMinMax::profileDataOnOnert()
+{
+  if (_minmax_computer->options().num_value_bins > 0)
+    throw std::runtime_error("Histogram of values is not supported on onert");
+
+  const auto input_nodes = loco::input_nodes(_module->graph());
+  for (auto input_node : input_nodes)
+  {
+    const auto *input_cnode = loco::must_cast<const luci::CircleInput *>(input_node);
+    checkInputDimension(input_cnode);
+  }
+
+  const auto num_inputs = input_nodes.size();
+
+  // onert runs kernels with _threads_size threads
+  OnertRunner runner(_onert_library_path, _input_model_path, _threads_size);
+  if (runner.numInputs() != num_inputs)
+    throw std::runtime_error("Wrong number of inputs in onert.");
+
+  // onert records min/max by (subgraph, operation index), where operation index is the node id
+  // given by luci importer
+  using NodeKey = std::pair<uint32_t, uint32_t>;
+  std::map<NodeKey, const luci::CircleNode *> op_nodes;
+  std::map<NodeKey, const luci::CircleNode *> graph_inputs;
+  for (uint32_t g = 0; g < _module->size(); ++g)
+  {
+    auto graph = _module->graph(g);
+    for (uint32_t n = 0; n < graph->nodes()->size(); ++n)
+    {
+      auto node = loco::must_cast<const luci::CircleNode *>(graph->nodes()->at(n));
+      if (luci::has_node_id(node))
+        op_nodes[{g, luci::get_node_id(node)}] = node;
+    }
+
+    for (auto input : loco::input_nodes(graph))
+    {
+      auto cinput = loco::must_cast<const luci::CircleInput *>(input);
+      graph_inputs[{g, cinput->index()}] = cinput;
+    }
+  }
+
+  MinMaxMap minmax_map(_minmax_computer->options());
+
+  auto recorder = [&minmax_map](const std::map<NodeKey, const luci::CircleNode *> &nodes) {
+    return [&minmax_map, &nodes](const RawMinMax &minmax) {
+      // nnpackage with multiple models is not supported
+      if (minmax.model_index != 0)
+        return;
+
+      auto iter = nodes.find({minmax.subgraph_index, minmax.index});
+      // Operations added by onert do not have circle nodes
+      if (iter == nodes.end())
+        return;
+
+      minmax_map.recordMinMax(iter->second, minmax.min, minmax.max);
+    };
+  };
+
+  const std::function<void(const RawMinMax &)> on_op = recorder(op_nodes);
+  const std::function<void(const RawMinMax &)> on_input = recorder(graph_inputs);
+
+  auto iter = createIterator();
+
+  bool check_type_shape = iter->check_type_shape();
+
+  if (not iter->hasNext())
+    throw std::runtime_error("The input data file does not contain any record.");
+
+  uint32_t record_idx = 0;
+  while (iter->hasNext())
+  {
+    const auto &record = iter->next();
+
+    if (num_inputs != record.size())
+      throw std::runtime_error("Wrong number of inputs.");
+
+    std::cout << "Recording " << record_idx << "'th data" << std::endl;
+
+    for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+    {
+      const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+      assert(input_node->index() == input_idx);
+
+      const auto &input_data = record.at(input_idx);
+
+      if (check_type_shape)
+      {
+        // Check the type and the shape of the input data is valid
+        verifyTypeShape(input_node, input_data.dtype, input_data.shape);
+      }
+
+      if (input_data.data.size() != getTensorSize(input_node))
+        throw std::runtime_error("Input size mismatch.");
+
+      runner.setInput(input_idx, input_data.data.data(), input_data.data.size());
+    }
+
+    runner.run();
+    // Fold min/max of the run not to keep all runs in the file
+    runner.readMinMax(on_op, on_input);
+
+    record_idx++;
+  }
+
+  std::cout << "Recording finished. Number of recorded data: " << record_idx << std::endl;
+
+  _minmax_computer->update_qparam(minmax_map.getMap());
+}
+
 void RecordMinMax::profileDataInParallel(const std::string &input_data_path)
 {
   LOGGER(l);
@@ -275,7 +401,13 @@ void RecordMinMax::profileDataInParallel(const std::string &input_data_path)
 
   const auto run_threads = num_records < _threads_size ? num_records : _threads_size;
 
-  const auto records_batch = static_cast<uint32_t>(num_records / run_threads);
+  auto records_batch = static_cast<uint32_t>(num_records / run_threads);
+
+  // Split records at batch boundaries of moving average, so that merging per-thread
+  // statistics gives the same result as recording in a single thread
+  const auto moving_avg_batch = _minmax_computer->options().moving_avg_batch;
+  if (records_batch >= moving_avg_batch)
+    records_batch -= records_batch % moving_avg_batch;
 
   auto interpret_batch = [&whole_output, &input_nodes](int first_record, int last_record,
                                                        luci_interpreter::Interpreter *interpreter) {
@@ -311,20 +443,11 @@ void RecordMinMax::profileDataInParallel(const std::string &input_data_path)
 
   // End parallel part
 
-  // Copy all min, max values to one min/max map
-  MinMaxMap main_min_max_map;
+  // Merge min/max of all threads in the order of records
+  MinMaxMap main_min_max_map(_minmax_computer->options());
 
   for (const auto &obs : _observers)
-  {
-    const auto cur_minmax_map = obs->minMaxData()->getMap();
-    for (auto &iter : *cur_minmax_map)
-    {
-      const auto node = iter.first;
-      const auto &minmax = iter.second;
-
-      main_min_max_map.appendMinMaxVector(node, minmax);
-    }
-  }
+    main_min_max_map.merge(*obs->minMaxData());
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Fake onert library for OnertRunner test
+//
+// The model has a float input of 4 values and a ReLU operation. Each run appends min/max of the
+// input and the output to minmax.bin in the workspace, same as onert's RawMinMaxDumper.
+
+#include <nnfw.h>
+#include <nnfw_experimental.h>
+#include <nnfw_internal.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+struct nnfw_session
+{
+  std::string workspace;
+  const float *input = nullptr;
+  bool dump_minmax = false;
+};
+
+namespace
+{
+
+const uint32_t kNumValues = 4;
+
+void writeEntry(FILE *file, uint32_t index, float min, float max)
+{
+  const uint32_t ids[3] = {0, 0, index};
+  const float minmax[2] = {min, max};
+  std::fwrite(ids, sizeof(uint32_t), 3, file);
+  std::fwrite(minmax, sizeof(float), 2, file);
+}
+
+void dump(const nnfw_session *session)
+{
+  const auto path = session->workspace + "/minmax.bin";
+  const uint32_t header[2] = {0x4F4D4D44, 1};
+  uint32_t runs = 1;
+
+  auto file = std::fopen(path.c_str(), "rb+");
+  if (file)
+  {
+    std::fseek(file, sizeof(header), SEEK_SET);
+    if (std::fread(&runs, sizeof(uint32_t), 1, file) == 1)
+      runs++;
+  }
+  else
+  {
+    file = std::fopen(path.c_str(), "wb+");
+    std::fwrite(header, sizeof(uint32_t), 2, file);
+  }
+
+  std::fseek(file, sizeof(header), SEEK_SET);
+  std::fwrite(&runs, sizeof(uint32_t), 1, file);
+  std::fseek(file, 0, SEEK_END);
+
+  const auto input = session->input;
+  const auto min = *std::min_element(input, input + kNumValues);
+  const auto max = *std::max_element(input, input + kNumValues);
+  const uint32_t counts[2] = {1, 1};
+  std::fwrite(counts, sizeof(uint32_t), 2, file);
+  writeEntry(file, 0, std::max(min, 0.0f), std::max(max, 0.0f));
+  writeEntry(file, 0, min, max);
+
+  std::fclose(file);
+}
+
+} // namespace
+
+NNFW_STATUS nnfw_create_session(nnfw_session **session)
+{
+  *session = new nnfw_session;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_close_session(nnfw_session *session)
+{
+  delete session;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_load_model_from_file(nnfw_session *, const char *) { return NNFW_STATUS_NO_ERROR; }
+
+NNFW_STATUS nnfw_set_available_backends(nnfw_session *, const char *)
+{
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_set_workspace(nnfw_session *session, const char *dir)
+{
+  session->workspace = dir;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_set_config(nnfw_session *, const char *, const char *)
+{
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_set_prepare_config(nnfw_session *, NNFW_PREPARE_CONFIG, const char *)
+{
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_set_execute_config(nnfw_session *session, const NNFW_RUN_CONFIG key,
+                                    const char *)
+{
+  if (key == NNFW_RUN_CONFIG_DUMP_MINMAX)
+    session->dump_minmax = true;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_prepare(nnfw_session *) { return NNFW_STATUS_NO_ERROR; }
+
+NNFW_STATUS nnfw_input_size(nnfw_session *, uint32_t *number)
+{
+  *number = 1;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_input_tensorinfo(nnfw_session *, uint32_t index, nnfw_tensorinfo *tensor_info)
+{
+  if (index != 0)
+    return NNFW_STATUS_ERROR;
+
+  std::memset(tensor_info, 0, sizeof(nnfw_tensorinfo));
+  tensor_info->dtype = NNFW_TYPE_TENSOR_FLOAT32;
+  tensor_info->rank = 1;
+  tensor_info->dims[0] = kNumValues;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_set_input(nnfw_session *session, uint32_t index, NNFW_TYPE type,
+                           const void *buffer, size_t length)
+{
+  if (index != 0 || type != NNFW_TYPE_TENSOR_FLOAT32 || length != kNumValues * sizeof(float))
+    return NNFW_STATUS_ERROR;
+
+  session->input = static_cast<const float *>(buffer);
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_run(nnfw_session *session)
+{
+  if (session->input == nullptr)
+    return NNFW_STATUS_ERROR;
+
+  if (session->dump_minmax)
+    dump(session);
+  return NNFW_STATUS_NO_ERROR;
+}
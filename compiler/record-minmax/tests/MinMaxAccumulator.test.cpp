@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxAccumulator.h"
+#include "RecordFunction.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace record_minmax;
+
+namespace
+{
+
+std::vector<float> sequence(uint32_t size)
+{
+  std::vector<float> values(size);
+  for (uint32_t i = 0; i < size; ++i)
+    values[i] = 10.0f * std::sin(0.37f * i) + 0.01f * i;
+  return values;
+}
+
+} // namespace
+
+TEST(StreamingHistogramTest, exact)
+{
+  auto values = sequence(100);
+
+  StreamingHistogram histogram(128);
+  for (auto value : values)
+    histogram.add(value);
+
+  for (float n : {0.0f, 1.0f, 33.3f, 50.0f, 99.0f, 100.0f})
+    EXPECT_FLOAT_EQ(getNthPercentile(values, n), histogram.percentile(n));
+}
+
+TEST(StreamingHistogramTest, compressed)
+{
+  auto values = sequence(20000);
+
+  StreamingHistogram histogram(1024);
+  for (auto value : values)
+    histogram.add(value);
+
+  EXPECT_EQ(20000u, histogram.count());
+  EXPECT_FLOAT_EQ(getNthPercentile(values, 0), histogram.percentile(0));
+  EXPECT_FLOAT_EQ(getNthPercentile(values, 100), histogram.percentile(100));
+
+  const float tolerance = (histogram.max() - histogram.min()) / 1024;
+  for (float n : {1.0f, 25.0f, 50.0f, 75.0f, 99.0f})
+    EXPECT_NEAR(getNthPercentile(values, n), histogram.percentile(n), tolerance);
+}
+
+TEST(StreamingHistogramTest, outlier)
+{
+  std::mt19937 gen(1);
+  std::normal_distribution<float> dist(0.0f, 1.0f);
+  std::vector<float> values(5000);
+  for (auto &value : values)
+    value = dist(gen);
+  values.insert(values.begin() + 2500, 1e4f);
+
+  StreamingHistogram histogram(1024);
+  for (auto value : values)
+    histogram.add(value);
+
+  // An outlier does not spoil other percentiles
+  for (float n : {0.1f, 1.0f, 5.0f, 50.0f, 95.0f, 99.0f, 99.9f})
+    EXPECT_NEAR(getNthPercentile(values, n), histogram.percentile(n), 1e-2);
+  EXPECT_FLOAT_EQ(1e4f, histogram.percentile(100));
+}
+
+TEST(StreamingHistogramTest, merge)
+{
+  auto values = sequence(20000);
+
+  // Parts are compressed, except the last one
+  StreamingHistogram whole(1024);
+  std::vector<StreamingHistogram> parts(4, StreamingHistogram(1024));
+  for (uint32_t i = 0; i < values.size(); ++i)
+  {
+    whole.add(values[i]);
+    parts[i < 19500 ? i / 6500 : 3].add(values[i]);
+  }
+
+  StreamingHistogram merged(1024);
+  for (const auto &part : parts)
+    merged.merge(part);
+
+  EXPECT_EQ(whole.count(), merged.count());
+  EXPECT_FLOAT_EQ(whole.min(), merged.min());
+  EXPECT_FLOAT_EQ(whole.max(), merged.max());
+
+  const float tolerance = (whole.max() - whole.min()) / 1024;
+  for (float n : {1.0f, 25.0f, 50.0f, 75.0f, 99.0f})
+    EXPECT_NEAR(getNthPercentile(values, n), merged.percentile(n), tolerance);
+}
+
+TEST(StreamingHistogramTest, empty_NEG)
+{
+  StreamingHistogram histogram(16);
+
+  EXPECT_ANY_THROW(histogram.percentile(50));
+}
+
+TEST(StreamingHistogramTest, wrong_percentile_NEG)
+{
+  StreamingHistogram histogram(16);
+  histogram.add(1.0);
+
+  EXPECT_ANY_THROW(histogram.percentile(-1));
+  EXPECT_ANY_THROW(histogram.percentile(101));
+}
+
+TEST(StreamingMovingAverageTest, same_as_getMovingAverage)
+{
+  auto values = sequence(1000);
+
+  for (uint32_t batch : {1u, 7u, 16u})
+  {
+    StreamingMovingAverage min_avg(batch, 0.9, true);
+    StreamingMovingAverage max_avg(batch, 0.9, false);
+    for (auto value : values)
+    {
+      min_avg.add(value);
+      max_avg.add(value);
+    }
+
+    EXPECT_NEAR(getMovingAverage(values, 0.9, batch, true), min_avg.average(), 1e-4);
+    EXPECT_NEAR(getMovingAverage(values, 0.9, batch, false), max_avg.average(), 1e-4);
+  }
+}
+
+TEST(StreamingMovingAverageTest, merge)
+{
+  auto values = sequence(1000);
+
+  // Split at batch boundaries
+  std::vector<StreamingMovingAverage> parts(3, StreamingMovingAverage(16, 0.9, false));
+  for (uint32_t i = 0; i < values.size(); ++i)
+    parts[i < 320 ? 0 : (i < 640 ? 1 : 2)].add(values[i]);
+
+  StreamingMovingAverage merged(16, 0.9, false);
+  for (const auto &part : parts)
+    merged.merge(part);
+
+  EXPECT_NEAR(getMovingAverage(values, 0.9, 16, false), merged.average(), 1e-4);
+}
+
+TEST(StreamingMovingAverageTest, empty_NEG)
+{
+  StreamingMovingAverage average(16, 0.9, true);
+
+  EXPECT_ANY_THROW(average.average());
+}
+
+TEST(StreamingMovingAverageTest, zero_batch_NEG)
+{
+  EXPECT_ANY_THROW(StreamingMovingAverage(0, 0.9, true));
+}
+
+TEST(AbsHistogramTest, merge)
+{
+  std::vector<float> zeros(10, 0.0f);
+  auto values = sequence(1000);
+
+  AbsHistogram first(64);
+  first.add(zeros.data(), zeros.size(), 0.0f);
+  first.add(values.data(), 500, 20.0f);
+
+  AbsHistogram second(64);
+  second.add(values.data() + 500, 500, 20.0f);
+
+  first.merge(second);
+
+  double total = 0.0;
+  for (auto count : first.bins().counts())
+    total += count;
+
+  EXPECT_NEAR(1010.0, total, 1e-6);
+  EXPECT_EQ(0.0, first.bins().lo());
+  EXPECT_GE(first.bins().hi(), 10.0);
+}
+
+TEST(MinMaxAccumulatorTest, merge)
+{
+  AccumulatorOptions options;
+  options.num_bins = 16;
+  options.moving_avg_batch = 4;
+  options.num_value_bins = 32;
+
+  auto values = sequence(64);
+
+  MinMaxAccumulator whole(options);
+  MinMaxAccumulator first(options);
+  MinMaxAccumulator second(options);
+  for (uint32_t i = 0; i < values.size(); ++i)
+  {
+    whole.record(values[i] - 1, values[i] + 1);
+    (i < 32 ? first : second).record(values[i] - 1, values[i] + 1);
+  }
+  first.merge(second);
+
+  EXPECT_EQ(64u, first.numRecords());
+  EXPECT_FLOAT_EQ(whole.min(), first.min());
+  EXPECT_FLOAT_EQ(whole.max(), first.max());
+  EXPECT_NEAR(whole.minMovingAverage().average(), first.minMovingAverage().average(), 1e-4);
+  EXPECT_NEAR(whole.maxMovingAverage().average(), first.maxMovingAverage().average(), 1e-4);
+  EXPECT_NE(nullptr, first.valueHistogram());
+}
@@ -18,7 +18,9 @@
 
 #include <luci/IR/CircleNodes.h>
 
+#include <cmath>
 #include <unordered_map>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -29,17 +31,20 @@ TEST(MinMaxComputerTest, percentile)
   auto computer = make_percentile_computer(0.0, 100.0);
 
   luci::CircleAdd node;
-  MinMaxVectors minmax;
+  MinMaxAccumulator minmax(computer->options());
   {
-    minmax.min_vector = {1.0, 2.0, 3.0};
-    minmax.max_vector = {4.0, 5.0, 6.0};
+    minmax.record(1.0, 4.0);
+    minmax.record(2.0, 5.0);
+    minmax.record(3.0, 6.0);
   }
-  std::unordered_map<const luci::CircleNode *, MinMaxVectors> min_max_map;
-  min_max_map.insert({&node, minmax});
+  MinMaxAccumulatorMap min_max_map;
+  min_max_map.emplace(&node, std::move(minmax));
 
   computer->update_qparam(&min_max_map);
 
-  EXPECT_TRUE(node.quantparam() != nullptr);
+  ASSERT_TRUE(node.quantparam() != nullptr);
+  EXPECT_FLOAT_EQ(1.0, node.quantparam()->min[0]);
+  EXPECT_FLOAT_EQ(6.0, node.quantparam()->max[0]);
 }
 
 TEST(MinMaxComputerTest, percentile_nullptr_NEG)
@@ -54,13 +59,14 @@ TEST(MinMaxComputerTest, moving_avg)
   auto computer = make_moving_avg_computer(1, 0.99);
 
   luci::CircleAdd node;
-  MinMaxVectors minmax;
+  MinMaxAccumulator minmax(computer->options());
   {
-    minmax.min_vector = {1.0, 2.0, 3.0};
-    minmax.max_vector = {4.0, 5.0, 6.0};
+    minmax.record(1.0, 4.0);
+    minmax.record(2.0, 5.0);
+    minmax.record(3.0, 6.0);
   }
-  std::unordered_map<const luci::CircleNode *, MinMaxVectors> min_max_map;
-  min_max_map.insert({&node, minmax});
+  MinMaxAccumulatorMap min_max_map;
+  min_max_map.emplace(&node, std::move(minmax));
 
   computer->update_qparam(&min_max_map);
 
@@ -73,3 +79,52 @@ TEST(MinMaxComputerTest, moving_avg_nullptr_NEG)
 
   EXPECT_ANY_THROW(computer->update_qparam(nullptr));
 }
+
+TEST(MinMaxComputerTest, entropy)
+{
+  auto computer = make_entropy_computer(2048);
+
+  // Values in [-1, 1] with a few outliers
+  std::vector<float> values;
+  for (int i = 0; i < 10000; ++i)
+    values.push_back(std::sin(static_cast<float>(i)));
+  values.push_back(100.0);
+  values.push_back(-100.0);
+
+  luci::CircleAdd node;
+  MinMaxAccumulator minmax(computer->options());
+  {
+    minmax.record(-100.0, 100.0);
+    minmax.recordValues(values.data(), values.size(), 100.0);
+  }
+  MinMaxAccumulatorMap min_max_map;
+  min_max_map.emplace(&node, std::move(minmax));
+
+  computer->update_qparam(&min_max_map);
+
+  // Outliers are clipped
+  ASSERT_TRUE(node.quantparam() != nullptr);
+  EXPECT_LT(node.quantparam()->max[0], 10.0);
+  EXPECT_GE(node.quantparam()->max[0], 0.9);
+  EXPECT_FLOAT_EQ(-node.quantparam()->max[0], node.quantparam()->min[0]);
+}
+
+TEST(MinMaxComputerTest, entropy_no_histogram_NEG)
+{
+  auto computer = make_entropy_computer(2048);
+
+  luci::CircleAdd node;
+  MinMaxAccumulator minmax(AccumulatorOptions{});
+  minmax.record(-1.0, 1.0);
+  MinMaxAccumulatorMap min_max_map;
+  min_max_map.emplace(&node, std::move(minmax));
+
+  EXPECT_ANY_THROW(computer->update_qparam(&min_max_map));
+}
+
+TEST(MinMaxComputerTest, entropy_nullptr_NEG)
+{
+  auto computer = make_entropy_computer(2048);
+
+  EXPECT_ANY_THROW(computer->update_qparam(nullptr));
+}
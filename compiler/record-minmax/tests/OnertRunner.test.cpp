@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OnertRunner.h"
+
+#include <fstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace record_minmax;
+
+namespace
+{
+
+// Built from FakeOnert.cpp, whose model has a float input of 4 values and a ReLU operation
+const char *kFakeOnertPath = FAKE_ONERT_LIBRARY_PATH;
+
+bool exists(const std::string &path) { return std::ifstream(path).good(); }
+
+} // namespace
+
+TEST(OnertRunnerTest, read_minmax_of_each_run)
+{
+  OnertRunner runner(kFakeOnertPath, "model.circle", 1);
+  ASSERT_EQ(1u, runner.numInputs());
+
+  std::vector<RawMinMax> ops;
+  std::vector<RawMinMax> inputs;
+  auto on_op = [&](const RawMinMax &minmax) { ops.push_back(minmax); };
+  auto on_input = [&](const RawMinMax &minmax) { inputs.push_back(minmax); };
+
+  const std::vector<std::vector<float>> records{{-1, 2, 3, 0}, {-4, -2, 5, 1}, {1, 2, 3, 6}};
+  for (const auto &record : records)
+  {
+    runner.setInput(0, record.data(), record.size() * sizeof(float));
+    runner.run();
+    runner.readMinMax(on_op, on_input);
+
+    // The file is removed not to grow with runs
+    EXPECT_FALSE(exists(runner.minMaxFilePath()));
+  }
+
+  ASSERT_EQ(3u, ops.size());
+  ASSERT_EQ(3u, inputs.size());
+  EXPECT_FLOAT_EQ(-4.0f, inputs[1].min);
+  EXPECT_FLOAT_EQ(5.0f, inputs[1].max);
+  EXPECT_FLOAT_EQ(0.0f, ops[1].min);
+  EXPECT_FLOAT_EQ(1.0f, ops[2].min);
+  EXPECT_FLOAT_EQ(6.0f, ops[2].max);
+}
+
+TEST(OnertRunnerTest, read_minmax_of_multiple_runs)
+{
+  OnertRunner runner(kFakeOnertPath, "model.circle", 1);
+
+  uint32_t num_ops = 0;
+  auto on_op = [&](const RawMinMax &) { num_ops++; };
+  auto nop = [](const RawMinMax &) {};
+
+  const std::vector<float> record{-1, 2, 3, 0};
+  runner.setInput(0, record.data(), record.size() * sizeof(float));
+  runner.run();
+  runner.run();
+  runner.readMinMax(on_op, nop);
+  EXPECT_EQ(2u, num_ops);
+
+  // Runs already read are not read again
+  runner.run();
+  runner.readMinMax(on_op, nop);
+  EXPECT_EQ(3u, num_ops);
+}
+
+TEST(OnertRunnerTest, read_without_run_NEG)
+{
+  OnertRunner runner(kFakeOnertPath, "model.circle", 1);
+
+  auto nop = [](const RawMinMax &) {};
+  EXPECT_ANY_THROW(runner.readMinMax(nop, nop));
+}
+
+TEST(OnertRunnerTest, wrong_library_NEG)
+{
+  EXPECT_ANY_THROW(OnertRunner("no_such_onert_library.so", "model.circle", 1));
+}
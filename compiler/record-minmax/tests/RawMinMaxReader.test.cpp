@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RawMinMaxReader.h"
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace record_minmax;
+
+namespace
+{
+
+class RawMinMaxFile
+{
+public:
+  ~RawMinMaxFile() { std::remove(_path.c_str()); }
+
+  template <typename T> void write(T value)
+  {
+    const auto bytes = reinterpret_cast<const char *>(&value);
+    _data.insert(_data.end(), bytes, bytes + sizeof(T));
+  }
+
+  void save(uint32_t magic_code = 0x4F4D4D44)
+  {
+    std::ofstream file(_path, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(&magic_code), sizeof(uint32_t));
+    file.write(_data.data(), _data.size());
+  }
+
+  const std::string &path() const { return _path; }
+
+private:
+  std::string _path = "record_minmax_raw_minmax_test.bin";
+  std::vector<char> _data;
+};
+
+void writeEntry(RawMinMaxFile &file, uint32_t subg, uint32_t index, float min, float max)
+{
+  file.write<uint32_t>(0);
+  file.write<uint32_t>(subg);
+  file.write<uint32_t>(index);
+  file.write<float>(min);
+  file.write<float>(max);
+}
+
+} // namespace
+
+TEST(RawMinMaxReaderTest, simple)
+{
+  RawMinMaxFile file;
+  file.write<uint32_t>(1); // version
+  file.write<uint32_t>(2); // runs
+  for (uint32_t run = 0; run < 2; ++run)
+  {
+    file.write<uint32_t>(2); // ops
+    file.write<uint32_t>(1); // inputs
+    writeEntry(file, 0, 3, -1.0f * run, 1.0f * run);
+    writeEntry(file, 1, 5, -2.0f * run, 2.0f * run);
+    writeEntry(file, 0, 0, -3.0f * run, 3.0f * run);
+  }
+  file.save();
+
+  std::vector<RawMinMax> ops;
+  std::vector<RawMinMax> inputs;
+  readRawMinMax(
+    file.path(), [&](const RawMinMax &minmax) { ops.push_back(minmax); },
+    [&](const RawMinMax &minmax) { inputs.push_back(minmax); });
+
+  ASSERT_EQ(4u, ops.size());
+  ASSERT_EQ(2u, inputs.size());
+  EXPECT_EQ(1u, ops[1].subgraph_index);
+  EXPECT_EQ(5u, ops[1].index);
+  EXPECT_FLOAT_EQ(1.0f, ops[2].max);
+  EXPECT_FLOAT_EQ(-3.0f, inputs[1].min);
+}
+
+TEST(RawMinMaxReaderTest, wrong_magic_code_NEG)
+{
+  RawMinMaxFile file;
+  file.write<uint32_t>(1);
+  file.write<uint32_t>(0);
+  file.save(0);
+
+  auto nop = [](const RawMinMax &) {};
+  EXPECT_ANY_THROW(readRawMinMax(file.path(), nop, nop));
+}
+
+TEST(RawMinMaxReaderTest, truncated_NEG)
+{
+  RawMinMaxFile file;
+  file.write<uint32_t>(1); // version
+  file.write<uint32_t>(1); // runs
+  file.write<uint32_t>(1); // ops
+  file.write<uint32_t>(0); // inputs
+  file.save();
+
+  auto nop = [](const RawMinMax &) {};
+  EXPECT_ANY_THROW(readRawMinMax(file.path(), nop, nop));
+}
@@ -17,7 +17,9 @@
 #include "RecordFunction.h"
 
 #include <vector>
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include <gtest/gtest.h>
 
@@ -123,4 +125,43 @@ TEST(GetMovingAverageTest, Simple)
   EXPECT_NE(0, getMovingAverage(input, 0.5, 4, false));
 }
 
+TEST(GetMinMaxTest, Simple)
+{
+  // Sizes not aligned to SIMD width
+  for (uint32_t size : {1u, 3u, 4u, 9u, 17u, 100u})
+  {
+    std::vector<float> input(size);
+    for (uint32_t i = 0; i < size; ++i)
+      input[i] = std::sin(0.7f * i) * 10.0f;
+
+    float min = 0.0f, max = 0.0f;
+    EXPECT_TRUE(getMinMax(input.data(), size, min, max));
+    EXPECT_FLOAT_EQ(*std::min_element(input.begin(), input.end()), min);
+    EXPECT_FLOAT_EQ(*std::max_element(input.begin(), input.end()), max);
+  }
+}
+
+TEST(GetMinMaxTest, SkipNaNAndLowest)
+{
+  std::vector<float> input(19, NAN);
+  input[2] = std::numeric_limits<float>::lowest();
+  input[5] = 3.0f;
+  input[11] = -2.0f;
+  input[18] = 7.0f;
+
+  float min = 0.0f, max = 0.0f;
+  EXPECT_TRUE(getMinMax(input.data(), input.size(), min, max));
+  EXPECT_FLOAT_EQ(-2.0f, min);
+  EXPECT_FLOAT_EQ(7.0f, max);
+}
+
+TEST(GetMinMaxTest, AllNaN_NEG)
+{
+  std::vector<float> input(13, NAN);
+  input[7] = std::numeric_limits<float>::lowest();
+
+  float min = 0.0f, max = 0.0f;
+  EXPECT_FALSE(getMinMax(input.data(), input.size(), min, max));
+}
+
 } // namespace record_minmax
@@ -430,13 +430,11 @@ typedef double ggml_float;
 // global data
 //
 
-#if 0 // [FIX] disable
 // precomputed gelu table for f16 (128 KB)
 static ggml_fp16_t ggml_table_gelu_f16[1 << 16];
 
 // precomputed quick gelu table for f16 (128 KB)
 static ggml_fp16_t ggml_table_gelu_quick_f16[1 << 16];
-#endif // [FIX] end
 
 // precomputed f32 table for f16 (256 KB) (ggml-impl.h)
 float ggml_table_f32_f16[1 << 16];
@@ -674,9 +672,7 @@ FILE * ggml_fopen(const char * fname, const char * mode) {
 #endif
 #endif
 
-#if 0 // [FIX] disable
 static const size_t CACHE_LINE_SIZE_F32 = CACHE_LINE_SIZE/sizeof(float);
-#endif // [FIX] end
 
 static void ggml_vec_dot_f32(int n, float * restrict s, size_t bs, const float * restrict x, size_t bx, const float * restrict y, size_t by, int nrc);
 static void ggml_vec_dot_f16(int n, float * restrict s, size_t bs, ggml_fp16_t * restrict x, size_t bx, ggml_fp16_t * restrict y, size_t by, int nrc);
@@ -1958,7 +1954,6 @@ struct ggml_compute_params {
     struct ggml_compute_state_shared * shared;
 };
 
-#if 0 // [FIX] disable
 //
 // fundamental operations
 //
@@ -1983,7 +1978,6 @@ inline static void ggml_vec_cpy_f32 (const int n, float * y, const float * x)
 inline static void ggml_vec_neg_f32 (const int n, float * y, const float * x)                  { for (int i = 0; i < n; ++i) y[i]  = -x[i];       }
 inline static void ggml_vec_mul_f32 (const int n, float * z, const float * x, const float * y) { for (int i = 0; i < n; ++i) z[i]  = x[i]*y[i];   }
 inline static void ggml_vec_div_f32 (const int n, float * z, const float * x, const float * y) { for (int i = 0; i < n; ++i) z[i]  = x[i]/y[i];   }
-#endif // [FIX] end
 
 static void ggml_vec_dot_f32(int n, float * restrict s, size_t bs, const float * restrict x, size_t bx, const float * restrict y, size_t by, int nrc) {
    assert(nrc == 1);
@@ -2134,7 +2128,6 @@ static void ggml_vec_dot_f16(int n, float * restrict s, size_t bs, ggml_fp16_t *
     *s = sumf;
 }
 
-#if 0 // [FIX] disable
 // compute GGML_VEC_DOT_UNROLL dot products at once
 // xs - x row stride in bytes
 inline static void ggml_vec_dot_f16_unroll(const int n, const int xs, float * restrict s, void * restrict xv, ggml_fp16_t * restrict y) {
@@ -2800,7 +2793,6 @@ inline static void ggml_vec_argmax_f32(const int n, int * s, const float * x) {
     }
     *s = idx;
 }
-#endif // [FIX] end
 
 //
 // data types
@@ -3250,7 +3242,6 @@ GGML_CALL int64_t ggml_nrows(const struct ggml_tensor * tensor) {
     return tensor->ne[1]*tensor->ne[2]*tensor->ne[3];
 }
 
-#if 0 // [FIX] disable
 GGML_CALL size_t ggml_nbytes(const struct ggml_tensor * tensor) {
     size_t nbytes;
     size_t blck_size = ggml_blck_size(tensor->type);
@@ -3270,6 +3261,7 @@ GGML_CALL size_t ggml_nbytes(const struct ggml_tensor * tensor) {
     return nbytes;
 }
 
+#if 0 // [FIX] disable
 size_t ggml_nbytes_pad(const struct ggml_tensor * tensor) {
     return GGML_PAD(ggml_nbytes(tensor), GGML_MEM_ALIGN);
 }
@@ -3486,7 +3478,6 @@ GGML_CALL bool ggml_is_empty(const struct ggml_tensor * tensor) {
     return false;
 }
 
-#if 0 // [FIX] disable
 bool ggml_are_same_shape(const struct ggml_tensor * t0, const struct ggml_tensor * t1) {
     static_assert(GGML_MAX_DIMS == 4, "GGML_MAX_DIMS is not 4 - update this function");
 
@@ -3518,6 +3509,7 @@ bool ggml_can_repeat(const struct ggml_tensor * t0, const struct ggml_tensor * t
         (t1->ne[3]%t0->ne[3] == 0);
 }
 
+#if 0 // [FIX] disable
 static inline bool ggml_can_repeat_rows(const struct ggml_tensor * t0, const struct ggml_tensor * t1) {
     static_assert(GGML_MAX_DIMS == 4, "GGML_MAX_DIMS is not 4 - update this function");
 
@@ -3563,12 +3555,9 @@ struct ggml_context * ggml_init(struct ggml_init_params params) {
                     uint16_t u16;
                     ggml_fp16_t fp16;
                 } u = {i};
-                // [FIX] disable f
-                /* float f = */ggml_table_f32_f16[i] = GGML_COMPUTE_FP16_TO_FP32(u.fp16);
-#if 0 // [FIX] disable
+                float f = ggml_table_f32_f16[i] = GGML_COMPUTE_FP16_TO_FP32(u.fp16);
                 ggml_table_gelu_f16[i] = GGML_FP32_TO_FP16(ggml_gelu_f32(f));
                 ggml_table_gelu_quick_f16[i] = GGML_FP32_TO_FP16(ggml_gelu_quick_f32(f));
-#endif // [FIX] end
             }
 
 
@@ -3800,7 +3789,6 @@ static struct ggml_object * ggml_new_object(struct ggml_context * ctx, enum ggml
     return obj_new;
 }
 
-#if 0 // [FIX] disable
 static struct ggml_tensor * ggml_new_tensor_impl(
         struct ggml_context * ctx,
         enum   ggml_type      type,
@@ -3910,6 +3898,7 @@ struct ggml_tensor * ggml_new_tensor(
         const int64_t       * ne) {
     return ggml_new_tensor_impl(ctx, type, n_dims, ne, NULL, 0);
 }
+#if 0 // [FIX] disable
 
 struct ggml_tensor * ggml_new_tensor_1d(
         struct ggml_context * ctx,
@@ -3972,6 +3961,7 @@ struct ggml_tensor * ggml_new_f32(struct ggml_context * ctx, float value) {
     return result;
 }
 
+#endif // [FIX] end
 struct ggml_tensor * ggml_dup_tensor(struct ggml_context * ctx, const struct ggml_tensor * src) {
     return ggml_new_tensor(ctx, src->type, GGML_MAX_DIMS, src->ne);
 }
@@ -3986,6 +3976,7 @@ static int32_t ggml_get_op_params_i32(const struct ggml_tensor * tensor, uint32_
     assert(i < GGML_MAX_OP_PARAMS / sizeof(int32_t));
     return ((const int32_t *)(tensor->op_params))[i];
 }
+#if 0 // [FIX] disable
 
 static float ggml_get_op_params_f32(const struct ggml_tensor * tensor, uint32_t i) {
     assert(i < GGML_MAX_OP_PARAMS / sizeof(float));
@@ -4432,10 +4423,12 @@ float * ggml_get_data_f32(const struct ggml_tensor * tensor) {
     return (float *)(tensor->data);
 }
 
+#endif // [FIX] end
 GGML_CALL enum ggml_unary_op ggml_get_unary_op(const struct ggml_tensor * tensor) {
     GGML_ASSERT(tensor->op == GGML_OP_UNARY);
     return (enum ggml_unary_op) ggml_get_op_params_i32(tensor, 0);
 }
+#if 0 // [FIX] disable
 
 const char * ggml_get_name(const struct ggml_tensor * tensor) {
     return tensor->name;
@@ -4450,6 +4443,7 @@ struct ggml_tensor * ggml_set_name(struct ggml_tensor * tensor, const char * nam
     return tensor;
 }
 
+#endif // [FIX] end
 struct ggml_tensor * ggml_format_name(struct ggml_tensor * tensor, const char * fmt, ...) {
     va_list args;
     va_start(args, fmt);
@@ -4470,6 +4464,7 @@ struct ggml_tensor * ggml_view_tensor(
 
     return result;
 }
+#if 0 // [FIX] disable
 
 struct ggml_tensor * ggml_get_first_tensor(const struct ggml_context * ctx) {
     struct ggml_object * obj = ctx->objects_begin;
@@ -7922,6 +7917,7 @@ struct ggml_tensor * ggml_map_custom2_inplace(
     return ggml_map_custom2_impl(ctx, a, b, fun, n_tasks, userdata, true);
 }
 
+#endif // [FIX] end
 // ggml_map_custom3
 
 struct ggml_map_custom3_op_params {
@@ -7986,6 +7982,7 @@ struct ggml_tensor * ggml_map_custom3_inplace(
         void                         * userdata) {
     return ggml_map_custom3_impl(ctx, a, b, c, fun, n_tasks, userdata, true);
 }
+#if 0 // [FIX] disable
 
 // ggml_cross_entropy_loss
 
@@ -9196,6 +9193,7 @@ static void ggml_compute_forward_dup(
     }
 }
 
+#endif // [FIX] end
 // ggml_compute_forward_add
 
 static void ggml_compute_forward_add_f32(
@@ -9676,6 +9674,7 @@ static void ggml_compute_forward_add(
     }
 }
 
+#if 0 // [FIX] disable
 // ggml_compute_forward_add1
 
 static void ggml_compute_forward_add1_f32(
@@ -10179,6 +10178,7 @@ static void ggml_compute_forward_acc(
     }
 }
 
+#endif // [FIX] end
 // ggml_compute_forward_sub
 
 static void ggml_compute_forward_sub_f32(
@@ -10445,6 +10445,7 @@ static void ggml_compute_forward_div(
     }
 }
 
+#if 0 // [FIX] disable
 // ggml_compute_forward_sqr
 
 static void ggml_compute_forward_sqr_f32(
@@ -11132,6 +11133,7 @@ static void ggml_compute_forward_concat(
     }
 }
 
+#endif // [FIX] end
 // ggml_compute_forward_abs
 
 static void ggml_compute_forward_abs_f32(
@@ -11660,6 +11662,7 @@ static void ggml_compute_forward_silu(
             }
     }
 }
+#if 0 // [FIX] disable
 // ggml_compute_forward_leaky_relu
 
 static void ggml_compute_forward_leaky_relu_f32(
@@ -11774,6 +11777,7 @@ static void ggml_compute_forward_silu_back(
 }
 
 
+#endif // [FIX] end
 static void ggml_compute_forward_hardswish_f32(
         const struct ggml_compute_params * params,
         struct ggml_tensor * dst) {
@@ -11858,6 +11862,7 @@ static void ggml_compute_forward_hardsigmoid(
 }
 
 
+#if 0 // [FIX] disable
 // ggml_compute_forward_norm
 
 static void ggml_compute_forward_norm_f32(
@@ -11929,6 +11934,7 @@ static void ggml_compute_forward_norm(
     }
 }
 
+#endif // [FIX] end
 // ggml_compute_forward_group_rms_norm
 
 static void ggml_compute_forward_rms_norm_f32(
@@ -11997,6 +12003,7 @@ static void ggml_compute_forward_rms_norm(
     }
 }
 
+#if 0 // [FIX] disable
 static void ggml_compute_forward_rms_norm_back_f32(
         const struct ggml_compute_params * params,
         struct ggml_tensor * dst) {
@@ -13769,6 +13776,7 @@ static void ggml_compute_forward_diag_mask_zero(
     }
 }
 
+#endif // [FIX] end
 // ggml_compute_forward_soft_max
 
 static void ggml_compute_forward_soft_max_f32(
@@ -13887,6 +13895,7 @@ static void ggml_compute_forward_soft_max(
     }
 }
 
+#if 0 // [FIX] disable
 
 // ggml_compute_forward_soft_max_back
 
@@ -16236,6 +16245,7 @@ static void ggml_compute_forward_win_unpart(
     }
 }
 
+#endif // [FIX] end
 //gmml_compute_forward_unary
 
 static void ggml_compute_forward_unary(
@@ -16304,6 +16314,7 @@ static void ggml_compute_forward_unary(
     }
 }
 
+#if 0 // [FIX] disable
 // ggml_compute_forward_get_rel_pos
 
 static void ggml_compute_forward_get_rel_pos_f16(
@@ -16607,6 +16618,7 @@ static void ggml_compute_forward_map_custom2(
     p.fun(dst, a, b, params->ith, params->nth, p.userdata);
 }
 
+#endif // [FIX] end
 // ggml_compute_forward_map_custom3
 
 static void ggml_compute_forward_map_custom3(
@@ -16623,6 +16635,7 @@ static void ggml_compute_forward_map_custom3(
     p.fun(dst, a, b, c, params->ith, params->nth, p.userdata);
 }
 
+#if 0 // [FIX] disable
 // ggml_compute_forward_cross_entropy_loss
 
 static void ggml_compute_forward_cross_entropy_loss_f32(
@@ -16829,10 +16842,12 @@ static void ggml_compute_forward(struct ggml_compute_params * params, struct ggm
             {
                 ggml_compute_forward_dup(params, tensor);
             } break;
+#endif // [FIX] end
         case GGML_OP_ADD:
             {
                 ggml_compute_forward_add(params, tensor);
             } break;
+#if 0 // [FIX] disable
         case GGML_OP_ADD1:
             {
                 ggml_compute_forward_add1(params, tensor);
@@ -16841,6 +16856,7 @@ static void ggml_compute_forward(struct ggml_compute_params * params, struct ggm
             {
                 ggml_compute_forward_acc(params, tensor);
             } break;
+#endif // [FIX] end
         case GGML_OP_SUB:
             {
                 ggml_compute_forward_sub(params, tensor);
@@ -16853,6 +16869,7 @@ static void ggml_compute_forward(struct ggml_compute_params * params, struct ggm
             {
                 ggml_compute_forward_div(params, tensor);
             } break;
+#if 0 // [FIX] disable
         case GGML_OP_SQR:
             {
                 ggml_compute_forward_sqr(params, tensor);
@@ -16901,10 +16918,12 @@ static void ggml_compute_forward(struct ggml_compute_params * params, struct ggm
             {
                 ggml_compute_forward_norm(params, tensor);
             } break;
+#endif // [FIX] end
         case GGML_OP_RMS_NORM:
             {
                 ggml_compute_forward_rms_norm(params, tensor);
             } break;
+#if 0 // [FIX] disable
         case GGML_OP_RMS_NORM_BACK:
             {
                 ggml_compute_forward_rms_norm_back(params, tensor);
@@ -16981,10 +17000,12 @@ static void ggml_compute_forward(struct ggml_compute_params * params, struct ggm
             {
                 ggml_compute_forward_diag_mask_zero(params, tensor);
             } break;
+#endif // [FIX] end
         case GGML_OP_SOFT_MAX:
             {
                 ggml_compute_forward_soft_max(params, tensor);
             } break;
+#if 0 // [FIX] disable
         case GGML_OP_SOFT_MAX_BACK:
             {
                 ggml_compute_forward_soft_max_back(params, tensor);
@@ -17072,10 +17093,12 @@ static void ggml_compute_forward(struct ggml_compute_params * params, struct ggm
             {
                 ggml_compute_forward_win_unpart(params, tensor);
             } break;
+#endif // [FIX] end
         case GGML_OP_UNARY:
             {
                 ggml_compute_forward_unary(params, tensor);
             } break;
+#if 0 // [FIX] disable
         case GGML_OP_GET_REL_POS:
             {
                 ggml_compute_forward_get_rel_pos(params, tensor);
@@ -17129,11 +17152,13 @@ static void ggml_compute_forward(struct ggml_compute_params * params, struct ggm
                 ggml_compute_forward_map_custom2(params, tensor);
             }
             break;
+#endif // [FIX] end
         case GGML_OP_MAP_CUSTOM3:
             {
                 ggml_compute_forward_map_custom3(params, tensor);
             }
             break;
+#if 0 // [FIX] disable
         case GGML_OP_CROSS_ENTROPY_LOSS:
             {
                 ggml_compute_forward_cross_entropy_loss(params, tensor);
@@ -18620,7 +18645,6 @@ static int ggml_get_n_tasks(struct ggml_tensor * node, int n_threads) {
             {
                 n_tasks = 1;
             } break;
-#if 0 // [FIX] disable
         case GGML_OP_UNARY:
             switch (ggml_get_unary_op(node)) {
                 case GGML_UNARY_OP_ABS:
@@ -18647,7 +18671,6 @@ static int ggml_get_n_tasks(struct ggml_tensor * node, int n_threads) {
                     GGML_ABORT("fatal error");
             }
             break;
-#endif // [FIX] end
         case GGML_OP_SILU_BACK:
         case GGML_OP_MUL:
         case GGML_OP_DIV:
@@ -18752,6 +18775,7 @@ static int ggml_get_n_tasks(struct ggml_tensor * node, int n_threads) {
                     n_tasks = MIN(p.n_tasks, n_threads);
                 }
             } break;
+#endif // [FIX] end
         case GGML_OP_MAP_CUSTOM3:
             {
                 struct ggml_map_custom3_op_params p;
@@ -18762,6 +18786,7 @@ static int ggml_get_n_tasks(struct ggml_tensor * node, int n_threads) {
                     n_tasks = MIN(p.n_tasks, n_threads);
                 }
             } break;
+#if 0 // [FIX] disable
         case GGML_OP_CROSS_ENTROPY_LOSS:
         case GGML_OP_CROSS_ENTROPY_LOSS_BACK:
             {
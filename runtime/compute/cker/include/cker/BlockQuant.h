@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BLOCK_QUANT_H__
+#define __NNFW_CKER_BLOCK_QUANT_H__
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Block quantization formats with the same memory layout as ggml Q8_0 and Q4_0,
+// i.e. ir::DataType::QUANT_GGML_Q8_0 and QUANT_GGML_Q4_0.
+// Each block holds kBlockQuantSize consecutive elements and one fp16 scale.
+constexpr int kBlockQuantSize = 32;
+
+struct BlockQ8_0
+{
+  uint16_t d;                  // scale (fp16)
+  int8_t qs[kBlockQuantSize];  // x = qs[i] * d
+};
+static_assert(sizeof(BlockQ8_0) == sizeof(uint16_t) + kBlockQuantSize, "wrong q8_0 block size");
+
+struct BlockQ4_0
+{
+  uint16_t d;                      // scale (fp16)
+  uint8_t qs[kBlockQuantSize / 2]; // x = ((qs[i] & 0xF) - 8) * d for element i,
+                                   //     ((qs[i] >> 4) - 8) * d for element i + 16
+};
+static_assert(sizeof(BlockQ4_0) == sizeof(uint16_t) + kBlockQuantSize / 2,
+              "wrong q4_0 block size");
+
+inline float FP16ToFP32(uint16_t h)
+{
+  const uint32_t sign = static_cast<uint32_t>(h & 0x8000) << 16;
+  uint32_t exp = (h >> 10) & 0x1F;
+  uint32_t mant = h & 0x3FF;
+  uint32_t bits;
+
+  if (exp == 0x1F) // inf, nan
+    bits = sign | 0x7F800000 | (mant << 13);
+  else if (exp != 0) // normal
+    bits = sign | ((exp + 112) << 23) | (mant << 13);
+  else if (mant == 0) // zero
+    bits = sign;
+  else // subnormal: normalize
+  {
+    exp = 113;
+    while ((mant & 0x400) == 0)
+    {
+      mant <<= 1;
+      --exp;
+    }
+    bits = sign | (exp << 23) | ((mant & 0x3FF) << 13);
+  }
+
+  float f;
+  std::memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+inline uint16_t FP32ToFP16(float f)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &f, sizeof(bits));
+
+  const uint16_t sign = (bits >> 16) & 0x8000;
+  const int32_t exp = static_cast<int32_t>((bits >> 23) & 0xFF) - 127 + 15;
+  uint32_t mant = bits & 0x7FFFFF;
+
+  if (((bits >> 23) & 0xFF) == 0xFF) // inf, nan
+    return sign | 0x7C00 | (mant ? 0x200 : 0);
+  if (exp >= 0x1F) // overflow
+    return sign | 0x7C00;
+  if (exp <= 0) // subnormal or zero
+  {
+    if (exp < -10)
+      return sign;
+    mant |= 0x800000;
+    const uint32_t shift = 14 - exp;
+    uint32_t half = mant >> shift;
+    const uint32_t rest = mant & ((1u << shift) - 1);
+    const uint32_t halfway = 1u << (shift - 1);
+    if (rest > halfway || (rest == halfway && (half & 1)))
+      ++half;
+    return sign | static_cast<uint16_t>(half);
+  }
+
+  // Round to nearest even. A carry into the exponent is still a valid encoding.
+  uint32_t half = (static_cast<uint32_t>(exp) << 10) | (mant >> 13);
+  const uint32_t rest = mant & 0x1FFF;
+  if (rest > 0x1000 || (rest == 0x1000 && (half & 1)))
+    ++half;
+  return sign | static_cast<uint16_t>(half);
+}
+
+// Quantize n elements (multiple of kBlockQuantSize) into n / kBlockQuantSize blocks
+inline void QuantizeRow(const float *src, BlockQ8_0 *dst, int n)
+{
+  for (int b = 0; b < n / kBlockQuantSize; ++b)
+  {
+    const float *x = src + b * kBlockQuantSize;
+    float amax = 0.0f;
+    for (int i = 0; i < kBlockQuantSize; ++i)
+      amax = std::max(amax, std::fabs(x[i]));
+
+    const float d = amax / 127.0f;
+    const float id = d != 0.0f ? 1.0f / d : 0.0f;
+    dst[b].d = FP32ToFP16(d);
+    for (int i = 0; i < kBlockQuantSize; ++i)
+      dst[b].qs[i] = static_cast<int8_t>(std::round(x[i] * id));
+  }
+}
+
+inline void QuantizeRow(const float *src, BlockQ4_0 *dst, int n)
+{
+  constexpr int kHalf = kBlockQuantSize / 2;
+  for (int b = 0; b < n / kBlockQuantSize; ++b)
+  {
+    const float *x = src + b * kBlockQuantSize;
+    // Value of the largest magnitude is mapped to -8, to use the full 4-bit range
+    float amax = 0.0f;
+    float max = 0.0f;
+    for (int i = 0; i < kBlockQuantSize; ++i)
+    {
+      if (std::fabs(x[i]) > amax)
+      {
+        amax = std::fabs(x[i]);
+        max = x[i];
+      }
+    }
+
+    const float d = max / -8.0f;
+    const float id = d != 0.0f ? 1.0f / d : 0.0f;
+    dst[b].d = FP32ToFP16(d);
+    for (int i = 0; i < kHalf; ++i)
+    {
+      const int q0 = std::min(15, static_cast<int>(x[i] * id + 8.5f));
+      const int q1 = std::min(15, static_cast<int>(x[i + kHalf] * id + 8.5f));
+      dst[b].qs[i] = static_cast<uint8_t>(q0 | (q1 << 4));
+    }
+  }
+}
+
+inline void DequantizeRow(const BlockQ8_0 *src, float *dst, int n)
+{
+  for (int b = 0; b < n / kBlockQuantSize; ++b)
+  {
+    const float d = FP16ToFP32(src[b].d);
+    for (int i = 0; i < kBlockQuantSize; ++i)
+      dst[b * kBlockQuantSize + i] = src[b].qs[i] * d;
+  }
+}
+
+inline void DequantizeRow(const BlockQ4_0 *src, float *dst, int n)
+{
+  constexpr int kHalf = kBlockQuantSize / 2;
+  for (int b = 0; b < n / kBlockQuantSize; ++b)
+  {
+    const float d = FP16ToFP32(src[b].d);
+    for (int i = 0; i < kHalf; ++i)
+    {
+      dst[b * kBlockQuantSize + i] = ((src[b].qs[i] & 0xF) - 8) * d;
+      dst[b * kBlockQuantSize + i + kHalf] = ((src[b].qs[i] >> 4) - 8) * d;
+    }
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BLOCK_QUANT_H__
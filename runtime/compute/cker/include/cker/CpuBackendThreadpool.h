@@ -21,7 +21,11 @@
 #include <ruy/context.h>     // from @ruy
 #include <ruy/thread_pool.h> // from @ruy
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
 #include <stdexcept>
+#include <vector>
 
 namespace nnfw
 {
@@ -44,6 +48,51 @@ void Execute(int tasks_count, TaskType *tasks, ruy::Context *ruy_context)
   ruy_context->mutable_thread_pool()->Execute(tasks_count, tasks);
 }
 
+// Minimum work, i.e. number of elements, for a thread of ParallelFor not to be dominated by the
+// cost of distributing tasks
+constexpr int64_t kMinWorkPerThread = 16384;
+
+template <typename Fn> struct ParallelForTask : Task
+{
+  ParallelForTask(const Fn &fn, int64_t start, int64_t end) : fn_(fn), start_(start), end_(end) {}
+
+  void Run() override { fn_(start_, end_); }
+
+private:
+  const Fn &fn_;
+  int64_t start_;
+  int64_t end_;
+};
+
+// Calls fn(start, end) for ranges of [0, size) with threads of ruy_context, up to its
+// max_num_threads. work_per_index is the number of elements processed for an index, which bounds
+// the number of threads by kMinWorkPerThread. fn runs on the calling thread only if ruy_context is
+// null or the work is small. fn must not call ParallelFor with the same ruy_context.
+template <typename Fn>
+void ParallelFor(int64_t size, int64_t work_per_index, ruy::Context *ruy_context, const Fn &fn)
+{
+  int64_t thread_count = 1;
+  if (ruy_context != nullptr && size > 1)
+  {
+    const int64_t work = size * std::max<int64_t>(work_per_index, 1);
+    thread_count = std::min<int64_t>({static_cast<int64_t>(ruy_context->max_num_threads()), size,
+                                      work / kMinWorkPerThread});
+  }
+
+  if (thread_count <= 1)
+  {
+    if (size > 0)
+      fn(0, size);
+    return;
+  }
+
+  std::vector<ParallelForTask<Fn>> tasks;
+  tasks.reserve(thread_count);
+  for (int64_t i = 0; i < thread_count; ++i)
+    tasks.emplace_back(fn, size * i / thread_count, size * (i + 1) / thread_count);
+  Execute(static_cast<int>(tasks.size()), tasks.data(), ruy_context);
+}
+
 } // namespace cpu_backend_threadpool
 } // namespace cker
 } // namespace nnfw
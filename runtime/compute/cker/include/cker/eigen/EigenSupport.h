@@ -107,12 +107,49 @@ struct EigenContext
   }
 };
 
+// Device which overrides the global device on the calling thread, if not null
+inline const Eigen::ThreadPoolDevice *&ThreadLocalDevice()
+{
+  static thread_local const Eigen::ThreadPoolDevice *device = nullptr;
+  return device;
+}
+
 inline const Eigen::ThreadPoolDevice *GetThreadPoolDevice()
 {
+  if (auto device = ThreadLocalDevice())
+    return device;
+
   auto &ctx = EigenContext::GetEigenContext();
   return ctx.device.get();
 }
 
+// Make GetThreadPoolDevice() return device on the calling thread while in scope, so that a
+// runtime can bound threads of kernels, e.g. with a device having fewer threads on the global
+// thread pool.
+class ScopedThreadPoolDevice
+{
+public:
+  explicit ScopedThreadPoolDevice(const Eigen::ThreadPoolDevice *device)
+    : prev_(ThreadLocalDevice())
+  {
+    ThreadLocalDevice() = device;
+  }
+  ~ScopedThreadPoolDevice() { ThreadLocalDevice() = prev_; }
+
+  ScopedThreadPoolDevice(const ScopedThreadPoolDevice &) = delete;
+  ScopedThreadPoolDevice &operator=(const ScopedThreadPoolDevice &) = delete;
+
+private:
+  const Eigen::ThreadPoolDevice *prev_;
+};
+
+// Thread pool interface of the global thread pool, to make devices on it
+inline Eigen::ThreadPoolInterface *GetThreadPool()
+{
+  auto &ctx = EigenContext::GetEigenContext();
+  return ctx.thread_pool_wrapper.get();
+}
+
 template <typename T> int64_t kPacketSize()
 {
   typedef typename Eigen::internal::packet_traits<T>::type Packet;
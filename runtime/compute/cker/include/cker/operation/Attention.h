@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_ATTENTION_H__
+#define __NNFW_CKER_ATTENTION_H__
+
+#include "cker/BlockQuant.h"
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+struct AttentionParams
+{
+  // Multiplier of Q·K, usually 1/sqrt(d_head)
+  float scale;
+  // Number of cache positions processed at once
+  int32_t block_size = 32;
+};
+
+namespace attention
+{
+
+// Number of elements stored in one unit of cache type T
+template <typename T> constexpr int32_t ElementsPerUnit = 1;
+template <> constexpr int32_t ElementsPerUnit<BlockQ8_0> = kBlockQuantSize;
+template <> constexpr int32_t ElementsPerUnit<BlockQ4_0> = kBlockQuantSize;
+
+// q · k for n elements of k, dequantizing k on the fly
+inline float Dot(const float *q, const float *k, int32_t n)
+{
+  float dot = 0.0f;
+  for (int32_t d = 0; d < n; ++d)
+    dot += q[d] * k[d];
+  return dot;
+}
+
+inline float Dot(const float *q, const BlockQ8_0 *k, int32_t n)
+{
+  float dot = 0.0f;
+  for (int32_t b = 0; b < n / kBlockQuantSize; ++b, q += kBlockQuantSize)
+  {
+    float block_dot = 0.0f;
+    for (int32_t i = 0; i < kBlockQuantSize; ++i)
+      block_dot += q[i] * k[b].qs[i];
+    dot += block_dot * FP16ToFP32(k[b].d);
+  }
+  return dot;
+}
+
+inline float Dot(const float *q, const BlockQ4_0 *k, int32_t n)
+{
+  constexpr int32_t kHalf = kBlockQuantSize / 2;
+  float dot = 0.0f;
+  for (int32_t b = 0; b < n / kBlockQuantSize; ++b, q += kBlockQuantSize)
+  {
+    float block_dot = 0.0f;
+    for (int32_t i = 0; i < kHalf; ++i)
+    {
+      block_dot += q[i] * ((k[b].qs[i] & 0xF) - 8);
+      block_dot += q[i + kHalf] * ((k[b].qs[i] >> 4) - 8);
+    }
+    dot += block_dot * FP16ToFP32(k[b].d);
+  }
+  return dot;
+}
+
+// acc += p * v for n elements of v, dequantizing v on the fly
+inline void Axpy(float p, const float *v, float *acc, int32_t n)
+{
+  for (int32_t d = 0; d < n; ++d)
+    acc[d] += p * v[d];
+}
+
+inline void Axpy(float p, const BlockQ8_0 *v, float *acc, int32_t n)
+{
+  for (int32_t b = 0; b < n / kBlockQuantSize; ++b, acc += kBlockQuantSize)
+  {
+    const float pd = p * FP16ToFP32(v[b].d);
+    for (int32_t i = 0; i < kBlockQuantSize; ++i)
+      acc[i] += pd * v[b].qs[i];
+  }
+}
+
+inline void Axpy(float p, const BlockQ4_0 *v, float *acc, int32_t n)
+{
+  constexpr int32_t kHalf = kBlockQuantSize / 2;
+  for (int32_t b = 0; b < n / kBlockQuantSize; ++b, acc += kBlockQuantSize)
+  {
+    const float pd = p * FP16ToFP32(v[b].d);
+    for (int32_t i = 0; i < kHalf; ++i)
+    {
+      acc[i] += pd * ((v[b].qs[i] & 0xF) - 8);
+      acc[i + kHalf] += pd * ((v[b].qs[i] >> 4) - 8);
+    }
+  }
+}
+
+// Computes attention of query rows of heads in [head_start, head_end) for all tokens.
+//
+// Scores of a block of cache positions are computed, then folded into a running
+// (max, sum, output) triple with online softmax. So neither the full score matrix
+// nor transposed copies of the caches are materialized.
+template <typename T>
+void AttentionHeads(const AttentionParams &params, int32_t n_tokens, int32_t n_head,
+                    int32_t d_head, int32_t n_ctx, const float *q_data, const T *k_cache_data,
+                    const T *v_cache_data, int32_t mask_rows, int32_t mask_stride,
+                    const float *mask_data, float *output_data, int32_t head_start,
+                    int32_t head_end)
+{
+  constexpr float kNegInf = -std::numeric_limits<float>::infinity();
+  const int32_t row_stride = n_head * d_head; // stride of a token in q, caches and output
+  constexpr int32_t kUnit = ElementsPerUnit<T>;
+  const int32_t block_size = std::max(1, params.block_size);
+
+  std::vector<float> scores(block_size);
+  std::vector<float> acc(d_head);
+
+  for (int32_t h = head_start; h < head_end; ++h)
+  {
+    for (int32_t t = 0; t < n_tokens; ++t)
+    {
+      const float *q = q_data + t * row_stride + h * d_head;
+      const float *mask = mask_data ? mask_data + (t % mask_rows) * mask_stride : nullptr;
+
+      float max_score = kNegInf;
+      float sum = 0.0f;
+      std::fill(acc.begin(), acc.end(), 0.0f);
+
+      for (int32_t block = 0; block < n_ctx; block += block_size)
+      {
+        const int32_t block_end = std::min(block + block_size, n_ctx);
+
+        // Scores of this block. Masked-out positions are skipped without reading K.
+        float block_max = kNegInf;
+        for (int32_t j = block; j < block_end; ++j)
+        {
+          const float bias = mask ? mask[j] : 0.0f;
+          float score = kNegInf;
+          if (bias != kNegInf)
+          {
+            const T *k = k_cache_data + (j * row_stride + h * d_head) / kUnit;
+            score = Dot(q, k, d_head) * params.scale + bias;
+          }
+          scores[j - block] = score;
+          block_max = std::max(block_max, score);
+        }
+        if (block_max == kNegInf)
+          continue;
+
+        // Rescale what was accumulated with the previous max
+        const float new_max = std::max(max_score, block_max);
+        const float correction = std::exp(max_score - new_max);
+        sum *= correction;
+        for (int32_t d = 0; d < d_head; ++d)
+          acc[d] *= correction;
+        max_score = new_max;
+
+        for (int32_t j = block; j < block_end; ++j)
+        {
+          if (scores[j - block] == kNegInf)
+            continue;
+          const float p = std::exp(scores[j - block] - max_score);
+          sum += p;
+          const T *v = v_cache_data + (j * row_stride + h * d_head) / kUnit;
+          Axpy(p, v, acc.data(), d_head);
+        }
+      }
+
+      float *out = output_data + t * row_stride + h * d_head;
+      const float inv_sum = sum > 0.0f ? 1.0f / sum : 0.0f;
+      for (int32_t d = 0; d < d_head; ++d)
+        out[d] = acc[d] * inv_sum;
+    }
+  }
+}
+
+template <typename T> struct AttentionWorkerTask : cpu_backend_threadpool::Task
+{
+  AttentionWorkerTask(const AttentionParams &params, int32_t n_tokens, int32_t n_head,
+                      int32_t d_head, int32_t n_ctx, const float *q_data, const T *k_cache_data,
+                      const T *v_cache_data, int32_t mask_rows, int32_t mask_stride,
+                      const float *mask_data, float *output_data, int32_t head_start,
+                      int32_t head_end)
+    : params_(params), n_tokens_(n_tokens), n_head_(n_head), d_head_(d_head), n_ctx_(n_ctx),
+      q_data_(q_data), k_cache_data_(k_cache_data), v_cache_data_(v_cache_data),
+      mask_rows_(mask_rows), mask_stride_(mask_stride), mask_data_(mask_data),
+      output_data_(output_data), head_start_(head_start), head_end_(head_end)
+  {
+  }
+
+  void Run() override
+  {
+    AttentionHeads(params_, n_tokens_, n_head_, d_head_, n_ctx_, q_data_, k_cache_data_,
+                   v_cache_data_, mask_rows_, mask_stride_, mask_data_, output_data_, head_start_,
+                   head_end_);
+  }
+
+private:
+  const AttentionParams &params_;
+  int32_t n_tokens_;
+  int32_t n_head_;
+  int32_t d_head_;
+  int32_t n_ctx_;
+  const float *q_data_;
+  const T *k_cache_data_;
+  const T *v_cache_data_;
+  int32_t mask_rows_;
+  int32_t mask_stride_;
+  const float *mask_data_;
+  float *output_data_;
+  int32_t head_start_;
+  int32_t head_end_;
+};
+
+} // namespace attention
+
+// Scaled dot-product attention over a KV cache
+//
+// q_shape      : [n_batch(=1), n_tokens, n_head, d_head]
+// k/v cache    : [n_batch(=1), cache_size, n_head, d_head], read in place.
+//                T is float, or BlockQ8_0/BlockQ4_0 when d_head is a multiple of kBlockQuantSize.
+// n_filled     : Number of leading cache positions holding K and V, including the new tokens.
+//                Later positions are never read.
+// mask_shape   : [..., mask_rows, mask_width], one row per token or one row shared by all tokens.
+//                Positions [0, min(mask_width, n_filled)) are attended. -inf masks out.
+// output_shape : [n_batch(=1), n_tokens, n_head, d_head]
+//
+// Heads are distributed over the threads of ruy_context when given.
+template <typename T>
+void Attention(const AttentionParams &params, const Shape &q_shape, const float *q_data,
+               const Shape &k_cache_shape, const T *k_cache_data, const Shape &v_cache_shape,
+               const T *v_cache_data, int32_t n_filled, const Shape &mask_shape,
+               const float *mask_data, const Shape &output_shape, float *output_data,
+               ruy::Context *ruy_context = nullptr)
+{
+  if (q_shape.DimensionsCount() != 4 || k_cache_shape.DimensionsCount() != 4 ||
+      v_cache_shape.DimensionsCount() != 4 || output_shape.DimensionsCount() != 4)
+    throw std::runtime_error{"Attention: q, caches and output must be 4D"};
+  if (q_shape.Dims(0) != 1)
+    throw std::runtime_error{"Attention: multi-batch is not supported"};
+
+  const int32_t n_tokens = MatchingDim(q_shape, 1, output_shape, 1);
+  const int32_t n_head = MatchingDim(q_shape, 2, k_cache_shape, 2, v_cache_shape, 2);
+  const int32_t d_head = MatchingDim(q_shape, 3, k_cache_shape, 3, v_cache_shape, 3);
+  const int32_t cache_size = MatchingDim(k_cache_shape, 1, v_cache_shape, 1);
+  if (output_shape.Dims(2) != n_head || output_shape.Dims(3) != d_head)
+    throw std::runtime_error{"Attention: output shape mismatch"};
+  if (d_head % attention::ElementsPerUnit<T> != 0)
+    throw std::runtime_error{"Attention: d_head must be a multiple of quantization block size"};
+
+  if (n_filled < n_tokens || n_filled > cache_size)
+    throw std::runtime_error{"Attention: filled positions are out of cache bounds"};
+
+  int32_t n_ctx = n_filled;
+  int32_t mask_rows = 1;
+  int32_t mask_stride = 0;
+  if (mask_data != nullptr)
+  {
+    const int32_t mask_rank = mask_shape.DimensionsCount();
+    mask_stride = mask_shape.Dims(mask_rank - 1);
+    mask_rows = mask_rank >= 2 ? mask_shape.Dims(mask_rank - 2) : 1;
+    if (mask_rows != 1 && mask_rows != n_tokens)
+      throw std::runtime_error{"Attention: mask must have one row or one row per token"};
+    n_ctx = std::min(n_ctx, mask_stride);
+  }
+
+  int32_t thread_count = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  thread_count = std::max(1, std::min(thread_count, n_head));
+
+  if (thread_count == 1)
+  {
+    attention::AttentionHeads(params, n_tokens, n_head, d_head, n_ctx, q_data, k_cache_data,
+                              v_cache_data, mask_rows, mask_stride, mask_data, output_data, 0,
+                              n_head);
+    return;
+  }
+
+  std::vector<attention::AttentionWorkerTask<T>> tasks;
+  tasks.reserve(thread_count);
+  int32_t head_start = 0;
+  for (int32_t i = 0; i < thread_count; ++i)
+  {
+    int32_t head_end = head_start + (n_head - head_start) / (thread_count - i);
+    tasks.emplace_back(params, n_tokens, n_head, d_head, n_ctx, q_data, k_cache_data, v_cache_data,
+                       mask_rows, mask_stride, mask_data, output_data, head_start, head_end);
+    head_start = head_end;
+  }
+  cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_ATTENTION_H__
@@ -22,6 +22,7 @@
 #include <stdexcept>
 #include "cker/operation/optimized/BinaryArithmeticOps.h"
 #include "cker/operation/reference/BinaryArithmeticOps.h"
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -257,31 +258,38 @@ template <BinaryArithmeticOpType op_type>
 inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                                const float *input1_data, const Shape &input2_shape,
                                const float *input2_data, const Shape &output_shape,
-                               float *output_data)
+                               float *output_data, ruy::Context *ruy_context = nullptr)
 {
-  // Supported type is only float now
-  switch (op_type)
-  {
-    case nnfw::cker::BinaryArithmeticOpType::ADD:
-      optimized::Add(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                     output_data);
-      break;
-    case nnfw::cker::BinaryArithmeticOpType::MUL:
-      optimized::Mul(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                     output_data);
-      break;
-    case nnfw::cker::BinaryArithmeticOpType::SUB:
-      optimized::Sub(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                     output_data);
-      break;
-    case nnfw::cker::BinaryArithmeticOpType::DIV:
-      optimized::Div(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                     output_data);
-      break;
-    default:
-      assert(false);
-      break;
-  }
+  const int flat_size = MatchingElementsSize(input1_shape, input2_shape, output_shape);
+
+  // Elements are split into ranges of flat shapes
+  auto elementwise = [&](int64_t start, int64_t end) {
+    const Shape shape({static_cast<int>(end - start)});
+    const float *input1_ptr = input1_data + start;
+    const float *input2_ptr = input2_data + start;
+    float *output_ptr = output_data + start;
+
+    // Supported type is only float now
+    switch (op_type)
+    {
+      case nnfw::cker::BinaryArithmeticOpType::ADD:
+        optimized::Add(params, shape, input1_ptr, shape, input2_ptr, shape, output_ptr);
+        break;
+      case nnfw::cker::BinaryArithmeticOpType::MUL:
+        optimized::Mul(params, shape, input1_ptr, shape, input2_ptr, shape, output_ptr);
+        break;
+      case nnfw::cker::BinaryArithmeticOpType::SUB:
+        optimized::Sub(params, shape, input1_ptr, shape, input2_ptr, shape, output_ptr);
+        break;
+      case nnfw::cker::BinaryArithmeticOpType::DIV:
+        optimized::Div(params, shape, input1_ptr, shape, input2_ptr, shape, output_ptr);
+        break;
+      default:
+        assert(false);
+        break;
+    }
+  };
+  cpu_backend_threadpool::ParallelFor(flat_size, 1, ruy_context, elementwise);
 }
 
 template <BinaryArithmeticOpType op_type, typename T>
@@ -323,35 +331,84 @@ BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1
   }
 }
 
+// Runs fn(params, input1_data, input2_data, output_data) of fivefold broadcast pattern for ranges
+// of the outermost non-trivial loop in parallel. Other patterns run on the calling thread.
+template <typename T, typename Fn>
+inline void ParallelBroadcastFiveFold(const BinaryArithmeticOpParam &params, const T *input1_data,
+                                      const T *input2_data, T *output_data,
+                                      ruy::Context *ruy_context, const Fn &fn)
+{
+  const bool first_fast =
+    params.broadcast_category == BroadcastableOpCategory::kFirstInputBroadcastsFast;
+  const bool second_fast =
+    params.broadcast_category == BroadcastableOpCategory::kSecondInputBroadcastsFast;
+  if (ruy_context == nullptr || !(first_fast || second_fast))
+  {
+    fn(params, input1_data, input2_data, output_data);
+    return;
+  }
+
+  // In the fivefold pattern, the input broadcasting fast has y0 * y1 * y2 * y4 elements and
+  // the other has y0 * y2 * y3 * y4 elements. See BinaryBroadcastFiveFold.
+  const int64_t y1 = params.broadcast_shape[1];
+  const int64_t y2 = params.broadcast_shape[2];
+  const int64_t y3 = params.broadcast_shape[3];
+  const int64_t y4 = params.broadcast_shape[4];
+
+  // Split y0, or y1 if y0 is 1. The other input is repeated for each index of y1.
+  const int dim = params.broadcast_shape[0] > 1 ? 0 : 1;
+  const int64_t fast_stride = dim == 0 ? y1 * y2 * y4 : y2 * y4;
+  const int64_t other_stride = dim == 0 ? y2 * y3 * y4 : 0;
+  const int64_t output_stride = dim == 0 ? y1 * y2 * y3 * y4 : y2 * y3 * y4;
+  const int64_t input1_stride = first_fast ? fast_stride : other_stride;
+  const int64_t input2_stride = first_fast ? other_stride : fast_stride;
+
+  auto broadcast = [&](int64_t start, int64_t end) {
+    BinaryArithmeticOpParam range_params = params;
+    range_params.broadcast_shape[dim] = static_cast<int>(end - start);
+    fn(range_params, input1_data + start * input1_stride, input2_data + start * input2_stride,
+       output_data + start * output_stride);
+  };
+  cpu_backend_threadpool::ParallelFor(params.broadcast_shape[dim], output_stride, ruy_context,
+                                      broadcast);
+}
+
 template <BinaryArithmeticOpType op_type>
 inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
                                         const float *input1_data, const Shape &input2_shape,
                                         const float *input2_data, const Shape &output_shape,
-                                        float *output_data)
+                                        float *output_data, ruy::Context *ruy_context = nullptr)
 {
   if (output_shape.DimensionsCount() > 6)
     throw std::runtime_error(
       std::string("cker::BroadcastBinaryArithmeticOp: Unsupported rank size : ") +
       std::to_string(output_shape.DimensionsCount()));
 
+  // NOTE Shapes are not used in the fivefold pattern, which is the only one to run in parallel
+  auto dispatch = [&](auto dispatch_fn) {
+    ParallelBroadcastFiveFold(
+      params, input1_data, input2_data, output_data, ruy_context,
+      [&](const BinaryArithmeticOpParam &range_params, const float *input1_ptr,
+          const float *input2_ptr, float *output_ptr) {
+        dispatch_fn(range_params, input1_shape, input1_ptr, input2_shape, input2_ptr, output_shape,
+                    output_ptr);
+      });
+  };
+
   // Supported type is only float now
   switch (op_type)
   {
     case nnfw::cker::BinaryArithmeticOpType::ADD:
-      optimized::BroadcastAddDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
-                                      output_shape, output_data);
+      dispatch([](auto &&...args) { optimized::BroadcastAddDispatch(args...); });
       break;
     case nnfw::cker::BinaryArithmeticOpType::MUL:
-      optimized::BroadcastMulDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
-                                      output_shape, output_data);
+      dispatch([](auto &&...args) { optimized::BroadcastMulDispatch(args...); });
       break;
     case nnfw::cker::BinaryArithmeticOpType::SUB:
-      optimized::BroadcastSubDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
-                                      output_shape, output_data);
+      dispatch([](auto &&...args) { optimized::BroadcastSubDispatch(args...); });
       break;
     case nnfw::cker::BinaryArithmeticOpType::DIV:
-      optimized::BroadcastDivDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
-                                      output_shape, output_data);
+      dispatch([](auto &&...args) { optimized::BroadcastDivDispatch(args...); });
       break;
     case nnfw::cker::BinaryArithmeticOpType::POW:
       reference::BroadcastBinaryArithmeticOpSlow<float>(
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_CONCATENATION_H__
 #define __NNFW_CKER_CONCATENATION_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 
@@ -32,7 +33,7 @@ namespace cker
 template <typename Scalar>
 inline void Concatenation(const ConcatenationParams &params, const Shape *const *input_shapes,
                           const Scalar *const *input_data, const Shape &output_shape,
-                          Scalar *output_data)
+                          Scalar *output_data, ruy::Context *ruy_context = nullptr)
 {
   int axis = params.axis;
   int inputs_count = params.inputs_count;
@@ -66,16 +67,20 @@ inline void Concatenation(const ConcatenationParams &params, const Shape *const
     base_inner_size *= output_shape.Dims(i);
   }
 
-  Scalar *output_ptr = output_data;
-  for (int k = 0; k < outer_size; k++)
-  {
-    for (int i = 0; i < inputs_count; ++i)
+  const int64_t output_inner_size = output_shape.Dims(axis) * base_inner_size;
+  auto concat_outers = [&](int64_t start, int64_t end) {
+    Scalar *output_ptr = output_data + start * output_inner_size;
+    for (int64_t k = start; k < end; k++)
     {
-      const int copy_size = input_shapes[i]->Dims(axis) * base_inner_size;
-      memcpy(output_ptr, input_data[i] + k * copy_size, copy_size * sizeof(Scalar));
-      output_ptr += copy_size;
+      for (int i = 0; i < inputs_count; ++i)
+      {
+        const int64_t copy_size = input_shapes[i]->Dims(axis) * base_inner_size;
+        memcpy(output_ptr, input_data[i] + k * copy_size, copy_size * sizeof(Scalar));
+        output_ptr += copy_size;
+      }
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(outer_size, output_inner_size, ruy_context, concat_outers);
 }
 
 // quantized as it takes scale as a floating point value. This should be fixed
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_REDUCE_H__
 #define __NNFW_CKER_REDUCE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -117,7 +118,8 @@ inline void OptimizedReduceSum(const float *input_data, const Shape &input_shape
 template <typename In, typename Out>
 inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Shape &,
                        const int *axis, const int num_axis, int *input_iter,
-                       Out reducer(const Out current, const In in), Out *output_data)
+                       Out reducer(const Out current, const In in), Out *output_data,
+                       ruy::Context *ruy_context = nullptr)
 {
   const auto input_dims = input_shape.DimsData();
   const auto input_num_dims = input_shape.DimensionsCount();
@@ -132,20 +134,23 @@ inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Sha
       input_size *= input_dims[idx];
     }
     reduce_size = input_dims[input_num_dims - 1];
-    for (int idx = 0; idx < input_size; idx++)
-    {
-      for (int r_idx = 0; r_idx < reduce_size; r_idx++)
+    auto reduce_rows = [&](int64_t start, int64_t end) {
+      for (int64_t idx = start; idx < end; idx++)
       {
-        if (r_idx == 0)
-        {
-          output_data[idx] = input_data[idx * reduce_size];
-        }
-        else
+        for (int r_idx = 0; r_idx < reduce_size; r_idx++)
         {
-          output_data[idx] = reducer(output_data[idx], input_data[idx * reduce_size + r_idx]);
+          if (r_idx == 0)
+          {
+            output_data[idx] = input_data[idx * reduce_size];
+          }
+          else
+          {
+            output_data[idx] = reducer(output_data[idx], input_data[idx * reduce_size + r_idx]);
+          }
         }
       }
-    }
+    };
+    cpu_backend_threadpool::ParallelFor(input_size, reduce_size, ruy_context, reduce_rows);
     return true;
   }
 
@@ -230,7 +235,7 @@ inline bool InitTensorDataForReduce(const Shape &shape, const T init_value, T *d
 class Reduce
 {
 public:
-  Reduce() : _temp_index(), _resolved_axis(), _prepared(false) {}
+  Reduce() : _temp_index(), _resolved_axis(), _prepared(false), _ruy_context(nullptr) {}
 
   void prepare(size_t temp_index_size, size_t resolved_axis_size)
   {
@@ -245,6 +250,9 @@ public:
     _prepared = true;
   }
 
+  // Reduction along the innermost axis runs with threads of ruy_context
+  void ruy_context(ruy::Context *ruy_context) { _ruy_context = ruy_context; }
+
   // Computes the generic value (i.e., sum/max/min/prod) of elements across
   // dimensions given in axis. It needs to pass in init_value and reducer.
   template <typename T>
@@ -266,7 +274,8 @@ public:
     }
 
     return ReduceImpl<T, T>(input_data, input_shape, output_shape, resolved_axis_data(),
-                            num_resolved_axis, temp_index_data(), reducer, output_data);
+                            num_resolved_axis, temp_index_data(), reducer, output_data,
+                            _ruy_context);
   }
 
   // Computes the mean of elements across dimensions given in axis.
@@ -306,7 +315,7 @@ public:
     }
 
     if (!ReduceImpl<T, U>(input_data, input_shape, output_shape, resolved_axis_data(),
-                          num_resolved_axis, temp_index_data(), reducer, temp_sum))
+                          num_resolved_axis, temp_index_data(), reducer, temp_sum, _ruy_context))
     {
       return false;
     }
@@ -368,6 +377,7 @@ private:
   std::vector<int> _temp_index;
   std::vector<int> _resolved_axis;
   bool _prepared;
+  ruy::Context *_ruy_context;
   static constexpr int kMaxSmallSize = 4;
   int _temp_index_small[kMaxSmallSize];
   int _resolved_axis_small[kMaxSmallSize];
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_SOFTMAX_H__
 #define __NNFW_CKER_SOFTMAX_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
 #include "cker/Types.h"
@@ -41,94 +42,110 @@ namespace reference
 
 // Note. This Softmax function supports all of dimensions
 inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const float *input_data,
-                    const Shape &output_shape, float *output_data)
+                    const Shape &output_shape, float *output_data,
+                    ruy::Context *ruy_context = nullptr)
 {
   const int trailing_dim = input_shape.DimensionsCount() - 1;
   const int outer_size = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
   const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
 
-  for (int i = 0; i < outer_size; ++i)
-  {
-    // Find max element value which we'll use to ensure numerical stability
-    // taking advantage of the following equality:
-    // exp(x[i])/sum(exp(x[i])) == exp(x[i]+C)/sum(exp(x[i]+C))
-    float max = std::numeric_limits<float>::lowest();
-    for (int c = 0; c < depth; ++c)
+  auto softmax_rows = [&](int64_t start, int64_t end) {
+    for (int64_t i = start; i < end; ++i)
     {
-      max = std::max(max, input_data[i * depth + c]);
+      // Find max element value which we'll use to ensure numerical stability
+      // taking advantage of the following equality:
+      // exp(x[i])/sum(exp(x[i])) == exp(x[i]+C)/sum(exp(x[i]+C))
+      float max = std::numeric_limits<float>::lowest();
+      for (int c = 0; c < depth; ++c)
+      {
+        max = std::max(max, input_data[i * depth + c]);
+      }
+
+      // Compute sum.
+      float sum = 0.f;
+      for (int c = 0; c < depth; ++c)
+      {
+        sum += std::exp((input_data[i * depth + c] - max) * static_cast<float>(params.beta));
+      }
+
+      // Compute result.
+      for (int c = 0; c < depth; ++c)
+      {
+        output_data[i * depth + c] =
+          std::exp((input_data[i * depth + c] - max) * static_cast<float>(params.beta)) / sum;
+      }
     }
-
-    // Compute sum.
-    float sum = 0.f;
-    for (int c = 0; c < depth; ++c)
-    {
-      sum += std::exp((input_data[i * depth + c] - max) * static_cast<float>(params.beta));
-    }
-
-    // Compute result.
-    for (int c = 0; c < depth; ++c)
-    {
-      output_data[i * depth + c] =
-        std::exp((input_data[i * depth + c] - max) * static_cast<float>(params.beta)) / sum;
-    }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(outer_size, depth, ruy_context, softmax_rows);
 }
 } // namespace reference
 
 // Performs softmax along the input of size (input_size * batch_size).
 inline void Softmax(const float *in, const int input_size, const int batch_size, const float beta,
-                    float *out)
+                    float *out, ruy::Context *ruy_context = nullptr)
 {
   assert(input_size > 0);
 
-  // For each batch
-  for (int b = 0; b < batch_size; b++)
-  {
-    // Find the max coeff.
-    float max_coeff = in[0];
-    for (int i = 1; i < input_size; i++)
-    {
-      if (in[i] > max_coeff)
-        max_coeff = in[i];
-    }
-
-    // Compute the normalized sum of exps.
-    float exp_sum = 0.0;
-    for (int i = 0; i < input_size; i++)
+  auto softmax_batches = [&](int64_t start, int64_t end) {
+    // For each batch
+    for (int64_t b = start; b < end; b++)
     {
-      out[i] = std::exp((in[i] - max_coeff) * beta);
-      exp_sum += out[i];
+      const float *in_b = in + b * input_size;
+      float *out_b = out + b * input_size;
+
+      // Find the max coeff.
+      float max_coeff = in_b[0];
+      for (int i = 1; i < input_size; i++)
+      {
+        if (in_b[i] > max_coeff)
+          max_coeff = in_b[i];
+      }
+
+      // Compute the normalized sum of exps.
+      float exp_sum = 0.0;
+      for (int i = 0; i < input_size; i++)
+      {
+        out_b[i] = std::exp((in_b[i] - max_coeff) * beta);
+        exp_sum += out_b[i];
+      }
+
+      // Divide by the sum of exps.
+      float reciprocal_sum_exp = 1.f / exp_sum;
+      for (int i = 0; i < input_size; i++)
+      {
+        out_b[i] *= reciprocal_sum_exp;
+      }
     }
-
-    // Divide by the sum of exps.
-    float reciprocal_sum_exp = 1.f / exp_sum;
-    for (int i = 0; i < input_size; i++)
-    {
-      out[i] *= reciprocal_sum_exp;
-    }
-
-    // Advance in and out pointers for the next batch.
-    in += input_size;
-    out += input_size;
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(batch_size, input_size, ruy_context, softmax_batches);
 }
 
 inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const float *input_data,
-                    const Shape &output_shape, float *output_data)
+                    const Shape &output_shape, float *output_data,
+                    ruy::Context *ruy_context = nullptr)
 {
   // Validate whether if shapes of input and output are the same
   MatchingFlatSize(input_shape, output_shape);
 
-  const auto in_mat = MapAsMatrixWithLastDimAsRows(input_data, input_shape);
-  auto out_mat = MapAsMatrixWithLastDimAsRows(output_data, output_shape);
-  // Compute the exponential first, removing the max coefficient for numerical
-  // stability.
-  out_mat = (in_mat.rowwise() - in_mat.colwise().maxCoeff()).array() * params.beta;
-  // We are separating out the exp function so that exp can be vectorized.
-  out_mat = out_mat.array().exp();
-  // Normalize to get the activations.
-  Eigen::Array<float, 1, Eigen::Dynamic> scale = out_mat.array().colwise().sum().inverse();
-  out_mat.array().rowwise() *= scale;
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int depth = input_shape.Dims(trailing_dim);
+  const int outer_size = FlatSizeSkipDim(input_shape, trailing_dim);
+
+  // Each column of matrices is a row of the last dimension
+  auto softmax_cols = [&](int64_t start, int64_t end) {
+    const auto cols = static_cast<int>(end - start);
+    const MatrixMap<const float> in_mat(input_data + start * depth, depth, cols);
+    MatrixMap<float> out_mat(output_data + start * depth, depth, cols);
+    // Compute the exponential first, removing the max coefficient for numerical
+    // stability.
+    out_mat = (in_mat.rowwise() - in_mat.colwise().maxCoeff()).array() * params.beta;
+    // We are separating out the exp function so that exp can be vectorized.
+    out_mat = out_mat.array().exp();
+    // Normalize to get the activations.
+    Eigen::Array<float, 1, Eigen::Dynamic> scale = out_mat.array().colwise().sum().inverse();
+    out_mat.array().rowwise() *= scale;
+  };
+  cpu_backend_threadpool::ParallelFor(outer_size, depth, ruy_context, softmax_cols);
 }
 
 template <typename T> inline int32_t QuantizeSoftmaxOutput(float prob_rescaled, int32_t zero_point)
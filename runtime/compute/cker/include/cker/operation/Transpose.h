@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_TRANSPOSE_H__
 #define __NNFW_CKER_TRANSPOSE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -406,7 +407,8 @@ inline void Transpose2D(const Shape &input_shape, const T *input_data,
 // of lines of code in branching without affecting latency.
 template <typename T>
 inline void Transpose3D(const TransposeParams &params, const Shape &input_shape,
-                        const T *input_data, const Shape &, T *output_data)
+                        const T *input_data, const Shape &, T *output_data,
+                        ruy::Context *ruy_context = nullptr)
 {
   int s2, s3;
   s2 = input_shape.Dims(1);
@@ -460,23 +462,26 @@ inline void Transpose3D(const TransposeParams &params, const Shape &input_shape,
   o_s[1] = input_shape.Dims(params.perm[1]);
   o_s[2] = input_shape.Dims(params.perm[2]);
 
-  for (int i1 = 0; i1 < o_s[0]; ++i1)
-  {
-    for (int i2 = 0; i2 < o_s[1]; ++i2)
+  auto transpose_rows = [&](int64_t start, int64_t end) {
+    for (int64_t i1 = start; i1 < end; ++i1)
     {
-      for (int i3 = 0; i3 < o_s[2]; ++i3)
+      for (int i2 = 0; i2 < o_s[1]; ++i2)
       {
-        const int i = i1 * p1 + i2 * p2 + i3 * p3;
-        const int o = i1 * o_s[1] * o_s[2] + i2 * o_s[2] + i3;
-        output_data[o] = input_data[i];
+        for (int i3 = 0; i3 < o_s[2]; ++i3)
+        {
+          const int64_t i = i1 * p1 + i2 * p2 + i3 * p3;
+          const int64_t o = i1 * o_s[1] * o_s[2] + i2 * o_s[2] + i3;
+          output_data[o] = input_data[i];
+        }
       }
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(o_s[0], o_s[1] * o_s[2], ruy_context, transpose_rows);
 }
 
 template <typename T>
 void TransposeImpl(const TransposeParams &params, const Shape &input_shape, const T *input_data,
-                   const Shape &output_shape, T *output_data)
+                   const Shape &output_shape, T *output_data, ruy::Context *ruy_context = nullptr)
 {
   const int dims_cnt = input_shape.DimensionsCount();
 
@@ -499,7 +504,7 @@ void TransposeImpl(const TransposeParams &params, const Shape &input_shape, cons
   // Consider tradeoffs.
   if (dims_cnt == 3)
   {
-    Transpose3D(params, input_shape, input_data, output_shape, output_data);
+    Transpose3D(params, input_shape, input_data, output_shape, output_data, ruy_context);
     return;
   }
 
@@ -510,7 +515,8 @@ void TransposeImpl(const TransposeParams &params, const Shape &input_shape, cons
 
 template <typename T>
 void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_input_shape,
-               const T *input_data, const Shape &unshrunk_output_shape, T *output_data)
+               const T *input_data, const Shape &unshrunk_output_shape, T *output_data,
+               ruy::Context *ruy_context = nullptr)
 {
   const int output_size = unshrunk_output_shape.DimensionsCount();
   assert(unshrunk_input_shape.DimensionsCount() <= 6);
@@ -562,18 +568,31 @@ void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_inp
               &non_flatten_input_shape, &non_flatten_output_shape, &non_flatten_params);
     assert(non_flatten_params.perm[0] != 0);
 
-    for (int i = 0; i < total_size; i += non_flatten_size)
+    // Blocks are transposed in parallel, or a single block is transposed in parallel
+    const int num_blocks = total_size / non_flatten_size;
+    if (num_blocks == 1)
     {
-      TransposeImpl(non_flatten_params, non_flatten_input_shape, input_data + i,
-                    non_flatten_output_shape, output_data + i);
+      TransposeImpl(non_flatten_params, non_flatten_input_shape, input_data,
+                    non_flatten_output_shape, output_data, ruy_context);
+      return;
     }
+
+    auto transpose_blocks = [&](int64_t start, int64_t end) {
+      for (int64_t b = start; b < end; ++b)
+      {
+        TransposeImpl(non_flatten_params, non_flatten_input_shape,
+                      input_data + b * non_flatten_size, non_flatten_output_shape,
+                      output_data + b * non_flatten_size);
+      }
+    };
+    cpu_backend_threadpool::ParallelFor(num_blocks, non_flatten_size, ruy_context,
+                                        transpose_blocks);
     return;
   }
 
   // Call non-flattened case.
-  TransposeImpl(shrunk_params, shrunk_input_shape, input_data, shrunk_output_shape,
-
-                output_data);
+  TransposeImpl(shrunk_params, shrunk_input_shape, input_data, shrunk_output_shape, output_data,
+                ruy_context);
 }
 
 } // namespace cker
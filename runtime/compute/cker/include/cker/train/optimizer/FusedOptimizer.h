@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_TRAIN_OPTIMIZER_FUSED_OPTIMIZER_H__
+#define __NNFW_CKER_TRAIN_OPTIMIZER_FUSED_OPTIMIZER_H__
+
+#include "cker/eigen/EigenSupport.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace train
+{
+
+/**
+ * @brief Buffers of a trainable tensor updated by a fused optimizer
+ *
+ * m and v are optimizer variables, which are null if the optimizer does not use them.
+ */
+struct TrainableChunk
+{
+  float *var;
+  const float *grad;
+  float *m;
+  float *v;
+  int64_t size;
+};
+
+namespace fused_optimizer
+{
+
+// Number of elements updated at once, small enough for all buffers of a piece to stay in cache
+constexpr int64_t kPieceSize = 4096;
+
+struct Piece
+{
+  const TrainableChunk *chunk;
+  int64_t begin;
+  int64_t size;
+};
+
+// Split chunks into pieces so that small tensors are updated together and large ones in parallel
+inline std::vector<Piece> SplitPieces(const std::vector<TrainableChunk> &chunks)
+{
+  std::vector<Piece> pieces;
+  for (const auto &chunk : chunks)
+  {
+    for (int64_t begin = 0; begin < chunk.size; begin += kPieceSize)
+      pieces.emplace_back(Piece{&chunk, begin, std::min(kPieceSize, chunk.size - begin)});
+  }
+  return pieces;
+}
+
+// Run fn for each piece with threads of Eigen device
+template <typename Fn>
+void ParallelForPieces(const std::vector<Piece> &pieces, int bytes_per_elem,
+                       int cycles_per_elem, const Fn &fn)
+{
+  const auto &device = *eigen_support::GetThreadPoolDevice();
+  const Eigen::TensorOpCost cost(kPieceSize * bytes_per_elem, kPieceSize * bytes_per_elem,
+                                 kPieceSize * cycles_per_elem);
+  device.parallelFor(static_cast<Eigen::Index>(pieces.size()), cost,
+                     [&](Eigen::Index first, Eigen::Index last) {
+                       for (auto i = first; i < last; ++i)
+                         fn(i, pieces[i]);
+                     });
+}
+
+// Sum of squares of gradients, whose partial sums are added in order not to depend on threads
+inline double SquaredSum(const std::vector<Piece> &pieces)
+{
+  std::vector<double> sums(pieces.size());
+  ParallelForPieces(pieces, sizeof(float), 2, [&](Eigen::Index i, const Piece &piece) {
+    Eigen::Map<const Eigen::ArrayXf> grad(piece.chunk->grad + piece.begin, piece.size);
+    sums[i] = static_cast<double>(grad.square().sum());
+  });
+
+  double sum = 0.0;
+  for (const auto value : sums)
+    sum += value;
+  return sum;
+}
+
+// Scale of gradients to clip them by global norm, or 1 if clip_norm is not positive
+inline float ClipScale(const std::vector<Piece> &pieces, float clip_norm)
+{
+  if (!(clip_norm > 0.0f))
+    return 1.0f;
+
+  const auto global_norm = static_cast<float>(std::sqrt(SquaredSum(pieces)));
+  return global_norm > clip_norm ? clip_norm / global_norm : 1.0f;
+}
+
+} // namespace fused_optimizer
+
+/**
+ * @brief Global L2 norm of gradients of all chunks
+ */
+inline float GradientGlobalNorm(const std::vector<TrainableChunk> &chunks)
+{
+  const auto pieces = fused_optimizer::SplitPieces(chunks);
+  return static_cast<float>(std::sqrt(fused_optimizer::SquaredSum(pieces)));
+}
+
+/**
+ * @brief Apply Adam to all chunks in a sweep, which is the same as cker::train::Adam for each
+ *
+ * If clip_norm is positive, gradients are scaled down by clip_norm / global_norm when their
+ * global norm is larger than clip_norm. Gradients are not modified.
+ */
+inline void FusedAdam(const std::vector<TrainableChunk> &chunks, float beta1_power,
+                      float beta2_power, float learning_rate, float beta1, float beta2,
+                      float epsilon, float clip_norm = 0.0f)
+{
+  for (const auto &chunk : chunks)
+  {
+    if (chunk.m == nullptr || chunk.v == nullptr)
+      throw std::runtime_error("cker::FusedAdam: m and v must be given");
+  }
+
+  const auto pieces = fused_optimizer::SplitPieces(chunks);
+  const float scale = fused_optimizer::ClipScale(pieces, clip_norm);
+  const float alpha = learning_rate * std::sqrt(1.0f - beta2_power) / (1.0f - beta1_power);
+
+  fused_optimizer::ParallelForPieces(
+    pieces, sizeof(float) * 4, 16, [&](Eigen::Index, const fused_optimizer::Piece &piece) {
+      const auto &chunk = *piece.chunk;
+      Eigen::Map<Eigen::ArrayXf> var(chunk.var + piece.begin, piece.size);
+      Eigen::Map<Eigen::ArrayXf> m(chunk.m + piece.begin, piece.size);
+      Eigen::Map<Eigen::ArrayXf> v(chunk.v + piece.begin, piece.size);
+      Eigen::Map<const Eigen::ArrayXf> grad(chunk.grad + piece.begin, piece.size);
+
+      if (scale == 1.0f)
+      {
+        m += (grad - m) * (1.0f - beta1);
+        v += (grad.square() - v) * (1.0f - beta2);
+      }
+      else
+      {
+        m += (grad * scale - m) * (1.0f - beta1);
+        v += ((grad * scale).square() - v) * (1.0f - beta2);
+      }
+      var -= (m * alpha) / (v.sqrt() + epsilon);
+    });
+}
+
+/**
+ * @brief Apply gradient descent to all chunks in a sweep
+ *
+ * Gradients are clipped by global norm in the same way as FusedAdam.
+ */
+inline void FusedGradientDescent(const std::vector<TrainableChunk> &chunks, float learning_rate,
+                                 float clip_norm = 0.0f)
+{
+  const auto pieces = fused_optimizer::SplitPieces(chunks);
+  const float lr = learning_rate * fused_optimizer::ClipScale(pieces, clip_norm);
+
+  fused_optimizer::ParallelForPieces(
+    pieces, sizeof(float) * 2, 2, [&](Eigen::Index, const fused_optimizer::Piece &piece) {
+      const auto &chunk = *piece.chunk;
+      Eigen::Map<Eigen::ArrayXf> var(chunk.var + piece.begin, piece.size);
+      Eigen::Map<const Eigen::ArrayXf> grad(chunk.grad + piece.begin, piece.size);
+      var -= grad * lr;
+    });
+}
+
+} // namespace train
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_TRAIN_OPTIMIZER_FUSED_OPTIMIZER_H__
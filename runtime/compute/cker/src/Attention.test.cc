@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cker/Shape.h"
+#include <cker/operation/Attention.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using nnfw::cker::AttentionParams;
+using nnfw::cker::Shape;
+
+namespace
+{
+
+// Softmax(Q·K^T * scale + mask)·V computed with full score rows
+std::vector<float> referenceAttention(int n_tokens, int n_head, int d_head, int n_ctx,
+                                      const std::vector<float> &q, const std::vector<float> &k,
+                                      const std::vector<float> &v, int mask_rows,
+                                      const std::vector<float> &mask, float scale)
+{
+  const int stride = n_head * d_head;
+  std::vector<float> out(n_tokens * stride);
+  for (int h = 0; h < n_head; ++h)
+  {
+    for (int t = 0; t < n_tokens; ++t)
+    {
+      std::vector<float> scores(n_ctx);
+      float max_score = -std::numeric_limits<float>::infinity();
+      for (int j = 0; j < n_ctx; ++j)
+      {
+        float dot = 0.0f;
+        for (int d = 0; d < d_head; ++d)
+          dot += q[t * stride + h * d_head + d] * k[j * stride + h * d_head + d];
+        scores[j] = dot * scale + mask[(t % mask_rows) * n_ctx + j];
+        max_score = std::max(max_score, scores[j]);
+      }
+      float sum = 0.0f;
+      for (int j = 0; j < n_ctx; ++j)
+      {
+        scores[j] = std::exp(scores[j] - max_score);
+        sum += scores[j];
+      }
+      for (int d = 0; d < d_head; ++d)
+      {
+        float acc = 0.0f;
+        for (int j = 0; j < n_ctx; ++j)
+          acc += scores[j] / sum * v[j * stride + h * d_head + d];
+        out[t * stride + h * d_head + d] = acc;
+      }
+    }
+  }
+  return out;
+}
+
+std::vector<float> sequence(size_t size, float step)
+{
+  std::vector<float> data(size);
+  for (size_t i = 0; i < size; ++i)
+    data[i] = std::sin(step * static_cast<float>(i));
+  return data;
+}
+
+} // namespace
+
+TEST(CKer_Operation, Attention)
+{
+  const float kNegInf = -std::numeric_limits<float>::infinity();
+
+  // Decode one token at position 5, cache spans blocks of 4
+  {
+    const int n_head = 2, d_head = 4, cache_size = 8, pos = 5;
+    const int stride = n_head * d_head;
+
+    std::vector<float> q = sequence(stride, 0.3f);
+    std::vector<float> k = sequence(cache_size * stride, 0.7f);
+    std::vector<float> v = sequence(cache_size * stride, 1.1f);
+    std::vector<float> mask(cache_size, 0.0f);
+    for (int j = pos + 1; j < cache_size; ++j)
+      mask[j] = kNegInf;
+
+    AttentionParams params;
+    params.scale = 0.5f;
+    params.block_size = 4;
+
+    std::vector<float> output(stride);
+    nnfw::cker::Attention(params, Shape{1, 1, n_head, d_head}, q.data(),
+                          Shape{1, cache_size, n_head, d_head}, k.data(),
+                          Shape{1, cache_size, n_head, d_head}, v.data(), pos + 1,
+                          Shape{1, 1, 1, cache_size}, mask.data(), Shape{1, 1, n_head, d_head},
+                          output.data());
+
+    auto expected = referenceAttention(1, n_head, d_head, cache_size, q, k, v, 1, mask, 0.5f);
+    for (size_t i = 0; i < expected.size(); ++i)
+      EXPECT_NEAR(expected[i], output[i], 1e-5f);
+  }
+
+  // Causal attention of 3 tokens at positions 2..4 with one mask row per token
+  {
+    const int n_tokens = 3, n_head = 3, d_head = 2, cache_size = 6, pos = 2;
+    const int stride = n_head * d_head;
+
+    std::vector<float> q = sequence(n_tokens * stride, 0.9f);
+    std::vector<float> k = sequence(cache_size * stride, 0.4f);
+    std::vector<float> v = sequence(cache_size * stride, 1.7f);
+    std::vector<float> mask(n_tokens * cache_size, 0.0f);
+    for (int t = 0; t < n_tokens; ++t)
+      for (int j = pos + t + 1; j < cache_size; ++j)
+        mask[t * cache_size + j] = kNegInf;
+
+    AttentionParams params;
+    params.scale = 1.0f / std::sqrt(static_cast<float>(d_head));
+    params.block_size = 4;
+
+    std::vector<float> output(n_tokens * stride);
+    nnfw::cker::Attention(params, Shape{1, n_tokens, n_head, d_head}, q.data(),
+                          Shape{1, cache_size, n_head, d_head}, k.data(),
+                          Shape{1, cache_size, n_head, d_head}, v.data(), pos + n_tokens,
+                          Shape{1, 1, n_tokens, cache_size}, mask.data(),
+                          Shape{1, n_tokens, n_head, d_head}, output.data());
+
+    auto expected = referenceAttention(n_tokens, n_head, d_head, cache_size, q, k, v, n_tokens,
+                                       mask, params.scale);
+    for (size_t i = 0; i < expected.size(); ++i)
+      EXPECT_NEAR(expected[i], output[i], 1e-5f);
+  }
+}
+
+TEST(CKer_Operation, AttentionFilledPositions)
+{
+  // Decode one token at position 2 without mask. Positions after it are not written yet.
+  const int n_head = 2, d_head = 4, cache_size = 8, pos = 2;
+  const int stride = n_head * d_head;
+
+  std::vector<float> q = sequence(stride, 0.3f);
+  std::vector<float> k = sequence(cache_size * stride, 0.7f);
+  std::vector<float> v = sequence(cache_size * stride, 1.1f);
+  std::fill(k.begin() + (pos + 1) * stride, k.end(), std::numeric_limits<float>::quiet_NaN());
+  std::fill(v.begin() + (pos + 1) * stride, v.end(), std::numeric_limits<float>::quiet_NaN());
+
+  AttentionParams params;
+  params.scale = 0.5f;
+  params.block_size = 4;
+
+  std::vector<float> output(stride);
+  nnfw::cker::Attention(params, Shape{1, 1, n_head, d_head}, q.data(),
+                        Shape{1, cache_size, n_head, d_head}, k.data(),
+                        Shape{1, cache_size, n_head, d_head}, v.data(), pos + 1, Shape{}, nullptr,
+                        Shape{1, 1, n_head, d_head}, output.data());
+
+  std::vector<float> mask(pos + 1, 0.0f);
+  auto expected = referenceAttention(1, n_head, d_head, pos + 1, q, k, v, 1, mask, 0.5f);
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_NEAR(expected[i], output[i], 1e-5f);
+}
+
+TEST(CKer_Operation, AttentionBlockQuantCache)
+{
+  const float kNegInf = -std::numeric_limits<float>::infinity();
+  const int n_tokens = 2, n_head = 2, d_head = 32, cache_size = 5, pos = 3;
+  const int stride = n_head * d_head;
+
+  std::vector<float> q = sequence(n_tokens * stride, 0.05f);
+  std::vector<float> k = sequence(cache_size * stride, 0.13f);
+  std::vector<float> v = sequence(cache_size * stride, 0.29f);
+  std::vector<float> mask(n_tokens * cache_size, 0.0f);
+  for (int t = 0; t < n_tokens; ++t)
+    for (int j = pos + t + 1; j < cache_size; ++j)
+      mask[t * cache_size + j] = kNegInf;
+
+  AttentionParams params;
+  params.scale = 1.0f / std::sqrt(static_cast<float>(d_head));
+
+  const Shape q_shape{1, n_tokens, n_head, d_head};
+  const Shape cache_shape{1, cache_size, n_head, d_head};
+  const Shape mask_shape{1, 1, n_tokens, cache_size};
+  const int n_blocks = cache_size * stride / nnfw::cker::kBlockQuantSize;
+
+  // Compare with attention over the dequantized caches
+  auto check = [&](auto block) {
+    using Block = decltype(block);
+    std::vector<Block> k_q(n_blocks), v_q(n_blocks);
+    nnfw::cker::QuantizeRow(k.data(), k_q.data(), cache_size * stride);
+    nnfw::cker::QuantizeRow(v.data(), v_q.data(), cache_size * stride);
+
+    std::vector<float> k_dq(k.size()), v_dq(v.size());
+    nnfw::cker::DequantizeRow(k_q.data(), k_dq.data(), cache_size * stride);
+    nnfw::cker::DequantizeRow(v_q.data(), v_dq.data(), cache_size * stride);
+
+    std::vector<float> output(n_tokens * stride);
+    nnfw::cker::Attention(params, q_shape, q.data(), cache_shape, k_q.data(), cache_shape,
+                          v_q.data(), pos + n_tokens, mask_shape, mask.data(), q_shape,
+                          output.data());
+
+    auto expected = referenceAttention(n_tokens, n_head, d_head, cache_size, q, k_dq, v_dq,
+                                       n_tokens, mask, params.scale);
+    for (size_t i = 0; i < expected.size(); ++i)
+      EXPECT_NEAR(expected[i], output[i], 1e-4f);
+  };
+
+  check(nnfw::cker::BlockQ8_0{});
+  check(nnfw::cker::BlockQ4_0{});
+}
+
+TEST(CKer_Operation, BlockQuantRoundTrip)
+{
+  const int n = 2 * nnfw::cker::kBlockQuantSize;
+  std::vector<float> x = sequence(n, 0.37f);
+
+  std::vector<nnfw::cker::BlockQ8_0> q8(2);
+  std::vector<float> x8(n);
+  nnfw::cker::QuantizeRow(x.data(), q8.data(), n);
+  nnfw::cker::DequantizeRow(q8.data(), x8.data(), n);
+  for (int i = 0; i < n; ++i)
+    EXPECT_NEAR(x[i], x8[i], 1.0f / 127);
+
+  std::vector<nnfw::cker::BlockQ4_0> q4(2);
+  std::vector<float> x4(n);
+  nnfw::cker::QuantizeRow(x.data(), q4.data(), n);
+  nnfw::cker::DequantizeRow(q4.data(), x4.data(), n);
+  for (int i = 0; i < n; ++i)
+    EXPECT_NEAR(x[i], x4[i], 1.0f / 8);
+}
+
+TEST(CKer_Operation, neg_AttentionMaskRows)
+{
+  const int n_head = 1, d_head = 2, cache_size = 4;
+  std::vector<float> q(2 * d_head), k(cache_size * d_head), v(cache_size * d_head);
+  std::vector<float> mask(3 * cache_size), output(2 * d_head);
+
+  AttentionParams params;
+  params.scale = 1.0f;
+
+  // 3 mask rows for 2 tokens
+  EXPECT_ANY_THROW(nnfw::cker::Attention(
+    params, Shape{1, 2, n_head, d_head}, q.data(), Shape{1, cache_size, n_head, d_head}, k.data(),
+    Shape{1, cache_size, n_head, d_head}, v.data(), cache_size, Shape{1, 1, 3, cache_size},
+    mask.data(), Shape{1, 2, n_head, d_head}, output.data()));
+
+  // More filled positions than the cache
+  EXPECT_ANY_THROW(nnfw::cker::Attention(
+    params, Shape{1, 2, n_head, d_head}, q.data(), Shape{1, cache_size, n_head, d_head}, k.data(),
+    Shape{1, cache_size, n_head, d_head}, v.data(), cache_size + 1, Shape{1, 1, 2, cache_size},
+    mask.data(), Shape{1, 2, n_head, d_head}, output.data()));
+}
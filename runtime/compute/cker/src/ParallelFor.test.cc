@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/CpuBackendThreadpool.h>
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/SoftMax.h>
+#include <cker/operation/Transpose.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+std::vector<float> randomData(size_t size)
+{
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<float> dist(-3.0f, 3.0f);
+  std::vector<float> data(size);
+  for (auto &value : data)
+    value = dist(gen);
+  return data;
+}
+
+} // namespace
+
+TEST(CKer_ParallelFor, CoverAllIndices)
+{
+  ruy::Context ctx;
+  ctx.set_max_num_threads(4);
+
+  std::vector<std::atomic<int>> visits(1000);
+  nnfw::cker::cpu_backend_threadpool::ParallelFor(
+    visits.size(), nnfw::cker::cpu_backend_threadpool::kMinWorkPerThread, &ctx,
+    [&](int64_t start, int64_t end) {
+      for (int64_t i = start; i < end; ++i)
+        visits[i]++;
+    });
+
+  for (const auto &visit : visits)
+    ASSERT_EQ(visit, 1);
+}
+
+TEST(CKer_ParallelFor, Softmax)
+{
+  ruy::Context ctx;
+  ctx.set_max_num_threads(4);
+
+  nnfw::cker::Shape shape{64, 1000};
+  auto input = randomData(shape.FlatSize());
+  std::vector<float> expected(shape.FlatSize());
+  std::vector<float> actual(shape.FlatSize());
+
+  nnfw::cker::SoftmaxParams params;
+  params.beta = 1.0f;
+  nnfw::cker::Softmax(params, shape, input.data(), shape, expected.data());
+  nnfw::cker::Softmax(params, shape, input.data(), shape, actual.data(), &ctx);
+
+  ASSERT_EQ(expected, actual);
+}
+
+TEST(CKer_ParallelFor, Transpose)
+{
+  ruy::Context ctx;
+  ctx.set_max_num_threads(4);
+
+  nnfw::cker::Shape input_shape{40, 50, 60};
+  nnfw::cker::Shape output_shape{60, 40, 50};
+  auto input = randomData(input_shape.FlatSize());
+  std::vector<float> expected(input_shape.FlatSize());
+  std::vector<float> actual(input_shape.FlatSize());
+
+  nnfw::cker::TransposeParams params;
+  params.perm_count = 3;
+  params.perm[0] = 2;
+  params.perm[1] = 0;
+  params.perm[2] = 1;
+  nnfw::cker::Transpose(params, input_shape, input.data(), output_shape, expected.data());
+  nnfw::cker::Transpose(params, input_shape, input.data(), output_shape, actual.data(), &ctx);
+
+  ASSERT_EQ(expected, actual);
+}
+
+TEST(CKer_ParallelFor, BroadcastMul)
+{
+  ruy::Context ctx;
+  ctx.set_max_num_threads(4);
+
+  nnfw::cker::Shape lhs_shape{4, 75, 400};
+  nnfw::cker::Shape rhs_shape{1, 75, 400};
+  auto lhs = randomData(lhs_shape.FlatSize());
+  auto rhs = randomData(rhs_shape.FlatSize());
+  std::vector<float> expected(lhs_shape.FlatSize());
+  std::vector<float> actual(lhs_shape.FlatSize());
+
+  nnfw::cker::BinaryArithmeticOpParam params;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+  ASSERT_TRUE(nnfw::cker::ProcessBroadcastShapes(lhs_shape, rhs_shape, &params));
+
+  nnfw::cker::BroadcastBinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::MUL>(
+    params, lhs_shape, lhs.data(), rhs_shape, rhs.data(), lhs_shape, expected.data());
+  nnfw::cker::BroadcastBinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::MUL>(
+    params, lhs_shape, lhs.data(), rhs_shape, rhs.data(), lhs_shape, actual.data(), &ctx);
+
+  ASSERT_EQ(expected, actual);
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/train/optimizer/Adam.h>
+#include <cker/train/optimizer/FusedOptimizer.h>
+#include <cker/train/optimizer/SGD.h>
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// Buffers of trainable tensors of various sizes, some of which are split into several pieces
+struct Trainables
+{
+  explicit Trainables(const std::vector<int> &sizes)
+  {
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    auto random = [&](int size) {
+      std::vector<float> data(size);
+      for (auto &value : data)
+        value = dist(gen);
+      return data;
+    };
+
+    for (const auto size : sizes)
+    {
+      vars.emplace_back(random(size));
+      grads.emplace_back(random(size));
+      ms.emplace_back(std::vector<float>(size, 0.0f));
+      vs.emplace_back(std::vector<float>(size, 0.0f));
+    }
+  }
+
+  std::vector<nnfw::cker::train::TrainableChunk> chunks()
+  {
+    std::vector<nnfw::cker::train::TrainableChunk> ret;
+    for (size_t i = 0; i < vars.size(); ++i)
+      ret.emplace_back(nnfw::cker::train::TrainableChunk{
+        vars[i].data(), grads[i].data(), ms[i].data(), vs[i].data(),
+        static_cast<int64_t>(vars[i].size())});
+    return ret;
+  }
+
+  std::vector<std::vector<float>> vars;
+  std::vector<std::vector<float>> grads;
+  std::vector<std::vector<float>> ms;
+  std::vector<std::vector<float>> vs;
+};
+
+const std::vector<int> kSizes = {1, 7, 4096, 10000, 3, 20000};
+
+} // namespace
+
+TEST(CKer_Optimizer, FusedAdam)
+{
+  Trainables expected{kSizes};
+  Trainables actual{kSizes};
+  const float lr = 0.001f;
+  const float beta1 = 0.9f;
+  const float beta2 = 0.999f;
+  const float epsilon = 1e-07f;
+
+  for (uint32_t step = 0; step < 3; ++step)
+  {
+    const float beta1_power = std::pow(beta1, step + 1);
+    const float beta2_power = std::pow(beta2, step + 1);
+
+    for (size_t i = 0; i < kSizes.size(); ++i)
+    {
+      const nnfw::cker::Shape shape{kSizes[i]};
+      nnfw::cker::train::Adam(shape, expected.vars[i].data(), shape, expected.grads[i].data(),
+                              shape, expected.ms[i].data(), shape, expected.vs[i].data(),
+                              beta1_power, beta2_power, lr, beta1, beta2, epsilon, false);
+    }
+    nnfw::cker::train::FusedAdam(actual.chunks(), beta1_power, beta2_power, lr, beta1, beta2,
+                                 epsilon);
+
+    for (size_t i = 0; i < kSizes.size(); ++i)
+    {
+      for (int j = 0; j < kSizes[i]; ++j)
+      {
+        ASSERT_NEAR(actual.vars[i][j], expected.vars[i][j], 1e-6f);
+        ASSERT_NEAR(actual.ms[i][j], expected.ms[i][j], 1e-6f);
+        ASSERT_NEAR(actual.vs[i][j], expected.vs[i][j], 1e-6f);
+      }
+    }
+  }
+}
+
+TEST(CKer_Optimizer, FusedGradientDescentClipNorm)
+{
+  Trainables expected{kSizes};
+  Trainables actual{kSizes};
+  const float lr = 0.01f;
+
+  double sum = 0.0;
+  for (const auto &grad : expected.grads)
+    for (const auto value : grad)
+      sum += value * value;
+  const auto global_norm = static_cast<float>(std::sqrt(sum));
+  EXPECT_NEAR(nnfw::cker::train::GradientGlobalNorm(actual.chunks()), global_norm, 1e-3f);
+
+  // Gradients are scaled to have global norm of clip_norm
+  const float clip_norm = global_norm / 4;
+  for (size_t i = 0; i < kSizes.size(); ++i)
+  {
+    const nnfw::cker::Shape shape{kSizes[i]};
+    nnfw::cker::train::GradientDescent(shape, expected.vars[i].data(), shape,
+                                       expected.grads[i].data(), lr * clip_norm / global_norm);
+  }
+  nnfw::cker::train::FusedGradientDescent(actual.chunks(), lr, clip_norm);
+
+  for (size_t i = 0; i < kSizes.size(); ++i)
+  {
+    for (int j = 0; j < kSizes[i]; ++j)
+      ASSERT_NEAR(actual.vars[i][j], expected.vars[i][j], 1e-6f);
+  }
+
+  // Gradients are not clipped if their global norm is not larger than clip_norm
+  const auto vars = actual.vars;
+  nnfw::cker::train::FusedGradientDescent(actual.chunks(), lr, global_norm * 2);
+  for (size_t i = 0; i < kSizes.size(); ++i)
+  {
+    for (int j = 0; j < kSizes[i]; ++j)
+      ASSERT_NEAR(actual.vars[i][j], vars[i][j] - lr * actual.grads[i][j], 1e-6f);
+  }
+}
+
+TEST(CKer_Optimizer, neg_FusedAdamWithoutVariables)
+{
+  Trainables trainables{kSizes};
+  auto chunks = trainables.chunks();
+  chunks[1].m = nullptr;
+
+  EXPECT_ANY_THROW(
+    nnfw::cker::train::FusedAdam(chunks, 0.9f, 0.999f, 0.001f, 0.9f, 0.999f, 1e-07f));
+}
@@ -30,6 +30,15 @@ extern "C" {
 /* Forward declaration */
 struct ggma_context;
 
+/**
+ * @brief Callback invoked for every generated token during streaming generation.
+ *
+ * @param[in] token     The newly generated token.
+ * @param[in] user_data The user data given to @c ggma_generate_stream.
+ * @return    0 to continue generation, or non-zero to stop it after this token.
+ */
+typedef int (*ggma_token_callback)(ggma_token token, void *user_data);
+
 /**
  * @brief Generates a sequence of tokens based on the provided prompt tokens.
  *
@@ -49,6 +58,86 @@ struct ggma_context;
 GGMA_STATUS ggma_generate(struct ggma_context *context, ggma_token *tokens, size_t n_tokens,
                           size_t n_tokens_max, size_t *n_tokens_out);
 
+/**
+ * @brief Generates tokens like @c ggma_generate, reporting each token as soon as it is sampled.
+ *
+ * @p callback is called right after each token is sampled, before the next decoding step,
+ * so the first token is reported as soon as the prompt is processed.
+ * The end token which stops generation is not reported.
+ *
+ * @param[in]    context      The GGMA context to use for generation.
+ * @param[inout] tokens       An array of input prompt tokens. The generated tokens will
+ *                            be placed in this buffer
+ * @param[in]    n_tokens     The number of tokens in the input @p tokens array.
+ * @param[in]    n_tokens_max The maximum number of tokens that the @p tokens buffer can hold.
+ * @param[inout] n_tokens_out A pointer to a variable that will receive the number of
+ *                            element in the @p tokens after generation
+ * @param[in]    callback     The function to call for every generated token.
+ *                            Generation stops early when it returns non-zero.
+ * @param[in]    user_data    An opaque pointer passed to @p callback as it is.
+ * @return    @c GGMA_STATUS_NO_ERROR on success, or an appropriate error code on failure.
+ */
+GGMA_STATUS ggma_generate_stream(struct ggma_context *context, ggma_token *tokens, size_t n_tokens,
+                                 size_t n_tokens_max, size_t *n_tokens_out,
+                                 ggma_token_callback callback, void *user_data);
+
+/**
+ * @brief Submits a prompt to be generated together with other sequences.
+ *
+ * The sequence waits in the context until a call to @c ggma_step admits it.
+ * Several sequences can be submitted at any time, also while others are running.
+ *
+ * @param[in]  context   The GGMA context to use for generation.
+ * @param[in]  tokens    An array of input prompt tokens. It is copied into the context.
+ * @param[in]  n_tokens  The number of tokens in the input @p tokens array.
+ * @param[in]  n_predict The maximum number of tokens to generate for this sequence.
+ * @param[out] seq_id    A pointer to a variable that will receive the sequence id.
+ * @return    @c GGMA_STATUS_NO_ERROR on success, or an appropriate error code on failure.
+ */
+GGMA_STATUS ggma_submit(struct ggma_context *context, const ggma_token *tokens, size_t n_tokens,
+                        size_t n_predict, ggma_seq_id *seq_id);
+
+/**
+ * @brief Runs one generation step for submitted sequences.
+ *
+ * Waiting sequences are admitted as long as the context has free sequence slots,
+ * then one token is generated for every running sequence.
+ * A finished sequence frees its slot for waiting ones in the next step.
+ *
+ * If the model package has a @c decode_batch graph, taking one token of each sequence slot
+ * as a batch, running sequences are decoded together in one run of it, so model weights are
+ * read once per step. Its batch size is the number of sequence slots. Otherwise, running
+ * sequences are decoded one after another, and a step takes about as long as generating one
+ * token for each of them.
+ * A sequence which fails, e.g. on its prompt, is finished and does not stop the others.
+ * The failure is returned when the sequence is collected.
+ *
+ * @param[in]  context     The GGMA context to use for generation.
+ * @param[out] n_remaining A pointer to a variable that will receive the number of
+ *                         sequences still running or waiting after this step.
+ * @return    @c GGMA_STATUS_NO_ERROR on success, or an appropriate error code on failure.
+ */
+GGMA_STATUS ggma_step(struct ggma_context *context, size_t *n_remaining);
+
+/**
+ * @brief Retrieves the tokens of a finished sequence.
+ *
+ * On success, the sequence is released and its id becomes invalid.
+ *
+ * @param[in]  context      The GGMA context to use for generation.
+ * @param[in]  seq_id       The sequence id given by @c ggma_submit.
+ * @param[out] tokens       A buffer that will receive the prompt and generated tokens.
+ * @param[in]  n_tokens_max The maximum number of tokens that the @p tokens buffer can hold.
+ * @param[out] n_tokens_out A pointer to a variable that will receive the number of
+ *                          element in the @p tokens
+ * @return    @c GGMA_STATUS_NO_ERROR on success,
+ *            @c GGMA_STATUS_INVALID_STATE if the sequence is not finished yet,
+ *            or an appropriate error code on failure. A sequence which failed
+ *            during @c ggma_step is released with @c GGMA_STATUS_ERROR.
+ */
+GGMA_STATUS ggma_collect(struct ggma_context *context, ggma_seq_id seq_id, ggma_token *tokens,
+                         size_t n_tokens_max, size_t *n_tokens_out);
+
 #ifdef __cplusplus
 }
 #endif
@@ -97,6 +97,69 @@ GGMA_STATUS ggma_tokenize(const ggma_tokenizer *tokenizer, const char *text, siz
 GGMA_STATUS ggma_detokenize(const ggma_tokenizer *tokenizer, const int32_t *tokens, size_t n_tokens,
                             char *text, size_t text_len);
 
+/**
+ * @brief State of incremental detokenization of a token stream.
+ *
+ * Zero-initialize it before the first token of a stream, and pass the same state to
+ * @c ggma_detokenize_next and @c ggma_detokenize_flush until the stream ends.
+ * Its fields are maintained by the tokenizer and should not be changed by the caller.
+ */
+typedef struct ggma_detokenize_state
+{
+  size_t prefix_offset; /* First token decoded as context of the new tokens */
+  size_t read_offset;   /* First token whose text is not fully returned yet */
+  size_t n_written;     /* Bytes of text after @c read_offset already returned */
+} ggma_detokenize_state;
+
+/**
+ * @brief Detokenizes the text newly completed by the last tokens of a token stream.
+ *
+ * This function is intended for streaming generation. The caller passes all tokens
+ * generated so far with the same @p state on every call. Only the tokens after
+ * the text already returned are decoded, together with the tokens of the last returned
+ * chunk as context, so a call costs the same however long the stream is.
+ * Bytes of a UTF-8 character which is not completed yet are held back until the following
+ * tokens complete it, or until @c ggma_detokenize_flush is called.
+ *
+ * @param[in]    tokenizer  The GGMA tokenizer handle for detokenization.
+ * @param[in]    tokens     A pointer to all token IDs of the stream so far.
+ * @param[in]    n_tokens   The number of tokens in the @p tokens buffer.
+ * @param[inout] state      The state of the stream, zero-initialized for a new stream.
+ * @param[out]   text       A pointer to the output buffer for the new text.
+ *                          It is always null-terminated.
+ * @param[in]    text_len   The maximum size of the @p text buffer in bytes.
+ *                          Text which does not fit is returned by the next call.
+ * @return     @c GGMA_STATUS_NO_ERROR if successful, or an appropriate error code on failure
+ *             (e.g., GGMA_STATUS_UNEXPECTED_NULL if @p tokenizer, @p tokens, @p state or
+ *             @p text is NULL).
+ */
+GGMA_STATUS ggma_detokenize_next(const ggma_tokenizer *tokenizer, const int32_t *tokens,
+                                 size_t n_tokens, ggma_detokenize_state *state, char *text,
+                                 size_t text_len);
+
+/**
+ * @brief Detokenizes the rest of a token stream, including held back bytes.
+ *
+ * Call it when the stream ends, e.g. at the end token or when generation stops,
+ * with the same arguments as @c ggma_detokenize_next. Text of an incomplete UTF-8
+ * character is returned as the tokenizer decodes it. When @p text is too small,
+ * call it again until it writes an empty string.
+ *
+ * @param[in]    tokenizer  The GGMA tokenizer handle for detokenization.
+ * @param[in]    tokens     A pointer to all token IDs of the stream.
+ * @param[in]    n_tokens   The number of tokens in the @p tokens buffer.
+ * @param[inout] state      The state of the stream.
+ * @param[out]   text       A pointer to the output buffer for the rest of the text.
+ *                          It is always null-terminated.
+ * @param[in]    text_len   The maximum size of the @p text buffer in bytes.
+ * @return     @c GGMA_STATUS_NO_ERROR if successful, or an appropriate error code on failure
+ *             (e.g., GGMA_STATUS_UNEXPECTED_NULL if @p tokenizer, @p tokens, @p state or
+ *             @p text is NULL).
+ */
+GGMA_STATUS ggma_detokenize_flush(const ggma_tokenizer *tokenizer, const int32_t *tokens,
+                                  size_t n_tokens, ggma_detokenize_state *state, char *text,
+                                  size_t text_len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -42,6 +42,8 @@ typedef enum
   GGMA_STATUS_ERROR = 1,
   /** Unexpected null argument is given. */
   GGMA_STATUS_UNEXPECTED_NULL = 2,
+  /** When a function was called but it is not valid for the current state. */
+  GGMA_STATUS_INVALID_STATE = 3,
   /** The system ran out of memory. */
   GGMA_STATUS_OUT_OF_MEMORY = 4,
   /** The called API function is deprecated and should no longer be used. */
@@ -51,6 +53,7 @@ typedef enum
 /* Forward declarations */
 typedef struct ggma_context ggma_context;
 typedef int32_t ggma_token;
+typedef int32_t ggma_seq_id;
 typedef struct ggma_tokenizer ggma_tokenizer;
 
 #ifdef __cplusplus
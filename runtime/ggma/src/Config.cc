@@ -45,6 +45,28 @@ void load_config_field<bool>(const Json::Value &root, const std::string &field_n
     throw std::runtime_error(field_name + " not found in config.json");
 }
 
+// Template specialization for float type
+template <>
+void load_config_field<float>(const Json::Value &root, const std::string &field_name, float &target,
+                              bool is_optional)
+{
+  if (root.isMember(field_name))
+    target = root[field_name].asFloat();
+  else if (!is_optional)
+    throw std::runtime_error(field_name + " not found in config.json");
+}
+
+// Template specialization for KVCacheDataType, given as a string
+template <>
+void load_config_field<KVCacheDataType>(const Json::Value &root, const std::string &field_name,
+                                        KVCacheDataType &target, bool is_optional)
+{
+  if (root.isMember(field_name))
+    target = from_string(root[field_name].asString());
+  else if (!is_optional)
+    throw std::runtime_error(field_name + " not found in config.json");
+}
+
 // Template specialization for std::optional<int> type
 template <>
 void load_config_field<std::optional<int>>(const Json::Value &root, const std::string &field_name,
@@ -92,6 +114,8 @@ void ModelConfig::load_from_json(const Json::Value &root)
   load_config_field(root, "num_attention_heads", num_attention_heads);
   load_config_field(root, "vocab_size", vocab_size);
   load_config_field(root, "max_position_embeddings", max_position_embeddings);
+  load_config_field(root, "rope_theta", rope_theta, true);
+  load_config_field(root, "kv_cache_type", kv_cache_type, true);
   load_config_field(root, "bos_token_id", bos_token_id);
   load_config_field(root, "eos_token_id", eos_token_id);
 }
@@ -130,6 +154,8 @@ std::string ModelConfig::to_string() const
   oss << "  num_attention_heads: " << num_attention_heads << "\n";
   oss << "  vocab_size: " << vocab_size << "\n";
   oss << "  max_position_embeddings: " << max_position_embeddings << "\n";
+  oss << "  rope_theta: " << rope_theta << "\n";
+  oss << "  kv_cache_type: " << ggma::to_string(kv_cache_type) << "\n";
   oss << "  bos_token_id: "
       << (bos_token_id.has_value() ? std::to_string(bos_token_id.value()) : "undefined") << "\n";
   oss << "  eos_token_id: "
@@ -138,6 +164,42 @@ std::string ModelConfig::to_string() const
   return oss.str();
 }
 
+// Load configuration from JSON file
+void SamplingConfig::load_from_file(const std::string &config_path)
+{
+  std::ifstream config_file(config_path);
+
+  if (!config_file.is_open())
+    throw std::runtime_error("Failed to open " + config_path);
+
+  Json::Value root;
+  Json::Reader reader;
+
+  if (!reader.parse(config_file, root, false))
+    throw std::runtime_error("Failed to parse JSON: " + reader.getFormattedErrorMessages());
+
+  load_from_json(root);
+}
+
+// Load configuration from JSON value
+void SamplingConfig::load_from_json(const Json::Value &root)
+{
+  // Load sampling configuration from Hugging Face generation_config.json
+  load_config_field(root, "do_sample", do_sample, true);
+  load_config_field(root, "temperature", temperature, true);
+  load_config_field(root, "top_k", top_k, true);
+  load_config_field(root, "top_p", top_p, true);
+  load_config_field(root, "min_p", min_p, true);
+  load_config_field(root, "repetition_penalty", repetition_penalty, true);
+  load_config_field(root, "presence_penalty", presence_penalty, true);
+  load_config_field(root, "seed", seed, true);
+}
+
+bool SamplingConfig::is_greedy() const
+{
+  return !do_sample || temperature <= 0.0f || top_k == 1;
+}
+
 // Utility functions for ModelConfig
 bool validate_model_config(const ModelConfig &config) { return config.is_valid(); }
 
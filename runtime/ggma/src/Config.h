@@ -41,6 +41,9 @@ struct ModelConfig
   int num_attention_heads;
   int vocab_size;              // Vocabulary size
   int max_position_embeddings; // Maximum sequence length
+  float rope_theta = 10000.0f; // Base period of rotary position embedding
+  // Data type of KV cache tensors in the exported model
+  KVCacheDataType kv_cache_type = KVCacheDataType::FLOAT32;
   std::optional<int> bos_token_id;
   std::optional<int> eos_token_id;
 
@@ -60,14 +63,40 @@ struct ModelConfig
   std::string to_string() const;
 };
 
+// Structure to hold token sampling parameters.
+// This can be loaded from Hugging Face generation_config.json.
+struct SamplingConfig
+{
+  bool do_sample = false;          // Greedy decoding if false
+  float temperature = 1.0f;        // Logits are divided by temperature
+  int top_k = 0;                   // Keep k most probable tokens, 0 to disable
+  float top_p = 1.0f;              // Keep smallest set with cumulative probability >= top_p
+  float min_p = 0.0f;              // Keep tokens with probability >= min_p * max probability
+  float repetition_penalty = 1.0f; // Penalty for tokens already in the sequence, 1 to disable
+  float presence_penalty = 0.0f;   // Subtracted from logits of tokens already in the sequence
+  int seed = 0;                    // Seed for random number generator
+
+  // Load configuration from JSON file, keeping defaults for missing fields
+  void load_from_file(const std::string &config_path);
+
+  // Load configuration from JSON value
+  void load_from_json(const Json::Value &root);
+
+  // Whether sampling reduces to picking the most probable token
+  bool is_greedy() const;
+};
+
 // Structure to hold all GGMA-specific configurations,
 // including both the model architecture and runtime/execution parameters.
 struct GGMAConfig
 {
-  ModelConfig model; // Model architecture details
+  ModelConfig model;       // Model architecture details
+  SamplingConfig sampling; // Token sampling parameters
   int cache_size = 32;
   int ubatch = 32;
-  KVCacheDataType kv_cache_type = KVCacheDataType::FLOAT32; // KV cache data type
+  int n_seq_max = 4; // Maximum number of running sequences, batch size of decode_batch if any
+  int n_draft = 4;   // Number of tokens proposed by draft model per speculative step
+  size_t prefix_cache_budget = 64 * 1024 * 1024; // Bytes of prompt KV snapshots, 0 to disable
 };
 
 // Utility functions for ModelConfig
@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <filesystem>
 #include <functional>
 #include <iostream>
@@ -42,12 +43,13 @@ namespace ggma
   } while (0)
 
 // Helper function to create and prepare a model session
-nnfw_session *create_and_prepare_session(const std::string &model_path)
+SessionPtr create_and_prepare_session(const std::string &model_path)
 {
-  nnfw_session *session = nullptr;
-  NNFW_ENSURE_STATUS(nnfw_create_session(&session));
-  NNFW_ENSURE_STATUS(nnfw_load_model_from_file(session, model_path.c_str()));
-  NNFW_ENSURE_STATUS(nnfw_prepare(session));
+  nnfw_session *raw = nullptr;
+  NNFW_ENSURE_STATUS(nnfw_create_session(&raw));
+  SessionPtr session(raw);
+  NNFW_ENSURE_STATUS(nnfw_load_model_from_file(session.get(), model_path.c_str()));
+  NNFW_ENSURE_STATUS(nnfw_prepare(session.get()));
   return session;
 }
 
@@ -79,6 +81,63 @@ ggma::Context::Context(const char *package_path) : _package_path(package_path)
 {
   _cfg = load_config(_package_path);
   _cache.init(_cfg, _cfg.cache_size);
+  _sampler.configure(_cfg.sampling);
+  _prefix_cache.set_budget(_cfg.prefix_cache_budget);
+  prepare_sessions();
+
+  // Load draft model for speculative decoding from package path/draft if exists.
+  // Proposals are verified in one decode run, which needs a decode model taking several tokens.
+  std::filesystem::path draft_path = std::filesystem::path(_package_path) / "draft";
+  if (std::filesystem::exists(draft_path / "config.json") && _decode_n_tokens == 1)
+  {
+    std::cerr << "Draft model is ignored: decode model takes one token per run" << std::endl;
+  }
+  else if (std::filesystem::exists(draft_path / "config.json"))
+  {
+    _draft = std::make_unique<Context>(draft_path.string().c_str());
+    if (_draft->_cfg.model.vocab_size != _cfg.model.vocab_size)
+      throw std::runtime_error("draft : vocab_size mismatch");
+  }
+}
+
+void Context::prepare_sessions()
+{
+  std::filesystem::path package_path(_package_path);
+  _prefill_session = create_and_prepare_session((package_path / "prefill").string());
+  _unemb_session = create_and_prepare_session((package_path / "unemb").string());
+  _decode_session = create_and_prepare_session((package_path / "decode").string());
+
+  NNFW_ENSURE_STATUS(nnfw_input_tensorinfo(_unemb_session.get(), 0, &_unemb_input_ti));
+  NNFW_ENSURE_STATUS(nnfw_output_tensorinfo(_unemb_session.get(), 0, &_unemb_output_ti));
+
+  NNFW_ENSURE_STATUS(nnfw_input_tensorinfo(_decode_session.get(), 0, &_decode_token_ti));
+  NNFW_ENSURE_STATUS(nnfw_output_tensorinfo(_decode_session.get(), 0, &_decode_output_ti));
+  if (_decode_token_ti.rank < 1 || _decode_output_ti.rank < 2)
+    throw std::runtime_error("decode : invalid input or output shape");
+  const int32_t n_tokens = _decode_token_ti.dims[_decode_token_ti.rank - 1];
+  if (n_tokens <= 0 || _decode_output_ti.dims[1] != n_tokens)
+    throw std::runtime_error("decode : invalid number of tokens");
+  _decode_n_tokens = n_tokens;
+
+  // Batched decode graph, which takes a token and a position per sequence:
+  //   token_id [n_batch, 1], caches [n_batch, cache_size, n_head, d_head], cache_pos [n_batch]
+  // Sequences decoded together are as many as its batch.
+  if (!std::filesystem::exists(package_path / "decode_batch"))
+    return;
+  _decode_batch_session = create_and_prepare_session((package_path / "decode_batch").string());
+  const nnfw_tensorinfo &token_ti = _decode_batch_token_ti;
+  const nnfw_tensorinfo &output_ti = _decode_batch_output_ti;
+  NNFW_ENSURE_STATUS(
+    nnfw_input_tensorinfo(_decode_batch_session.get(), 0, &_decode_batch_token_ti));
+  NNFW_ENSURE_STATUS(
+    nnfw_output_tensorinfo(_decode_batch_session.get(), 0, &_decode_batch_output_ti));
+  if (token_ti.rank != 2 || token_ti.dims[1] != 1 || output_ti.rank < 2 ||
+      output_ti.dims[0] != token_ti.dims[0] || output_ti.dims[1] != 1)
+    throw std::runtime_error("decode_batch : invalid input or output shape");
+  // Hidden states of the batch are unembedded in one run, as a sequence of ubatch at most
+  if (token_ti.dims[0] <= 0 || token_ti.dims[0] > _cfg.ubatch)
+    throw std::runtime_error("decode_batch : batch size must be in [1, ubatch]");
+  _cfg.n_seq_max = token_ti.dims[0];
 }
 
 ggma::GGMAConfig ggma::Context::load_config(const std::string &package_path)
@@ -89,13 +148,19 @@ ggma::GGMAConfig ggma::Context::load_config(const std::string &package_path)
   std::filesystem::path config_path = std::filesystem::path(package_path) / "config.json";
   config.model.load_from_file(config_path.string());
 
+  // Load sampling parameters from package path/generation_config.json if exists
+  std::filesystem::path gen_config_path =
+    std::filesystem::path(package_path) / "generation_config.json";
+  if (std::filesystem::exists(gen_config_path))
+    config.sampling.load_from_file(gen_config_path.string());
+
   return config;
 }
 
-void Context::prefill(ggma_token *tokens, size_t n_tokens, std::vector<uint8_t> &hidden_state)
+void Context::prefill(KVCache &cache, ggma_token *tokens, size_t n_tokens,
+                      std::vector<uint8_t> &hidden_state)
 {
-  std::filesystem::path nnpkg_path = std::filesystem::path(_package_path) / "prefill";
-  nnfw_session *session = create_and_prepare_session(nnpkg_path.string());
+  nnfw_session *session = _prefill_session.get();
 
   nnfw_tensorinfo ti;
 
@@ -108,6 +173,8 @@ void Context::prefill(ggma_token *tokens, size_t n_tokens, std::vector<uint8_t>
 
   // TODO: Check ubatch from model is same to runtime config
   int ubatch = ti.dims[1]; // Number of tokens after padding to align to 32 multiples
+  if (n_tokens > static_cast<size_t>(ubatch))
+    throw std::runtime_error("prefill : prompt is longer than ubatch");
   // Use tokens as input without copying (zero-copy)
   NNFW_ENSURE_STATUS(nnfw_set_input(session, 0, ti.dtype, tokens, ubatch * sizeof(ggma_token)));
 
@@ -130,14 +197,14 @@ void Context::prefill(ggma_token *tokens, size_t n_tokens, std::vector<uint8_t>
     throw std::runtime_error("prefill : number of outputs mismatch");
 
   // Output 0~2n-1: KV caches
+  //   Written directly into the cache arena, or its float staging buffer for block quantized
+  //   caches, then rearranged by KVCache::arrange_prefill()
   for (int i = 0; i < _cfg.model.n_layers; ++i)
   {
-    if (!_cache.v[i].empty())
-      NNFW_ENSURE_STATUS(nnfw_set_output(session, 2 * i, _cache.to_nnfw_type(), _cache.v[i].data(),
-                                         _cache.v[i].size()));
-    if (!_cache.k[i].empty())
-      NNFW_ENSURE_STATUS(nnfw_set_output(session, 2 * i + 1, _cache.to_nnfw_type(),
-                                         _cache.k[i].data(), _cache.k[i].size()));
+    NNFW_ENSURE_STATUS(nnfw_set_output(session, 2 * i, cache.prefill_nnfw_type(),
+                                       cache.prefill_v(i), cache.prefill_layer_size()));
+    NNFW_ENSURE_STATUS(nnfw_set_output(session, 2 * i + 1, cache.prefill_nnfw_type(),
+                                       cache.prefill_k(i), cache.prefill_layer_size()));
   }
 
   // Output 2n: hidden_state
@@ -155,17 +222,15 @@ void Context::prefill(ggma_token *tokens, size_t n_tokens, std::vector<uint8_t>
     nnfw_set_output(session, num_outputs - 1, ti.dtype, hidden_state.data(), hidden_state.size()));
 
   NNFW_ENSURE_STATUS(nnfw_run(session));
-  nnfw_close_session(session);
 }
 
 void Context::unemb(std::vector<uint8_t> &hidden_state, size_t n_tokens, std::vector<float> &logits)
 {
-  std::filesystem::path nnpkg_path = std::filesystem::path(_package_path) / "unemb";
-  nnfw_session *session = create_and_prepare_session(nnpkg_path.string());
+  nnfw_session *session = _unemb_session.get();
 
   // Input buffer setup - use externally allocated hidden_state
-  nnfw_tensorinfo ti;
-  NNFW_ENSURE_STATUS(nnfw_input_tensorinfo(session, 0, &ti));
+  // Start from the model's tensor info since the previous call may have resized the input.
+  nnfw_tensorinfo ti = _unemb_input_ti;
   // ti[0] : n_batch
   // ti[1] : n_seq = ubatch   if padded
   //               = n_tokens if not padded
@@ -181,7 +246,7 @@ void Context::unemb(std::vector<uint8_t> &hidden_state, size_t n_tokens, std::ve
     nnfw_set_input(session, 0, ti.dtype, hidden_state.data(), hidden_state.size()));
 
   // Output buffer setup - use externally allocated logits
-  NNFW_ENSURE_STATUS(nnfw_output_tensorinfo(session, 0, &ti));
+  ti = _unemb_output_ti;
   // Check if output data type is float
   if (ti.dtype != NNFW_TYPE_TENSOR_FLOAT32)
     throw std::runtime_error("unemb: output tensor must be float type");
@@ -199,21 +264,20 @@ void Context::unemb(std::vector<uint8_t> &hidden_state, size_t n_tokens, std::ve
     nnfw_set_output(session, 0, ti.dtype, logits.data(), logits.size() * sizeof(logits[0])));
 
   NNFW_ENSURE_STATUS(nnfw_run(session));
-  nnfw_close_session(session);
 }
 
 // Template implementation to eliminate code duplication
 template <bool ReturnLogits, typename OutputType>
-void Context::decode_impl(ggma_token token_id, OutputType &output)
+void Context::decode_impl(KVCache &cache, const ggma_token *tokens, size_t n_tokens,
+                          OutputType &output)
 {
-  std::filesystem::path nnpkg_path = std::filesystem::path(_package_path) / "decode";
-  nnfw_session *session = create_and_prepare_session(nnpkg_path.string());
+  nnfw_session *session = _decode_session.get();
 
   // Expected Input:
   //
   //  Index |   Name    |   Description
   //  ------|-----------|------------------------
-  //   0    | token_id  | input token to decode
+  //   0    | token_id  | input tokens to decode, [1, n_tokens]
   //   1    |   k0      | key cache for layer 0
   //   2    |   k1      | key cache for layer 1
   //   ...  |   ...     | ...
@@ -222,35 +286,46 @@ void Context::decode_impl(ggma_token token_id, OutputType &output)
   //   n+2  |   v1      | value cache for layer 1
   //   ...  |   ...     | ...
   //   2n   |   v{n-1}  | value cache for layer n-1
-  //   2n+1 | cache_pos | current cache position
+  //   2n+1 | cache_pos | cache position of the first token
   //
   // where n = number of layers
 
-  // Input 0: Token ID - use directly without copying
-  nnfw_tensorinfo token_ti;
-  NNFW_ENSURE_STATUS(nnfw_input_tensorinfo(session, 0, &token_ti));
-  NNFW_ENSURE_STATUS(nnfw_set_input(session, 0, token_ti.dtype, &token_id, sizeof(ggma_token)));
+  // Input 0: Token ID
+  //   The decode graph takes a fixed number of tokens per run, as Attention has no shape
+  //   inference to resize it. Fewer tokens are padded, and positions of the padding are
+  //   written to the cache but not counted in its position.
+  if (n_tokens == 0 || n_tokens > _decode_n_tokens)
+    throw std::runtime_error("decode : number of tokens exceeds the decode model");
+  const ggma_token *input = tokens;
+  if (n_tokens < _decode_n_tokens)
+  {
+    _decode_tokens.assign(_decode_n_tokens, 0);
+    std::copy(tokens, tokens + n_tokens, _decode_tokens.begin());
+    input = _decode_tokens.data();
+  }
+  NNFW_ENSURE_STATUS(nnfw_set_input(session, 0, _decode_token_ti.dtype, input,
+                                    _decode_n_tokens * sizeof(ggma_token)));
 
   // Input 1~2n: KV caches - use directly without copying
   for (int i = 0; i < _cfg.model.n_layers; ++i)
   {
-    NNFW_ENSURE_STATUS(nnfw_set_input(session, 1 + i, _cache.to_nnfw_type(), _cache.k[i].data(),
-                                      _cache.k[i].size()));
+    NNFW_ENSURE_STATUS(nnfw_set_input(session, 1 + i, cache.to_nnfw_type(), cache.k(i),
+                                      cache.layer_size()));
   }
   for (int i = 0; i < _cfg.model.n_layers; ++i)
   {
-    NNFW_ENSURE_STATUS(nnfw_set_input(session, 1 + _cfg.model.n_layers + i, _cache.to_nnfw_type(),
-                                      _cache.v[i].data(), _cache.v[i].size()));
+    NNFW_ENSURE_STATUS(nnfw_set_input(session, 1 + _cfg.model.n_layers + i, cache.to_nnfw_type(),
+                                      cache.v(i), cache.layer_size()));
   }
 
   // Input 2n+1: Cache position - current position in KV cache
-  int64_t cache_pos = _cache.pos();
+  int64_t cache_pos = cache.pos();
   NNFW_ENSURE_STATUS(nnfw_set_input(session, 1 + 2 * _cfg.model.n_layers, NNFW_TYPE_TENSOR_INT64,
                                     &cache_pos, sizeof(cache_pos)));
 
   // Output buffer setup - mode dependent
-  nnfw_tensorinfo ti;
-  NNFW_ENSURE_STATUS(nnfw_output_tensorinfo(session, 0, &ti));
+  //   shape = [n_batch, n_tokens, ...], trimmed to the given tokens after the run
+  const nnfw_tensorinfo &ti = _decode_output_ti;
   if constexpr (ReturnLogits)
   {
     // Logits mode: float vector, type validation required
@@ -268,30 +343,171 @@ void Context::decode_impl(ggma_token token_id, OutputType &output)
   }
 
   NNFW_ENSURE_STATUS(nnfw_run(session));
-  nnfw_close_session(session);
-  _cache.advance_pos();
+  output.resize(output.size() / _decode_n_tokens * n_tokens);
+  cache.set_pos(cache.pos() + n_tokens);
 }
 
 // Public interface functions - delegate to template implementation
-void Context::decode(ggma_token token_id, std::vector<uint8_t> &hidden_state)
+void Context::decode(KVCache &cache, ggma_token token_id, std::vector<uint8_t> &hidden_state)
 {
-  decode_impl<false, std::vector<uint8_t>>(token_id, hidden_state);
+  decode_impl<false, std::vector<uint8_t>>(cache, &token_id, 1, hidden_state);
 }
 
-void Context::decode(ggma_token token_id, std::vector<float> &logits)
+void Context::decode(KVCache &cache, ggma_token token_id, std::vector<float> &logits)
 {
-  decode_impl<true, std::vector<float>>(token_id, logits);
+  decode_impl<true, std::vector<float>>(cache, &token_id, 1, logits);
+}
+
+void Context::decode(KVCache &cache, const ggma_token *tokens, size_t n_tokens,
+                     std::vector<uint8_t> &hidden_state)
+{
+  decode_impl<false, std::vector<uint8_t>>(cache, tokens, n_tokens, hidden_state);
 }
 
 // Template instantiation (required for template implementation in .cpp file)
-template void Context::decode_impl<false, std::vector<uint8_t>>(ggma_token token_id,
+template void Context::decode_impl<false, std::vector<uint8_t>>(KVCache &cache,
+                                                                const ggma_token *tokens,
+                                                                size_t n_tokens,
                                                                 std::vector<uint8_t> &output);
-template void Context::decode_impl<true, std::vector<float>>(ggma_token token_id,
+template void Context::decode_impl<true, std::vector<float>>(KVCache &cache,
+                                                             const ggma_token *tokens,
+                                                             size_t n_tokens,
                                                              std::vector<float> &output);
 
-// Sample token from logits using greedy sampling
+// Decode the last sampled token of sequences in given slots in one run of decode_batch
+//
+// Each batch row reads and writes the KV cache of its slot at the position of the slot.
+// Rows of other slots, which are free or finished, decode padding at position 0. This is
+// overwritten when a sequence is admitted to the slot.
+void Context::decode_batch(const std::vector<int> &slots)
+{
+  nnfw_session *session = _decode_batch_session.get();
+  const size_t n_batch = _slots.size();
+
+  // Input 0: token_id, [n_batch, 1]
+  _batch_tokens.assign(n_batch, 0);
+  _batch_pos.assign(n_batch, 0);
+  for (const int slot : slots)
+  {
+    const Sequence &seq = _sequences.at(_slot_owner[slot]);
+    _batch_tokens[slot] = seq.tokens[seq.n_prompt + seq.n_generated - 1];
+    _batch_pos[slot] = _slots[slot].pos();
+  }
+  NNFW_ENSURE_STATUS(nnfw_set_input(session, 0, _decode_batch_token_ti.dtype, _batch_tokens.data(),
+                                    n_batch * sizeof(ggma_token)));
+
+  // Input 1~2n: KV caches of all slots, [n_batch, cache_size, n_head, d_head] per layer
+  const KVCache &caches = _slots.front();
+  for (int i = 0; i < _cfg.model.n_layers; ++i)
+  {
+    NNFW_ENSURE_STATUS(nnfw_set_input(session, 1 + i, caches.to_nnfw_type(), caches.k(i),
+                                      caches.batch_layer_size()));
+    NNFW_ENSURE_STATUS(nnfw_set_input(session, 1 + _cfg.model.n_layers + i,
+                                      caches.to_nnfw_type(), caches.v(i),
+                                      caches.batch_layer_size()));
+  }
+
+  // Input 2n+1: Cache position of each slot, [n_batch]
+  NNFW_ENSURE_STATUS(nnfw_set_input(session, 1 + 2 * _cfg.model.n_layers, NNFW_TYPE_TENSOR_INT64,
+                                    _batch_pos.data(), n_batch * sizeof(int64_t)));
+
+  // Output 0: hidden state, [n_batch, 1, n_emb]
+  const nnfw_tensorinfo &ti = _decode_batch_output_ti;
+  _batch_hidden.resize(bufsize_for(&ti));
+  NNFW_ENSURE_STATUS(
+    nnfw_set_output(session, 0, ti.dtype, _batch_hidden.data(), _batch_hidden.size()));
+
+  NNFW_ENSURE_STATUS(nnfw_run(session));
+  for (const int slot : slots)
+    _slots[slot].advance_pos();
+
+  // Unembed rows of decoded slots in one run, as a sequence of hidden states.
+  // Slots are in ascending order, so their rows are packed forward in place.
+  const size_t row_size = _batch_hidden.size() / n_batch;
+  for (size_t i = 0; i < slots.size(); ++i)
+  {
+    if (static_cast<size_t>(slots[i]) != i)
+      memcpy(_batch_hidden.data() + i * row_size, _batch_hidden.data() + slots[i] * row_size,
+             row_size);
+  }
+  unemb(_batch_hidden, slots.size(), _batch_logits);
+
+  const size_t vocab_size = _cfg.model.vocab_size;
+  for (size_t i = 0; i < slots.size(); ++i)
+  {
+    Sequence &seq = _sequences.at(_slot_owner[slots[i]]);
+    seq.logits.assign(_batch_logits.begin() + i * vocab_size,
+                      _batch_logits.begin() + (i + 1) * vocab_size);
+  }
+}
+
+// Slide the cache window when n_needed positions do not fit,
+// keeping BOS and dropping the older half of the rest
+//
+// The last decode run writes its padding after the needed positions, so room for it is
+// kept as well.
+void Context::slide_window(KVCache &cache, size_t n_needed)
+{
+  const size_t n_room = n_needed + _decode_n_tokens - 1;
+  if (cache.pos() + static_cast<int64_t>(n_room) <= cache.capacity())
+    return;
+
+  const size_t n_keep = _cfg.model.bos_token_id.has_value() ? 1 : 0;
+  const size_t n_discard = (cache.capacity() - n_keep) / 2;
+  if (n_room > n_discard)
+    throw std::runtime_error("Not enough room in KV cache");
+  cache.shift(n_keep, n_discard);
+}
+
+// Fill cache with the prompt and compute logits of its last token
+//
+// Resumes from the longest prompt prefix in the prefix cache.
+// - Whole prompt cached: KV and logits are restored without running the model.
+// - Part of prompt cached: remaining tokens are decoded in one run after the prefix.
+//   As decode takes a fixed number of tokens, only prefixes leaving at most that many
+//   tokens, with room for the padding, are used.
+// - Otherwise: the prompt is prefilled.
+// The result is stored in the prefix cache for later prompts.
+void Context::process_prompt(KVCache &cache, ggma_token *tokens, size_t n_tokens,
+                             std::vector<uint8_t> &hidden, std::vector<float> &logits)
+{
+  cache.reset_pos();
+
+  const bool fits_decode =
+    static_cast<int64_t>(n_tokens + _decode_n_tokens - 1) <= cache.capacity();
+  const size_t n_cached =
+    _prefix_cache.restore(tokens, n_tokens, cache, logits, fits_decode ? _decode_n_tokens : 0);
+  cache.set_pos(n_cached);
+  if (n_cached == n_tokens)
+    return;
+
+  if (n_cached == 0)
+  {
+    // Prefill: KV caches are written directly into the cache arena,
+    // then prompt positions are rearranged into the layout expected by the decoder.
+    prefill(cache, tokens, n_tokens, hidden);
+    cache.set_pos(n_tokens);
+    cache.arrange_prefill(n_tokens);
+  }
+  else
+  {
+    // Decode remaining tokens after the cached prefix
+    decode(cache, tokens + n_cached, n_tokens - n_cached, hidden);
+  }
+
+  // Unembed: obtain logits from the hidden state.
+  const size_t n_processed = n_tokens - n_cached;
+  unemb(hidden, n_processed, logits);
+
+  const size_t vocab_size = _cfg.model.vocab_size;
+  _prefix_cache.store(tokens, n_tokens, cache, logits.data() + (n_processed - 1) * vocab_size,
+                      vocab_size);
+}
+
+// Sample token from logits using the configured sampler
 // Input shape: [n_seq, vocab_size], sample from last token
-ggma_token Context::sample(const std::vector<float> &logits)
+// Logits of the last token are modified in place by penalties.
+ggma_token Context::sample(std::vector<float> &logits, const ggma_token *history, size_t n_history)
 {
   if (logits.empty())
     throw std::runtime_error("Empty logits tensor");
@@ -302,12 +518,19 @@ ggma_token Context::sample(const std::vector<float> &logits)
   if (total_elements % _cfg.model.vocab_size != 0)
     throw std::runtime_error("Invalid sequence length in logits tensor");
 
-  const float *last_logits = logits.data() + (total_elements - _cfg.model.vocab_size);
+  return sample(logits, total_elements / _cfg.model.vocab_size - 1, history, n_history);
+}
+
+// Sample token from given row of logits
+ggma_token Context::sample(std::vector<float> &logits, size_t row, const ggma_token *history,
+                           size_t n_history)
+{
+  if ((row + 1) * _cfg.model.vocab_size > logits.size())
+    throw std::runtime_error("Invalid row of logits tensor");
 
-  // Find the token with maximum logit value from the last token's logits
-  const float *max_elem_iter = std::max_element(last_logits, last_logits + _cfg.model.vocab_size);
+  float *row_logits = logits.data() + row * _cfg.model.vocab_size;
 
-  return std::distance(last_logits, max_elem_iter);
+  return _sampler.sample(row_logits, _cfg.model.vocab_size, history, n_history);
 }
 
 } // namespace ggma
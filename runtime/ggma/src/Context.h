@@ -17,11 +17,16 @@
 #ifndef __GGMA_CONTEXT_H__
 #define __GGMA_CONTEXT_H__
 
+#include "ggma_generate.h"
 #include "ggma_types.h"
 #include "Config.h"
 #include "KVCache.h"
+#include "PrefixCache.h"
+#include "Sampler.h"
 
 #include <cstdint>
+#include <deque>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -29,33 +34,129 @@
 namespace ggma
 {
 
+// Deleter to close nnfw_session owned by std::unique_ptr
+struct SessionDeleter
+{
+  void operator()(nnfw_session *session) const { nnfw_close_session(session); }
+};
+
+using SessionPtr = std::unique_ptr<nnfw_session, SessionDeleter>;
+
 class Context
 {
 public:
   Context(const char *package_path);
   GGMAConfig load_config(const std::string &package_path);
 
-  void prefill(ggma_token *tokens, size_t n_tokens, std::vector<uint8_t> &hidden_state);
+  void prefill(KVCache &cache, ggma_token *tokens, size_t n_tokens,
+               std::vector<uint8_t> &hidden_state);
   void unemb(std::vector<uint8_t> &hidden_state, size_t n_tokens, std::vector<float> &logits);
-  ggma_token sample(const std::vector<float> &logits);
-  void decode(ggma_token token_id, std::vector<uint8_t> &hidden_state);
-  void decode(ggma_token token_id, std::vector<float> &logits);
+  ggma_token sample(std::vector<float> &logits, const ggma_token *history, size_t n_history);
+  ggma_token sample(std::vector<float> &logits, size_t row, const ggma_token *history,
+                    size_t n_history);
+  void decode(KVCache &cache, ggma_token token_id, std::vector<uint8_t> &hidden_state);
+  void decode(KVCache &cache, ggma_token token_id, std::vector<float> &logits);
+  void decode(KVCache &cache, const ggma_token *tokens, size_t n_tokens,
+              std::vector<uint8_t> &hidden_state);
 
 private:
   // Template implementation to eliminate code duplication
   template <bool ReturnLogits, typename OutputType>
-  void decode_impl(ggma_token token_id, OutputType &output);
+  void decode_impl(KVCache &cache, const ggma_token *tokens, size_t n_tokens, OutputType &output);
   void init_kv_cache();
+  void prepare_sessions();
+  void slide_window(KVCache &cache, size_t n_needed = 1);
+  void process_prompt(KVCache &cache, ggma_token *tokens, size_t n_tokens,
+                      std::vector<uint8_t> &hidden, std::vector<float> &logits);
+  size_t generate_speculative(ggma_token *tokens, size_t n_tokens, size_t n_predict,
+                              ggma_token_callback callback, void *user_data);
 
 public:
   ~Context() = default;
 
-  GGMA_STATUS generate(ggma_token *tokens, size_t n_tokens, size_t n_tokens_max, size_t *n_predict);
+  GGMA_STATUS generate(ggma_token *tokens, size_t n_tokens, size_t n_tokens_max, size_t *n_predict,
+                       ggma_token_callback callback = nullptr, void *user_data = nullptr);
+
+  // Multi-sequence generation
+  //
+  // Sequences are queued by submit() and served by step(). Each step admits waiting
+  // sequences into free KV cache slots and generates one token for every running sequence.
+  // Finished sequences release their slot immediately so that waiting ones can join.
+  // If the package has a decode_batch graph, running sequences are decoded in one run of it,
+  // each in its batch row. Otherwise they are decoded one after another.
+  GGMA_STATUS submit(const ggma_token *tokens, size_t n_tokens, size_t n_predict,
+                     ggma_seq_id *seq_id);
+  GGMA_STATUS step(size_t *n_remaining);
+  GGMA_STATUS collect(ggma_seq_id seq_id, ggma_token *tokens, size_t n_tokens_max,
+                      size_t *n_tokens_out);
+
+private:
+  struct Sequence
+  {
+    std::vector<ggma_token> tokens; // Prompt tokens followed by generated tokens
+    size_t n_prompt = 0;
+    size_t n_predict = 0;
+    size_t n_generated = 0;
+    int slot = -1; // Index of KV cache slot, -1 if not running
+    bool done = false;
+    bool failed = false; // Finished by an error, reported by collect()
+    std::vector<uint8_t> hidden;
+    std::vector<float> logits;
+  };
+
+  void admit(ggma_seq_id seq_id, int slot);
+  bool advance(Sequence &seq);
+  void decode_batch(const std::vector<int> &slots);
+  void fail(Sequence &seq);
 
 private:
   std::string _package_path;
   ggma::GGMAConfig _cfg;
   ggma::KVCache _cache;
+  ggma::Sampler _sampler;
+  ggma::PrefixCache _prefix_cache;
+
+  // Buffers reused across generation steps and generate() calls
+  std::vector<uint8_t> _hidden;
+  std::vector<float> _logits;
+
+  // KV cache slots and sequence bookkeeping for multi-sequence generation
+  std::vector<ggma::KVCache> _slots;
+  std::vector<ggma_seq_id> _slot_owner; // Sequence id per slot, -1 if free
+  std::map<ggma_seq_id, Sequence> _sequences;
+  std::deque<ggma_seq_id> _waiting;
+  ggma_seq_id _next_seq_id = 0;
+
+  // Sessions for sub-packages, loaded and prepared once per context.
+  // Each generation step only rebinds inputs and outputs on these sessions.
+  SessionPtr _prefill_session;
+  SessionPtr _unemb_session;
+  SessionPtr _decode_session;
+
+  // Tensor infos of unemb session as declared in the model.
+  // unemb changes its sequence length per call, so original infos are kept here.
+  nnfw_tensorinfo _unemb_input_ti;
+  nnfw_tensorinfo _unemb_output_ti;
+
+  // Tensor infos of decode session as declared in the model.
+  // decode runs on as many tokens as the model takes, padding fewer ones.
+  nnfw_tensorinfo _decode_token_ti;
+  nnfw_tensorinfo _decode_output_ti;
+  size_t _decode_n_tokens = 1;            // Number of tokens the decode model takes per run
+  std::vector<ggma_token> _decode_tokens; // Padded token input
+
+  // Decode graph taking one token of each KV cache slot, loaded from package path/decode_batch
+  // if exists. Its batch size is the number of slots.
+  SessionPtr _decode_batch_session;
+  nnfw_tensorinfo _decode_batch_token_ti;
+  nnfw_tensorinfo _decode_batch_output_ti;
+  std::vector<ggma_token> _batch_tokens;
+  std::vector<int64_t> _batch_pos;
+  std::vector<uint8_t> _batch_hidden;
+  std::vector<float> _batch_logits;
+
+  // Draft model for speculative decoding, loaded from package path/draft if exists
+  std::unique_ptr<Context> _draft;
 };
 
 } // namespace ggma
@@ -33,64 +33,74 @@ namespace ggma
 // - n_predict: In/out parameter for number of tokens to predict/actually predicted
 //   - Input: Maximum number of tokens to generate
 //   - Output: Actual number of tokens generated
+// - callback: Optional function called with each generated token as soon as it is sampled.
+//   Generation stops after the token when it returns non-zero.
+// - user_data: Passed to callback as it is
 //
 // The function ensures no buffer overflow by checking against n_tokens_max
 // and stops generation when either the requested number is reached or the array is full.
 GGMA_STATUS Context::generate(ggma_token *tokens, size_t n_tokens, size_t n_tokens_max,
-                              size_t *n_predict)
+                              size_t *n_predict, ggma_token_callback callback, void *user_data)
 {
   try
   {
-    _cache.reset_pos();
-
-    std::vector<uint8_t> hidden;
-    std::vector<float> logits;
+    std::vector<uint8_t> &hidden = _hidden;
+    std::vector<float> &logits = _logits;
     ggma_token new_token;
 
-    // 1. Prefill: run the model on the initial prompt to obtain the initial hidden state.
-    prefill(tokens, n_tokens, hidden); // hidden = prefill(tokens)
-
-    // 2. Set cache position to the length of the prompt.
-    _cache.set_pos(n_tokens);
-
-    // 3. Transpose KV caches to the layout expected by the decoder.
-    _cache.transpose(true /* k */, "0213", _cfg.model.num_attention_heads, _cfg.cache_size,
-                     _cfg.model.hidden_size / _cfg.model.num_attention_heads);
-    _cache.transpose(false /* v */, "0213", _cfg.model.num_attention_heads, _cfg.cache_size,
-                     _cfg.model.hidden_size / _cfg.model.num_attention_heads);
+    // 1. Process the prompt to fill KV cache and obtain logits of its last token.
+    //    It resumes from a cached prefix of earlier prompts when possible.
+    process_prompt(_cache, tokens, n_tokens, hidden, logits);
 
-    // 4. Unembed: obtain logits from the hidden state.
-    unemb(hidden, n_tokens, logits); // logits = unemb(hidden)
-
-    // 5. Determine how many tokens we can actually generate.
+    // 2. Determine how many tokens we can actually generate.
     size_t n_possible = n_tokens_max - n_tokens;
     if (*n_predict > n_possible)
       *n_predict = n_possible;
 
+    // Speculative decoding when a draft model is given
+    if (_draft)
+    {
+      *n_predict = generate_speculative(tokens, n_tokens, *n_predict, callback, user_data);
+      return GGMA_STATUS_NO_ERROR;
+    }
+
     auto is_end_token = [this](ggma_token token) {
       return token == _cfg.model.eos_token_id.value_or(-1) || token == 0;
     };
 
-    // 6. Autoregressive generation loop.
-    while ((_cache.pos() - n_tokens) < *n_predict)
+    // 3. Autoregressive generation loop.
+    size_t n_generated = 0;
+    while (n_generated < *n_predict)
     {
-      // Sample the most probable token from the logits of the last position.
-      new_token = sample(logits);
-      tokens[n_tokens + (_cache.pos() - n_tokens)] = new_token;
+      // Sample a token from the logits of the last position.
+      new_token = sample(logits, tokens, n_tokens + n_generated);
+      tokens[n_tokens + n_generated] = new_token;
 
       // Stop if we hit an EOS or padding token.
       if (is_end_token(new_token))
         break;
+      ++n_generated;
+
+      // Report the token and stop if the caller cancels generation.
+      if (callback && callback(new_token, user_data) != 0)
+        break;
+
+      // No need to decode the last token.
+      if (n_generated == *n_predict)
+        break;
+
+      // Make room for the new token without reallocating the cache.
+      slide_window(_cache);
 
       // Decode: run the model for the newly generated token to update hidden state.
-      decode(new_token, hidden); // hidden = decode(new_token)
+      decode(_cache, new_token, hidden); // hidden = decode(new_token)
 
       // Unembed: get logits for the next step.
       unemb(hidden, 1, logits); // logits = unemb(hidden)
     }
 
     // Report how many tokens were actually generated.
-    *n_predict = _cache.pos() - n_tokens;
+    *n_predict = n_generated;
   }
   catch (const std::exception &e)
   {
@@ -17,7 +17,11 @@
 #include "Config.h"
 #include "KVCache.h"
 
+#include <cker/BlockQuant.h>
+
+#include <cmath>
 #include <cstring>
+#include <memory>
 #include <stdexcept>
 #include <string>
 
@@ -33,6 +37,10 @@ const char *to_string(KVCacheDataType type)
       return "FLOAT32";
     case KVCacheDataType::UINT8:
       return "UINT8";
+    case KVCacheDataType::Q8_0:
+      return "Q8_0";
+    case KVCacheDataType::Q4_0:
+      return "Q4_0";
     default:
       return "UNKNOWN";
   }
@@ -49,6 +57,14 @@ KVCacheDataType from_string(const std::string &type_str)
   {
     return KVCacheDataType::UINT8;
   }
+  else if (type_str == "Q8_0" || type_str == "q8_0")
+  {
+    return KVCacheDataType::Q8_0;
+  }
+  else if (type_str == "Q4_0" || type_str == "q4_0")
+  {
+    return KVCacheDataType::Q4_0;
+  }
   throw std::runtime_error("Unsupported KV cache data type: " + type_str);
 }
 
@@ -59,62 +75,223 @@ bool is_supported_type(KVCacheDataType type)
   {
     case KVCacheDataType::FLOAT32:
     case KVCacheDataType::UINT8:
+    case KVCacheDataType::Q8_0:
+    case KVCacheDataType::Q4_0:
       return true;
     default:
       return false;
   }
 }
 
-void KVCache::transpose(bool is_k_cache, const char *perm, size_t seq_len, size_t num_heads,
-                        size_t head_dim)
+void KVCache::init(const ggma::GGMAConfig &cfg, int cache_size)
+{
+  std::vector<KVCache> slots(1);
+  init_slots(cfg, cache_size, slots);
+  *this = std::move(slots[0]);
+}
+
+void KVCache::init_slots(const ggma::GGMAConfig &cfg, int cache_size, std::vector<KVCache> &slots)
+{
+  if (cfg.model.n_layers <= 0)
+    throw std::runtime_error("n_layers not properly initialized");
+  if (cfg.model.num_attention_heads <= 0 ||
+      cfg.model.hidden_size % cfg.model.num_attention_heads != 0)
+    throw std::runtime_error("hidden_size must be divisible by num_attention_heads");
+  if (cache_size <= 0)
+    throw std::runtime_error("cache_size must be positive");
+  if (slots.empty())
+    throw std::runtime_error("Number of KV cache slots must be positive");
+
+  // Set KV cache data type from config
+  KVCache layout;
+  layout.data_type = cfg.model.kv_cache_type;
+  const int d_head = cfg.model.hidden_size / cfg.model.num_attention_heads;
+  if (layout.is_block_quantized() && d_head % kBlockSize != 0)
+    throw std::runtime_error("Quantized KV cache requires head dimension to be a multiple of 32");
+
+  layout._n_layers = cfg.model.n_layers;
+  layout._n_head = cfg.model.num_attention_heads;
+  layout._d_head = d_head;
+  layout._cache_size = cache_size;
+  layout._rope_theta = cfg.model.rope_theta;
+  layout._n_slots = slots.size();
+
+  // Allocate one arena for K and V caches of all layers and slots
+  // Total: n_layers * 2 layer caches of all slots, each aligned to kAlignment
+  layout._layer_size = layout.bytes_of(static_cast<size_t>(cfg.model.hidden_size)) * cache_size;
+  const size_t batch_layer_size = layout.batch_layer_size();
+  layout._layer_stride = (batch_layer_size + kAlignment - 1) / kAlignment * kAlignment;
+  const size_t arena_size = layout._layer_stride * 2 * layout._n_layers;
+  layout._arena = std::make_shared<std::vector<uint8_t>>(arena_size + kAlignment, 0);
+
+  void *base = layout._arena->data();
+  size_t space = layout._arena->size();
+  auto aligned = static_cast<uint8_t *>(std::align(kAlignment, arena_size, base, space));
+  if (aligned == nullptr)
+    throw std::runtime_error("Failed to align KV cache arena");
+
+  for (size_t slot = 0; slot < slots.size(); ++slot)
+  {
+    KVCache &cache = slots[slot];
+    cache = layout;
+    cache._base = aligned + slot * layout._layer_size;
+    if (cache.is_block_quantized())
+      cache._staging.assign(static_cast<size_t>(cfg.model.hidden_size) * cache_size * 2 *
+                              cache._n_layers,
+                            0.0f);
+  }
+}
+
+uint8_t *KVCache::prefill_cache(int index)
 {
-  if (perm == nullptr || strcmp(perm, "0213") != 0)
-    throw std::runtime_error("Only \"0213\" permutation is supported");
+  if (!is_block_quantized())
+    return _base + index * _layer_stride;
+  return reinterpret_cast<uint8_t *>(_staging.data()) + index * prefill_layer_size();
+}
 
-  std::vector<std::vector<uint8_t>> &cache_vector = is_k_cache ? k : v;
-  const size_t element_bytes = element_size();
-  const size_t head_bytes = head_dim * element_bytes;
+size_t KVCache::prefill_layer_size() const
+{
+  if (!is_block_quantized())
+    return _layer_size;
+  return static_cast<size_t>(_n_head) * _d_head * _cache_size * sizeof(float);
+}
+
+NNFW_TYPE KVCache::prefill_nnfw_type() const
+{
+  return is_block_quantized() ? NNFW_TYPE_TENSOR_FLOAT32 : to_nnfw_type();
+}
+
+void KVCache::arrange_prefill(size_t n_tokens)
+{
+  if (n_tokens > static_cast<size_t>(_cache_size))
+    throw std::runtime_error("Number of prefilled tokens exceeds cache size");
 
-  for (size_t i = 0; i < cache_vector.size(); ++i)
+  if (is_block_quantized())
   {
-    std::vector<uint8_t> transposed_cache = cache_vector[i];
-    uint8_t *input_data = cache_vector[i].data();
-    uint8_t *output_data = transposed_cache.data();
+    // [n_head, cache_size, d_head] floats -> quantized rows of [n_head, d_head]
+    // Blocks do not cross heads as d_head is a multiple of kBlockSize.
+    const int n_row = _n_head * _d_head;
+    std::vector<float> row(n_row);
+    for (int index = 0; index < 2 * _n_layers; ++index)
+    {
+      const float *src = reinterpret_cast<const float *>(prefill_cache(index));
+      uint8_t *dst = _base + index * _layer_stride;
+      for (size_t s = 0; s < n_tokens; ++s)
+      {
+        for (int h = 0; h < _n_head; ++h)
+          memcpy(row.data() + h * _d_head, src + (h * _cache_size + s) * _d_head,
+                 _d_head * sizeof(float));
+        if (data_type == KVCacheDataType::Q8_0)
+          nnfw::cker::QuantizeRow(row.data(),
+                                  reinterpret_cast<nnfw::cker::BlockQ8_0 *>(dst + s * row_size()),
+                                  n_row);
+        else
+          nnfw::cker::QuantizeRow(row.data(),
+                                  reinterpret_cast<nnfw::cker::BlockQ4_0 *>(dst + s * row_size()),
+                                  n_row);
+      }
+    }
+    return;
+  }
+
+  // [n_head, cache_size, d_head] -> [cache_size, n_head, d_head] for the first n_tokens
+  const size_t head_bytes = bytes_of(_d_head);
+  const size_t row_bytes = _n_head * head_bytes;
+  _scratch.resize(n_tokens * row_bytes);
 
-    for (size_t s = 0; s < seq_len; ++s) // seq_len
+  for (int layer = 0; layer < _n_layers; ++layer)
+  {
+    for (uint8_t *cache : {k(layer), v(layer)})
     {
-      for (size_t h = 0; h < num_heads; ++h) // num_heads
+      for (int h = 0; h < _n_head; ++h)
       {
-        // source offset: s * (num_heads * head_bytes) + h * head_bytes
-        // target offset: h * (seq_len * head_bytes) + s * head_bytes
-        uint8_t *src_ptr = input_data + s * (num_heads * head_bytes) + h * head_bytes;
-        uint8_t *dst_ptr = output_data + h * (seq_len * head_bytes) + s * head_bytes;
-        memcpy(dst_ptr, src_ptr, head_bytes);
+        const uint8_t *src = cache + h * (_cache_size * head_bytes);
+        for (size_t s = 0; s < n_tokens; ++s)
+          memcpy(_scratch.data() + s * row_bytes + h * head_bytes, src + s * head_bytes,
+                 head_bytes);
       }
+      memcpy(cache, _scratch.data(), _scratch.size());
     }
+  }
+}
+
+void KVCache::shift(size_t n_keep, size_t n_discard)
+{
+  if (n_discard == 0)
+    return;
+  if (n_keep + n_discard > static_cast<size_t>(_pos))
+    throw std::runtime_error("Cannot discard more positions than cached");
+  if (data_type != KVCacheDataType::FLOAT32)
+    throw std::runtime_error("KV cache shift supports FLOAT32 only");
+
+  const size_t row_bytes = row_size();
+  const size_t n_move = _pos - n_keep - n_discard;
+
+  // RoPE (GPT-NeoX style) rotates pairs (x[i], x[i + d_head / 2]) by pos * theta^(-2i / d_head).
+  // Rotating by -n_discard positions moves the kept keys to their new positions.
+  const int half = _d_head / 2;
+  std::vector<float> cos_table(half);
+  std::vector<float> sin_table(half);
+  for (int i = 0; i < half; ++i)
+  {
+    const double inv_freq = std::pow(static_cast<double>(_rope_theta), -2.0 * i / _d_head);
+    const double angle = -static_cast<double>(n_discard) * inv_freq;
+    cos_table[i] = static_cast<float>(std::cos(angle));
+    sin_table[i] = static_cast<float>(std::sin(angle));
+  }
 
-    cache_vector[i] = std::move(transposed_cache);
+  for (int layer = 0; layer < _n_layers; ++layer)
+  {
+    uint8_t *k_cache = k(layer);
+    uint8_t *v_cache = v(layer);
+    memmove(k_cache + n_keep * row_bytes, k_cache + (n_keep + n_discard) * row_bytes,
+            n_move * row_bytes);
+    memmove(v_cache + n_keep * row_bytes, v_cache + (n_keep + n_discard) * row_bytes,
+            n_move * row_bytes);
+
+    float *moved = reinterpret_cast<float *>(k_cache + n_keep * row_bytes);
+    for (size_t r = 0; r < n_move * _n_head; ++r)
+    {
+      float *x = moved + r * _d_head;
+      for (int i = 0; i < half; ++i)
+      {
+        const float x0 = x[i];
+        const float x1 = x[i + half];
+        x[i] = x0 * cos_table[i] - x1 * sin_table[i];
+        x[i + half] = x0 * sin_table[i] + x1 * cos_table[i];
+      }
+    }
   }
+
+  _pos -= n_discard;
 }
 
-void KVCache::init(const ggma::GGMAConfig &cfg, int cache_size)
+void KVCache::save_prefix(size_t n_rows, uint8_t *dst) const
 {
-  if (cfg.model.n_layers <= 0)
-    throw std::runtime_error("n_layers not properly initialized");
+  const size_t bytes = n_rows * row_size();
+  if (bytes > _layer_size)
+    throw std::runtime_error("Prefix exceeds cache size");
 
-  // Set KV cache data type from config
-  data_type = cfg.kv_cache_type;
+  for (int layer = 0; layer < _n_layers; ++layer)
+  {
+    memcpy(dst, k(layer), bytes);
+    memcpy(dst + bytes, v(layer), bytes);
+    dst += 2 * bytes;
+  }
+}
 
-  // Allocate space for K and V caches for each layer
-  // Total: n_layers * 2 vectors (K and V for each layer)
-  k.resize(cfg.model.n_layers);
-  v.resize(cfg.model.n_layers);
+void KVCache::load_prefix(size_t n_rows, const uint8_t *src, size_t src_rows)
+{
+  const size_t bytes = n_rows * row_size();
+  const size_t src_bytes = src_rows * row_size();
+  if (n_rows > src_rows || bytes > _layer_size)
+    throw std::runtime_error("Prefix exceeds cache size");
 
-  for (int i = 0; i < cfg.model.n_layers; ++i)
+  for (int layer = 0; layer < _n_layers; ++layer)
   {
-    size_t buffer_size = cfg.model.hidden_size * cache_size * element_size();
-    k[i].resize(buffer_size, 0);
-    v[i].resize(buffer_size, 0);
+    memcpy(k(layer), src, bytes);
+    memcpy(v(layer), src + src_bytes, bytes);
+    src += 2 * src_bytes;
   }
 }
 
@@ -20,6 +20,7 @@
 #include "nnfw.h"
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -36,28 +37,47 @@ namespace ggma
 enum class KVCacheDataType
 {
   FLOAT32,
-  UINT8
+  UINT8,
+  Q8_0, // ggml Q8_0 blocks of 32 elements along d_head (34 bytes per block)
+  Q4_0  // ggml Q4_0 blocks of 32 elements along d_head (18 bytes per block)
 };
 
 // Structure to hold Key-Value cache data
+//
+// K and V caches of all layers live in one contiguous arena, laid out as
+//
+//   [ k0 | v0 | k1 | v1 | ... | k{n-1} | v{n-1} ]
+//
+// where each layer cache is aligned to KVCache::kAlignment and has the layout
+// that the decoder expects, i.e. [cache_size, n_head, d_head].
+//
+// Caches of several sequences made by init_slots() share one arena, where each layer
+// cache is followed by those of the other slots, i.e. [n_slots, cache_size, n_head, d_head],
+// as a decoder taking the sequences in one batch expects.
 struct KVCache
 {
-  KVCacheDataType data_type;           // Data type for KV cache
-  std::vector<std::vector<uint8_t>> k; // Key caches for each layer (raw byte storage)
-  std::vector<std::vector<uint8_t>> v; // Value caches for each layer (raw byte storage)
-  int64_t _pos = 0;                    // Current position in KV cache
+  static constexpr size_t kAlignment = 64;
 
-  // Get element size in bytes based on data type
-  size_t element_size() const
+  KVCacheDataType data_type; // Data type for KV cache
+  int64_t _pos = 0;          // Current position in KV cache
+
+  // Get size in bytes of n_elements elements based on data type
+  // Block quantized types require n_elements to be a multiple of kBlockSize.
+  static constexpr size_t kBlockSize = 32;
+  size_t bytes_of(size_t n_elements) const
   {
     switch (data_type)
     {
       case KVCacheDataType::FLOAT32:
-        return sizeof(float);
+        return n_elements * sizeof(float);
       case KVCacheDataType::UINT8:
-        return 1;
+        return n_elements;
+      case KVCacheDataType::Q8_0:
+        return n_elements / kBlockSize * (sizeof(uint16_t) + kBlockSize);
+      case KVCacheDataType::Q4_0:
+        return n_elements / kBlockSize * (sizeof(uint16_t) + kBlockSize / 2);
       default:
-        return sizeof(float);
+        return n_elements * sizeof(float);
     }
   }
 
@@ -70,43 +90,108 @@ struct KVCache
         return NNFW_TYPE_TENSOR_FLOAT32;
       case KVCacheDataType::UINT8:
         return NNFW_TYPE_TENSOR_UINT8;
+      case KVCacheDataType::Q8_0:
+      case KVCacheDataType::Q4_0:
+        // No API type for ggml blocks. Cache buffers are bound as raw bytes.
+        return NNFW_TYPE_TENSOR_UINT8;
       default:
         return NNFW_TYPE_TENSOR_FLOAT32;
     }
   }
 
-  // Check if KV cache is valid (properly initialized)
-  bool is_valid() const
+  // Whether the cache holds ggml blocks, which prefill does not produce
+  bool is_block_quantized() const
   {
-    if (k.size() != v.size())
-      return false;
+    return data_type == KVCacheDataType::Q8_0 || data_type == KVCacheDataType::Q4_0;
+  }
 
-    for (size_t i = 0; i < k.size(); ++i)
-      if (k[i].size() != v[i].size())
-        return false;
+  // Check if KV cache is valid (properly initialized)
+  bool is_valid() const { return _base != nullptr && _n_layers > 0; }
 
-    return true;
-  }
+  // Layer cache access
+  int n_layers() const { return _n_layers; }
+  size_t layer_size() const { return _layer_size; }
+  size_t row_size() const { return _layer_size / _cache_size; } // Bytes of one position
+  uint8_t *k(int layer) const { return _base + (2 * layer) * _layer_stride; }
+  uint8_t *v(int layer) const { return _base + (2 * layer + 1) * _layer_stride; }
+
+  // Layer caches of all slots sharing the arena, starting at k(layer) and v(layer) of slot 0
+  size_t batch_layer_size() const { return _n_slots * _layer_size; }
 
   // Position management methods
   int64_t pos() const { return _pos; }
-  void set_pos(int pos) { _pos = pos; }
+  void set_pos(int64_t pos) { _pos = pos; }
   void reset_pos() { _pos = 0; }
   void advance_pos() { _pos++; }
+  int64_t capacity() const { return _cache_size; }
+  bool is_full() const { return _pos >= _cache_size; }
 
   // Initialize KV cache
   void init(const ggma::GGMAConfig &cfg, int cache_size);
 
+  // Initialize caches of all slots in one arena, laid out for a batched decoder
+  static void init_slots(const ggma::GGMAConfig &cfg, int cache_size,
+                         std::vector<KVCache> &slots);
+
+  // Layer caches prefill writes to, and their size and type
+  //
+  // Prefill produces float K and V. For block quantized caches they are written to a float
+  // staging buffer, as large as a float cache, which arrange_prefill() quantizes into the cache.
+  uint8_t *prefill_k(int layer) { return prefill_cache(2 * layer); }
+  uint8_t *prefill_v(int layer) { return prefill_cache(2 * layer + 1); }
+  size_t prefill_layer_size() const;
+  NNFW_TYPE prefill_nnfw_type() const;
+
+  /**
+   * @brief Rearrange caches written by prefill into the decoder layout
+   *
+   * Prefill writes each layer cache as [n_head, cache_size, d_head] while decoder reads
+   * [cache_size, n_head, d_head]. Only the first @p n_tokens positions hold valid data,
+   * so only those are moved, in place, through one scratch buffer shared by all layers.
+   * Block quantized caches are filled by quantizing rows of the staging buffer instead.
+   *
+   * @param n_tokens Number of valid positions written by prefill
+   */
+  void arrange_prefill(size_t n_tokens);
+
+  /**
+   * @brief Slide the cache window to make room for new positions
+   *
+   * Positions [n_keep, n_keep + n_discard) are dropped and later positions are moved
+   * down. Moved keys are rotated back by n_discard positions so that RoPE distances
+   * to new queries remain correct.
+   *
+   * @param n_keep    Number of leading positions to keep (e.g. BOS)
+   * @param n_discard Number of positions to drop after @p n_keep
+   */
+  void shift(size_t n_keep, size_t n_discard);
+
   /**
-   * @brief Transpose cache with "0213" permutation [0,2,1,3]
-   * @param is_k_cache true for K cache, false for V cache
-   * @param perm Permutation string (must be "0213")
-   * @param seq_len Sequence length dimension
-   * @param num_heads Number of attention heads
-   * @param head_dim Head dimension
+   * @brief Copy first @p n_rows positions of all layer caches to/from a flat buffer
+   *
+   * The buffer holds K and V of each layer in order, n_rows * row_size() bytes each.
+   * load_prefix() may load fewer rows than saved, given @p src_rows rows were saved.
    */
-  void transpose(bool is_k_cache, const char *perm, size_t seq_len, size_t num_heads,
-                 size_t head_dim);
+  void save_prefix(size_t n_rows, uint8_t *dst) const;
+  void load_prefix(size_t n_rows, const uint8_t *src, size_t src_rows);
+
+private:
+  uint8_t *prefill_cache(int index);
+
+private:
+  int _n_layers = 0;
+  int _n_head = 0;
+  int _d_head = 0;
+  int64_t _cache_size = 0;
+  float _rope_theta = 0;
+
+  size_t _layer_size = 0;   // Bytes of one layer cache
+  size_t _layer_stride = 0; // Distance between two layer caches (aligned)
+  size_t _n_slots = 1;      // Number of slots sharing the arena
+  std::shared_ptr<std::vector<uint8_t>> _arena;
+  uint8_t *_base = nullptr; // Start of the caches of this slot in _arena
+  std::vector<uint8_t> _scratch;
+  std::vector<float> _staging; // Float layer caches written by prefill, if block quantized
 };
 
 // Utility functions for KVCacheDataType
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PrefixCache.h"
+
+#include <algorithm>
+
+namespace ggma
+{
+
+// FNV-1a over token ids
+uint64_t PrefixCache::hash(const ggma_token *tokens, size_t n_tokens)
+{
+  uint64_t h = 14695981039346656037ULL;
+  for (size_t i = 0; i < n_tokens; ++i)
+  {
+    h ^= static_cast<uint32_t>(tokens[i]);
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+void PrefixCache::set_budget(size_t budget)
+{
+  _budget = budget;
+  evict(0);
+}
+
+size_t PrefixCache::restore(const ggma_token *tokens, size_t n_tokens, KVCache &cache,
+                            std::vector<float> &logits, size_t max_remaining)
+{
+  if (_entries.empty() || n_tokens == 0)
+    return 0;
+
+  // Fast path: the whole prompt is cached
+  auto best = _entries.end();
+  size_t best_len = 0;
+  auto found = _index.find(hash(tokens, n_tokens));
+  if (found != _index.end() && found->second->tokens.size() == n_tokens &&
+      std::equal(tokens, tokens + n_tokens, found->second->tokens.begin()))
+  {
+    best = found->second;
+    best_len = n_tokens;
+  }
+  else
+  {
+    for (auto it = _entries.begin(); it != _entries.end(); ++it)
+    {
+      const size_t max_len = std::min(n_tokens, it->tokens.size());
+      const size_t len =
+        std::mismatch(tokens, tokens + max_len, it->tokens.begin()).first - tokens;
+      if (len > best_len)
+      {
+        best = it;
+        best_len = len;
+      }
+    }
+  }
+
+  if (best_len == 0)
+    return 0;
+
+  // Logits are kept for the last token of a snapshot only.
+  // Without them, leave at least one token to be processed to obtain logits.
+  const bool has_logits = best_len == best->tokens.size();
+  if (best_len == n_tokens && !has_logits)
+    --best_len;
+  if (best_len == 0 || n_tokens - best_len > max_remaining)
+    return 0;
+
+  cache.load_prefix(best_len, best->kv.data(), best->tokens.size());
+  if (best_len == n_tokens)
+    logits = best->logits;
+
+  // Mark as most recently used
+  _entries.splice(_entries.begin(), _entries, best);
+  return best_len;
+}
+
+void PrefixCache::store(const ggma_token *tokens, size_t n_tokens, const KVCache &cache,
+                        const float *last_logits, size_t vocab_size)
+{
+  if (_budget == 0 || n_tokens == 0)
+    return;
+
+  const uint64_t h = hash(tokens, n_tokens);
+  auto found = _index.find(h);
+  if (found != _index.end())
+  {
+    // Same prompt is cached already, or a hash collision which is replaced
+    _used -= found->second->bytes();
+    _entries.erase(found->second);
+    _index.erase(found);
+  }
+
+  const size_t kv_bytes = 2 * cache.n_layers() * n_tokens * cache.row_size();
+  const size_t bytes = n_tokens * sizeof(ggma_token) + kv_bytes + vocab_size * sizeof(float);
+  if (bytes > _budget)
+    return;
+  evict(bytes);
+
+  Entry entry;
+  entry.hash = h;
+  entry.tokens.assign(tokens, tokens + n_tokens);
+  entry.kv.resize(kv_bytes);
+  cache.save_prefix(n_tokens, entry.kv.data());
+  entry.logits.assign(last_logits, last_logits + vocab_size);
+
+  _entries.push_front(std::move(entry));
+  _index[h] = _entries.begin();
+  _used += bytes;
+}
+
+// Drop least recently used snapshots until needed bytes fit in the budget
+void PrefixCache::evict(size_t needed)
+{
+  while (!_entries.empty() && _used + needed > _budget)
+  {
+    const Entry &lru = _entries.back();
+    _used -= lru.bytes();
+    _index.erase(lru.hash);
+    _entries.pop_back();
+  }
+}
+
+} // namespace ggma
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __GGMA_PREFIX_CACHE_H__
+#define __GGMA_PREFIX_CACHE_H__
+
+#include "ggma_types.h"
+#include "KVCache.h"
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace ggma
+{
+
+/**
+ * @brief LRU cache of KV cache snapshots taken after processing prompts
+ *
+ * A later prompt resumes from the longest cached prefix it shares with any snapshot.
+ * When the whole prompt is cached, the logits of its last token are restored as well,
+ * so that no model run is needed before sampling.
+ */
+class PrefixCache
+{
+public:
+  /**
+   * @param budget Maximum bytes of all snapshots, 0 to disable caching
+   */
+  explicit PrefixCache(size_t budget = 0) : _budget(budget) {}
+
+  void set_budget(size_t budget);
+
+  /**
+   * @brief Restore the longest cached prefix of @p tokens into @p cache
+   * @param max_remaining Maximum number of tokens the caller can process after a prefix.
+   *                      A prefix leaving more tokens is not restored.
+   * @return Number of restored positions. If it equals @p n_tokens,
+   *         @p logits holds logits of the last token.
+   */
+  size_t restore(const ggma_token *tokens, size_t n_tokens, KVCache &cache,
+                 std::vector<float> &logits, size_t max_remaining = SIZE_MAX);
+
+  /**
+   * @brief Snapshot first @p n_tokens positions of @p cache with logits of the last token
+   */
+  void store(const ggma_token *tokens, size_t n_tokens, const KVCache &cache,
+             const float *last_logits, size_t vocab_size);
+
+  size_t size() const { return _used; }
+
+private:
+  struct Entry
+  {
+    uint64_t hash;
+    std::vector<ggma_token> tokens;
+    std::vector<uint8_t> kv;
+    std::vector<float> logits;
+
+    size_t bytes() const
+    {
+      return tokens.size() * sizeof(ggma_token) + kv.size() + logits.size() * sizeof(float);
+    }
+  };
+
+  static uint64_t hash(const ggma_token *tokens, size_t n_tokens);
+  void evict(size_t needed);
+
+private:
+  size_t _budget;
+  size_t _used = 0;
+  std::list<Entry> _entries; // Most recently used first
+  std::unordered_map<uint64_t, std::list<Entry>::iterator> _index;
+};
+
+} // namespace ggma
+
+#endif // __GGMA_PREFIX_CACHE_H__
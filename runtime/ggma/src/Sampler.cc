@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Sampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+namespace ggma
+{
+
+void Sampler::configure(const SamplingConfig &cfg)
+{
+  _cfg = cfg;
+  _rng.seed(static_cast<uint32_t>(cfg.seed));
+}
+
+ggma_token Sampler::sample(float *logits, size_t vocab_size, const ggma_token *history,
+                           size_t n_history)
+{
+  if (vocab_size == 0)
+    throw std::runtime_error("Empty logits tensor");
+
+  apply_penalties(logits, vocab_size, history, n_history);
+
+  if (_cfg.is_greedy())
+    return std::distance(logits, std::max_element(logits, logits + vocab_size));
+
+  auto by_logit = [logits](int32_t a, int32_t b) { return logits[a] > logits[b]; };
+
+  // 1. Top-k: keep k largest logits without sorting them
+  _candidates.resize(vocab_size);
+  std::iota(_candidates.begin(), _candidates.end(), 0);
+  size_t n = vocab_size;
+  if (_cfg.top_k > 0 && static_cast<size_t>(_cfg.top_k) < n)
+  {
+    n = _cfg.top_k;
+    std::nth_element(_candidates.begin(), _candidates.begin() + n - 1, _candidates.end(),
+                     by_logit);
+  }
+
+  // 2. Temperature: probabilities are exp((logit - max) / temperature) / sum
+  const float inv_temp = 1.0f / _cfg.temperature;
+  float max_logit = logits[_candidates[0]];
+  for (size_t i = 1; i < n; ++i)
+    max_logit = std::max(max_logit, logits[_candidates[i]]);
+  auto weight = [&](int32_t token) { return std::exp((logits[token] - max_logit) * inv_temp); };
+
+  float sum = 0.0f;
+  for (size_t i = 0; i < n; ++i)
+    sum += weight(_candidates[i]);
+
+  // 3. Top-p: keep the most probable tokens covering top_p of probability mass
+  bool sorted = false;
+  if (_cfg.top_p < 1.0f)
+  {
+    n = select_top_p(logits, n, max_logit, inv_temp, sum);
+    sorted = true;
+  }
+
+  // 4. Min-p: keep tokens with probability >= min_p * (max probability)
+  //    As max probability has weight 1, the threshold on weight is min_p itself.
+  if (_cfg.min_p > 0.0f)
+  {
+    if (sorted)
+    {
+      size_t kept = 1;
+      while (kept < n && weight(_candidates[kept]) >= _cfg.min_p)
+        ++kept;
+      n = kept;
+    }
+    else
+    {
+      auto end = std::partition(_candidates.begin(), _candidates.begin() + n,
+                                [&](int32_t token) { return weight(token) >= _cfg.min_p; });
+      n = std::max<size_t>(1, std::distance(_candidates.begin(), end));
+    }
+  }
+
+  // 5. Draw from the remaining candidates
+  float kept_sum = 0.0f;
+  for (size_t i = 0; i < n; ++i)
+    kept_sum += weight(_candidates[i]);
+
+  std::uniform_real_distribution<float> dist(0.0f, kept_sum);
+  float r = dist(_rng);
+  for (size_t i = 0; i < n; ++i)
+  {
+    r -= weight(_candidates[i]);
+    if (r <= 0.0f)
+      return _candidates[i];
+  }
+  return _candidates[n - 1];
+}
+
+void Sampler::apply_penalties(float *logits, size_t vocab_size, const ggma_token *history,
+                              size_t n_history)
+{
+  if (history == nullptr || n_history == 0)
+    return;
+  if (_cfg.repetition_penalty == 1.0f && _cfg.presence_penalty == 0.0f)
+    return;
+
+  if (_seen.size() != vocab_size)
+  {
+    _seen.assign(vocab_size, 0);
+    _stamp = 0;
+  }
+  // Stamps avoid clearing the whole vocabulary-sized table on every step
+  if (++_stamp == 0)
+  {
+    std::fill(_seen.begin(), _seen.end(), 0);
+    _stamp = 1;
+  }
+
+  for (size_t i = 0; i < n_history; ++i)
+  {
+    const ggma_token token = history[i];
+    if (token < 0 || static_cast<size_t>(token) >= vocab_size || _seen[token] == _stamp)
+      continue;
+    _seen[token] = _stamp;
+
+    float &logit = logits[token];
+    logit = logit > 0.0f ? logit / _cfg.repetition_penalty : logit * _cfg.repetition_penalty;
+    logit -= _cfg.presence_penalty;
+  }
+}
+
+// Sort candidates by descending logit just enough to cover top_p of the mass.
+// The sorted prefix grows geometrically, so a peaked distribution touches few tokens.
+size_t Sampler::select_top_p(const float *logits, size_t n, float max_logit, float inv_temp,
+                             float sum)
+{
+  auto by_logit = [logits](int32_t a, int32_t b) { return logits[a] > logits[b]; };
+  const float threshold = _cfg.top_p * sum;
+
+  size_t k = std::min<size_t>(n, 64);
+  while (true)
+  {
+    std::partial_sort(_candidates.begin(), _candidates.begin() + k, _candidates.begin() + n,
+                      by_logit);
+
+    float cum = 0.0f;
+    for (size_t i = 0; i < k; ++i)
+    {
+      cum += std::exp((logits[_candidates[i]] - max_logit) * inv_temp);
+      if (cum >= threshold)
+        return i + 1;
+    }
+    if (k == n)
+      return n;
+    k = std::min(n, k * 4);
+  }
+}
+
+} // namespace ggma
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __GGMA_SAMPLER_H__
+#define __GGMA_SAMPLER_H__
+
+#include "ggma_types.h"
+#include "Config.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace ggma
+{
+
+/**
+ * @brief Token sampler applying penalties, temperature, top-k, top-p and min-p in order
+ *
+ * Candidates are narrowed by partial selection (std::nth_element, std::partial_sort)
+ * instead of sorting the whole vocabulary, and all scratch buffers are kept across calls.
+ */
+class Sampler
+{
+public:
+  void configure(const SamplingConfig &cfg);
+
+  /**
+   * @brief Sample next token
+   * @param logits     Logits of the last position, modified in place by penalties
+   * @param vocab_size Number of logits
+   * @param history    Tokens already in the sequence, used for penalties
+   * @param n_history  Number of tokens in @p history
+   */
+  ggma_token sample(float *logits, size_t vocab_size, const ggma_token *history, size_t n_history);
+
+private:
+  void apply_penalties(float *logits, size_t vocab_size, const ggma_token *history,
+                       size_t n_history);
+  size_t select_top_p(const float *logits, size_t n, float max_logit, float inv_temp, float sum);
+
+private:
+  SamplingConfig _cfg;
+  std::mt19937 _rng;
+  std::vector<int32_t> _candidates;
+  std::vector<uint32_t> _seen; // Stamp per token to penalize each token once
+  uint32_t _stamp = 0;
+};
+
+} // namespace ggma
+
+#endif // __GGMA_SAMPLER_H__
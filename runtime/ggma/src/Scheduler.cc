@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Config.h"
+#include "Context.h"
+#include "KVCache.h"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+namespace ggma
+{
+
+// Queue a sequence for generation
+//
+// Parameters:
+// - tokens: Prompt tokens (copied, caller may release after return)
+// - n_tokens: Number of prompt tokens
+// - n_predict: Maximum number of tokens to generate
+// - seq_id: Output id to collect the result with
+GGMA_STATUS Context::submit(const ggma_token *tokens, size_t n_tokens, size_t n_predict,
+                            ggma_seq_id *seq_id)
+{
+  try
+  {
+    if (n_tokens == 0 || n_tokens > static_cast<size_t>(_cfg.ubatch))
+      throw std::runtime_error("submit : prompt length must be in [1, ubatch]");
+
+    Sequence seq;
+    seq.n_prompt = n_tokens;
+    seq.n_predict = n_predict;
+    // prefill reads ubatch tokens, so keep the buffer padded at least to ubatch
+    seq.tokens.resize(std::max(n_tokens + n_predict, static_cast<size_t>(_cfg.ubatch)), 0);
+    std::copy(tokens, tokens + n_tokens, seq.tokens.begin());
+
+    *seq_id = _next_seq_id++;
+    _sequences.emplace(*seq_id, std::move(seq));
+    _waiting.push_back(*seq_id);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error in submit: " << e.what() << std::endl;
+    return GGMA_STATUS_ERROR;
+  }
+  return GGMA_STATUS_NO_ERROR;
+}
+
+// Run one scheduling step
+//
+// 1. Admit waiting sequences into free KV cache slots (prefill)
+// 2. Generate one token for every running sequence (sample, then decode)
+// 3. Release slots of finished sequences
+//
+// With decode_batch, sampled tokens of all slots are decoded in one run, so weights are read
+// once per step for all sequences. Without it, slots are decoded one after another.
+// A sequence whose prompt or decoding fails is finished as failed and reported by collect(),
+// so others keep running.
+//
+// n_remaining receives the number of running and waiting sequences after this step.
+GGMA_STATUS Context::step(size_t *n_remaining)
+{
+  try
+  {
+    if (_slots.empty())
+    {
+      if (_cfg.n_seq_max <= 0)
+        throw std::runtime_error("n_seq_max must be positive");
+      _slots.resize(_cfg.n_seq_max);
+      _slot_owner.assign(_cfg.n_seq_max, -1);
+      // decode_batch reads caches of all slots as one batch
+      if (_decode_batch_session)
+        KVCache::init_slots(_cfg, _cfg.cache_size, _slots);
+    }
+
+    for (size_t slot = 0; slot < _slots.size(); ++slot)
+    {
+      while (_slot_owner[slot] == -1 && !_waiting.empty())
+      {
+        // Dequeue first so that a failing prompt is not retried on every step
+        const ggma_seq_id seq_id = _waiting.front();
+        _waiting.pop_front();
+        try
+        {
+          admit(seq_id, slot);
+        }
+        catch (const std::exception &e)
+        {
+          std::cerr << "Error in step: sequence " << seq_id << ": " << e.what() << std::endl;
+          fail(_sequences.at(seq_id));
+        }
+      }
+    }
+
+    // Slots whose sequence sampled a token to decode
+    std::vector<int> decoding;
+    for (size_t slot = 0; slot < _slots.size(); ++slot)
+    {
+      if (_slot_owner[slot] == -1)
+        continue;
+
+      Sequence &seq = _sequences.at(_slot_owner[slot]);
+      try
+      {
+        if (advance(seq))
+          decoding.push_back(slot);
+      }
+      catch (const std::exception &e)
+      {
+        std::cerr << "Error in step: sequence " << _slot_owner[slot] << ": " << e.what()
+                  << std::endl;
+        fail(seq);
+      }
+    }
+
+    if (_decode_batch_session && !decoding.empty())
+    {
+      try
+      {
+        decode_batch(decoding);
+      }
+      catch (const std::exception &e)
+      {
+        std::cerr << "Error in step: batched decoding: " << e.what() << std::endl;
+        for (const int slot : decoding)
+          fail(_sequences.at(_slot_owner[slot]));
+      }
+    }
+    else
+    {
+      for (const int slot : decoding)
+      {
+        Sequence &seq = _sequences.at(_slot_owner[slot]);
+        try
+        {
+          decode(_slots[slot], seq.tokens[seq.n_prompt + seq.n_generated - 1], seq.hidden);
+          unemb(seq.hidden, 1, seq.logits);
+        }
+        catch (const std::exception &e)
+        {
+          std::cerr << "Error in step: sequence " << _slot_owner[slot] << ": " << e.what()
+                    << std::endl;
+          fail(seq);
+        }
+      }
+    }
+
+    size_t n_running = 0;
+    for (size_t slot = 0; slot < _slots.size(); ++slot)
+    {
+      if (_slot_owner[slot] == -1)
+        continue;
+
+      Sequence &seq = _sequences.at(_slot_owner[slot]);
+      if (seq.done)
+      {
+        seq.slot = -1;
+        seq.hidden.clear();
+        seq.logits.clear();
+        _slot_owner[slot] = -1;
+      }
+      else
+        ++n_running;
+    }
+
+    *n_remaining = n_running + _waiting.size();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error in step: " << e.what() << std::endl;
+    return GGMA_STATUS_ERROR;
+  }
+  return GGMA_STATUS_NO_ERROR;
+}
+
+// Copy prompt and generated tokens of a finished sequence and forget it
+// A failed sequence is forgotten as well, returning an error.
+GGMA_STATUS Context::collect(ggma_seq_id seq_id, ggma_token *tokens, size_t n_tokens_max,
+                             size_t *n_tokens_out)
+{
+  auto it = _sequences.find(seq_id);
+  if (it == _sequences.end())
+  {
+    std::cerr << "Error in collect: unknown sequence " << seq_id << std::endl;
+    return GGMA_STATUS_ERROR;
+  }
+
+  const Sequence &seq = it->second;
+  if (!seq.done)
+    return GGMA_STATUS_INVALID_STATE;
+  if (seq.failed)
+  {
+    std::cerr << "Error in collect: sequence " << seq_id << " failed" << std::endl;
+    _sequences.erase(it);
+    return GGMA_STATUS_ERROR;
+  }
+
+  const size_t n_tokens = seq.n_prompt + seq.n_generated;
+  if (n_tokens > n_tokens_max)
+  {
+    std::cerr << "Error in collect: output buffer is too small" << std::endl;
+    return GGMA_STATUS_ERROR;
+  }
+
+  std::copy(seq.tokens.begin(), seq.tokens.begin() + n_tokens, tokens);
+  *n_tokens_out = n_tokens;
+  _sequences.erase(it);
+  return GGMA_STATUS_NO_ERROR;
+}
+
+// Bind a waiting sequence to a KV cache slot and process its prompt
+void Context::admit(ggma_seq_id seq_id, int slot)
+{
+  Sequence &seq = _sequences.at(seq_id);
+  KVCache &cache = _slots[slot];
+  if (!cache.is_valid())
+    cache.init(_cfg, _cfg.cache_size);
+
+  process_prompt(cache, seq.tokens.data(), seq.n_prompt, seq.hidden, seq.logits);
+
+  seq.slot = slot;
+  _slot_owner[slot] = seq_id;
+}
+
+// Finish a sequence whose prompt or decoding failed
+void Context::fail(Sequence &seq)
+{
+  seq.failed = true;
+  seq.done = true;
+}
+
+// Sample one token for a running sequence
+// Returns true if the token is to be decoded for the next one, after making room for it.
+bool Context::advance(Sequence &seq)
+{
+  if (seq.n_generated >= seq.n_predict)
+  {
+    seq.done = true;
+    return false;
+  }
+
+  ggma_token new_token = sample(seq.logits, seq.tokens.data(), seq.n_prompt + seq.n_generated);
+  seq.tokens[seq.n_prompt + seq.n_generated] = new_token;
+
+  // Stop if we hit an EOS or padding token.
+  if (new_token == _cfg.model.eos_token_id.value_or(-1) || new_token == 0)
+  {
+    seq.done = true;
+    return false;
+  }
+  ++seq.n_generated;
+
+  if (seq.n_generated >= seq.n_predict)
+  {
+    seq.done = true;
+    return false;
+  }
+
+  slide_window(_slots[seq.slot]);
+  return true;
+}
+
+} // namespace ggma
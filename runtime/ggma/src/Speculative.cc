@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Config.h"
+#include "Context.h"
+#include "KVCache.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace ggma
+{
+
+// Generate tokens by speculative decoding
+//
+// Expects the prompt to be prefilled in the target cache and its logits in _logits.
+// Each step,
+// 1. the draft model proposes up to n_draft tokens after the last generated token,
+// 2. the target decode graph runs once over the last token and all proposals,
+// 3. proposals are accepted while they are equal to the tokens sampled from the target,
+//    and the first rejected proposal is replaced by the target's token,
+// 4. both KV caches are rolled back to the accepted prefix.
+//
+// Every emitted token is sampled from the target, so the output follows the target model.
+// As the target decode graph takes a fixed number of tokens per run, at most that number
+// minus one tokens are proposed per step. The draft is not loaded for single-token graphs.
+//
+// Returns the number of generated tokens.
+size_t Context::generate_speculative(ggma_token *tokens, size_t n_tokens, size_t n_predict,
+                                     ggma_token_callback callback, void *user_data)
+{
+  if (n_predict == 0)
+    return 0;
+
+  Context &draft = *_draft;
+
+  // Prefill the draft model with the same prompt.
+  draft._cache.reset_pos();
+  draft.prefill(draft._cache, tokens, n_tokens, draft._hidden);
+  draft._cache.set_pos(n_tokens);
+  draft._cache.arrange_prefill(n_tokens);
+
+  size_t n_generated = 0;
+  bool stop = false;
+
+  // Emit a token sampled from the target. Returns false when generation should stop.
+  auto emit = [&](ggma_token token) {
+    tokens[n_tokens + n_generated] = token;
+
+    // Stop if we hit an EOS or padding token.
+    if (token == _cfg.model.eos_token_id.value_or(-1) || token == 0)
+      return false;
+    ++n_generated;
+
+    // Report the token and stop if the caller cancels generation.
+    if (callback && callback(token, user_data) != 0)
+      return false;
+
+    return n_generated < n_predict;
+  };
+
+  const size_t n_draft_max = std::min<size_t>(std::max(0, _cfg.n_draft), _decode_n_tokens - 1);
+  std::vector<ggma_token> batch; // Last token followed by draft tokens
+  batch.reserve(n_draft_max + 1);
+
+  ggma_token last = sample(_logits, tokens, n_tokens);
+  while (!stop && emit(last))
+  {
+    const size_t n_draft = std::min(n_draft_max, n_predict - n_generated);
+
+    // Make room for the last token and all proposals.
+    slide_window(_cache, n_draft + 1);
+    draft.slide_window(draft._cache, n_draft + 1);
+
+    // 1. Propose: the draft model consumes the last token and each of its own proposals.
+    batch.assign(1, last);
+    for (size_t i = 0; i < n_draft; ++i)
+    {
+      draft.decode(draft._cache, batch.back(), draft._hidden);
+      draft.unemb(draft._hidden, 1, draft._logits);
+      batch.push_back(draft.sample(draft._logits, nullptr, 0));
+    }
+
+    // 2. Verify: one target run over the last token and all proposals.
+    //    Row i of logits predicts the token after batch[i].
+    const int64_t target_base = _cache.pos();
+    const int64_t draft_base = draft._cache.pos() - n_draft;
+    decode(_cache, batch.data(), batch.size(), _hidden);
+    unemb(_hidden, batch.size(), _logits);
+
+    // 3. Accept proposals matching the target, then take the target's token.
+    size_t n_accepted = 0;
+    while (true)
+    {
+      const ggma_token target_token =
+        sample(_logits, n_accepted, tokens, n_tokens + n_generated);
+      if (n_accepted < n_draft && target_token == batch[n_accepted + 1])
+      {
+        ++n_accepted;
+        if (!emit(target_token))
+        {
+          stop = true;
+          break;
+        }
+        continue;
+      }
+      last = target_token;
+      break;
+    }
+    if (stop)
+      break;
+
+    // 4. Roll back to the last token and accepted proposals.
+    //    The draft has not consumed its last proposal, so catch it up if all are accepted.
+    _cache.set_pos(target_base + 1 + n_accepted);
+    if (n_accepted == n_draft && n_draft > 0)
+      draft.decode(draft._cache, batch.back(), draft._hidden);
+    draft._cache.set_pos(draft_base + 1 + n_accepted);
+  }
+
+  return n_generated;
+}
+
+} // namespace ggma
@@ -26,3 +26,39 @@ GGMA_STATUS ggma_generate(ggma_context *context, ggma_token *tokens, size_t n_to
   return reinterpret_cast<ggma::Context *>(context)->generate(tokens, n_tokens, n_tokens_max,
                                                               n_tokens_out);
 }
+
+GGMA_STATUS ggma_generate_stream(ggma_context *context, ggma_token *tokens, size_t n_tokens,
+                                 size_t n_tokens_max, size_t *n_tokens_out,
+                                 ggma_token_callback callback, void *user_data)
+{
+  GGMA_RETURN_ERROR_IF_NULL(context);
+  GGMA_RETURN_ERROR_IF_NULL(callback);
+  return reinterpret_cast<ggma::Context *>(context)->generate(tokens, n_tokens, n_tokens_max,
+                                                              n_tokens_out, callback, user_data);
+}
+
+GGMA_STATUS ggma_submit(ggma_context *context, const ggma_token *tokens, size_t n_tokens,
+                        size_t n_predict, ggma_seq_id *seq_id)
+{
+  GGMA_RETURN_ERROR_IF_NULL(context);
+  GGMA_RETURN_ERROR_IF_NULL(tokens);
+  GGMA_RETURN_ERROR_IF_NULL(seq_id);
+  return reinterpret_cast<ggma::Context *>(context)->submit(tokens, n_tokens, n_predict, seq_id);
+}
+
+GGMA_STATUS ggma_step(ggma_context *context, size_t *n_remaining)
+{
+  GGMA_RETURN_ERROR_IF_NULL(context);
+  GGMA_RETURN_ERROR_IF_NULL(n_remaining);
+  return reinterpret_cast<ggma::Context *>(context)->step(n_remaining);
+}
+
+GGMA_STATUS ggma_collect(ggma_context *context, ggma_seq_id seq_id, ggma_token *tokens,
+                         size_t n_tokens_max, size_t *n_tokens_out)
+{
+  GGMA_RETURN_ERROR_IF_NULL(context);
+  GGMA_RETURN_ERROR_IF_NULL(tokens);
+  GGMA_RETURN_ERROR_IF_NULL(n_tokens_out);
+  return reinterpret_cast<ggma::Context *>(context)->collect(seq_id, tokens, n_tokens_max,
+                                                             n_tokens_out);
+}
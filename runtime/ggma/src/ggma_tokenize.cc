@@ -94,4 +94,42 @@ GGMA_STATUS ggma_detokenize(const ggma_tokenizer *tokenizer, const int32_t *toke
   }
 }
 
+GGMA_STATUS ggma_detokenize_next(const ggma_tokenizer *tokenizer, const int32_t *tokens,
+                                 size_t n_tokens, ggma_detokenize_state *state, char *text,
+                                 size_t text_len)
+{
+  if (!tokenizer || !tokens || !state || !text)
+    return GGMA_STATUS_UNEXPECTED_NULL;
+
+  try
+  {
+    auto impl = reinterpret_cast<const ggma::Tokenizer *>(tokenizer);
+    impl->detokenize_next(tokens, n_tokens, state, text, text_len);
+    return GGMA_STATUS_NO_ERROR;
+  }
+  catch (...)
+  {
+    return GGMA_STATUS_ERROR;
+  }
+}
+
+GGMA_STATUS ggma_detokenize_flush(const ggma_tokenizer *tokenizer, const int32_t *tokens,
+                                  size_t n_tokens, ggma_detokenize_state *state, char *text,
+                                  size_t text_len)
+{
+  if (!tokenizer || !tokens || !state || !text)
+    return GGMA_STATUS_UNEXPECTED_NULL;
+
+  try
+  {
+    auto impl = reinterpret_cast<const ggma::Tokenizer *>(tokenizer);
+    impl->detokenize_next(tokens, n_tokens, state, text, text_len, true);
+    return GGMA_STATUS_NO_ERROR;
+  }
+  catch (...)
+  {
+    return GGMA_STATUS_ERROR;
+  }
+}
+
 } // extern "C"
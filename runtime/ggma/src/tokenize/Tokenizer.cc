@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Tokenizer.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ggma
+{
+
+namespace
+{
+
+// Length of text which does not end in the middle of a UTF-8 character
+size_t complete_utf8_length(const std::string &text)
+{
+  // U+FFFD is emitted for byte tokens which do not form a character yet.
+  // It may be replaced by a real character once the following byte tokens arrive.
+  const char *replacement = "\xEF\xBF\xBD";
+  size_t len = text.size();
+  while (len >= 3 && text.compare(len - 3, 3, replacement) == 0)
+    len -= 3;
+
+  // Look back at most 3 bytes for the lead byte of the last character
+  for (size_t back = 1; back <= std::min<size_t>(4, len); ++back)
+  {
+    const auto c = static_cast<unsigned char>(text[len - back]);
+    if ((c & 0xC0) == 0x80) // continuation byte
+      continue;
+
+    size_t expected = 1;
+    if ((c & 0xE0) == 0xC0)
+      expected = 2;
+    else if ((c & 0xF0) == 0xE0)
+      expected = 3;
+    else if ((c & 0xF8) == 0xF0)
+      expected = 4;
+
+    return back < expected ? len - back : len;
+  }
+  return len;
+}
+
+} // namespace
+
+size_t Tokenizer::detokenize_next(const int32_t *tokens, size_t n_tokens,
+                                  ggma_detokenize_state *state, char *text, size_t text_len,
+                                  bool flush) const
+{
+  if (!state || !text || text_len == 0)
+    return 0;
+
+  text[0] = '\0';
+  if (!tokens || n_tokens <= state->read_offset)
+    return 0;
+
+  // Text of tokens after read_offset is the difference of decoding with and without them
+  const size_t n_context = state->read_offset - state->prefix_offset;
+  const std::string context = decode(tokens + state->prefix_offset, n_context);
+  const std::string decoded =
+    decode(tokens + state->prefix_offset, n_tokens - state->prefix_offset);
+  const std::string pending =
+    decoded.size() > context.size() ? decoded.substr(context.size()) : std::string{};
+  const size_t complete = flush ? pending.size() : complete_utf8_length(pending);
+
+  // Return as much as fits, stopping at a character boundary
+  size_t end = std::min(complete, state->n_written + text_len - 1);
+  if (end < complete)
+    end = complete_utf8_length(pending.substr(0, end));
+
+  size_t copy_len = 0;
+  if (end > state->n_written)
+  {
+    copy_len = end - state->n_written;
+    memcpy(text, pending.data() + state->n_written, copy_len);
+    text[copy_len] = '\0';
+    state->n_written = end;
+  }
+
+  // Tokens whose text is fully returned become the context of the following ones
+  if (state->n_written == pending.size())
+  {
+    state->prefix_offset = state->read_offset;
+    state->read_offset = n_tokens;
+    state->n_written = 0;
+  }
+  return copy_len;
+}
+
+} // namespace ggma
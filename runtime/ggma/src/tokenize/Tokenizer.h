@@ -17,6 +17,9 @@
 #ifndef __GGMA_TOKENIZE_TOKENIZER_H__
 #define __GGMA_TOKENIZE_TOKENIZER_H__
 
+#include "ggma_tokenize.h"
+
+#include <cstdint>
 #include <string>
 
 namespace ggma
@@ -31,6 +34,26 @@ public:
                           size_t *n_tokens) const = 0;
   virtual size_t detokenize(const int32_t *tokens, size_t n_tokens, char *text,
                             size_t text_len) const = 0;
+  virtual std::string decode(const int32_t *tokens, size_t n_tokens) const = 0;
+
+  /**
+   * @brief Detokenize text which is newly completed by the last tokens of a stream
+   *
+   * @param tokens   All tokens of the stream so far
+   * @param n_tokens Number of tokens in @p tokens
+   * @param state    In/out state of the stream, zero-initialized for a new stream
+   * @param text     Output buffer for new text, always null-terminated
+   * @param text_len Size of @p text in bytes
+   * @param flush    Whether to return held back bytes as well, at the end of the stream
+   * @return Number of bytes written to @p text
+   *
+   * Only tokens after the returned text are decoded, with the tokens of the last returned
+   * chunk in front of them, as tokenizers decode a token differently at the start of text.
+   * Trailing bytes of an incomplete UTF-8 character are held back until the tokens
+   * completing it arrive, so that every returned chunk is valid UTF-8 by itself.
+   */
+  size_t detokenize_next(const int32_t *tokens, size_t n_tokens, ggma_detokenize_state *state,
+                         char *text, size_t text_len, bool flush = false) const;
 
 protected:
   Tokenizer() = default; // Protected constructor to enforce factory pattern
@@ -32,6 +32,7 @@ public:
                   size_t *n_tokens) const override;
   size_t detokenize(const int32_t *tokens, size_t n_tokens, char *text,
                     size_t text_len) const override;
+  std::string decode(const int32_t *tokens, size_t n_tokens) const override;
 
 private:
   std::unique_ptr<::sentencepiece::SentencePieceProcessor> _processor;
@@ -99,14 +100,7 @@ size_t SentencePieceTokenizer::detokenize(const int32_t *tokens, size_t n_tokens
   if (!tokens || !text || n_tokens == 0 || text_len == 0 || !_processor)
     return 0;
 
-  std::vector<int> piece_ids;
-  for (size_t i = 0; i < n_tokens; ++i)
-    piece_ids.push_back(tokens[i]);
-
-  std::string decoded_text;
-  auto status = _processor->Decode(piece_ids, &decoded_text);
-  if (!status.ok())
-    return 0;
+  std::string decoded_text = decode(tokens, n_tokens);
 
   size_t copy_len = std::min(decoded_text.length(), text_len - 1);
   memcpy(text, decoded_text.c_str(), copy_len);
@@ -115,6 +109,21 @@ size_t SentencePieceTokenizer::detokenize(const int32_t *tokens, size_t n_tokens
   return copy_len;
 }
 
+std::string SentencePieceTokenizer::decode(const int32_t *tokens, size_t n_tokens) const
+{
+  if (!tokens || n_tokens == 0 || !_processor)
+    return {};
+
+  std::vector<int> piece_ids(tokens, tokens + n_tokens);
+
+  std::string decoded_text;
+  auto status = _processor->Decode(piece_ids, &decoded_text);
+  if (!status.ok())
+    return {};
+
+  return decoded_text;
+}
+
 } // namespace ggma
 
 // Register SentencePieceTokenizer using the macro
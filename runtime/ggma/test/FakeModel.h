@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __GGMA_TEST_FAKE_MODEL_H__
+#define __GGMA_TEST_FAKE_MODEL_H__
+
+#include <filesystem>
+#include <string>
+
+// Tiny language model served by the fake nnfw API in FakeNNFW.cc
+//
+// Each position holds the key and value [token, position, 0, 0] in every layer. The hidden
+// state of a position is [sum of tokens up to it, token, 0, 0], read back from the key cache,
+// so a wrong KV cache changes the output. unemb maps a hidden state to one-hot logits of
+//
+//   next = (sum * 7 + token * 3 + salt) % 13 + 2
+//
+// which never yields 0, BOS or EOS. Like decode graphs of onert without shape inference of
+// Attention, decode fails if its token input is resized.
+namespace ggma_test
+{
+
+constexpr int kLayers = 2;
+constexpr int kHidden = 4;
+constexpr int kVocab = 16;
+constexpr int kCacheSize = 32; // GGMAConfig::cache_size
+constexpr int kUbatch = 32;    // GGMAConfig::ubatch
+constexpr int kBos = 1;
+constexpr int kEos = 15;
+
+// Number of model runs of all fake sessions, including failed ones
+struct RunCounts
+{
+  int prefill = 0;
+  int decode = 0;
+  int decode_batch = 0;
+  int unemb = 0;
+};
+extern RunCounts run_counts;
+
+// Next token of the fake model after position whose token sum is sum
+int next_token(int sum, int token, int salt = 0);
+
+// Package directory of the fake model, removed with its contents on destruction
+class FakePackage
+{
+public:
+  /**
+   * @param decode_len Number of tokens the decode graph takes per run
+   * @param salt       Changes the tokens predicted by the model
+   * @param extra_config Additional fields of config.json, e.g. "\"kv_cache_type\": \"q8_0\","
+   */
+  explicit FakePackage(int decode_len = 1, int salt = 0, const std::string &extra_config = "");
+  ~FakePackage();
+
+  // Add a draft package in path()/draft
+  void add_draft(int decode_len, int salt);
+
+  // Add a decode_batch graph decoding one token of each of n_batch sequences
+  void add_decode_batch(int n_batch);
+
+  std::string path() const { return _dir.string(); }
+
+private:
+  static void write(const std::filesystem::path &dir, int decode_len, int salt,
+                    const std::string &extra_config);
+
+private:
+  std::filesystem::path _dir;
+};
+
+} // namespace ggma_test
+
+#endif // __GGMA_TEST_FAKE_MODEL_H__
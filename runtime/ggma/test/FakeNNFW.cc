@@ -0,0 +1,433 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// nnfw API serving the fake model of FakeModel.h, so that generation logic of ggma
+// is tested without model files
+
+#include "FakeModel.h"
+
+#include <nnfw.h>
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <random>
+#include <stdexcept>
+
+namespace ggma_test
+{
+
+RunCounts run_counts;
+
+int next_token(int sum, int token, int salt) { return (sum * 7 + token * 3 + salt) % 13 + 2; }
+
+FakePackage::FakePackage(int decode_len, int salt, const std::string &extra_config)
+{
+  std::random_device rd;
+  _dir = std::filesystem::temp_directory_path() / ("ggma_test_" + std::to_string(rd()));
+  write(_dir, decode_len, salt, extra_config);
+}
+
+FakePackage::~FakePackage()
+{
+  std::error_code ec;
+  std::filesystem::remove_all(_dir, ec);
+}
+
+void FakePackage::add_draft(int decode_len, int salt)
+{
+  write(_dir / "draft", decode_len, salt, "");
+}
+
+void FakePackage::add_decode_batch(int n_batch)
+{
+  // Batch size of the graph, read by nnfw_load_model_from_file
+  std::ofstream batch(_dir / "decode_batch");
+  batch << n_batch;
+}
+
+void FakePackage::write(const std::filesystem::path &dir, int decode_len, int salt,
+                        const std::string &extra_config)
+{
+  std::filesystem::create_directories(dir);
+  std::ofstream config(dir / "config.json");
+  config << "{" << extra_config << "\"num_hidden_layers\": " << kLayers
+         << ", \"hidden_size\": " << kHidden << ", \"num_attention_heads\": 1"
+         << ", \"vocab_size\": " << kVocab << ", \"max_position_embeddings\": " << kCacheSize
+         << ", \"bos_token_id\": " << kBos << ", \"eos_token_id\": " << kEos << "}";
+
+  // Parameters of the fake model, read by nnfw_load_model_from_file
+  std::ofstream params(dir / "fake_model");
+  params << decode_len << " " << salt;
+}
+
+} // namespace ggma_test
+
+using namespace ggma_test;
+
+struct nnfw_session
+{
+  enum class Kind
+  {
+    None,
+    Prefill,
+    Decode,
+    DecodeBatch,
+    Unemb
+  };
+
+  Kind kind = Kind::None;
+  int decode_len = 1;
+  int n_batch = 1; // Number of sequences of DecodeBatch
+  int salt = 0;
+  int unemb_len = kUbatch; // Sequence length of unemb, which may be resized
+  std::map<uint32_t, std::pair<const void *, size_t>> inputs;
+  std::map<uint32_t, std::pair<void *, size_t>> outputs;
+};
+
+namespace
+{
+
+nnfw_tensorinfo make_info(NNFW_TYPE dtype, std::initializer_list<int32_t> dims)
+{
+  nnfw_tensorinfo ti{};
+  ti.dtype = dtype;
+  ti.rank = static_cast<int32_t>(dims.size());
+  int32_t i = 0;
+  for (const auto dim : dims)
+    ti.dims[i++] = dim;
+  return ti;
+}
+
+size_t bytes_of(const nnfw_tensorinfo &ti)
+{
+  size_t n = ti.dtype == NNFW_TYPE_TENSOR_INT64 ? sizeof(int64_t) : sizeof(float);
+  for (int32_t i = 0; i < ti.rank; ++i)
+    n *= ti.dims[i];
+  return n;
+}
+
+bool input_info(const nnfw_session *session, uint32_t index, nnfw_tensorinfo *ti)
+{
+  switch (session->kind)
+  {
+    case nnfw_session::Kind::Prefill:
+      if (index != 0)
+        return false;
+      *ti = make_info(NNFW_TYPE_TENSOR_INT32, {1, kUbatch});
+      return true;
+    case nnfw_session::Kind::Decode:
+      if (index == 0)
+        *ti = make_info(NNFW_TYPE_TENSOR_INT32, {1, session->decode_len});
+      else if (index <= 2 * kLayers)
+        *ti = make_info(NNFW_TYPE_TENSOR_FLOAT32, {1, kCacheSize, 1, kHidden});
+      else if (index == 2 * kLayers + 1)
+        *ti = make_info(NNFW_TYPE_TENSOR_INT64, {1});
+      else
+        return false;
+      return true;
+    case nnfw_session::Kind::DecodeBatch:
+      if (index == 0)
+        *ti = make_info(NNFW_TYPE_TENSOR_INT32, {session->n_batch, 1});
+      else if (index <= 2 * kLayers)
+        *ti = make_info(NNFW_TYPE_TENSOR_FLOAT32, {session->n_batch, kCacheSize, 1, kHidden});
+      else if (index == 2 * kLayers + 1)
+        *ti = make_info(NNFW_TYPE_TENSOR_INT64, {session->n_batch});
+      else
+        return false;
+      return true;
+    case nnfw_session::Kind::Unemb:
+      if (index != 0)
+        return false;
+      *ti = make_info(NNFW_TYPE_TENSOR_FLOAT32, {1, session->unemb_len, kHidden});
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool output_info(const nnfw_session *session, uint32_t index, nnfw_tensorinfo *ti)
+{
+  switch (session->kind)
+  {
+    case nnfw_session::Kind::Prefill:
+      if (index < 2 * kLayers)
+        *ti = make_info(NNFW_TYPE_TENSOR_FLOAT32, {1, 1, kCacheSize, kHidden});
+      else if (index == 2 * kLayers)
+        *ti = make_info(NNFW_TYPE_TENSOR_FLOAT32, {1, kUbatch, kHidden});
+      else
+        return false;
+      return true;
+    case nnfw_session::Kind::Decode:
+      if (index != 0)
+        return false;
+      *ti = make_info(NNFW_TYPE_TENSOR_FLOAT32, {1, session->decode_len, kHidden});
+      return true;
+    case nnfw_session::Kind::DecodeBatch:
+      if (index != 0)
+        return false;
+      *ti = make_info(NNFW_TYPE_TENSOR_FLOAT32, {session->n_batch, 1, kHidden});
+      return true;
+    case nnfw_session::Kind::Unemb:
+      if (index != 0)
+        return false;
+      *ti = make_info(NNFW_TYPE_TENSOR_FLOAT32, {1, session->unemb_len, kVocab});
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Write key and value of a position into all layer caches and return its hidden state
+void fill_position(float *const *k, float *const *v, int pos, int token, float *hidden)
+{
+  for (int layer = 0; layer < kLayers; ++layer)
+  {
+    for (float *cache : {k[layer], v[layer]})
+    {
+      float *row = cache + pos * kHidden;
+      row[0] = static_cast<float>(token);
+      row[1] = static_cast<float>(pos);
+      row[2] = row[3] = 0.0f;
+    }
+  }
+
+  float sum = 0.0f;
+  for (int p = 0; p <= pos; ++p)
+    sum += k[0][p * kHidden];
+  hidden[0] = sum;
+  hidden[1] = static_cast<float>(token);
+  hidden[2] = hidden[3] = 0.0f;
+}
+
+void run_prefill(nnfw_session *session)
+{
+  auto tokens = static_cast<const int32_t *>(session->inputs.at(0).first);
+  float *k[kLayers];
+  float *v[kLayers];
+  for (int layer = 0; layer < kLayers; ++layer)
+  {
+    // As in exported models, output 2i is bound to the value cache and 2i+1 to the key cache
+    v[layer] = static_cast<float *>(session->outputs.at(2 * layer).first);
+    k[layer] = static_cast<float *>(session->outputs.at(2 * layer + 1).first);
+  }
+  auto hidden = static_cast<float *>(session->outputs.at(2 * kLayers).first);
+
+  for (int s = 0; s < kUbatch; ++s)
+  {
+    if (tokens[s] < 0 || tokens[s] >= kVocab)
+      throw std::runtime_error("invalid token");
+    fill_position(k, v, s, tokens[s], hidden + s * kHidden);
+  }
+}
+
+void run_decode(nnfw_session *session)
+{
+  auto tokens = static_cast<const int32_t *>(session->inputs.at(0).first);
+  float *k[kLayers];
+  float *v[kLayers];
+  for (int layer = 0; layer < kLayers; ++layer)
+  {
+    // KV caches are updated in place as the Attention kernel does
+    k[layer] = static_cast<float *>(const_cast<void *>(session->inputs.at(1 + layer).first));
+    v[layer] =
+      static_cast<float *>(const_cast<void *>(session->inputs.at(1 + kLayers + layer).first));
+  }
+  const auto pos = *static_cast<const int64_t *>(session->inputs.at(1 + 2 * kLayers).first);
+  auto hidden = static_cast<float *>(session->outputs.at(0).first);
+
+  for (int j = 0; j < session->decode_len; ++j)
+  {
+    if (pos + j >= kCacheSize)
+      throw std::runtime_error("cache position out of range");
+    if (tokens[j] < 0 || tokens[j] >= kVocab)
+      throw std::runtime_error("invalid token");
+    fill_position(k, v, pos + j, tokens[j], hidden + j * kHidden);
+  }
+}
+
+// Decode one token of each sequence with its own KV cache and position
+void run_decode_batch(nnfw_session *session)
+{
+  auto tokens = static_cast<const int32_t *>(session->inputs.at(0).first);
+  const auto pos = static_cast<const int64_t *>(session->inputs.at(1 + 2 * kLayers).first);
+  auto hidden = static_cast<float *>(session->outputs.at(0).first);
+
+  for (int b = 0; b < session->n_batch; ++b)
+  {
+    float *k[kLayers];
+    float *v[kLayers];
+    for (int layer = 0; layer < kLayers; ++layer)
+    {
+      auto k_batch = static_cast<const float *>(session->inputs.at(1 + layer).first);
+      auto v_batch = static_cast<const float *>(session->inputs.at(1 + kLayers + layer).first);
+      k[layer] = const_cast<float *>(k_batch) + b * kCacheSize * kHidden;
+      v[layer] = const_cast<float *>(v_batch) + b * kCacheSize * kHidden;
+    }
+
+    if (pos[b] < 0 || pos[b] >= kCacheSize)
+      throw std::runtime_error("cache position out of range");
+    if (tokens[b] < 0 || tokens[b] >= kVocab)
+      throw std::runtime_error("invalid token");
+    fill_position(k, v, pos[b], tokens[b], hidden + b * kHidden);
+  }
+}
+
+void run_unemb(nnfw_session *session)
+{
+  auto hidden = static_cast<const float *>(session->inputs.at(0).first);
+  auto logits = static_cast<float *>(session->outputs.at(0).first);
+
+  for (int s = 0; s < session->unemb_len; ++s)
+  {
+    const float *h = hidden + s * kHidden;
+    float *row = logits + s * kVocab;
+    std::fill(row, row + kVocab, 0.0f);
+    row[next_token(static_cast<int>(h[0]), static_cast<int>(h[1]), session->salt)] = 1.0f;
+  }
+}
+
+} // namespace
+
+extern "C" {
+
+NNFW_STATUS nnfw_create_session(nnfw_session **session)
+{
+  *session = new nnfw_session;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_close_session(nnfw_session *session)
+{
+  delete session;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_load_model_from_file(nnfw_session *session, const char *path)
+{
+  const std::filesystem::path model_path(path);
+  const auto name = model_path.filename().string();
+  if (name == "prefill")
+    session->kind = nnfw_session::Kind::Prefill;
+  else if (name == "decode")
+    session->kind = nnfw_session::Kind::Decode;
+  else if (name == "unemb")
+    session->kind = nnfw_session::Kind::Unemb;
+  else if (name == "decode_batch")
+  {
+    session->kind = nnfw_session::Kind::DecodeBatch;
+    std::ifstream batch(model_path);
+    if (!(batch >> session->n_batch))
+      return NNFW_STATUS_ERROR;
+  }
+  else
+    return NNFW_STATUS_ERROR;
+
+  std::ifstream params(model_path.parent_path() / "fake_model");
+  if (!(params >> session->decode_len >> session->salt))
+    return NNFW_STATUS_ERROR;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_prepare(nnfw_session *) { return NNFW_STATUS_NO_ERROR; }
+
+NNFW_STATUS nnfw_input_tensorinfo(nnfw_session *session, uint32_t index,
+                                  nnfw_tensorinfo *tensor_info)
+{
+  return input_info(session, index, tensor_info) ? NNFW_STATUS_NO_ERROR : NNFW_STATUS_ERROR;
+}
+
+NNFW_STATUS nnfw_output_tensorinfo(nnfw_session *session, uint32_t index,
+                                   nnfw_tensorinfo *tensor_info)
+{
+  return output_info(session, index, tensor_info) ? NNFW_STATUS_NO_ERROR : NNFW_STATUS_ERROR;
+}
+
+NNFW_STATUS nnfw_output_size(nnfw_session *session, uint32_t *number)
+{
+  *number = session->kind == nnfw_session::Kind::Prefill ? 2 * kLayers + 1 : 1;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_set_input_tensorinfo(nnfw_session *session, uint32_t index,
+                                      const nnfw_tensorinfo *tensor_info)
+{
+  // Only the sequence length of unemb can change
+  if (session->kind != nnfw_session::Kind::Unemb || index != 0 || tensor_info->rank != 3 ||
+      tensor_info->dims[1] < 1 || tensor_info->dims[1] > kUbatch)
+    return NNFW_STATUS_ERROR;
+  session->unemb_len = tensor_info->dims[1];
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_set_input(nnfw_session *session, uint32_t index, NNFW_TYPE type,
+                           const void *buffer, size_t length)
+{
+  nnfw_tensorinfo ti;
+  if (!input_info(session, index, &ti) || buffer == nullptr || length < bytes_of(ti))
+    return NNFW_STATUS_ERROR;
+  if (type != ti.dtype)
+    return NNFW_STATUS_ERROR;
+  session->inputs[index] = {buffer, length};
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_set_output(nnfw_session *session, uint32_t index, NNFW_TYPE type, void *buffer,
+                            size_t length)
+{
+  nnfw_tensorinfo ti;
+  if (!output_info(session, index, &ti) || buffer == nullptr || length < bytes_of(ti))
+    return NNFW_STATUS_ERROR;
+  if (type != ti.dtype)
+    return NNFW_STATUS_ERROR;
+  session->outputs[index] = {buffer, length};
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_run(nnfw_session *session)
+{
+  try
+  {
+    switch (session->kind)
+    {
+      case nnfw_session::Kind::Prefill:
+        ++run_counts.prefill;
+        run_prefill(session);
+        break;
+      case nnfw_session::Kind::Decode:
+        ++run_counts.decode;
+        run_decode(session);
+        break;
+      case nnfw_session::Kind::DecodeBatch:
+        ++run_counts.decode_batch;
+        run_decode_batch(session);
+        break;
+      case nnfw_session::Kind::Unemb:
+        ++run_counts.unemb;
+        run_unemb(session);
+        break;
+      default:
+        return NNFW_STATUS_ERROR;
+    }
+  }
+  catch (const std::exception &)
+  {
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
+} // extern "C"
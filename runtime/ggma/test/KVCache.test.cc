@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Config.h"
+#include "KVCache.h"
+
+#include <cker/BlockQuant.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+
+using namespace ggma;
+
+constexpr int kLayers = 2;
+constexpr int kHeads = 2;
+constexpr int kHeadDim = 4;
+constexpr int kCacheSize = 8;
+constexpr float kTheta = 10000.0f;
+
+GGMAConfig makeConfig(KVCacheDataType type = KVCacheDataType::FLOAT32, int head_dim = kHeadDim)
+{
+  GGMAConfig cfg;
+  cfg.model.n_layers = kLayers;
+  cfg.model.hidden_size = kHeads * head_dim;
+  cfg.model.num_attention_heads = kHeads;
+  cfg.model.vocab_size = 16;
+  cfg.model.max_position_embeddings = kCacheSize;
+  cfg.model.rope_theta = kTheta;
+  cfg.model.kv_cache_type = type;
+  return cfg;
+}
+
+float *floats(uint8_t *cache) { return reinterpret_cast<float *>(cache); }
+
+// Value of element d of head h at position s, distinct for each layer and cache
+float value(int layer, int cache, int h, int s, int d)
+{
+  return layer * 1000 + cache * 100 + h * 10 + s + d * 0.1f;
+}
+
+// Rotate x by RoPE (GPT-NeoX style) of position pos
+std::vector<float> rope(const std::vector<float> &x, int pos)
+{
+  const int half = kHeadDim / 2;
+  std::vector<float> ret(x);
+  for (int i = 0; i < half; ++i)
+  {
+    const double angle = pos * std::pow(static_cast<double>(kTheta), -2.0 * i / kHeadDim);
+    ret[i] = x[i] * std::cos(angle) - x[i + half] * std::sin(angle);
+    ret[i + half] = x[i] * std::sin(angle) + x[i + half] * std::cos(angle);
+  }
+  return ret;
+}
+
+} // namespace
+
+TEST(KVCache, Layout)
+{
+  KVCache cache;
+  cache.init(makeConfig(), kCacheSize);
+
+  ASSERT_TRUE(cache.is_valid());
+  EXPECT_EQ(cache.n_layers(), kLayers);
+  EXPECT_EQ(cache.layer_size(), kCacheSize * kHeads * kHeadDim * sizeof(float));
+  EXPECT_EQ(cache.row_size(), kHeads * kHeadDim * sizeof(float));
+  EXPECT_EQ(cache.capacity(), kCacheSize);
+  EXPECT_EQ(cache.pos(), 0);
+
+  // Layer caches are aligned and do not overlap
+  for (int layer = 0; layer < kLayers; ++layer)
+  {
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(cache.k(layer)) % KVCache::kAlignment, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(cache.v(layer)) % KVCache::kAlignment, 0u);
+    EXPECT_GE(cache.v(layer), cache.k(layer) + cache.layer_size());
+    if (layer > 0)
+    {
+      EXPECT_GE(cache.k(layer), cache.v(layer - 1) + cache.layer_size());
+    }
+  }
+
+  // Positions beyond 32 bits are kept as they are
+  const int64_t far = (int64_t{1} << 33) + 5;
+  cache.set_pos(far);
+  EXPECT_EQ(cache.pos(), far);
+}
+
+TEST(KVCache, SlotsLayout)
+{
+  constexpr int kSlots = 3;
+  std::vector<KVCache> slots(kSlots);
+  KVCache::init_slots(makeConfig(), kCacheSize, slots);
+
+  // Layer caches of all slots follow each other, as batches of one aligned layer cache
+  const KVCache &first = slots.front();
+  EXPECT_EQ(first.batch_layer_size(), kSlots * first.layer_size());
+  for (int layer = 0; layer < kLayers; ++layer)
+  {
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(first.k(layer)) % KVCache::kAlignment, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(first.v(layer)) % KVCache::kAlignment, 0u);
+    EXPECT_GE(first.v(layer), first.k(layer) + first.batch_layer_size());
+    for (int slot = 0; slot < kSlots; ++slot)
+    {
+      EXPECT_EQ(slots[slot].k(layer), first.k(layer) + slot * first.layer_size());
+      EXPECT_EQ(slots[slot].v(layer), first.v(layer) + slot * first.layer_size());
+    }
+  }
+
+  // Each slot keeps its own position
+  slots[1].set_pos(5);
+  EXPECT_EQ(slots[0].pos(), 0);
+  EXPECT_EQ(slots[1].pos(), 5);
+
+  // Slots are valid while the arena is shared by any of them
+  KVCache last = slots.back();
+  slots.clear();
+  ASSERT_TRUE(last.is_valid());
+  floats(last.v(kLayers - 1))[kCacheSize * kHeads * kHeadDim - 1] = 1.0f;
+}
+
+TEST(KVCache, ArrangePrefill)
+{
+  KVCache cache;
+  cache.init(makeConfig(), kCacheSize);
+
+  // Prefill writes [n_head, cache_size, d_head]
+  for (int layer = 0; layer < kLayers; ++layer)
+  {
+    int c = 0;
+    for (uint8_t *data : {cache.k(layer), cache.v(layer)})
+    {
+      for (int h = 0; h < kHeads; ++h)
+        for (int s = 0; s < kCacheSize; ++s)
+          for (int d = 0; d < kHeadDim; ++d)
+            floats(data)[(h * kCacheSize + s) * kHeadDim + d] = value(layer, c, h, s, d);
+      ++c;
+    }
+  }
+
+  const int n_tokens = 5;
+  cache.arrange_prefill(n_tokens);
+
+  // Decoder reads [cache_size, n_head, d_head] for the prefilled positions
+  for (int layer = 0; layer < kLayers; ++layer)
+  {
+    int c = 0;
+    for (uint8_t *data : {cache.k(layer), cache.v(layer)})
+    {
+      for (int s = 0; s < n_tokens; ++s)
+        for (int h = 0; h < kHeads; ++h)
+          for (int d = 0; d < kHeadDim; ++d)
+            ASSERT_EQ(floats(data)[(s * kHeads + h) * kHeadDim + d], value(layer, c, h, s, d));
+      ++c;
+    }
+  }
+}
+
+TEST(KVCache, ArrangePrefillQuantized)
+{
+  constexpr int kQuantHeadDim = 32;
+  const int n_row = kHeads * kQuantHeadDim;
+  const int n_tokens = 5;
+
+  for (const auto type : {KVCacheDataType::Q8_0, KVCacheDataType::Q4_0})
+  {
+    KVCache cache;
+    cache.init(makeConfig(type, kQuantHeadDim), kCacheSize);
+
+    // Prefill writes floats [n_head, cache_size, d_head] to the staging buffer
+    EXPECT_EQ(cache.prefill_nnfw_type(), NNFW_TYPE_TENSOR_FLOAT32);
+    ASSERT_EQ(cache.prefill_layer_size(), kCacheSize * n_row * sizeof(float));
+    for (int layer = 0; layer < kLayers; ++layer)
+    {
+      int c = 0;
+      for (uint8_t *data : {cache.prefill_k(layer), cache.prefill_v(layer)})
+      {
+        for (int h = 0; h < kHeads; ++h)
+          for (int s = 0; s < kCacheSize; ++s)
+            for (int d = 0; d < kQuantHeadDim; ++d)
+              floats(data)[(h * kCacheSize + s) * kQuantHeadDim + d] = value(layer, c, h, s, d);
+        ++c;
+      }
+    }
+
+    cache.arrange_prefill(n_tokens);
+
+    // Each position is a row of blocks along [n_head, d_head]
+    std::vector<float> row(n_row);
+    for (int layer = 0; layer < kLayers; ++layer)
+    {
+      int c = 0;
+      for (uint8_t *data : {cache.k(layer), cache.v(layer)})
+      {
+        for (int s = 0; s < n_tokens; ++s)
+        {
+          const uint8_t *blocks = data + s * cache.row_size();
+          if (type == KVCacheDataType::Q8_0)
+            nnfw::cker::DequantizeRow(reinterpret_cast<const nnfw::cker::BlockQ8_0 *>(blocks),
+                                      row.data(), n_row);
+          else
+            nnfw::cker::DequantizeRow(reinterpret_cast<const nnfw::cker::BlockQ4_0 *>(blocks),
+                                      row.data(), n_row);
+
+          for (int h = 0; h < kHeads; ++h)
+          {
+            for (int d = 0; d < kQuantHeadDim; ++d)
+            {
+              const float expected = value(layer, c, h, s, d);
+              // One quantization step of the block
+              const float tolerance = std::fabs(value(layer, c, h, s, kQuantHeadDim - 1)) /
+                                      (type == KVCacheDataType::Q8_0 ? 127 : 8);
+              ASSERT_NEAR(row[h * kQuantHeadDim + d], expected, tolerance);
+            }
+          }
+        }
+        ++c;
+      }
+    }
+  }
+
+  // Float caches are written by prefill directly
+  KVCache cache;
+  cache.init(makeConfig(), kCacheSize);
+  EXPECT_EQ(cache.prefill_k(1), cache.k(1));
+  EXPECT_EQ(cache.prefill_v(1), cache.v(1));
+  EXPECT_EQ(cache.prefill_layer_size(), cache.layer_size());
+}
+
+TEST(KVCache, Shift)
+{
+  KVCache cache;
+  cache.init(makeConfig(), kCacheSize);
+
+  // Key of each position is a base vector rotated by its position
+  const std::vector<float> base = {1.0f, 0.5f, -0.25f, 2.0f};
+  const int n_pos = 7;
+  for (int layer = 0; layer < kLayers; ++layer)
+  {
+    for (int s = 0; s < n_pos; ++s)
+    {
+      for (int h = 0; h < kHeads; ++h)
+      {
+        const auto key = rope(base, s);
+        for (int d = 0; d < kHeadDim; ++d)
+        {
+          floats(cache.k(layer))[(s * kHeads + h) * kHeadDim + d] = key[d];
+          floats(cache.v(layer))[(s * kHeads + h) * kHeadDim + d] = value(layer, 1, h, s, d);
+        }
+      }
+    }
+  }
+  cache.set_pos(n_pos);
+
+  // Keep BOS, drop 2 positions after it
+  const int n_keep = 1;
+  const int n_discard = 2;
+  cache.shift(n_keep, n_discard);
+  ASSERT_EQ(cache.pos(), n_pos - n_discard);
+
+  for (int layer = 0; layer < kLayers; ++layer)
+  {
+    for (int s = 0; s < n_pos - n_discard; ++s)
+    {
+      // Position s holds what was at old_s, with the key rotated to its new position
+      const int old_s = s < n_keep ? s : s + n_discard;
+      const auto key = rope(base, s);
+      for (int h = 0; h < kHeads; ++h)
+      {
+        for (int d = 0; d < kHeadDim; ++d)
+        {
+          EXPECT_NEAR(floats(cache.k(layer))[(s * kHeads + h) * kHeadDim + d], key[d], 1e-5f);
+          EXPECT_EQ(floats(cache.v(layer))[(s * kHeads + h) * kHeadDim + d],
+                    value(layer, 1, h, old_s, d));
+        }
+      }
+    }
+  }
+}
+
+TEST(KVCache, SaveLoadPrefix)
+{
+  KVCache src;
+  src.init(makeConfig(), kCacheSize);
+  for (int layer = 0; layer < kLayers; ++layer)
+  {
+    for (size_t i = 0; i < src.layer_size() / sizeof(float); ++i)
+    {
+      floats(src.k(layer))[i] = value(layer, 0, 0, 0, 0) + i;
+      floats(src.v(layer))[i] = value(layer, 1, 0, 0, 0) + i;
+    }
+  }
+
+  const size_t n_rows = 5;
+  std::vector<uint8_t> snapshot(n_rows * src.row_size() * 2 * kLayers);
+  src.save_prefix(n_rows, snapshot.data());
+
+  // Load fewer rows than saved
+  KVCache dst;
+  dst.init(makeConfig(), kCacheSize);
+  const size_t n_load = 3;
+  dst.load_prefix(n_load, snapshot.data(), n_rows);
+  for (int layer = 0; layer < kLayers; ++layer)
+  {
+    for (size_t i = 0; i < n_load * dst.row_size() / sizeof(float); ++i)
+    {
+      ASSERT_EQ(floats(dst.k(layer))[i], floats(src.k(layer))[i]);
+      ASSERT_EQ(floats(dst.v(layer))[i], floats(src.v(layer))[i]);
+    }
+    EXPECT_EQ(floats(dst.k(layer))[n_load * dst.row_size() / sizeof(float)], 0.0f);
+  }
+}
+
+TEST(KVCache, neg_Shift)
+{
+  KVCache cache;
+  cache.init(makeConfig(), kCacheSize);
+  cache.set_pos(4);
+
+  // More positions than cached
+  EXPECT_ANY_THROW(cache.shift(1, 4));
+
+  // Quantized keys cannot be rotated
+  KVCache quantized;
+  quantized.init(makeConfig(KVCacheDataType::Q8_0, 32), kCacheSize);
+  quantized.set_pos(4);
+  EXPECT_ANY_THROW(quantized.shift(1, 2));
+}
+
+TEST(KVCache, neg_Init)
+{
+  KVCache cache;
+  EXPECT_ANY_THROW(cache.init(makeConfig(), 0));
+  // Quantized blocks must not cross heads
+  EXPECT_ANY_THROW(cache.init(makeConfig(KVCacheDataType::Q4_0, kHeadDim), kCacheSize));
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Config.h"
+#include "Context.h"
+#include "FakeModel.h"
+#include "PrefixCache.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+using namespace ggma;
+
+constexpr int kLayers = 2;
+constexpr int kVocab = 16;
+constexpr int kCacheSize = 8;
+
+GGMAConfig makeConfig()
+{
+  GGMAConfig cfg;
+  cfg.model.n_layers = kLayers;
+  cfg.model.hidden_size = 8;
+  cfg.model.num_attention_heads = 2;
+  cfg.model.vocab_size = kVocab;
+  cfg.model.max_position_embeddings = kCacheSize;
+  return cfg;
+}
+
+float *floats(uint8_t *cache) { return reinterpret_cast<float *>(cache); }
+
+// Cache whose values are distinct for each seed, layer and position
+KVCache makeCache(float seed)
+{
+  KVCache cache;
+  cache.init(makeConfig(), kCacheSize);
+  for (int layer = 0; layer < kLayers; ++layer)
+  {
+    for (size_t i = 0; i < cache.layer_size() / sizeof(float); ++i)
+    {
+      floats(cache.k(layer))[i] = seed * 10000 + layer * 1000 + i;
+      floats(cache.v(layer))[i] = -(seed * 10000 + layer * 1000 + i);
+    }
+  }
+  return cache;
+}
+
+// Whether first n_rows positions of all layer caches are equal
+bool equal_rows(const KVCache &a, const KVCache &b, size_t n_rows)
+{
+  for (int layer = 0; layer < kLayers; ++layer)
+  {
+    const size_t bytes = n_rows * a.row_size();
+    if (memcmp(a.k(layer), b.k(layer), bytes) != 0 || memcmp(a.v(layer), b.v(layer), bytes) != 0)
+      return false;
+  }
+  return true;
+}
+
+// Tokens of prompt followed by tokens generated by ctx
+std::vector<ggma_token> generate(Context &ctx, const std::vector<ggma_token> &prompt)
+{
+  std::vector<ggma_token> tokens(2 * ggma_test::kUbatch, 0);
+  std::copy(prompt.begin(), prompt.end(), tokens.begin());
+  size_t n_predict = 8;
+  EXPECT_EQ(ctx.generate(tokens.data(), prompt.size(), tokens.size(), &n_predict),
+            GGMA_STATUS_NO_ERROR);
+  tokens.resize(prompt.size() + n_predict);
+  return tokens;
+}
+
+std::vector<float> makeLogits(float seed) { return std::vector<float>(kVocab, seed); }
+
+// Bytes of a snapshot of n_tokens positions
+size_t entry_bytes(size_t n_tokens)
+{
+  KVCache cache;
+  cache.init(makeConfig(), kCacheSize);
+  const size_t row_bytes = sizeof(ggma_token) + 2 * kLayers * cache.row_size();
+  return n_tokens * row_bytes + kVocab * sizeof(float);
+}
+
+} // namespace
+
+TEST(PrefixCache, StoreRestore)
+{
+  PrefixCache prefix_cache(1 << 20);
+  const KVCache src = makeCache(1);
+  const ggma_token prompt[] = {1, 2, 3, 4};
+  prefix_cache.store(prompt, 4, src, makeLogits(1).data(), kVocab);
+  EXPECT_EQ(prefix_cache.size(), entry_bytes(4));
+
+  // Whole prompt: KV and logits are restored
+  KVCache dst = makeCache(2);
+  std::vector<float> logits;
+  EXPECT_EQ(prefix_cache.restore(prompt, 4, dst, logits), 4u);
+  EXPECT_TRUE(equal_rows(src, dst, 4));
+  EXPECT_EQ(logits, makeLogits(1));
+
+  // Longer prompt sharing 3 tokens: KV of the prefix only
+  dst = makeCache(2);
+  logits.clear();
+  const ggma_token longer[] = {1, 2, 3, 9, 9};
+  EXPECT_EQ(prefix_cache.restore(longer, 5, dst, logits), 3u);
+  EXPECT_TRUE(equal_rows(src, dst, 3));
+  EXPECT_FALSE(equal_rows(src, dst, 4));
+  EXPECT_TRUE(logits.empty());
+
+  // Prefix of the snapshot: its last token is left to compute logits
+  EXPECT_EQ(prefix_cache.restore(prompt, 2, dst, logits), 1u);
+
+  // Too many tokens left for the caller
+  EXPECT_EQ(prefix_cache.restore(longer, 5, dst, logits, 1), 0u);
+  EXPECT_EQ(prefix_cache.restore(longer, 5, dst, logits, 2), 3u);
+
+  // Nothing shared
+  const ggma_token other[] = {5, 1, 2};
+  EXPECT_EQ(prefix_cache.restore(other, 3, dst, logits), 0u);
+}
+
+TEST(PrefixCache, Eviction)
+{
+  // Room for two snapshots of 4 tokens
+  PrefixCache prefix_cache(2 * entry_bytes(4) + entry_bytes(4) / 2);
+  const ggma_token a[] = {1, 2, 3, 4};
+  const ggma_token b[] = {2, 2, 3, 4};
+  const ggma_token c[] = {3, 2, 3, 4};
+  KVCache cache = makeCache(1);
+  std::vector<float> logits;
+
+  prefix_cache.store(a, 4, cache, makeLogits(1).data(), kVocab);
+  prefix_cache.store(b, 4, cache, makeLogits(2).data(), kVocab);
+  EXPECT_EQ(prefix_cache.size(), 2 * entry_bytes(4));
+
+  // Using a makes b the least recently used
+  EXPECT_EQ(prefix_cache.restore(a, 4, cache, logits), 4u);
+  prefix_cache.store(c, 4, cache, makeLogits(3).data(), kVocab);
+  EXPECT_EQ(prefix_cache.size(), 2 * entry_bytes(4));
+  EXPECT_EQ(prefix_cache.restore(b, 4, cache, logits), 0u);
+  EXPECT_EQ(prefix_cache.restore(a, 4, cache, logits), 4u);
+  EXPECT_EQ(prefix_cache.restore(c, 4, cache, logits), 4u);
+  EXPECT_EQ(logits, makeLogits(3));
+
+  // Storing the same prompt again replaces its snapshot
+  prefix_cache.store(c, 4, cache, makeLogits(4).data(), kVocab);
+  EXPECT_EQ(prefix_cache.size(), 2 * entry_bytes(4));
+  EXPECT_EQ(prefix_cache.restore(c, 4, cache, logits), 4u);
+  EXPECT_EQ(logits, makeLogits(4));
+
+  // Shrinking the budget evicts immediately
+  prefix_cache.set_budget(entry_bytes(4));
+  EXPECT_EQ(prefix_cache.size(), entry_bytes(4));
+  EXPECT_EQ(prefix_cache.restore(a, 4, cache, logits), 0u);
+  EXPECT_EQ(prefix_cache.restore(c, 4, cache, logits), 4u);
+}
+
+TEST(PrefixCache, neg_Budget)
+{
+  const ggma_token prompt[] = {1, 2, 3, 4};
+  KVCache cache = makeCache(1);
+  std::vector<float> logits;
+
+  // Disabled
+  PrefixCache disabled;
+  disabled.store(prompt, 4, cache, makeLogits(1).data(), kVocab);
+  EXPECT_EQ(disabled.size(), 0u);
+  EXPECT_EQ(disabled.restore(prompt, 4, cache, logits), 0u);
+
+  // Larger than the whole budget
+  PrefixCache small(entry_bytes(4) - 1);
+  small.store(prompt, 4, cache, makeLogits(1).data(), kVocab);
+  EXPECT_EQ(small.size(), 0u);
+}
+
+TEST(PrefixCache, SharedPrompt)
+{
+  using ggma_test::FakePackage;
+  using ggma_test::run_counts;
+
+  // Prompts sharing a prefix with the first one
+  const std::vector<std::vector<ggma_token>> prompts = {
+    {1, 3, 4, 5}, {1, 3, 4, 5}, {1, 3, 4, 5, 6}, {1, 3, 4, 7, 8, 9}, {1, 3}};
+
+  for (const int decode_len : {1, 4})
+  {
+    FakePackage package(decode_len);
+    Context ctx(package.path().c_str());
+    const int n_prefill = run_counts.prefill;
+    for (const auto &prompt : prompts)
+    {
+      Context fresh(package.path().c_str());
+      EXPECT_EQ(generate(ctx, prompt), generate(fresh, prompt));
+    }
+
+    // Only the prompt leaving more tokens than one decode run takes is prefilled again.
+    // Fresh contexts prefill every prompt.
+    const int n_reused = decode_len == 1 ? 3 : 4;
+    EXPECT_EQ(run_counts.prefill - n_prefill,
+              static_cast<int>(2 * prompts.size()) - n_reused);
+  }
+}
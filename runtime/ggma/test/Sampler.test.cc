@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Sampler.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+using namespace ggma;
+
+constexpr int kDraws = 10000;
+
+// Logits whose probabilities are given at temperature 1
+std::vector<float> logits_of(const std::vector<float> &probs)
+{
+  std::vector<float> logits;
+  for (const float p : probs)
+    logits.push_back(std::log(p));
+  return logits;
+}
+
+SamplingConfig sampling(int seed = 0)
+{
+  SamplingConfig cfg;
+  cfg.do_sample = true;
+  cfg.seed = seed;
+  return cfg;
+}
+
+// Frequency of each token drawn by sampler
+std::vector<float> frequencies(Sampler &sampler, const std::vector<float> &logits)
+{
+  std::vector<int> counts(logits.size(), 0);
+  for (int i = 0; i < kDraws; ++i)
+  {
+    std::vector<float> copy(logits);
+    ++counts[sampler.sample(copy.data(), copy.size(), nullptr, 0)];
+  }
+
+  std::vector<float> freq;
+  for (const int count : counts)
+    freq.push_back(static_cast<float>(count) / kDraws);
+  return freq;
+}
+
+const std::vector<float> kProbs = {0.05f, 0.4f, 0.1f, 0.25f, 0.2f};
+
+} // namespace
+
+TEST(Sampler, Greedy)
+{
+  Sampler sampler;
+  sampler.configure(SamplingConfig{});
+
+  std::vector<float> logits = logits_of(kProbs);
+  EXPECT_EQ(sampler.sample(logits.data(), logits.size(), nullptr, 0), 1);
+
+  // top_k = 1 is greedy even when sampling
+  SamplingConfig cfg = sampling();
+  cfg.top_k = 1;
+  sampler.configure(cfg);
+  for (int i = 0; i < 10; ++i)
+    EXPECT_EQ(sampler.sample(logits.data(), logits.size(), nullptr, 0), 1);
+}
+
+TEST(Sampler, Seed)
+{
+  const std::vector<float> logits = logits_of(kProbs);
+  auto draw = [&](int seed) {
+    Sampler sampler;
+    sampler.configure(sampling(seed));
+    std::vector<ggma_token> tokens;
+    for (int i = 0; i < 100; ++i)
+    {
+      std::vector<float> copy(logits);
+      tokens.push_back(sampler.sample(copy.data(), copy.size(), nullptr, 0));
+    }
+    return tokens;
+  };
+
+  EXPECT_EQ(draw(7), draw(7));
+  EXPECT_NE(draw(7), draw(8));
+
+  // configure() restarts the sequence of the seed
+  Sampler sampler;
+  sampler.configure(sampling(7));
+  std::vector<float> copy(logits);
+  sampler.sample(copy.data(), copy.size(), nullptr, 0);
+  sampler.configure(sampling(7));
+  std::vector<ggma_token> tokens;
+  for (int i = 0; i < 100; ++i)
+  {
+    std::vector<float> copy(logits);
+    tokens.push_back(sampler.sample(copy.data(), copy.size(), nullptr, 0));
+  }
+  EXPECT_EQ(tokens, draw(7));
+}
+
+TEST(Sampler, Distribution)
+{
+  Sampler sampler;
+  sampler.configure(sampling());
+
+  const auto freq = frequencies(sampler, logits_of(kProbs));
+  for (size_t i = 0; i < kProbs.size(); ++i)
+    EXPECT_NEAR(freq[i], kProbs[i], 0.02f) << "token " << i;
+}
+
+TEST(Sampler, TopK)
+{
+  SamplingConfig cfg = sampling();
+  cfg.top_k = 3;
+  Sampler sampler;
+  sampler.configure(cfg);
+
+  // Tokens 1, 3 and 4 are kept and renormalized
+  const auto freq = frequencies(sampler, logits_of(kProbs));
+  EXPECT_EQ(freq[0], 0.0f);
+  EXPECT_EQ(freq[2], 0.0f);
+  EXPECT_NEAR(freq[1], 0.4f / 0.85f, 0.02f);
+  EXPECT_NEAR(freq[3], 0.25f / 0.85f, 0.02f);
+  EXPECT_NEAR(freq[4], 0.2f / 0.85f, 0.02f);
+}
+
+TEST(Sampler, TopP)
+{
+  SamplingConfig cfg = sampling();
+  cfg.top_p = 0.6f;
+  Sampler sampler;
+  sampler.configure(cfg);
+
+  // Tokens 1 and 3 are the smallest set covering 0.6
+  const auto freq = frequencies(sampler, logits_of(kProbs));
+  EXPECT_EQ(freq[0], 0.0f);
+  EXPECT_EQ(freq[2], 0.0f);
+  EXPECT_EQ(freq[4], 0.0f);
+  EXPECT_NEAR(freq[1], 0.4f / 0.65f, 0.02f);
+  EXPECT_NEAR(freq[3], 0.25f / 0.65f, 0.02f);
+
+  // Top-p applies after top-k
+  cfg.top_k = 2;
+  cfg.top_p = 0.5f;
+  sampler.configure(cfg);
+  const auto freq_k = frequencies(sampler, logits_of(kProbs));
+  EXPECT_EQ(freq_k[1], 1.0f);
+}
+
+TEST(Sampler, MinP)
+{
+  SamplingConfig cfg = sampling();
+  cfg.min_p = 0.45f;
+  Sampler sampler;
+  sampler.configure(cfg);
+
+  // Tokens with probability >= 0.45 * 0.4 are kept
+  const auto freq = frequencies(sampler, logits_of(kProbs));
+  EXPECT_EQ(freq[0], 0.0f);
+  EXPECT_EQ(freq[2], 0.0f);
+  EXPECT_NEAR(freq[1], 0.4f / 0.85f, 0.02f);
+  EXPECT_NEAR(freq[3], 0.25f / 0.85f, 0.02f);
+  EXPECT_NEAR(freq[4], 0.2f / 0.85f, 0.02f);
+}
+
+TEST(Sampler, Temperature)
+{
+  SamplingConfig cfg = sampling();
+  cfg.temperature = 0.5f;
+  Sampler sampler;
+  sampler.configure(cfg);
+
+  // Probabilities are squared and renormalized
+  float sum = 0.0f;
+  for (const float p : kProbs)
+    sum += p * p;
+  const auto freq = frequencies(sampler, logits_of(kProbs));
+  for (size_t i = 0; i < kProbs.size(); ++i)
+    EXPECT_NEAR(freq[i], kProbs[i] * kProbs[i] / sum, 0.02f) << "token " << i;
+}
+
+TEST(Sampler, Penalties)
+{
+  SamplingConfig cfg;
+  cfg.repetition_penalty = 2.0f;
+  Sampler sampler;
+  sampler.configure(cfg);
+
+  // Positive logits are divided, negative ones multiplied, once per token
+  std::vector<float> logits = {1.0f, 3.0f, -1.0f, 2.0f};
+  const ggma_token history[] = {1, 2, 1};
+  EXPECT_EQ(sampler.sample(logits.data(), logits.size(), history, 3), 3);
+  EXPECT_EQ(logits, (std::vector<float>{1.0f, 1.5f, -2.0f, 2.0f}));
+
+  cfg.repetition_penalty = 1.0f;
+  cfg.presence_penalty = 1.5f;
+  sampler.configure(cfg);
+  logits = {1.0f, 3.0f, -1.0f, 2.0f};
+  EXPECT_EQ(sampler.sample(logits.data(), logits.size(), history, 3), 3);
+  EXPECT_EQ(logits, (std::vector<float>{1.0f, 1.5f, -2.5f, 2.0f}));
+}
+
+TEST(Sampler, neg_Sample)
+{
+  Sampler sampler;
+  sampler.configure(sampling());
+  float logit = 0.0f;
+  EXPECT_ANY_THROW(sampler.sample(&logit, 0, nullptr, 0));
+}
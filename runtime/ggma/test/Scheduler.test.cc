@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Context.h"
+#include "FakeModel.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+
+using namespace ggma;
+using namespace ggma_test;
+
+constexpr size_t kPredict = 6;
+
+// Tokens of prompt followed by tokens generated by a fresh context
+std::vector<ggma_token> generate(const FakePackage &package, const std::vector<ggma_token> &prompt)
+{
+  Context ctx(package.path().c_str());
+  std::vector<ggma_token> tokens(2 * kUbatch, 0);
+  std::copy(prompt.begin(), prompt.end(), tokens.begin());
+  size_t n_predict = kPredict;
+  EXPECT_EQ(ctx.generate(tokens.data(), prompt.size(), tokens.size(), &n_predict),
+            GGMA_STATUS_NO_ERROR);
+  tokens.resize(prompt.size() + n_predict);
+  return tokens;
+}
+
+} // namespace
+
+TEST(Scheduler, MatchGenerate)
+{
+  FakePackage package;
+  Context ctx(package.path().c_str());
+
+  // More prompts than slots, not sharing any prefix
+  const std::vector<std::vector<ggma_token>> prompts = {
+    {2, 3}, {4, 5, 6}, {7}, {8, 9}, {10, 11, 12}, {13, 2, 2}};
+  std::vector<ggma_seq_id> ids(prompts.size());
+  for (size_t i = 0; i < prompts.size(); ++i)
+    ASSERT_EQ(ctx.submit(prompts[i].data(), prompts[i].size(), kPredict, &ids[i]),
+              GGMA_STATUS_NO_ERROR);
+
+  std::vector<ggma_token> out(2 * kUbatch);
+  size_t n_out = 0;
+  size_t n_remaining = 0;
+  ASSERT_EQ(ctx.step(&n_remaining), GGMA_STATUS_NO_ERROR);
+  EXPECT_EQ(n_remaining, prompts.size());
+  EXPECT_EQ(ctx.collect(ids.back(), out.data(), out.size(), &n_out), GGMA_STATUS_INVALID_STATE);
+
+  for (int i = 0; i < 100 && n_remaining > 0; ++i)
+    ASSERT_EQ(ctx.step(&n_remaining), GGMA_STATUS_NO_ERROR);
+  ASSERT_EQ(n_remaining, 0u);
+
+  for (size_t i = 0; i < prompts.size(); ++i)
+  {
+    ASSERT_EQ(ctx.collect(ids[i], out.data(), out.size(), &n_out), GGMA_STATUS_NO_ERROR);
+    out.resize(n_out);
+    EXPECT_EQ(out, generate(package, prompts[i]));
+    out.resize(2 * kUbatch);
+  }
+}
+
+TEST(Scheduler, BatchedDecode)
+{
+  FakePackage package;
+  package.add_decode_batch(3);
+  Context ctx(package.path().c_str());
+
+  // Sequences finish at different steps, leaving free slots between running ones
+  const std::vector<std::vector<ggma_token>> prompts = {
+    {2, 3}, {4, 5, 6}, {7}, {8, 9}, {10, 11, 12}, {13, 2, 2}};
+  std::vector<size_t> n_predict(prompts.size());
+  std::vector<ggma_seq_id> ids(prompts.size());
+  for (size_t i = 0; i < prompts.size(); ++i)
+  {
+    n_predict[i] = kPredict - i % 3;
+    ASSERT_EQ(ctx.submit(prompts[i].data(), prompts[i].size(), n_predict[i], &ids[i]),
+              GGMA_STATUS_NO_ERROR);
+  }
+
+  const RunCounts before = run_counts;
+  int n_step = 0;
+  size_t n_remaining = prompts.size();
+  for (; n_step < 100 && n_remaining > 0; ++n_step)
+    ASSERT_EQ(ctx.step(&n_remaining), GGMA_STATUS_NO_ERROR);
+  ASSERT_EQ(n_remaining, 0u);
+
+  // Running sequences are decoded and unembedded together, in one run per step
+  EXPECT_EQ(run_counts.decode, before.decode);
+  EXPECT_GT(run_counts.decode_batch, before.decode_batch);
+  EXPECT_LE(run_counts.decode_batch - before.decode_batch, n_step);
+  EXPECT_LE(run_counts.unemb - before.unemb, n_step + static_cast<int>(prompts.size()));
+
+  // Each sequence is generated as if it were alone
+  std::vector<ggma_token> out(2 * kUbatch);
+  size_t n_out = 0;
+  size_t n_generated = 0;
+  for (size_t i = 0; i < prompts.size(); ++i)
+  {
+    ASSERT_EQ(ctx.collect(ids[i], out.data(), out.size(), &n_out), GGMA_STATUS_NO_ERROR);
+    out.resize(n_out);
+    auto expected = generate(package, prompts[i]);
+    expected.resize(prompts[i].size() + n_predict[i]);
+    EXPECT_EQ(out, expected);
+    n_generated += n_out - prompts[i].size();
+    out.resize(2 * kUbatch);
+  }
+  EXPECT_LT(run_counts.decode_batch - before.decode_batch, static_cast<int>(n_generated));
+}
+
+TEST(Scheduler, neg_FailedPrompt)
+{
+  FakePackage package;
+  Context ctx(package.path().c_str());
+
+  // The model fails on the out-of-vocabulary token
+  const std::vector<ggma_token> bad = {kBos, 99};
+  const std::vector<ggma_token> good = {2, 3, 4};
+  ggma_seq_id bad_id = 0;
+  ggma_seq_id good_id = 0;
+  ASSERT_EQ(ctx.submit(bad.data(), bad.size(), kPredict, &bad_id), GGMA_STATUS_NO_ERROR);
+  ASSERT_EQ(ctx.submit(good.data(), good.size(), kPredict, &good_id), GGMA_STATUS_NO_ERROR);
+
+  const int n_prefill = run_counts.prefill;
+  size_t n_remaining = 0;
+  for (int i = 0; i < 100; ++i)
+  {
+    ASSERT_EQ(ctx.step(&n_remaining), GGMA_STATUS_NO_ERROR);
+    if (n_remaining == 0)
+      break;
+  }
+  ASSERT_EQ(n_remaining, 0u);
+  // The failed prompt is not retried
+  EXPECT_EQ(run_counts.prefill - n_prefill, 2);
+
+  std::vector<ggma_token> out(2 * kUbatch);
+  size_t n_out = 0;
+  EXPECT_EQ(ctx.collect(bad_id, out.data(), out.size(), &n_out), GGMA_STATUS_ERROR);
+  // A collected failure is released
+  EXPECT_EQ(ctx.collect(bad_id, out.data(), out.size(), &n_out), GGMA_STATUS_ERROR);
+
+  ASSERT_EQ(ctx.collect(good_id, out.data(), out.size(), &n_out), GGMA_STATUS_NO_ERROR);
+  out.resize(n_out);
+  EXPECT_EQ(out, generate(package, good));
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Context.h"
+#include "FakeModel.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+
+using namespace ggma;
+using namespace ggma_test;
+
+// Few enough tokens to generate without sliding the cache window
+constexpr size_t kPredict = 15;
+
+const std::vector<ggma_token> kPrompt = {kBos, 3, 4};
+
+// Tokens generated greedily after kPrompt
+std::vector<ggma_token> generate(const FakePackage &package)
+{
+  Context ctx(package.path().c_str());
+  std::vector<ggma_token> tokens(2 * kUbatch, 0);
+  std::copy(kPrompt.begin(), kPrompt.end(), tokens.begin());
+  size_t n_predict = kPredict;
+  EXPECT_EQ(ctx.generate(tokens.data(), kPrompt.size(), tokens.size(), &n_predict),
+            GGMA_STATUS_NO_ERROR);
+  return std::vector<ggma_token>(tokens.begin() + kPrompt.size(),
+                                 tokens.begin() + kPrompt.size() + n_predict);
+}
+
+// Tokens the fake model generates after kPrompt
+std::vector<ggma_token> expected()
+{
+  std::vector<ggma_token> tokens;
+  int sum = 0;
+  for (const auto token : kPrompt)
+    sum += token;
+  ggma_token last = kPrompt.back();
+  for (size_t i = 0; i < kPredict; ++i)
+  {
+    last = next_token(sum, last);
+    sum += last;
+    tokens.push_back(last);
+  }
+  return tokens;
+}
+
+} // namespace
+
+TEST(Speculative, DecodeLength)
+{
+  // Decode models taking several tokens per run are padded for one token
+  FakePackage single(1);
+  FakePackage multi(5);
+  EXPECT_EQ(generate(single), expected());
+  EXPECT_EQ(generate(multi), expected());
+}
+
+TEST(Speculative, MatchGreedy)
+{
+  // Draft proposing the same tokens as the target
+  FakePackage good(5);
+  good.add_draft(1, 0);
+
+  // Draft proposing other tokens, all of which are rejected
+  FakePackage bad(5);
+  bad.add_draft(1, 5);
+
+  const int n_decode = run_counts.decode;
+  EXPECT_EQ(generate(good), expected());
+  const int n_decode_good = run_counts.decode - n_decode;
+  EXPECT_EQ(generate(bad), expected());
+
+  // The draft decodes one token per run, and the target verifies 4 proposals per run
+  EXPECT_LE(n_decode_good, static_cast<int>(kPredict + kPredict / 4 + 1));
+}
+
+TEST(Speculative, SingleTokenDecode)
+{
+  // Proposals cannot be verified in one run, so the draft is not used
+  FakePackage package(1);
+  package.add_draft(1, 5);
+
+  const int n_decode = run_counts.decode;
+  EXPECT_EQ(generate(package), expected());
+  EXPECT_EQ(run_counts.decode - n_decode, static_cast<int>(kPredict) - 1);
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Tokenizer.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// Tokenizer decoding like SentencePiece
+//
+// Token 0..2 are words with a leading space, which is dropped at the start of text.
+// Token 100 + b is byte b. Bytes of an incomplete UTF-8 character at the end of text
+// are decoded as U+FFFD each.
+class FakeTokenizer : public ggma::Tokenizer
+{
+public:
+  std::string id() const override { return "fake"; }
+  size_t tokenize(const char *, size_t, int32_t *, size_t, size_t *) const override { return 0; }
+  size_t detokenize(const int32_t *, size_t, char *, size_t) const override { return 0; }
+
+  std::string decode(const int32_t *tokens, size_t n_tokens) const override
+  {
+    n_decoded += n_tokens;
+
+    static const char *words[] = {" hello", " world", " !"};
+    std::string text;
+    for (size_t i = 0; i < n_tokens; ++i)
+      text += tokens[i] >= 100 ? std::string(1, static_cast<char>(tokens[i] - 100))
+                               : std::string(words[tokens[i]]);
+    if (!text.empty() && text[0] == ' ')
+      text.erase(0, 1);
+
+    // Replace bytes of a trailing incomplete character
+    size_t lead = text.size();
+    while (lead > 0 && (static_cast<unsigned char>(text[lead - 1]) & 0xC0) == 0x80)
+      --lead;
+    if (lead > 0 && (static_cast<unsigned char>(text[lead - 1]) & 0xC0) == 0xC0)
+    {
+      const auto c = static_cast<unsigned char>(text[lead - 1]);
+      const size_t expected = (c & 0xE0) == 0xC0 ? 2 : (c & 0xF0) == 0xE0 ? 3 : 4;
+      const size_t n_bytes = text.size() - lead + 1;
+      if (n_bytes < expected)
+      {
+        text.resize(lead - 1);
+        for (size_t i = 0; i < n_bytes; ++i)
+          text += "\xEF\xBF\xBD";
+      }
+    }
+    return text;
+  }
+
+  mutable size_t n_decoded = 0; // Number of tokens passed to decode()
+};
+
+// Byte tokens of a string
+std::vector<int32_t> bytes(const std::string &s)
+{
+  std::vector<int32_t> tokens;
+  for (const char c : s)
+    tokens.push_back(100 + static_cast<unsigned char>(c));
+  return tokens;
+}
+
+// Text returned by streaming tokens one by one, with a flush at the end
+std::string stream(const FakeTokenizer &tokenizer, const std::vector<int32_t> &tokens,
+                   size_t text_len = 64)
+{
+  std::string streamed;
+  std::vector<char> text(text_len);
+  ggma_detokenize_state state{};
+  for (size_t n = 1; n <= tokens.size(); ++n)
+  {
+    tokenizer.detokenize_next(tokens.data(), n, &state, text.data(), text.size());
+    streamed += text.data();
+  }
+  while (tokenizer.detokenize_next(tokens.data(), tokens.size(), &state, text.data(),
+                                   text.size(), true) > 0)
+    streamed += text.data();
+  return streamed;
+}
+
+} // namespace
+
+TEST(Tokenizer, DetokenizeNext)
+{
+  FakeTokenizer tokenizer;
+  std::vector<int32_t> tokens = {0, 1};
+  const auto han = bytes("\xED\x95\x9C"); // U+D55C
+  tokens.insert(tokens.end(), han.begin(), han.end());
+  tokens.push_back(2);
+
+  ggma_detokenize_state state{};
+  char text[64];
+  EXPECT_EQ(tokenizer.detokenize_next(tokens.data(), 1, &state, text, sizeof(text)), 5u);
+  EXPECT_STREQ(text, "hello");
+  EXPECT_EQ(tokenizer.detokenize_next(tokens.data(), 2, &state, text, sizeof(text)), 6u);
+  EXPECT_STREQ(text, " world");
+
+  // Bytes of an incomplete character are held back
+  EXPECT_EQ(tokenizer.detokenize_next(tokens.data(), 3, &state, text, sizeof(text)), 0u);
+  EXPECT_STREQ(text, "");
+  EXPECT_EQ(tokenizer.detokenize_next(tokens.data(), 4, &state, text, sizeof(text)), 0u);
+  EXPECT_EQ(tokenizer.detokenize_next(tokens.data(), 5, &state, text, sizeof(text)), 3u);
+  EXPECT_STREQ(text, "\xED\x95\x9C");
+  EXPECT_EQ(tokenizer.detokenize_next(tokens.data(), 6, &state, text, sizeof(text)), 2u);
+  EXPECT_STREQ(text, " !");
+
+  EXPECT_EQ(stream(tokenizer, tokens), tokenizer.decode(tokens.data(), tokens.size()));
+}
+
+TEST(Tokenizer, DetokenizeNextSmallBuffer)
+{
+  FakeTokenizer tokenizer;
+  const std::vector<int32_t> tokens = {0, 1, 2, 0, 1};
+
+  // Text which does not fit is returned later
+  EXPECT_EQ(stream(tokenizer, tokens, 4), tokenizer.decode(tokens.data(), tokens.size()));
+}
+
+TEST(Tokenizer, DetokenizeFlush)
+{
+  FakeTokenizer tokenizer;
+  std::vector<int32_t> tokens = {0};
+  const auto partial = bytes("\xED\x95");
+  tokens.insert(tokens.end(), partial.begin(), partial.end());
+
+  // The stream ends in the middle of a character
+  const std::string streamed = stream(tokenizer, tokens);
+  EXPECT_EQ(streamed, "hello\xEF\xBF\xBD\xEF\xBF\xBD");
+  EXPECT_EQ(streamed, tokenizer.decode(tokens.data(), tokens.size()));
+}
+
+TEST(Tokenizer, DetokenizeNextCost)
+{
+  FakeTokenizer tokenizer;
+  std::vector<int32_t> tokens;
+  for (int i = 0; i < 1000; ++i)
+    tokens.push_back(i % 3);
+
+  const std::string streamed = stream(tokenizer, tokens);
+  const size_t n_decoded = tokenizer.n_decoded;
+  EXPECT_EQ(streamed, tokenizer.decode(tokens.data(), tokens.size()));
+
+  // Each call decodes the new token with the previous one as context
+  EXPECT_LE(n_decoded, 4 * tokens.size());
+}
+
+TEST(Tokenizer, neg_DetokenizeNext)
+{
+  FakeTokenizer tokenizer;
+  const int32_t tokens[] = {0};
+  char text[8];
+  EXPECT_EQ(tokenizer.detokenize_next(tokens, 1, nullptr, text, sizeof(text)), 0u);
+
+  ggma_detokenize_state state{};
+  EXPECT_EQ(tokenizer.detokenize_next(tokens, 1, &state, text, 0), 0u);
+  EXPECT_EQ(tokenizer.detokenize_next(tokens, 0, &state, text, sizeof(text)), 0u);
+  EXPECT_STREQ(text, "");
+}
@@ -117,13 +117,16 @@ NNFW_STATUS nnfw_output_tensorindex(nnfw_session *session, const char *tensornam
 NNFW_STATUS nnfw_set_backends_per_operation(nnfw_session *session, const char *backend_settings);
 
 /**
- * @brief Prepare session to be ready for inference
+ * @brief Prepare session to run models of nnpackage as pipeline
  *
- * This phase may finalize model compilation, scheduling, and additional settings.
+ * Each model of nnpackage, e.g. a partition by circle-partitioner, runs on its own thread as a
+ * pipeline stage. Stage k can run frame t + 1 while stage k + 1 runs frame t. Frames between
+ * stages are queued up to ONERT_PIPELINE_QUEUE_SIZE (default: 2).
  *
- * @deprecated Deprecated since 1.22.1
+ * @note Models are given by nnpackage, so \p map_file_path is not used.
  *
  * @param session the session to be prepared
+ * @param map_file_path unused
  * @return NNFW_STATUS_NO_ERROR if successful
  */
 NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_path = nullptr);
@@ -133,9 +136,8 @@ NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_pa
  *
  * This function must be called after {@link nnfw_prepare_pipeline}, \p inputs given to this
  * function can be reused for many inferences. \p lengths must be greater or equal than the operand
- * requires. if you give empty \p inputs to this function, then this function will join all threads.
- *
- * @deprecated Deprecated since 1.22.1
+ * requires. if you give empty \p inputs to this function, then no more input is pushed, and threads
+ * end after remaining outputs are popped. It blocks while the queue of the first stage is full.
  *
  * @param[in] session Session to the input is to be set
  * @param[in] inputs  Raw buffers for input, it must be \p std::vector<void *> type pointer for
@@ -151,9 +153,9 @@ NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *session, void *inputs, void *
  * @brief       Get last outputs of partitioned model in session
  *
  * This function must be called after {@link nnfw_prepare_pipeline}, \p outputs given to this
- * function must be cleared for memory management.
- *
- * @deprecated Deprecated since 1.22.1
+ * function must be cleared for memory management. Output buffers of the oldest frame are appended
+ * to \p outputs, and they should be released by \p free(). It waits until the frame is computed,
+ * and \p outputs is left unchanged if all frames are popped after the end of inputs.
  *
  * @param[in]   session Session from last outputs is to be extracted
  * @param[out]  outputs Raw buffer for outputs, it must be \p std::vector<void *> type pointer for
@@ -715,6 +717,11 @@ typedef enum
    * Enable internal allocation for model outputs instead of using external buffer
    */
   NNFW_ENABLE_INTERNAL_OUTPUT_ALLOC,
+  /**
+   * Keep the model after prepare to create instances by {@link nnfw_create_instance}
+   * (not require value setting)
+   */
+  NNFW_PREPARE_CONFIG_ENABLE_INSTANCES,
 } NNFW_PREPARE_CONFIG;
 
 /**
@@ -787,6 +794,29 @@ NNFW_STATUS nnfw_set_execute_config(nnfw_session *session, const NNFW_RUN_CONFIG
  */
 NNFW_STATUS nnfw_reset_execute_config(nnfw_session *session);
 
+//////////////////////////////////////////////
+// APIs for concurrent execution
+//////////////////////////////////////////////
+
+/**
+ * @brief     Create an instance of a prepared session
+ *
+ * The instance is a prepared session for the same model, which shares constant tensors
+ * (weights) with @c session and owns its kernels and activation memory.
+ * So @c session and its instances can run simultaneously on different threads,
+ * while several sessions loading the same model would keep a copy of weights each.
+ * Set inputs and outputs of the instance and run it like other sessions,
+ * and close it by {@link nnfw_close_session}. It is independent of @c session's lifetime.
+ *
+ * {@link NNFW_PREPARE_CONFIG_ENABLE_INSTANCES} should be set to @c session
+ * by {@link nnfw_set_prepare_config} before {@link nnfw_prepare}.
+ *
+ * @param[in]  session  Prepared session
+ * @param[out] instance Created instance
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_create_instance(nnfw_session *session, nnfw_session **instance);
+
 #ifdef __cplusplus
 }
 #endif
@@ -19,6 +19,10 @@
 
 #include "nnfw.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 NNFW_STATUS nnfw_set_config(nnfw_session *session, const char *key, const char *value);
 
 NNFW_STATUS nnfw_get_config(nnfw_session *session, const char *key, char *value, size_t value_size);
@@ -70,4 +74,22 @@ NNFW_STATUS nnfw_train_export_circleplus(nnfw_session *session, const char *file
 NNFW_STATUS nnfw_get_output(nnfw_session *session, uint32_t index, nnfw_tensorinfo *out_info,
                             const void **out_buffer);
 
+/**
+ * @brief Python-binding-only API to check whether an internal output buffer is dynamic
+ *
+ * The buffer of a static output retrieved by {@link nnfw_get_output} is kept until the session is
+ * closed, and only overwritten by later runs. The buffer of a dynamic output may be freed or
+ * reallocated by the next run.
+ *
+ * @param[in]    session     The session object
+ * @param[in]    index       Output tensor index
+ * @param[out]   is_dynamic  Whether the output buffer is dynamic
+ * @return       NNFW_STATUS_NO_ERROR on success, otherwise an error code
+ */
+NNFW_STATUS nnfw_output_is_dynamic(nnfw_session *session, uint32_t index, bool *is_dynamic);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif // __NNFW_INTERNAL_H__
@@ -238,22 +238,25 @@ NNFW_STATUS nnfw_set_backends_per_operation(nnfw_session *session, const char *b
   return reinterpret_cast<Session *>(session)->set_backends_per_operation(backend_settings);
 }
 
-NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *)
+NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_path)
 {
   NNFW_RETURN_ERROR_IF_NULL(session);
-  return reinterpret_cast<Session *>(session)->deprecated("nnfw_prepare_pipeline: Deprecated");
+  return reinterpret_cast<Session *>(session)->prepare_pipeline(map_file_path);
 }
 
-NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *session, void *, void *)
+NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *session, void *inputs, void *lengths)
 {
   NNFW_RETURN_ERROR_IF_NULL(session);
-  return reinterpret_cast<Session *>(session)->deprecated("nnfw_push_pipeline_input: Deprecated");
+  return reinterpret_cast<Session *>(session)->push_pipeline_input(
+    reinterpret_cast<std::vector<void *> *>(inputs),
+    reinterpret_cast<std::vector<uint32_t> *>(lengths));
 }
 
-NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *session, void *)
+NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *session, void *outputs)
 {
   NNFW_RETURN_ERROR_IF_NULL(session);
-  return reinterpret_cast<Session *>(session)->deprecated("nnfw_pop_pipeline_output: Deprecated");
+  return reinterpret_cast<Session *>(session)->pop_pipeline_output(
+    reinterpret_cast<std::vector<void *> *>(outputs));
 }
 
 NNFW_STATUS nnfw_set_workspace(nnfw_session *session, const char *dir)
@@ -439,6 +442,13 @@ NNFW_STATUS nnfw_reset_execute_config(nnfw_session *session)
   return reinterpret_cast<Session *>(session)->reset_execute_config();
 }
 
+NNFW_STATUS nnfw_create_instance(nnfw_session *session, nnfw_session **instance)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return reinterpret_cast<Session *>(session)->create_instance(
+    reinterpret_cast<Session **>(instance));
+}
+
 // Internal API
 
 NNFW_STATUS nnfw_set_config(nnfw_session *session, const char *key, const char *value)
@@ -471,3 +481,9 @@ NNFW_STATUS nnfw_get_output(nnfw_session *session, uint32_t index, nnfw_tensorin
   NNFW_RETURN_ERROR_IF_NULL(session);
   return reinterpret_cast<Session *>(session)->get_output(index, out_info, out_buffer);
 }
+
+NNFW_STATUS nnfw_output_is_dynamic(nnfw_session *session, uint32_t index, bool *is_dynamic)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return reinterpret_cast<Session *>(session)->output_is_dynamic(index, is_dynamic);
+}
@@ -19,6 +19,7 @@
 #include "compiler/CompilerFactory.h"
 #include "exporter/CircleExporter.h"
 #include "exporter/train/CheckpointExporter.h"
+#include "ir/Graph.h"
 #include "ir/OpCode.h"
 #include "json/json.h"
 #include "loader/CircleLoader.h"
@@ -213,6 +214,29 @@ uint64_t getBufSize(const nnfw_tensorinfo *info)
   }
   return elmsize[info->dtype] * n;
 }
+
+// Copy graphs of nnpkg to compile them again. Operands of the copy share constant data
+// with the original, so weights are not duplicated.
+std::unique_ptr<onert::ir::NNPkg> cloneNNPkg(const onert::ir::NNPkg &nnpkg)
+{
+  auto clone = std::make_unique<onert::ir::NNPkg>(nnpkg);
+  for (uint16_t i = 0; i < clone->model_count(); ++i)
+  {
+    const auto &model = nnpkg.model(onert::ir::ModelIndex{i});
+    auto model_clone = std::make_shared<onert::ir::Model>();
+    model->iterate([&](const onert::ir::SubgraphIndex &subg_index, const onert::ir::IGraph &subg) {
+      const auto graph = dynamic_cast<const onert::ir::Graph *>(&subg);
+      if (graph == nullptr)
+        throw std::runtime_error{"Only ir::Graph can be cloned"};
+      model_clone->push(subg_index, std::make_shared<onert::ir::Graph>(*graph));
+    });
+    model_clone->bindKernelBuilder(model->getKernelBuilder());
+    for (const auto &[subg_index, name] : model->signatureMap())
+      model_clone->addSignatureMap(subg_index, name);
+    clone->model(onert::ir::ModelIndex{i}) = model_clone;
+  }
+  return clone;
+}
 } // namespace
 
 namespace onert::api
@@ -461,6 +485,10 @@ NNFW_STATUS Session::prepare()
 
   try
   {
+    // Compilation modifies graphs, so keep a copy of them for instances
+    if (_enable_instances)
+      _instance_nnpkg = cloneNNPkg(*_nnpkg);
+
     auto compiler =
       onert::compiler::CompilerFactory::get().create(std::move(_nnpkg), _coptions.get());
     _compiler_artifact = compiler->compile();
@@ -476,6 +504,64 @@ NNFW_STATUS Session::prepare()
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS Session::create_instance(Session **instance)
+{
+  if (instance == nullptr)
+  {
+    setLastErrorMessage("Error during Session::create_instance : instance is NULL");
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  if (!isStatePreparedOrFinishedRun())
+  {
+    setLastErrorMessage("Error during Session::create_instance : Session is not prepared");
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (_instance_nnpkg == nullptr)
+  {
+    setLastErrorMessage(
+      "Error during Session::create_instance : Call nnfw_set_prepare_config(session, "
+      "NNFW_PREPARE_CONFIG_ENABLE_INSTANCES, nullptr) before nnfw_prepare()");
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    // Each instance has its own kernels and activation memory, because kernels are bound to
+    // the tensors they use. Constant data is shared through the operands of _instance_nnpkg.
+    auto new_session = std::unique_ptr<Session>(new Session());
+    new_session->_kernel_registry = _kernel_registry;
+    new_session->_coptions = std::make_unique<onert::compiler::CompilerOptions>(*_coptions);
+    new_session->_model_path = _model_path;
+    new_session->_signature_map = _signature_map;
+    new_session->_selected_signature = _selected_signature;
+    new_session->_enable_instances = true;
+    new_session->_instance_nnpkg = _instance_nnpkg;
+
+    auto compiler = onert::compiler::CompilerFactory::get().create(
+      cloneNNPkg(*_instance_nnpkg), new_session->_coptions.get());
+    new_session->_compiler_artifact = compiler->compile();
+    new_session->_execution =
+      std::make_unique<onert::exec::Execution>(new_session->_compiler_artifact->_executors);
+    new_session->_state = State::PREPARED;
+
+    *instance = new_session.release();
+  }
+  catch (const std::bad_alloc &e)
+  {
+    setLastErrorMessage("Error during Session::create_instance : " + std::string(e.what()));
+    return NNFW_STATUS_OUT_OF_MEMORY;
+  }
+  catch (const std::exception &e)
+  {
+    setLastErrorMessage("Error during Session::create_instance : " + std::string(e.what()));
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS Session::run()
 {
   if (!isStatePreparedOrFinishedRun())
@@ -534,6 +620,104 @@ NNFW_STATUS Session::await()
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS Session::prepare_pipeline(const char *)
+{
+  if (!isStateModelLoaded())
+  {
+    setLastErrorMessage("Error during Session::prepare_pipeline : Invalid state");
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    auto compiler =
+      onert::compiler::CompilerFactory::get().create(std::move(_nnpkg), _coptions.get());
+    _compiler_artifact = compiler->compile();
+
+    // Stages are models of nnpackage, so partition map file is not used
+    const auto queue_size = onert::util::getConfigInt(onert::util::config::PIPELINE_QUEUE_SIZE);
+    if (queue_size <= 0)
+      throw std::runtime_error{"PIPELINE_QUEUE_SIZE should be greater than 0"};
+    _pipeline = std::make_unique<onert::exec::PipelineExecution>(_compiler_artifact->_executors,
+                                                                  queue_size);
+  }
+  catch (const std::exception &e)
+  {
+    setLastErrorMessage("Error during Session::prepare_pipeline : " + std::string(e.what()));
+    return NNFW_STATUS_ERROR;
+  }
+
+  _state = State::PREPARED_PIPELINE;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS Session::push_pipeline_input(std::vector<void *> *inputs,
+                                         std::vector<uint32_t> *lengths)
+{
+  if (!isStatePreparedPipeline())
+  {
+    setLastErrorMessage("Error during Session::push_pipeline_input : Invalid state");
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    // Empty inputs mean the end of inputs
+    if (inputs == nullptr || inputs->empty())
+    {
+      _pipeline->finish();
+      return NNFW_STATUS_NO_ERROR;
+    }
+
+    if (lengths == nullptr || inputs->size() != lengths->size())
+    {
+      setLastErrorMessage("Error during Session::push_pipeline_input : Invalid lengths");
+      return NNFW_STATUS_ERROR;
+    }
+
+    std::vector<const void *> buffers{inputs->begin(), inputs->end()};
+    std::vector<size_t> sizes{lengths->begin(), lengths->end()};
+    _pipeline->pushInput(buffers, sizes);
+  }
+  catch (const std::exception &e)
+  {
+    setLastErrorMessage("Error during Session::push_pipeline_input : " + std::string(e.what()));
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS Session::pop_pipeline_output(std::vector<void *> *outputs)
+{
+  if (!isStatePreparedPipeline())
+  {
+    setLastErrorMessage("Error during Session::pop_pipeline_output : Invalid state");
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (outputs == nullptr)
+  {
+    setLastErrorMessage("Error during Session::pop_pipeline_output : outputs is NULL");
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  try
+  {
+    // outputs is left empty after all frames are popped
+    std::vector<void *> buffers;
+    if (_pipeline->popOutput(buffers))
+      outputs->insert(outputs->end(), buffers.begin(), buffers.end());
+  }
+  catch (const std::exception &e)
+  {
+    setLastErrorMessage("Error during Session::pop_pipeline_output : " + std::string(e.what()));
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS Session::set_input(uint32_t index, NNFW_TYPE, const void *buffer, size_t length)
 {
   if (!isStatePreparedOrFinishedRun())
@@ -1015,6 +1199,40 @@ NNFW_STATUS Session::get_output(uint32_t index, nnfw_tensorinfo *ti, const void
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS Session::output_is_dynamic(uint32_t index, bool *is_dynamic)
+{
+  if (is_dynamic == nullptr)
+  {
+    setLastErrorMessage("Error during Session::output_is_dynamic : is_dynamic is NULL");
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  if (!isStateFinishedRun())
+  {
+    setLastErrorMessage("Error during Session::output_is_dynamic : Invalid state");
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    if (index >= getOutputSize())
+    {
+      setLastErrorMessage("Error during Session::output_is_dynamic : index is out of range : " +
+                          std::to_string(index) + " >= " + std::to_string(getOutputSize()));
+      return NNFW_STATUS_ERROR;
+    }
+
+    *is_dynamic = _execution->outputInfo(onert::ir::IOIndex{index}).isDynamic();
+  }
+  catch (const std::exception &e)
+  {
+    setLastErrorMessage("Error during Session::output_is_dynamic : " + std::string(e.what()));
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS Session::set_available_backends(const char *backends)
 {
   if (!isStateModelLoaded())
@@ -1187,7 +1405,9 @@ NNFW_STATUS Session::set_config(const char *key, const char *value)
   {
     _coptions->he_profiling_mode = toBool(value);
   }
-  else if (skey == config::ENABLE_LOG || skey == config::NUM_THREADS)
+  else if (skey == config::ENABLE_LOG || skey == config::NUM_THREADS ||
+           skey == config::TRAINING_RECOMPUTE || skey == config::TRAINING_FUSE_OPTIMIZER ||
+           skey == config::TRAINING_CLIP_NORM)
   {
     onert::util::CfgKeyValues keyValues;
     keyValues[skey] = std::string(value);
@@ -2118,6 +2338,20 @@ bool Session::isStatePreparedOrFinishedTraining()
   return isStatePreparedTraining() || isStateFinishedTraining();
 }
 
+bool Session::isStatePreparedPipeline()
+{
+  if (_state == State::PREPARED_PIPELINE)
+  {
+    assert(_nnpkg == nullptr);
+    assert(_pipeline != nullptr);
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+}
+
 NNFW_STATUS Session::set_quantization_type(NNFW_QUANTIZE_TYPE qtype)
 {
   using onert::odc::QuantizeType;
@@ -2312,6 +2546,9 @@ NNFW_STATUS Session::set_prepare_config(const NNFW_PREPARE_CONFIG key, const cha
     case NNFW_ENABLE_INTERNAL_OUTPUT_ALLOC:
       _coptions->internal_output_alloc = true;
       break;
+    case NNFW_PREPARE_CONFIG_ENABLE_INSTANCES:
+      _enable_instances = true;
+      break;
     default:
       setLastErrorMessage("Error during Session::set_prepare_config : Invalid config key");
       return NNFW_STATUS_ERROR;
@@ -2329,6 +2566,7 @@ NNFW_STATUS Session::reset_prepare_config()
   }
 
   _coptions->he_profiling_mode = false;
+  _enable_instances = false;
 
   return NNFW_STATUS_NO_ERROR;
 }
@@ -23,6 +23,7 @@
 #include "compiler/CompilerOptions.h"
 #include "compiler/ICompiler.h"
 #include "exec/Execution.h"
+#include "exec/PipelineExecution.h"
 #include "ir/NNPkg.h"
 #include "ir/train/TrainingInfo.h"
 #include "odc/CodegenManager.h"
@@ -84,7 +85,8 @@ private:
     RUNNING,           //< Execution is in progress (only for asynchronous execution)
     FINISHED_RUN,      //< Executed at least once
     PREPARED_TRAINING, //< Prepared for training
-    FINISHED_TRAINING  //< Trained at least once
+    FINISHED_TRAINING, //< Trained at least once
+    PREPARED_PIPELINE  //< Prepared for pipelined execution of multiple models
   };
 
   enum class AutoCompilationState
@@ -114,6 +116,10 @@ public:
   NNFW_STATUS run_async();
   NNFW_STATUS await();
 
+  NNFW_STATUS prepare_pipeline(const char *map_file_path);
+  NNFW_STATUS push_pipeline_input(std::vector<void *> *inputs, std::vector<uint32_t> *lengths);
+  NNFW_STATUS pop_pipeline_output(std::vector<void *> *outputs);
+
   NNFW_STATUS set_input(uint32_t index, NNFW_TYPE type, const void *buffer, size_t length);
   NNFW_STATUS set_output(uint32_t index, NNFW_TYPE type, void *buffer, size_t length);
 
@@ -149,6 +155,7 @@ public:
   NNFW_STATUS get_config(const char *key, char *value, size_t value_size);
   NNFW_STATUS load_circle_from_buffer(uint8_t *buffer, size_t size);
   NNFW_STATUS get_output(uint32_t index, nnfw_tensorinfo *out_info, const void **out_buffer);
+  NNFW_STATUS output_is_dynamic(uint32_t index, bool *is_dynamic);
 
   //
   // Experimental API
@@ -170,6 +177,11 @@ public:
    */
   NNFW_STATUS set_backends_per_operation(const char *backend_settings);
 
+  /**
+   * @brief   Create a prepared session which shares constant data with this session
+   */
+  NNFW_STATUS create_instance(Session **instance);
+
   NNFW_STATUS train_get_traininfo(nnfw_train_info *info);
   NNFW_STATUS train_set_traininfo(const nnfw_train_info *info);
   NNFW_STATUS train_prepare();
@@ -217,6 +229,7 @@ private:
   bool isStatePreparedTraining();
   bool isStateFinishedTraining();
   bool isStatePreparedOrFinishedTraining();
+  bool isStatePreparedPipeline();
 
 private:
   State _state{State::INITIALIZED};
@@ -224,6 +237,10 @@ private:
   std::unique_ptr<onert::compiler::CompilerOptions> _coptions;
   std::unique_ptr<onert::compiler::CompilerArtifact> _compiler_artifact;
   std::unique_ptr<onert::exec::Execution> _execution;
+  std::unique_ptr<onert::exec::PipelineExecution> _pipeline;
+  bool _enable_instances = false;
+  // Graphs before compilation, compiled again by create_instance()
+  std::shared_ptr<const onert::ir::NNPkg> _instance_nnpkg;
   std::shared_ptr<onert::api::CustomKernelRegistry> _kernel_registry;
   std::unique_ptr<onert::ir::train::TrainingInfo> _train_info;
   std::unique_ptr<onert::odc::QuantizeManager> _quant_manager;
@@ -17,6 +17,7 @@
 #ifndef __ONERT_API_PYTHON_NNFW_API_WRAPPER_H__
 #define __ONERT_API_PYTHON_NNFW_API_WRAPPER_H__
 
+#include <memory>
 #include <string>
 
 #include "nnfw.h"
@@ -127,6 +128,11 @@ class NNFW_SESSION
 {
 private:
   nnfw_session *session;
+  // Owner of session, shared with views over outputs to close session after the last view is gone
+  std::shared_ptr<nnfw_session> session_owner;
+  // Buffers given to set_input() and set_output(), kept alive while runtime refers to them
+  std::vector<py::object> inputs;
+  std::vector<py::object> outputs;
 
 public:
   NNFW_SESSION(const char *package_file_path, const char *backends);
@@ -139,33 +145,19 @@ public:
   void run_async();
   void wait();
   /**
-   * @brief   process input array according to data type of numpy array sent by Python
-   *          (int, float, uint8_t, bool, int64_t, int8_t, int16_t)
+   * @brief   Pass memory of buffer sent by Python to runtime as input without copy
+   *
+   * @c buffer must be C-contiguous and have the data type of the input. It is kept alive until
+   * another buffer is set for the input.
    */
-  template <typename T> void set_input(uint32_t index, py::array_t<T> &buffer)
-  {
-    nnfw_tensorinfo tensor_info;
-    nnfw_input_tensorinfo(this->session, index, &tensor_info);
-    NNFW_TYPE type = tensor_info.dtype;
-    uint32_t input_elements = num_elems(&tensor_info);
-    size_t length = sizeof(T) * input_elements;
-
-    ensure_status(nnfw_set_input(session, index, type, buffer.request().ptr, length));
-  }
+  void set_input(uint32_t index, const py::buffer &buffer);
   /**
-   * @brief   process output array according to data type of numpy array sent by Python
-   *          (int, float, uint8_t, bool, int64_t, int8_t, int16_t)
+   * @brief   Pass memory of writable buffer sent by Python to runtime as output without copy
+   *
+   * @c buffer must be C-contiguous and have the data type of the output. It is kept alive until
+   * another buffer is set for the output.
    */
-  template <typename T> void set_output(uint32_t index, py::array_t<T> &buffer)
-  {
-    nnfw_tensorinfo tensor_info;
-    nnfw_output_tensorinfo(this->session, index, &tensor_info);
-    NNFW_TYPE type = tensor_info.dtype;
-    uint32_t output_elements = num_elems(&tensor_info);
-    size_t length = sizeof(T) * output_elements;
-
-    ensure_status(nnfw_set_output(session, index, type, buffer.request().ptr, length));
-  }
+  void set_output(uint32_t index, const py::buffer &buffer);
   uint32_t input_size();
   uint32_t output_size();
   // process the input layout by receiving a string from Python instead of NNFW_LAYOUT
@@ -178,7 +170,14 @@ public:
   //////////////////////////////////////////////
   // Internal APIs
   //////////////////////////////////////////////
-  py::array get_output(uint32_t index);
+  /**
+   * @brief   Get the internally-allocated output
+   *
+   * If @c copy is false, it returns a read-only view over memory of runtime for a static output.
+   * The view keeps the memory alive even after close_session(), and is overwritten by the next
+   * run. A dynamic output may be freed or reallocated by the next run, so it is always copied.
+   */
+  py::array get_output(uint32_t index, bool copy = true);
 
   //////////////////////////////////////////////
   // Experimental APIs for inference
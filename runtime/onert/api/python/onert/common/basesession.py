@@ -123,7 +123,9 @@ class BaseSession:
                 raise OnertError(f"Failed to get input tensorinfo #{i}: {e}") from e
 
             if len(inputs_array) > i:
-                input_array = np.array(inputs_array[i], dtype=input_tensorinfo.dtype)
+                # No copy if the array is already C-contiguous with the input type
+                input_array = np.ascontiguousarray(inputs_array[i],
+                                                   dtype=input_tensorinfo.dtype)
             else:
                 print(
                     f"Model's input size is {size}, but given inputs_array size is {len(inputs_array)}.\n{i}-th index input is replaced by an array filled with 0."
@@ -150,12 +152,14 @@ class BaseSession:
 
             self.inputs.append(input_array)
 
-    def _set_outputs(self, size):
+    def _set_outputs(self, size, copy=True):
         """
         Set the output tensors for the session.
 
         Args:
             size (int): Number of output tensors.
+            copy (bool): If False, static outputs are read-only views over runtime memory,
+                         which are overwritten by the next run. Dynamic outputs are copied.
 
 	    Raises:
             ValueError: If session uninitialized.
@@ -169,7 +173,7 @@ class BaseSession:
         self.outputs = []
         for i in range(size):
             try:
-                output_array = self.session.get_output(i)
+                output_array = self.session.get_output(i, copy)
             except ValueError:
                 raise
             except Exception as e:
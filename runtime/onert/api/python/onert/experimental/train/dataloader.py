@@ -1,12 +1,18 @@
 import os
+import queue
+import threading
 import numpy as np
 from typing import List, Tuple, Union, Optional, Any, Iterator
 
+Batch = Tuple[List[np.ndarray], List[np.ndarray]]
+
 
 class DataLoader:
     """
     A flexible DataLoader to manage training and validation data.
     Automatically detects whether inputs are paths or NumPy arrays.
+    Files are memory-mapped and batches are assembled while iterating, optionally in
+    a shuffled order and on a background thread ahead of the training step.
     """
     def __init__(self,
                  input_dataset: Union[List[np.ndarray], np.ndarray, str],
@@ -14,7 +20,10 @@ class DataLoader:
                  batch_size: int,
                  input_shape: Optional[Tuple[int, ...]] = None,
                  expected_shape: Optional[Tuple[int, ...]] = None,
-                 dtype: Any = np.float32) -> None:
+                 dtype: Any = np.float32,
+                 shuffle: bool = False,
+                 seed: int = 0,
+                 prefetch: int = 0) -> None:
         """
         Initialize the DataLoader.
 
@@ -29,13 +38,25 @@ class DataLoader:
             input_shape (tuple[int, ...], optional): Shape of the input data if raw format is used.
             expected_shape (tuple[int, ...], optional): Shape of the expected data if raw format is used.
             dtype (type, optional): Data type of the raw file (default: np.float32).
+            shuffle (bool, optional): Visit samples in a new random order every epoch
+                (default: False).
+            seed (int, optional): Seed of the random order, combined with the epoch (default: 0).
+            prefetch (int, optional): Number of batches assembled ahead on a background thread.
+                0 assembles each batch when it is requested (default: 0).
         """
+        if prefetch < 0:
+            raise ValueError("Prefetch must not be negative.")
+
         self.batch_size: int = batch_size
+        self.shuffle: bool = shuffle
+        self.seed: int = seed
+        self.prefetch: int = prefetch
+        self.epoch: int = 0
         self.inputs: List[np.ndarray] = self._process_dataset(input_dataset, input_shape,
                                                               dtype)
         self.expecteds: List[np.ndarray] = self._process_dataset(
             expected_dataset, expected_shape, dtype)
-        self.batched_inputs: List[List[np.ndarray]] = []
+        self._iterator: Optional[Iterator[Batch]] = None
 
         # Verify data consistency
         self.num_samples: int = self.inputs[0].shape[0]  # Batch dimension
@@ -43,8 +64,7 @@ class DataLoader:
             raise ValueError(
                 "Input data and expected data must have the same number of samples.")
 
-        # Precompute batches
-        self.batched_inputs, self.batched_expecteds = self._create_batches()
+        self.num_batches: int = (self.num_samples + self.batch_size - 1) // self.batch_size
 
     def _process_dataset(self,
                          data: Union[List[np.ndarray], np.ndarray, str],
@@ -98,8 +118,8 @@ class DataLoader:
         _, ext = os.path.splitext(file_path)
 
         if ext == ".npy":
-            # Load .npy file
-            return np.load(file_path)
+            # Map .npy file, whose samples are read when batches are assembled
+            return np.load(file_path, mmap_mode="r")
         elif ext in [".bin", ".raw"]:
             # Load raw binary file
             if shape is None:
@@ -136,83 +156,125 @@ class DataLoader:
                 f"({expected_size} bytes) based on the provided shape {shape} and dtype {dtype}."
             )
 
-        # Read and load the raw data
-        with open(file_path, "rb") as f:
-            data = f.read()
-        array = np.frombuffer(data, dtype=dtype)
-        if array.size != expected_elements:
-            raise ValueError(
-                f"Raw data size does not match the expected shape: {shape}. "
-                f"Expected {expected_elements} elements, got {array.size} elements.")
-        return array.reshape(shape)
+        # Map the raw data, whose samples are read when batches are assembled
+        return np.memmap(file_path, dtype=dtype, mode="r", shape=tuple(shape))
 
-    def _create_batches(self) -> Tuple[List[List[np.ndarray]], List[List[np.ndarray]]]:
+    def _sample_order(self) -> Optional[np.ndarray]:
         """
-        Precompute batches for inputs and expected outputs.
+        Get the order of samples for the next epoch.
 
         Returns:
-            tuple: Lists of batched inputs and batched expecteds.
+            np.ndarray | None: Permutation of sample indices, or None for the stored order.
         """
-        batched_inputs: List[List[np.ndarray]] = []
-        batched_expecteds: List[List[np.ndarray]] = []
+        if not self.shuffle:
+            return None
+        rng = np.random.default_rng(self.seed + self.epoch)
+        return rng.permutation(self.num_samples)
 
-        for batch_start in range(0, self.num_samples, self.batch_size):
-            batch_end = min(batch_start + self.batch_size, self.num_samples)
-
-            # Collect batched inputs
-            inputs_batch = [
-                input_array[batch_start:batch_end] for input_array in self.inputs
-            ]
-            if batch_end - batch_start < self.batch_size:
-                # Resize the last batch to match batch_size
-                inputs_batch = [
-                    np.resize(batch, (self.batch_size, *batch.shape[1:]))
-                    for batch in inputs_batch
-                ]
+    def _get_batch(self, order: Optional[np.ndarray], index: int) -> Batch:
+        """
+        Assemble a batch by copying its samples.
 
-            batched_inputs.append(inputs_batch)
+        Args:
+            order (np.ndarray, optional): Order of samples in this epoch.
+            index (int): Index of the batch in this epoch.
 
-            # Collect batched expecteds
-            expecteds_batch = [
-                expected_array[batch_start:batch_end] for expected_array in self.expecteds
-            ]
-            if batch_end - batch_start < self.batch_size:
-                # Resize the last batch to match batch_size
-                expecteds_batch = [
-                    np.resize(batch, (self.batch_size, *batch.shape[1:]))
-                    for batch in expecteds_batch
-                ]
+        Returns:
+            tuple: (inputs, expecteds) of the batch.
+        """
+        batch_start = index * self.batch_size
+        batch_end = min(batch_start + self.batch_size, self.num_samples)
+        positions = np.arange(batch_start, batch_end)
+        if batch_end - batch_start < self.batch_size:
+            # Resize the last batch to match batch_size by repeating its samples
+            positions = np.resize(positions, self.batch_size)
+        samples = positions if order is None else order[positions]
+
+        # Copied samples are plain arrays, not memory-mapped ones
+        inputs_batch = [np.asarray(np.take(array, samples, axis=0)) for array in self.inputs]
+        expecteds_batch = [
+            np.asarray(np.take(array, samples, axis=0)) for array in self.expecteds
+        ]
+        return inputs_batch, expecteds_batch
 
-            batched_expecteds.append(expecteds_batch)
+    def _batches(self, order: Optional[np.ndarray]) -> Iterator[Batch]:
+        """
+        Assemble batches of an epoch when they are requested.
+        """
+        for index in range(self.num_batches):
+            yield self._get_batch(order, index)
 
-        return batched_inputs, batched_expecteds
+    def _prefetch_batches(self, order: Optional[np.ndarray]) -> Iterator[Batch]:
+        """
+        Assemble batches of an epoch on a background thread, up to prefetch batches ahead.
+        """
+        batches: queue.Queue = queue.Queue(maxsize=self.prefetch)
+        stop = threading.Event()
+
+        def put(item: Any) -> bool:
+            while not stop.is_set():
+                try:
+                    batches.put(item, timeout=0.1)
+                    return True
+                except queue.Full:
+                    continue
+            return False
+
+        def produce() -> None:
+            try:
+                for index in range(self.num_batches):
+                    if not put(self._get_batch(order, index)):
+                        return
+                put(None)
+            except Exception as e:
+                put(e)
+
+        producer = threading.Thread(target=produce, daemon=True)
+        producer.start()
+        try:
+            while True:
+                item = batches.get()
+                if item is None:
+                    return
+                if isinstance(item, Exception):
+                    raise item
+                yield item
+        finally:
+            # Stop the producer if iteration ends early
+            stop.set()
+            producer.join()
+
+    def __len__(self) -> int:
+        """
+        Number of batches in an epoch.
+        """
+        return self.num_batches
 
-    def __iter__(self) -> Iterator[Tuple[List[np.ndarray], List[np.ndarray]]]:
+    def __iter__(self) -> Iterator[Batch]:
         """
-        Make the DataLoader iterable.
+        Make the DataLoader iterable. Each iteration is an epoch.
 
         Returns:
             self
         """
-        self.index = 0
+        order = self._sample_order()
+        self.epoch += 1
+        if self.prefetch > 0:
+            self._iterator = self._prefetch_batches(order)
+        else:
+            self._iterator = self._batches(order)
         return self
 
-    def __next__(self) -> Tuple[List[np.ndarray], List[np.ndarray]]:
+    def __next__(self) -> Batch:
         """
         Return the next batch of data.
 
         Returns:
             tuple: (inputs, expecteds) for the next batch.
         """
-        if self.index >= len(self.batched_inputs):
-            raise StopIteration
-
-        # Retrieve precomputed batch
-        input_batch = self.batched_inputs[self.index]
-        expected_batch = self.batched_expecteds[self.index]
-
-        self.index += 1
-        return input_batch, expected_batch
+        if self._iterator is None:
+            iter(self)
+        return next(self._iterator)
 
     def split(self, validation_split: float) -> Tuple["DataLoader", "DataLoader"]:
         """
@@ -238,7 +300,15 @@ class DataLoader:
             expected_array[split_index:] for expected_array in self.expecteds
         ]
 
-        train_loader = DataLoader(train_inputs, train_expecteds, self.batch_size)
-        val_loader = DataLoader(val_inputs, val_expecteds, self.batch_size)
+        train_loader = DataLoader(train_inputs,
+                                  train_expecteds,
+                                  self.batch_size,
+                                  shuffle=self.shuffle,
+                                  seed=self.seed,
+                                  prefetch=self.prefetch)
+        val_loader = DataLoader(val_inputs,
+                                val_expecteds,
+                                self.batch_size,
+                                prefetch=self.prefetch)
 
         return train_loader, val_loader
@@ -28,7 +28,8 @@ class session(BaseSession):
         self,
         inputs_array: List[np.ndarray],
         *,
-        measure: bool = False
+        measure: bool = False,
+        copy_outputs: bool = True
     ) -> Union[List[np.ndarray], Tuple[List[np.ndarray], Dict[str, float]]]:
         """
         Run a complete inference cycle:
@@ -43,6 +44,10 @@ class session(BaseSession):
         Args:
             inputs_array (list[np.ndarray]): List of numpy arrays representing the input data.
             measure (bool): If True, measure prepare/io/run latencies (ms).
+            copy_outputs (bool): If False, return read-only views over runtime memory
+                                 instead of copies for static outputs. They are
+                                 overwritten by the next infer(). Dynamic outputs, whose
+                                 memory may be freed by the next infer(), are copied.
 
         Returns:
             list[np.ndarray]: A list containing the output numpy arrays.
@@ -122,7 +127,7 @@ class session(BaseSession):
 
         try:
             with self._time_block(metrics, 'output_time_ms', measure):
-                self._set_outputs(self.session.output_size())
+                self._set_outputs(self.session.output_size(), copy_outputs)
         except ValueError:
             raise
         except Exception as e:
@@ -47,76 +47,16 @@ void bind_nnfw_session(py::module_ &m)
     .def("run", &NNFW_SESSION::run, "Run inference")
     .def("run_async", &NNFW_SESSION::run_async, "Run inference asynchronously")
     .def("wait", &NNFW_SESSION::wait, "Wait for asynchronous run to finish")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<float> &buffer) {
-        session.set_input<float>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int> &buffer) {
-        session.set_input<int>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<uint8_t> &buffer) {
-        session.set_input<uint8_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<bool> &buffer) {
-        session.set_input<bool>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int64_t> &buffer) {
-        session.set_input<int64_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int8_t> &buffer) {
-        session.set_input<int8_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int16_t> &buffer) {
-        session.set_input<int16_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
+    .def("set_input", &NNFW_SESSION::set_input, py::arg("index"), py::arg("buffer"),
+         "Set input buffer, which is used by runtime without copy\n"
+         "Parameters:\n"
+         "\tindex (int): Index of input to be set (0-indexed)\n"
+         "\tbuffer (numpy): C-contiguous buffer with the data type of input")
+    .def("set_output", &NNFW_SESSION::set_output, py::arg("index"), py::arg("buffer"),
+         "Set output buffer, which is written by runtime without copy\n"
+         "Parameters:\n"
+         "\tindex (int): Index of output to be set (0-indexed)\n"
+         "\tbuffer (numpy): Writable C-contiguous buffer with the data type of output")
     .def("input_size", &NNFW_SESSION::input_size,
          "Get the number of inputs defined in loaded model\n"
          "Returns:\n"
@@ -143,13 +83,17 @@ void bind_nnfw_session(py::module_ &m)
          "\tindex (int): Index of output\n"
          "Returns:\n"
          "\ttensorinfo: Tensor info (shape, type, etc)")
-    .def("get_output", &NNFW_SESSION::get_output, py::arg("index"),
+    .def("get_output", &NNFW_SESSION::get_output, py::arg("index"), py::arg("copy") = true,
          R"pbdoc(
-         Retrieve the internally-allocated dynamic output as a copy.
+         Retrieve the internally-allocated dynamic output.
          Parameters:
              index (int): Index of the output tensor (0-indexed)
+             copy (bool): If False, return a read-only view over the internal buffer of a
+                          static output. The view is overwritten by the next run, and keeps
+                          the buffer alive even after the session is closed. A dynamic output
+                          is always copied, as the next run may free its buffer.
          Returns:
-             numpy.ndarray: a copy of the internal buffer
+             numpy.ndarray: a copy of or a view over the internal buffer
          )pbdoc")
     .def("set_prepare_config", &NNFW_SESSION::set_prepare_config, py::arg("config"),
          "Set configuration to prepare");
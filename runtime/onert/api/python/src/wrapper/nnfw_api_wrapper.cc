@@ -133,10 +133,43 @@ void set_dims(tensorinfo &tensor_info, const py::list &array)
   }
 }
 
+namespace
+{
+
+py::dtype getDtype(NNFW_TYPE type)
+{
+  auto np = py::module_::import("numpy");
+  return np.attr("dtype")(py::str(getStringType(type))).cast<py::dtype>();
+}
+
+// Get memory of buffer to be used by runtime as it is, i.e. C-contiguous with the tensor type
+py::buffer_info requestTensorBuffer(const py::buffer &buffer, NNFW_TYPE type, bool writable)
+{
+  py::buffer_info info = buffer.request(writable);
+
+  if (!py::dtype(info).equal(getDtype(type)))
+    throw py::value_error(std::string("Buffer must have data type '") + getStringType(type) +
+                          "', but it is '" + py::str(py::dtype(info)).cast<std::string>() + "'");
+
+  ssize_t stride = info.itemsize;
+  for (auto i = info.ndim; i > 0; --i)
+  {
+    if (info.shape[i - 1] > 1 && info.strides[i - 1] != stride)
+      throw py::value_error("Buffer must be C-contiguous");
+    stride *= info.shape[i - 1];
+  }
+
+  return info;
+}
+
+} // namespace
+
 NNFW_SESSION::NNFW_SESSION(const char *package_file_path, const char *backends)
 {
   this->session = nullptr;
   ensure_status(nnfw_create_session(&(this->session)));
+  this->session_owner = std::shared_ptr<nnfw_session>(
+    this->session, [](nnfw_session *session) { nnfw_close_session(session); });
   ensure_status(nnfw_load_model_from_file(this->session, package_file_path));
   ensure_status(nnfw_set_available_backends(this->session, backends));
 }
@@ -150,7 +183,8 @@ NNFW_SESSION::~NNFW_SESSION()
 
 void NNFW_SESSION::close_session()
 {
-  ensure_status(nnfw_close_session(this->session));
+  // Views over outputs may still refer to memory of session, which closes it when they are gone
+  this->session_owner.reset();
   this->session = nullptr;
 }
 void NNFW_SESSION::set_input_tensorinfo(uint32_t index, const tensorinfo *tensor_info)
@@ -165,6 +199,33 @@ void NNFW_SESSION::set_input_tensorinfo(uint32_t index, const tensorinfo *tensor
   ensure_status(nnfw_set_input_tensorinfo(session, index, &ti));
 }
 void NNFW_SESSION::prepare() { ensure_status(nnfw_prepare(session)); }
+void NNFW_SESSION::set_input(uint32_t index, const py::buffer &buffer)
+{
+  nnfw_tensorinfo tensor_info;
+  ensure_status(nnfw_input_tensorinfo(session, index, &tensor_info));
+  const auto info = requestTensorBuffer(buffer, tensor_info.dtype, false);
+
+  // Runtime checks the length against the input shape, which may be changed until run
+  const size_t length = info.size * info.itemsize;
+  ensure_status(nnfw_set_input(session, index, tensor_info.dtype, info.ptr, length));
+
+  if (inputs.size() <= index)
+    inputs.resize(index + 1);
+  inputs[index] = buffer;
+}
+void NNFW_SESSION::set_output(uint32_t index, const py::buffer &buffer)
+{
+  nnfw_tensorinfo tensor_info;
+  ensure_status(nnfw_output_tensorinfo(session, index, &tensor_info));
+  const auto info = requestTensorBuffer(buffer, tensor_info.dtype, true);
+
+  const size_t length = info.size * info.itemsize;
+  ensure_status(nnfw_set_output(session, index, tensor_info.dtype, info.ptr, length));
+
+  if (outputs.size() <= index)
+    outputs.resize(index + 1);
+  outputs[index] = buffer;
+}
 void NNFW_SESSION::run() { ensure_status(nnfw_run(session)); }
 void NNFW_SESSION::run_async() { ensure_status(nnfw_run_async(session)); }
 void NNFW_SESSION::wait() { ensure_status(nnfw_await(session)); }
@@ -217,7 +278,7 @@ tensorinfo NNFW_SESSION::output_tensorinfo(uint32_t index)
 //////////////////////////////////////////////
 // Internal APIs
 //////////////////////////////////////////////
-py::array NNFW_SESSION::get_output(uint32_t index)
+py::array NNFW_SESSION::get_output(uint32_t index, bool copy)
 {
   // First call into the C API
   nnfw_tensorinfo out_info = {};
@@ -225,22 +286,35 @@ py::array NNFW_SESSION::get_output(uint32_t index)
   ensure_status(nnfw_get_output(session, index, &out_info, &out_buffer));
 
   // Convert nnfw_tensorinfo to our python-visible struct
-  size_t num_elements = 1;
   std::vector<ssize_t> shape;
   shape.reserve(out_info.rank);
   for (int i = 0; i < out_info.rank; ++i)
   {
     shape.push_back(static_cast<ssize_t>(out_info.dims[i]));
-    num_elements *= static_cast<size_t>(out_info.dims[i]);
   }
 
-  // Wrap the raw buffer in a numpy array;
-  auto np = py::module_::import("numpy");
-  py::dtype dt = np.attr("dtype")(py::str(getStringType(out_info.dtype))).cast<py::dtype>();
-  size_t itemsize = dt.attr("itemsize").cast<size_t>();
+  py::dtype dt = getDtype(out_info.dtype);
 
-  py::array arr(dt, shape);
-  std::memcpy(arr.mutable_data(), out_buffer, num_elements * itemsize);
+  // Memory of dynamic output may be freed by the next run, which cannot be known by a view
+  bool is_dynamic = true;
+  if (!copy)
+    ensure_status(nnfw_output_is_dynamic(session, index, &is_dynamic));
+
+  py::array arr;
+  if (copy || is_dynamic)
+  {
+    arr = py::array(dt, shape);
+    std::memcpy(arr.mutable_data(), out_buffer, arr.nbytes());
+  }
+  else
+  {
+    // Wrap the raw buffer in a numpy array, whose base shares the ownership of session
+    auto owner = new std::shared_ptr<nnfw_session>(session_owner);
+    py::capsule base(owner, [](void *ptr) {
+      delete static_cast<std::shared_ptr<nnfw_session> *>(ptr);
+    });
+    arr = py::array(dt, shape, out_buffer, base);
+  }
   arr.attr("flags").attr("writeable") = false;
 
   return arr;
@@ -52,6 +52,8 @@ FunctionMap BackendContext::genKernels()
   for (auto &&op_ind : _data.op_order)
   {
     auto fn_seq = kernel_gen->generate(op_ind);
+    if (_external_context->eigen_device())
+      fn_seq->wrap<EigenDeviceFunction>(_external_context);
     ret.emplace(op_ind, std::move(fn_seq));
   }
 
@@ -69,4 +71,13 @@ FunctionMap BackendContext::genKernels()
   return ret;
 }
 
+std::vector<std::pair<std::string, uint64_t>> BackendContext::counters() const
+{
+  const auto stats = tensor_builder->dynamicTensorManager()->dynamic_mem_mgr()->stats();
+  return {{"dynamic_mem_pool_hits", stats.hits},
+          {"dynamic_mem_pool_misses", stats.misses},
+          {"dynamic_mem_pool_footprint", stats.footprint},
+          {"dynamic_mem_pool_peak_footprint", stats.peak_footprint}};
+}
+
 } // namespace onert::backend::cpu
@@ -35,10 +35,13 @@ public:
     : onert::backend::BackendContext(backend, std::move(data), tensor_registry),
       tensor_builder{tensor_builder}, kernel_gen{kernel_gen}, _external_context(new ExternalContext)
   {
+    if (_data.thread_budget)
+      _external_context->setThreadBudget(*_data.thread_budget, _data.num_threads);
   }
 
   ITensorRegistry *genTensors() override;
   FunctionMap genKernels() override;
+  std::vector<std::pair<std::string, uint64_t>> counters() const override;
 
   std::shared_ptr<ExternalContext> external_context() { return _external_context; }
 
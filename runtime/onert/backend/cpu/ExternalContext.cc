@@ -16,58 +16,172 @@
 
 #include "ExternalContext.h"
 
-#include <fstream>
-#include <string>
+#include <cker/eigen/EigenSupport.h>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
 #include <thread>
-#include <unordered_set>
+#include <unordered_map>
+#include <vector>
+
+namespace onert::backend::cpu
+{
+
+// ruy contexts of the threads running kernels with an ExternalContext
+//
+// Threads refer to the pool weakly, so a thread exiting first releases its context from the pool
+// and a thread outliving the ExternalContext does not touch it.
+struct RuyContextPool
+{
+  std::mutex mutex;
+  int32_t max_num_threads = 1;
+  std::unordered_map<std::thread::id, std::unique_ptr<ruy::Context>> contexts;
+};
+
+} // namespace onert::backend::cpu
 
 namespace
 {
 
-int32_t countPhysicalCores()
+using onert::backend::cpu::RuyContextPool;
+
+/**
+ * @brief ruy contexts that the thread got from pools, found without locking the pools
+ */
+class ThreadRuyContexts
 {
-#ifdef __linux__
-  // Count physical cores, not threads by checking thread_siblings.
-  std::unordered_set<std::string> siblings;
-  for (uint32_t cpu = 0; cpu < UINT32_MAX; ++cpu)
+public:
+  ~ThreadRuyContexts()
   {
-    std::ifstream thread_siblings("/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
-                                  "/topology/thread_siblings");
-    if (!thread_siblings.is_open())
+    for (const auto &entry : _entries)
     {
-      break;
+      if (auto pool = entry.pool.lock())
+      {
+        std::lock_guard<std::mutex> lock{pool->mutex};
+        pool->contexts.erase(std::this_thread::get_id());
+      }
     }
+  }
 
-    std::string line;
-    if (std::getline(thread_siblings, line))
+  ruy::Context *get(const std::shared_ptr<RuyContextPool> &pool)
+  {
+    // A live pool at the same address is the same pool, as the pools of entries are alive
+    for (const auto &entry : _entries)
+      if (entry.address == pool.get() && !entry.pool.expired())
+        return entry.context;
+
+    _entries.erase(std::remove_if(_entries.begin(), _entries.end(),
+                                  [](const Entry &entry) { return entry.pool.expired(); }),
+                   _entries.end());
+
+    std::lock_guard<std::mutex> lock{pool->mutex};
+    auto &context = pool->contexts[std::this_thread::get_id()];
+    if (!context)
     {
-      siblings.insert(line);
+      context = std::make_unique<ruy::Context>();
+      context->set_max_num_threads(pool->max_num_threads);
     }
+    _entries.push_back({pool.get(), pool, context.get()});
+    return context.get();
   }
-  if (!siblings.empty())
+
+private:
+  struct Entry
+  {
+    const RuyContextPool *address;
+    std::weak_ptr<RuyContextPool> pool;
+    ruy::Context *context;
+  };
+  std::vector<Entry> _entries;
+};
+
+thread_local ThreadRuyContexts thread_ruy_contexts;
+
+/**
+ * @brief Thread pool interface counting tasks scheduled on the global Eigen thread pool
+ */
+class CountingEigenThreadPool : public Eigen::ThreadPoolInterface
+{
+public:
+  CountingEigenThreadPool(Eigen::ThreadPoolInterface *pool,
+                          std::shared_ptr<onert::util::ThreadPoolCounter> counter)
+    : _pool{pool}, _counter{std::move(counter)}
   {
-    return static_cast<int32_t>(siblings.size());
   }
-#endif
 
-  unsigned int n_threads = std::thread::hardware_concurrency();
-  return n_threads > 0 ? (n_threads <= 4 ? n_threads : n_threads / 2) : 1;
-}
+  void Schedule(std::function<void()> fn) override
+  {
+    _pool->Schedule([fn = std::move(fn), counter = _counter]() {
+      const auto begin = std::chrono::steady_clock::now();
+      fn();
+      counter->record(std::chrono::steady_clock::now() - begin);
+    });
+  }
+  int NumThreads() const override { return _pool->NumThreads(); }
+  int CurrentThreadId() const override { return _pool->CurrentThreadId(); }
+
+private:
+  Eigen::ThreadPoolInterface *_pool;
+  std::shared_ptr<onert::util::ThreadPoolCounter> _counter;
+};
 
 } // namespace
 
 namespace onert::backend::cpu
 {
 
-ExternalContext::ExternalContext() : _ruy_context(new ruy::Context)
+ExternalContext::ExternalContext() : _ruy_contexts{std::make_shared<RuyContextPool>()}
 {
   setMaxNumThreads(onert::util::getConfigInt(onert::util::config::NUM_THREADS));
 }
 
+ExternalContext::~ExternalContext() = default;
+
 void ExternalContext::setMaxNumThreads(int max_num_threads)
 {
-  _max_num_threads = max_num_threads > -1 ? max_num_threads : countPhysicalCores();
-  _ruy_context->set_max_num_threads(_max_num_threads);
+  _max_num_threads =
+    max_num_threads > -1 ? max_num_threads : util::ThreadBudget::defaultNumThreads();
+
+  std::lock_guard<std::mutex> lock{_ruy_contexts->mutex};
+  _ruy_contexts->max_num_threads = _max_num_threads;
+  for (auto &&[thread_id, ruy_context] : _ruy_contexts->contexts)
+    ruy_context->set_max_num_threads(_max_num_threads);
+}
+
+ruy::Context *ExternalContext::ruy_context() const
+{
+  return thread_ruy_contexts.get(_ruy_contexts);
+}
+
+void ExternalContext::setThreadBudget(util::ThreadBudget &budget, int32_t num_threads)
+{
+  setMaxNumThreads(num_threads);
+
+  // ruy does not expose its tasks, so only its threads are counted
+  budget.addPool("ruy", _max_num_threads);
+
+  auto pool = nnfw::cker::eigen_support::GetThreadPool();
+  _eigen_counter = budget.addPool("eigen", _max_num_threads);
+  _eigen_device = std::make_unique<Eigen::ThreadPoolDevice>(pool, _max_num_threads);
+
+  _counting_eigen_device.reset(); // destroy before the thread pool
+  _counting_eigen_thread_pool = std::make_unique<CountingEigenThreadPool>(pool, _eigen_counter);
+  _counting_eigen_device = std::make_unique<Eigen::ThreadPoolDevice>(
+    _counting_eigen_thread_pool.get(), _max_num_threads);
+}
+
+const Eigen::ThreadPoolDevice *ExternalContext::eigen_device() const
+{
+  if (_eigen_counter && _eigen_counter->timed())
+    return _counting_eigen_device.get();
+  return _eigen_device.get();
+}
+
+void EigenDeviceFunction::run()
+{
+  nnfw::cker::eigen_support::ScopedThreadPoolDevice scope{_external_context->eigen_device()};
+  _fn->run();
 }
 
 } // namespace onert::backend::cpu
@@ -17,29 +17,88 @@
 #ifndef __ONERT_BACKEND_CPU_EXTERNAL_CONTEXT_H__
 #define __ONERT_BACKEND_CPU_EXTERNAL_CONTEXT_H__
 
+#include <exec/IFunction.h>
 #include <util/ConfigSource.h>
+#include <util/ThreadBudget.h>
 #include <ruy/context.h>
 
 #include <memory>
 
+namespace Eigen
+{
+class ThreadPoolInterface;
+struct ThreadPoolDevice;
+} // namespace Eigen
+
 namespace onert::backend::cpu
 {
 
+struct RuyContextPool;
+
 class ExternalContext
 {
 public:
   ExternalContext();
+  ~ExternalContext();
 
 public:
   void setMaxNumThreads(int max_num_threads);
 
+  /**
+   * @brief Take num_threads threads from the thread budget of session, instead of NUM_THREADS
+   *
+   * Kernels use the threads through ruy context and Eigen device. Eigen tasks are counted on
+   * the budget while it times its pools.
+   */
+  void setThreadBudget(util::ThreadBudget &budget, int32_t num_threads);
+
   int32_t maxNumThreads() const { return _max_num_threads; }
 
-  ruy::Context *ruy_context() const { return _ruy_context.get(); }
+  /**
+   * @brief ruy context of the calling thread
+   *
+   * Kernels may run at the same time on workers of ParallelExecutor, while ruy::Context is not
+   * thread-safe. So each thread running kernels gets its own context of maxNumThreads() threads.
+   * The context is looked up in thread local storage without locking, and released when the
+   * thread exits.
+   */
+  ruy::Context *ruy_context() const;
+
+  /**
+   * @brief Eigen device with maxNumThreads() threads on the global Eigen thread pool
+   *
+   * @return nullptr if the context has no thread budget, then the global device is used
+   */
+  const Eigen::ThreadPoolDevice *eigen_device() const;
 
 private:
   int32_t _max_num_threads;
-  const std::unique_ptr<ruy::Context> _ruy_context;
+  std::shared_ptr<RuyContextPool> _ruy_contexts;
+  std::shared_ptr<util::ThreadPoolCounter> _eigen_counter;
+  std::unique_ptr<Eigen::ThreadPoolDevice> _eigen_device;
+  // Device timing each task on _eigen_counter, used only while the counter is timed
+  std::unique_ptr<Eigen::ThreadPoolInterface> _counting_eigen_thread_pool;
+  std::unique_ptr<Eigen::ThreadPoolDevice> _counting_eigen_device;
+};
+
+/**
+ * @brief Function running a kernel with the Eigen device of ExternalContext
+ */
+class EigenDeviceFunction : public exec::IFunction
+{
+public:
+  EigenDeviceFunction(std::unique_ptr<exec::IFunction> &&fn,
+                      const std::shared_ptr<ExternalContext> &external_context)
+    : _fn{std::move(fn)}, _external_context{external_context}
+  {
+  }
+
+  void run() override;
+  void prepare() override { _fn->prepare(); }
+
+private:
+  std::unique_ptr<exec::IFunction> _fn;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace onert::backend::cpu
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ExternalContext.h"
+
+#include <gtest/gtest.h>
+#include <future>
+#include <thread>
+
+using namespace onert::backend::cpu;
+
+TEST(ExternalContext, RuyContextPerThread)
+{
+  ExternalContext context;
+  context.setMaxNumThreads(3);
+
+  auto ruy_context = context.ruy_context();
+  ASSERT_NE(ruy_context, nullptr);
+  EXPECT_EQ(context.ruy_context(), ruy_context);
+  EXPECT_EQ(ruy_context->max_num_threads(), 3);
+
+  std::thread thread{[&]() {
+    auto thread_ruy_context = context.ruy_context();
+    EXPECT_NE(thread_ruy_context, ruy_context);
+    EXPECT_EQ(context.ruy_context(), thread_ruy_context);
+    EXPECT_EQ(thread_ruy_context->max_num_threads(), 3);
+  }};
+  thread.join();
+
+  ExternalContext other;
+  EXPECT_NE(other.ruy_context(), ruy_context);
+
+  context.setMaxNumThreads(2);
+  EXPECT_EQ(ruy_context->max_num_threads(), 2);
+}
+
+TEST(ExternalContext, RuyContextOfDestroyedContext)
+{
+  auto context = std::make_unique<ExternalContext>();
+  std::promise<void> used;
+  std::promise<void> destroyed;
+
+  std::thread thread{[&]() {
+    context->ruy_context();
+    used.set_value();
+    destroyed.get_future().wait();
+
+    // A context made after, possibly at the same address, gets a new ruy context
+    ExternalContext next;
+    next.setMaxNumThreads(2);
+    EXPECT_EQ(next.ruy_context()->max_num_threads(), 2);
+  }};
+
+  used.get_future().wait();
+  context.reset();
+  destroyed.set_value();
+  thread.join();
+}
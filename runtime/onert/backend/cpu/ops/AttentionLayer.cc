@@ -19,15 +19,14 @@
 #include "../KernelGenerator.h"
 #include "../Validator.h"
 
-#include "cker/operation/BatchMatMul.h"
+#include "cker/operation/Attention.h"
 #include "cker/operation/FullyConnected.h"
 #include "cker/operation/RoPE.h"
-#include "cker/operation/SoftMax.h"
-#include "cker/operation/Transpose.h"
 #include "cker/Shape.h"
 
-#include <cassert>
+#include <cstring>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace onert::backend::cpu
@@ -71,7 +70,8 @@ void KernelGenerator::visit(const ir::operation::Attention &node)
   auto fn = std::make_unique<ops::AttentionLayer>();
 
   fn->configure(input_tensor, wq_tensor, wk_tensor, wv_tensor, wo_tensor, cos_tensor, sin_tensor,
-                mask_tensor, k_cache_tensor, v_cache_tensor, pos_tensor, output_tensor);
+                mask_tensor, k_cache_tensor, v_cache_tensor, pos_tensor, output_tensor,
+                _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -84,7 +84,7 @@ namespace onert::backend::cpu::ops
 AttentionLayer::AttentionLayer()
   : _input(nullptr), _wq(nullptr), _wk(nullptr), _wv(nullptr), _wo(nullptr), _cos(nullptr),
     _sin(nullptr), _mask(nullptr), _k_cache(nullptr), _v_cache(nullptr), _cache_pos(nullptr),
-    _output(nullptr)
+    _output(nullptr), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -96,7 +96,8 @@ void AttentionLayer::configure(const IPortableTensor *input, const IPortableTens
                                const IPortableTensor *wo, const IPortableTensor *cos,
                                const IPortableTensor *sin, const IPortableTensor *mask,
                                IPortableTensor *k_cache, IPortableTensor *v_cache,
-                               const IPortableTensor *pos, IPortableTensor *output)
+                               const IPortableTensor *pos, IPortableTensor *output,
+                               const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _wq = wq;
@@ -110,10 +111,11 @@ void AttentionLayer::configure(const IPortableTensor *input, const IPortableTens
   _v_cache = v_cache;
   _cache_pos = pos;
   _output = output;
+  _external_context = external_context;
 
   // 0. Read and check inputs and params
+  //   Each batch is a sequence with its own KV cache and position
   const auto n_batch = getShape(_input).Dims(0);
-  assert(n_batch == 1); // Multi-batch is not supported.
   const auto d_model = getShape(_input).Dims(2);
 
   if (_cos == nullptr || _sin == nullptr || _cache_pos == nullptr)
@@ -136,6 +138,21 @@ void AttentionLayer::configure(const IPortableTensor *input, const IPortableTens
 
   if (n_batch != k_cache_n_batch || n_head != k_cache_n_head || d_head != k_cache_d_head)
     throw std::runtime_error{"Attention: shape mismatch between inputs"};
+
+  const auto n_pos = getShape(_cache_pos).FlatSize();
+  if (n_pos != 1 && n_pos != n_batch)
+    throw std::runtime_error{"Attention: position must be one or one per batch"};
+  if (_mask != nullptr && getShape(_mask).DimensionsCount() == 4 &&
+      getShape(_mask).Dims(0) != 1 && getShape(_mask).Dims(0) != n_batch)
+    throw std::runtime_error{"Attention: mask must be one or one per batch"};
+
+  // 0.2 Param - KV cache type. Block quantized caches are quantized along d_head.
+  if (_k_cache->data_type() != _v_cache->data_type())
+    throw std::runtime_error{"Attention: K and V caches must have the same data type"};
+  if ((_k_cache->data_type() == OperandType::QUANT_GGML_Q8_0 ||
+       _k_cache->data_type() == OperandType::QUANT_GGML_Q4_0) &&
+      d_head % nnfw::cker::kBlockQuantSize != 0)
+    throw std::runtime_error{"Attention: d_head must be a multiple of 32 for quantized KV cache"};
 }
 
 /**
@@ -166,9 +183,8 @@ void AttentionLayer::attentionFloat32()
 {
   // 0. Read and check inputs and params
 
-  const auto n_batch = getShape(_input).Dims(0);
-  assert(n_batch == 1);                           // Multi-batch is not supported.
-  const auto n_tokens = getShape(_input).Dims(1); // tokens to decode. Expects 1
+  const auto n_batch = getShape(_input).Dims(0);  // sequences, each with its own cache
+  const auto n_tokens = getShape(_input).Dims(1); // tokens to decode. 1, or more to verify
   const auto d_model = getShape(_input).Dims(2);
 
   const int32_t n_head = getShape(_k_cache).Dims(2);
@@ -182,6 +198,8 @@ void AttentionLayer::attentionFloat32()
   // Weight tensors: _wq, _wk, _wv, _wo
   //   Shape: [d_model, d_model] (assuming d_q = d_k = d_v = d_model)
   //   Data: float*
+  //
+  // Tokens of all batches are projected together, so weights are read once per run.
 
   // Define the output shape for Q and K projections
   nnfw::cker::Shape proj_output_shape({n_batch, n_tokens, d_model});
@@ -211,178 +229,169 @@ void AttentionLayer::attentionFloat32()
   // 2. RoPE
 
   // _cos, _sin
-  //   Shape: [ n_batch, n_tokens, d_head ] (assume n_batch=1, n_tokens=1)
+  //   Shape: [ n_batch, n_tokens, d_head ]
   //   DataType: float*
 
   // 2.1 nullcheck (Validation moved to configure())
+  const int32_t n_rows = n_batch * n_tokens;
+  if (getShape(_cos).FlatSize() < n_rows * d_head || getShape(_sin).FlatSize() < n_rows * d_head)
+    throw std::runtime_error{"Attention: cos/sin tables must have one row per token"};
 
   // 2.2  inputs: (input, cos, sin)
-  // RoPE expects 4D tensor for input and sin/cos tables.
-  // The projection output (proj_out) is logically reinterpreted:
-  //     from [ n_batch, n_tokens, d_model ]
-  //     to   [ n_batch, n_head, n_tokens, d_head ]
-  // This reinterpretation is valid as d_model = n_head * d_head and n_tokens = 1.
-  nnfw::cker::Shape rope_in_shape({n_batch, n_head, n_tokens, d_head});
-  // Extend cos, sin to 4D
-  nnfw::cker::Shape sin_cos_shape({1, n_batch, n_tokens, d_head});
+  // RoPE expects 4D tensor for input and sin/cos tables, and applies one table row.
+  // So it is applied per token of each batch. The projection output row r is logically
+  // reinterpreted:
+  //     from [ d_model ]
+  //     to   [ 1, n_head, 1, d_head ]
+  // This reinterpretation is valid as d_model = n_head * d_head.
+  nnfw::cker::Shape rope_in_shape({1, n_head, 1, d_head});
+  nnfw::cker::Shape sin_cos_shape({1, 1, 1, d_head});
+  nnfw::cker::Shape rope_out_shape({1, n_head, 1, d_head});
 
   // 2.3 output buffer:
-  nnfw::cker::Shape rope_out_shape({n_batch, n_head, n_tokens, d_head});
-  std::vector<float> q_rope_buf(rope_out_shape.FlatSize());
-  std::vector<float> k_rope_buf(rope_out_shape.FlatSize());
+  //   q_rope_buf: [ n_batch, n_tokens, n_head, d_head ] read by the attention kernel
+  //   k_rope_buf: [ n_batch, n_tokens, n_head, d_head ] to match k_cache memory layout
+  nnfw::cker::Shape q_shape({n_batch, n_tokens, n_head, d_head});
+  std::vector<float> q_rope_buf(q_shape.FlatSize());
+  std::vector<float> k_rope_buf(n_batch * n_tokens * d_model);
 
   nnfw::cker::RoPEMode rope_mode = nnfw::cker::RoPEMode::kGptNeox;
 
   // 2.4 Call cker::RoPE
-  nnfw::cker::RoPE<float>(rope_mode, rope_in_shape, k_proj_buf.data(), sin_cos_shape,
-                          getBuffer<float>(_sin), sin_cos_shape, getBuffer<float>(_cos),
-                          rope_out_shape, k_rope_buf.data());
-  nnfw::cker::RoPE<float>(rope_mode, rope_in_shape, q_proj_buf.data(), sin_cos_shape,
-                          getBuffer<float>(_sin), sin_cos_shape, getBuffer<float>(_cos),
-                          rope_out_shape, q_rope_buf.data());
-
-  // 3. K cache
-
-  // _k_cache
-  //   Shape: [ n_batch, cache_size, n_head, d_head ]
-  //   DataType: float
+  const float *sin_data = getBuffer<float>(_sin);
+  const float *cos_data = getBuffer<float>(_cos);
+  for (int32_t r = 0; r < n_rows; ++r)
+  {
+    nnfw::cker::RoPE<float>(rope_mode, rope_in_shape, k_proj_buf.data() + r * d_model,
+                            sin_cos_shape, sin_data + r * d_head, sin_cos_shape,
+                            cos_data + r * d_head, rope_out_shape,
+                            k_rope_buf.data() + r * d_model);
+    nnfw::cker::RoPE<float>(rope_mode, rope_in_shape, q_proj_buf.data() + r * d_model,
+                            sin_cos_shape, sin_data + r * d_head, sin_cos_shape,
+                            cos_data + r * d_head, rope_out_shape,
+                            q_rope_buf.data() + r * d_model);
+  }
 
-  // 3.1 Transpose K tensor to match k_cache memory layout
+  // 3. Attention
   //
-  //   from  [ n_batch, n_head, n_tokens, d_head ]
-  //     to  [ n_batch, n_tokens, n_head, d_head ]
+  // _k_cache, _v_cache
+  //   Shape: [ n_batch, cache_size, n_head, d_head ]
+  //   DataType: float, or ggml Q8_0/Q4_0 blocks of 32 elements along d_head
   //
-  // Since both n_tokens and n_batch are 1, the K tensor is already effectively
-  // a contiguous memory block of size n_head * d_head, making an explicit transpose
-  // operation unnecessary.
+  // K and V already have cache memory layout [ n_batch, n_tokens, n_head, d_head ].
+  // Those of batch b are put in cache[b][cache_pos[b] : cache_pos[b] + n_tokens], quantized
+  // if needed, and attended with the cache of batch b.
+
+  // _cache_pos is expected to be a 1D tensor with the position of the first token,
+  // one shared by all batches or one per batch.
+  const int64_t *cache_pos_data = getBuffer<int64_t>(_cache_pos);
+  const bool pos_per_batch = getShape(_cache_pos).FlatSize() == n_batch;
+
+  // attn_out_buf: [n_batch, n_tokens, n_head, d_head], which is [n_batch, n_tokens, d_model]
+  std::vector<float> attn_out_buf(q_shape.FlatSize());
+  for (int32_t b = 0; b < n_batch; ++b)
+  {
+    const int64_t cache_pos = cache_pos_data[pos_per_batch ? b : 0];
+    if (cache_pos < 0 || cache_pos + n_tokens > getShape(_k_cache).Dims(1) ||
+        cache_pos + n_tokens > getShape(_v_cache).Dims(1))
+      throw std::runtime_error{"Attention: Current position is out of cache bounds"};
+
+    const int32_t offset = b * n_tokens * d_model;
+    const float *q = q_rope_buf.data() + offset;
+    const float *k = k_rope_buf.data() + offset;
+    const float *v = v_proj_buf.data() + offset;
+    float *out = attn_out_buf.data() + offset;
+    switch (_k_cache->data_type())
+    {
+      case OperandType::FLOAT32:
+        attendCache<float>(b, q, k, v, cache_pos, out);
+        break;
+      case OperandType::QUANT_GGML_Q8_0:
+        attendCache<nnfw::cker::BlockQ8_0>(b, q, k, v, cache_pos, out);
+        break;
+      case OperandType::QUANT_GGML_Q4_0:
+        attendCache<nnfw::cker::BlockQ4_0>(b, q, k, v, cache_pos, out);
+        break;
+      default:
+        throw std::runtime_error{"Attention: unsupported KV cache data type"};
+    }
+  }
+
+  // 4. Output Projection
+  nnfw::cker::FullyConnected(fc_params, proj_output_shape, attn_out_buf.data(), getShape(_wo),
+                             getBuffer<float>(_wo), /*bias_shape=*/getShape(nullptr),
+                             /*bias_data=*/nullptr, getShape(_output), getBuffer<float>(_output));
+}
 
-  // 3.2 Put K in k_cache[cache_pos]
+template <typename T>
+void AttentionLayer::attendCache(int32_t batch, const float *q, const float *k, const float *v,
+                                 int64_t cache_pos, float *output)
+{
   const auto k_cache_shape = getShape(_k_cache);
-  // _cache_pos is expected to be a 1D tensor with one element, the current sequence position.
-  auto cache_pos = static_cast<int64_t>(getBuffer<int64_t>(_cache_pos)[0]);
-  if (cache_pos < 0 || cache_pos >= k_cache_shape.Dims(1))
-    throw std::runtime_error{"Attention: Current position is out of cache bounds"};
-
-  auto n_k = k_rope_buf.size();
-  auto sz_k = sizeof(k_rope_buf[0]) * n_k;
-  memcpy(getBuffer<float>(_k_cache) + cache_pos * n_k, k_rope_buf.data(), sz_k);
-
-  // 4. Attension Score
-
-  // 4.1 Transpose K
-  const int32_t block_size = 32;
-  auto alignedSize = [](int32_t index) -> int32_t {
-    // We need to include index, so we calculate for index + 1 elements
-    // Then round up to the nearest multiple of block_size
-    const int32_t elements_needed = index + 1;
-    return ((elements_needed + block_size - 1) / block_size) * block_size;
-  };
-
-  const int32_t aligned_ctx_size = alignedSize(cache_pos + 1);
-  nnfw::cker::Shape k_cache_tr_in_shape({n_batch, aligned_ctx_size, n_head, d_head});
-  nnfw::cker::Shape k_cache_tr_out_shape({n_batch, n_head, aligned_ctx_size, d_head});
-  std::vector<float> k_cache_tr_buf(k_cache_tr_out_shape.FlatSize());
-  nnfw::cker::TransposeParams tr_params{4, {0, 2, 1, 3}};
-  nnfw::cker::Transpose<float>(tr_params, k_cache_tr_in_shape, getBuffer<float>(_k_cache),
-                               k_cache_tr_out_shape, k_cache_tr_buf.data());
-
-  // 4.2 Compute attention logits via batch matrix multiplication
-  //   Inputs:
-  //              q = [n_batch, n_head, n_tokens, d_head]
-  // (transposed) k = [n_batch, n_head, aligned_ctx_size, d_head]
-  //   Output:
-  //             qk = [n_batch, n_head, n_tokens, aligned_ctx_size]
-  //
-  // Note: Use adj_y=true to avoid additional transpose inside BMM kernel.
-  // With adj_y=true, the kernel directly computes Q × K^T without extra
-  // memory operations, improving performance by eliminating redundant
-  // transpose steps that would otherwise occur internally.
-  nnfw::cker::Shape qk_shape({n_batch, n_head, n_tokens, aligned_ctx_size});
-  std::vector<float> qk_buf(qk_shape.FlatSize());
-  nnfw::cker::BatchMatMul bmm_op;
-  bool adj_x = false;
-  bool adj_y = true;
-  bmm_op.prepare(rope_out_shape, k_cache_tr_out_shape, adj_x, adj_y,
-                 /*rhs_const=*/false);
-  bmm_op(rope_out_shape, q_rope_buf.data(), k_cache_tr_out_shape, k_cache_tr_buf.data(), adj_x,
-         adj_y, qk_shape, qk_buf.data());
-
-  // 4.3 Scale attention logits by 1/sqrt(d_model)
-  const float scaling_factor = 1.0f / std::sqrt(static_cast<float>(d_head));
-  // NOTE: TICO believes in duality: each tensor seeks its own sqrt(scaling_factor)
-  // truth, manifesting as (sqrt(scaling_factor) × Q) * (sqrt(scaling_factor) × K).
-  // We embrace unity: one scaling_factor for all, scaling_factor × (Q * K)
-  for (size_t i = 0; i < qk_buf.size(); ++i)
-    qk_buf[i] *= scaling_factor;
-
-  // 4.4 Add attention
+  const auto v_cache_shape = getShape(_v_cache);
+  const int32_t n_tokens = getShape(_input).Dims(1);
+  const int32_t n_head = k_cache_shape.Dims(2);
+  const int32_t d_head = k_cache_shape.Dims(3);
+  const int32_t d_model = n_head * d_head;
+  constexpr int32_t kUnit = nnfw::cker::attention::ElementsPerUnit<T>;
+
+  // Q, output and caches of the batch, which the kernel attends as a single batch
+  const nnfw::cker::Shape q_shape({1, n_tokens, n_head, d_head});
+  const nnfw::cker::Shape k_cache_batch_shape({1, k_cache_shape.Dims(1), n_head, d_head});
+  const nnfw::cker::Shape v_cache_batch_shape({1, v_cache_shape.Dims(1), n_head, d_head});
+  T *k_cache = getBuffer<T>(_k_cache) + batch * k_cache_shape.Dims(1) * d_model / kUnit;
+  T *v_cache = getBuffer<T>(_v_cache) + batch * v_cache_shape.Dims(1) * d_model / kUnit;
+
+  // Put K, V in cache[cache_pos : cache_pos + n_tokens]
+  T *k_dst = k_cache + cache_pos * d_model / kUnit;
+  T *v_dst = v_cache + cache_pos * d_model / kUnit;
+  if constexpr (std::is_same_v<T, float>)
+  {
+    memcpy(k_dst, k, sizeof(float) * n_tokens * d_model);
+    memcpy(v_dst, v, sizeof(float) * n_tokens * d_model);
+  }
+  else
+  {
+    nnfw::cker::QuantizeRow(k, k_dst, n_tokens * d_model);
+    nnfw::cker::QuantizeRow(v, v_dst, n_tokens * d_model);
+  }
 
   // mask tensor
   //
   // - shape: [n_batch, n_head, n_tokens, alignged_ctx_sz]
-  //   - n_batch  = 1
+  //   - n_batch  : one mask per batch, or 1 to share a mask across batches
   //   - n_head   = 1 : mask vector (last axis) is shared across heads
-  //   - n_tokens = 1 : Process 1 token per 1 decode
+  //   - n_tokens : one mask row per token, or 1 to share a row across tokens
   //   - aligned_ctx_size : multiple of block_size
   // - type: float32
-  // - data:
+  // - data (row of token at cache_pos):
   //      index   0  1  ...     cache_pos    ...           {block_size-1}
   //      mask    0  0 ... 0        0        -inf -inf ...    -inf
   //              |        |                   |                |
   //              +--past--+       new         +-----future-----+
   //                tokens        token              tokens
-
-  const float *mask_data = getBuffer<float>(_mask);
-  for (size_t i = 0; i < qk_buf.size(); ++i)
+  //
+  // The kernel reads the caches in place and streams over cache positions with online
+  // softmax, so neither transposed caches nor the score matrix are materialized.
+  // Masked-out (-inf) positions are skipped. Quantized caches are dequantized on the fly.
+  const float *mask = nullptr;
+  const auto mask_shape = getShape(_mask);
+  if (_mask != nullptr)
   {
-    // The mask repeats every 'aligned_ctx_size' elements.
-    qk_buf[i] += mask_data[i % aligned_ctx_size];
+    mask = getBuffer<float>(_mask);
+    if (mask_shape.DimensionsCount() == 4 && mask_shape.Dims(0) > 1)
+      mask += batch * (mask_shape.FlatSize() / mask_shape.Dims(0));
   }
 
-  // 4.5 Softmax
-  std::vector<float> attn_score_buf(qk_shape.FlatSize());
-  nnfw::cker::SoftmaxParams softmax_params;
-  softmax_params.beta = 1.0f; // Standard beta for attention softmax
-  nnfw::cker::Softmax(softmax_params, qk_shape, qk_buf.data(), qk_shape, attn_score_buf.data());
-
-  // 5. V cache
-
-  // _v_cache
-  //   Shape: [n_batch, cache_size, n_head, d_head]
-  //   DataType: float
+  nnfw::cker::AttentionParams attn_params;
+  attn_params.scale = 1.0f / std::sqrt(static_cast<float>(d_head));
 
-  // 5.1 Transpose V to align v_cache (NOP)
-  // 5.2 Put V in v_cache[cache_pos]
-  const auto v_cache_shape = getShape(_v_cache);
-  if (cache_pos >= v_cache_shape.Dims(1))
-    throw std::runtime_error{"Attention: Current position is out of cache bounds"};
-
-  auto n_v = v_proj_buf.size();
-  auto sz_v = sizeof(v_proj_buf[0]) * n_v;
-  memcpy(getBuffer<float>(_v_cache) + cache_pos * n_v, v_proj_buf.data(), sz_v);
-
-  // 7. Attention Output Calculation
-  // 7.1. Compute attention output: attn_scores * V_cache -> attn_out
-  nnfw::cker::Shape v_cache_in_shape({n_batch, aligned_ctx_size, n_head, d_head});
-  nnfw::cker::Shape v_cache_tr_out_shape({n_batch, n_head, aligned_ctx_size, d_head});
-  std::vector<float> v_cache_tr_buf(v_cache_tr_out_shape.FlatSize());
-  nnfw::cker::TransposeParams v_tr_params{4, {0, 2, 1, 3}};
-  nnfw::cker::Transpose<float>(v_tr_params, v_cache_in_shape, getBuffer<float>(_v_cache),
-                               v_cache_tr_out_shape, v_cache_tr_buf.data());
-
-  nnfw::cker::Shape attn_out_shape({n_batch, n_head, n_tokens, d_head});
-  std::vector<float> attn_out_buf(attn_out_shape.FlatSize());
-  nnfw::cker::BatchMatMul attn_bmm_op;
-  attn_bmm_op.prepare(qk_shape, v_cache_tr_out_shape, /*adj_x=*/false, /*adj_y=*/false,
-                      /*rhs_const=*/false);
-  attn_bmm_op(qk_shape, attn_score_buf.data(), v_cache_tr_out_shape, v_cache_tr_buf.data(),
-              /*adj_x=*/false, /*adj_y=*/false, attn_out_shape, attn_out_buf.data());
-
-  // 7.2. Output Projection:
-  // When n_batch = n_tokens = 1, attn_out_buf layout already matches [1,1,d_model]
-  nnfw::cker::FullyConnected(fc_params, proj_output_shape, attn_out_buf.data(), getShape(_wo),
-                             getBuffer<float>(_wo), /*bias_shape=*/getShape(nullptr),
-                             /*bias_data=*/nullptr, getShape(_output), getBuffer<float>(_output));
+  // Positions after the new tokens hold stale or no K and V, so they are never attended
+  // even if the mask is wider or absent.
+  const auto n_filled = static_cast<int32_t>(cache_pos + n_tokens);
+  nnfw::cker::Attention(attn_params, q_shape, q, k_cache_batch_shape, k_cache,
+                        v_cache_batch_shape, v_cache, n_filled, mask_shape, mask, q_shape, output,
+                        _external_context->ruy_context());
 }
 
 void AttentionLayer::run()
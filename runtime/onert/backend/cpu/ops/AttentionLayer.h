@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_ATTENTION_LAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
@@ -35,13 +36,20 @@ public:
   void configure(const IPortableTensor *input, const IPortableTensor *wq, const IPortableTensor *wk,
                  const IPortableTensor *wv, const IPortableTensor *wo, const IPortableTensor *cos,
                  const IPortableTensor *sin, const IPortableTensor *mask, IPortableTensor *k_cache,
-                 IPortableTensor *v_cache, const IPortableTensor *pos, IPortableTensor *output);
+                 IPortableTensor *v_cache, const IPortableTensor *pos, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
 private:
   void attentionFloat32();
 
+  // Append K, V of new tokens of a batch to its caches of element type T
+  // and attend Q of the batch to the caches
+  template <typename T>
+  void attendCache(int32_t batch, const float *q, const float *k, const float *v,
+                   int64_t cache_pos, float *output);
+
 private:
   const IPortableTensor *_input;
   const IPortableTensor *_wq;
@@ -55,6 +63,8 @@ private:
   IPortableTensor *_v_cache;
   const IPortableTensor *_cache_pos;
   IPortableTensor *_output;
+
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace onert::backend::cpu::ops
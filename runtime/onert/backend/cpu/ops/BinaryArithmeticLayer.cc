@@ -59,7 +59,7 @@ void KernelGenerator::visit(const ir::operation::BinaryArithmetic &node)
   auto fn = std::make_unique<ops::BinaryArithmeticLayer>();
 
   fn->configure(lhs_tensor, rhs_tensor, ofm_tensor, activation,
-                convertArithmeticType(node.param().arithmetic_type));
+                convertArithmeticType(node.param().arithmetic_type), _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -79,10 +79,14 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T> struct
   nnfw::cker::Shape _output_shape;
   nnfw::cker::BinaryArithmeticOpParam _op_params;
   bool _need_broadcast;
+  // Only float kernels run in parallel, with ruy context of the running thread
+  const ExternalContext *_external_context;
 
   Eval(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
-       nnfw::cker::BinaryArithmeticOpParam op_params)
-    : _op_params(std::move(op_params)), _need_broadcast(false)
+       nnfw::cker::BinaryArithmeticOpParam op_params,
+       const ExternalContext *external_context = nullptr)
+    : _op_params(std::move(op_params)), _need_broadcast(false),
+      _external_context(external_context)
   {
     if (!output->is_dynamic())
       updateCache(lhs, rhs, output);
@@ -108,7 +112,20 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T> struct
     auto lhs_buffer = getBuffer<T>(lhs);
     auto rhs_buffer = getBuffer<T>(rhs);
     auto output_buffer = getBuffer<T>(output);
-    if (_need_broadcast)
+    if constexpr (std::is_same<T, float>::value)
+    {
+      auto ruy_context = _external_context ? _external_context->ruy_context() : nullptr;
+      if (_need_broadcast)
+        nnfw::cker::BroadcastBinaryArithmeticOp<arithmetic_type>(_op_params, _lhs_shape, lhs_buffer,
+                                                                 _rhs_shape, rhs_buffer,
+                                                                 _output_shape, output_buffer,
+                                                                 ruy_context);
+      else
+        nnfw::cker::BinaryArithmeticOp<arithmetic_type>(_op_params, _lhs_shape, lhs_buffer,
+                                                        _rhs_shape, rhs_buffer, _output_shape,
+                                                        output_buffer, ruy_context);
+    }
+    else if (_need_broadcast)
     {
       nnfw::cker::BroadcastBinaryArithmeticOp<arithmetic_type>(
         _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer);
@@ -125,7 +142,8 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type>
 std::function<void(const IPortableTensor *, const IPortableTensor *, IPortableTensor *)>
 generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
                       IPortableTensor *output, const ir::Activation activation,
-                      nnfw::cker::BinaryArithmeticOpParam &op_params)
+                      nnfw::cker::BinaryArithmeticOpParam &op_params,
+                      const ExternalContext *external_context)
 {
   switch (lhs->data_type())
   {
@@ -135,7 +153,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       op_params.float_activation_max = output_activation_max;
       op_params.float_activation_min = output_activation_min;
-      return Eval<arithmetic_type, float>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, float>(lhs, rhs, output, op_params, external_context);
       break;
     }
     case OperandType::INT32:
@@ -227,7 +245,8 @@ void setMulQuant8Params(const IPortableTensor *lhs, const IPortableTensor *rhs,
 
 void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
                                       IPortableTensor *output, const ir::Activation activation,
-                                      const ArithmeticType arithmetic_type)
+                                      const ArithmeticType arithmetic_type,
+                                      const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(lhs != nullptr);
   assert(rhs != nullptr);
@@ -257,7 +276,7 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::ADD>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, external_context.get());
       }
       break;
     case ArithmeticType::kSub:
@@ -279,7 +298,7 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::SUB>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, external_context.get());
       }
       break;
     case ArithmeticType::kMul:
@@ -300,14 +319,14 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::MUL>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, external_context.get());
       }
       break;
     case ArithmeticType::kDiv:
       if (_lhs->data_type() == OperandType::FLOAT32)
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::DIV>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, external_context.get());
       }
       else
       {
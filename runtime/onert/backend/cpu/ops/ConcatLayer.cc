@@ -42,7 +42,7 @@ void KernelGenerator::visit(const ir::operation::Concat &node)
 
   auto fn = std::make_unique<ops::ConcatLayer>();
 
-  fn->configure(input_tensors, axis, output_tensor);
+  fn->configure(input_tensors, axis, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -52,7 +52,7 @@ void KernelGenerator::visit(const ir::operation::Concat &node)
 namespace onert::backend::cpu::ops
 {
 
-ConcatLayer::ConcatLayer() : _inputs(), _output(nullptr), _axis(0)
+ConcatLayer::ConcatLayer() : _inputs(), _output(nullptr), _axis(0), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -84,7 +84,8 @@ template <typename T> void ConcatLayer::concatenationGeneral()
   }
 
   nnfw::cker::Concatenation<T>(op_params, inputDimsPtr.data(), inputDataPtrs.data(),
-                               getShape(_output), getBuffer<T>(_output));
+                               getShape(_output), getBuffer<T>(_output),
+                               _external_context->ruy_context());
 }
 void ConcatLayer::concatenationQuant8()
 {
@@ -127,7 +128,8 @@ void ConcatLayer::concatenationQuant8()
 }
 
 void ConcatLayer::configure(const std::vector<const IPortableTensor *> &inputs, int32_t axis,
-                            IPortableTensor *output)
+                            IPortableTensor *output,
+                            const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(inputs.size() > 0);
   assert(output != nullptr);
@@ -135,6 +137,7 @@ void ConcatLayer::configure(const std::vector<const IPortableTensor *> &inputs,
   _inputs = inputs;
   _axis = axis;
   _output = output;
+  _external_context = external_context;
 }
 
 void ConcatLayer::run()
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_CONCATLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -35,7 +36,7 @@ public:
   void concatenationQuant8();
 
   void configure(const std::vector<const IPortableTensor *> &inputs, int32_t axis,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -43,6 +44,7 @@ private:
   std::vector<const IPortableTensor *> _inputs;
   IPortableTensor *_output;
   int32_t _axis;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace onert::backend::cpu::ops
@@ -55,7 +55,7 @@ void KernelGenerator::visit(const ir::operation::Gather &node)
 
   auto fn = std::make_unique<ops::GatherLayer>();
 
-  fn->configure(input_tensor, indices_tensor, output_tensor, axis);
+  fn->configure(input_tensor, indices_tensor, output_tensor, axis, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -66,12 +66,14 @@ namespace onert::backend::cpu::ops
 {
 
 void GatherLayer::configure(const IPortableTensor *input, const IPortableTensor *indices,
-                            IPortableTensor *output, int32_t axis)
+                            IPortableTensor *output, int32_t axis,
+                            const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _indices = indices;
   _axis = axis;
   _output = output;
+  _external_context = external_context;
 }
 
 template <typename InputType> void GatherLayer::runByInputType()
@@ -88,7 +90,8 @@ template <typename InputType> void GatherLayer::runByInputType()
 
       nnfw::cker::Gather<InputType, IndicesType>(
         op_params, getShape(_input), getBuffer<InputType>(_input), getShape(_indices),
-        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output));
+        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output),
+        _external_context->ruy_context());
       break;
     }
     case OperandType::INT64:
@@ -97,7 +100,8 @@ template <typename InputType> void GatherLayer::runByInputType()
 
       nnfw::cker::Gather<InputType, IndicesType>(
         op_params, getShape(_input), getBuffer<InputType>(_input), getShape(_indices),
-        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output));
+        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output),
+        _external_context->ruy_context());
       break;
     }
     default:
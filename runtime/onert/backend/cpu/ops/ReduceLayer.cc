@@ -74,7 +74,8 @@ void KernelGenerator::visit(const ir::operation::Reduce &node)
     auto fn = std::make_unique<ops::ReduceLayer>();
 
     const auto reduce_type = convertReduceType(node.param().reduce_type);
-    fn->configure(input_tensor, axes_tensor, output_tensor, reduce_type, keep_dims);
+    fn->configure(input_tensor, axes_tensor, output_tensor, reduce_type, keep_dims,
+                  _external_context);
 
     _return_fn = std::move(fn);
   }
@@ -112,24 +113,26 @@ evalType(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_ty
   {
     case ReduceType::kSum:
       return std::bind(&evalLogic<T>, std::placeholders::_1, std::placeholders::_2,
-                       std::placeholders::_3, keep_dims, static_cast<T>(0), reduce_kernel,
+                       std::placeholders::_3, keep_dims, static_cast<T>(0),
+                       std::ref(reduce_kernel),
                        [](const T current, const T in) -> T { return in + current; });
       break;
     case ReduceType::kProd:
       return std::bind(&evalLogic<T>, std::placeholders::_1, std::placeholders::_2,
-                       std::placeholders::_3, keep_dims, static_cast<T>(1), reduce_kernel,
+                       std::placeholders::_3, keep_dims, static_cast<T>(1),
+                       std::ref(reduce_kernel),
                        [](const T current, const T in) -> T { return in * current; });
       break;
     case ReduceType::kMax:
       return std::bind(
         &evalLogic<T>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
-        keep_dims, std::numeric_limits<T>::lowest(), reduce_kernel,
+        keep_dims, std::numeric_limits<T>::lowest(), std::ref(reduce_kernel),
         [](const T current, const T in) -> T { return (in > current) ? in : current; });
       break;
     case ReduceType::kMin:
       return std::bind(
         &evalLogic<T>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
-        keep_dims, std::numeric_limits<T>::max(), reduce_kernel,
+        keep_dims, std::numeric_limits<T>::max(), std::ref(reduce_kernel),
         [](const T current, const T in) -> T { return (in < current) ? in : current; });
       break;
     default:
@@ -147,12 +150,12 @@ evalType<bool>(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType red
   {
     case ReduceType::kAny:
       return std::bind(&evalLogic<bool>, std::placeholders::_1, std::placeholders::_2,
-                       std::placeholders::_3, keep_dims, false, reduce_kernel,
+                       std::placeholders::_3, keep_dims, false, std::ref(reduce_kernel),
                        [](const bool current, const bool in) -> bool { return in || current; });
       break;
     case ReduceType::kAll:
       return std::bind(&evalLogic<bool>, std::placeholders::_1, std::placeholders::_2,
-                       std::placeholders::_3, keep_dims, true, reduce_kernel,
+                       std::placeholders::_3, keep_dims, true, std::ref(reduce_kernel),
                        [](const bool current, const bool in) -> bool { return in && current; });
       break;
     default:
@@ -223,12 +226,14 @@ ReduceLayer::ReduceLayer()
 ReduceLayer::~ReduceLayer() = default;
 
 void ReduceLayer::configure(const IPortableTensor *input, const IPortableTensor *axes,
-                            IPortableTensor *output, ReduceType reduceType, bool keep_dims)
+                            IPortableTensor *output, ReduceType reduceType, bool keep_dims,
+                            const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _axes = axes;
   _output = output;
   _reduceType = reduceType;
+  _external_context = external_context;
 
   switch (_reduceType)
   {
@@ -236,7 +241,7 @@ void ReduceLayer::configure(const IPortableTensor *input, const IPortableTensor
       if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
       {
         _kernel = std::bind(&evalSumQuantized, std::placeholders::_1, std::placeholders::_2,
-                            std::placeholders::_3, keep_dims, *_reduce_kernel);
+                            std::placeholders::_3, keep_dims, std::ref(*_reduce_kernel));
         return;
       }
       _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kSum);
@@ -273,6 +278,8 @@ void ReduceLayer::run()
     return;
   }
 #endif // NEON
+  // Kernels refer to _reduce_kernel, which runs with ruy context of the running thread
+  _reduce_kernel->ruy_context(_external_context->ruy_context());
   _kernel(_input, _output, axes);
 }
 
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_SOFTMAX_LAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -34,7 +35,8 @@ public:
 
   template <typename T> void softmaxQuant8();
 
-  void configure(const IPortableTensor *input, const float beta, IPortableTensor *output);
+  void configure(const IPortableTensor *input, const float beta, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -44,6 +46,7 @@ protected:
 
 private:
   float _beta;
+  std::shared_ptr<ExternalContext> _external_context;
 
   float _table[256];
   uint8_t _uint8_table1[256];
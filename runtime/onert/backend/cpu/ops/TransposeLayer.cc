@@ -40,7 +40,7 @@ void KernelGenerator::visit(const ir::operation::Transpose &node)
 
   auto fn = std::make_unique<ops::TransposeLayer>();
 
-  fn->configure(input_tensor, perm_tensor, output_tensor);
+  fn->configure(input_tensor, perm_tensor, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -50,7 +50,8 @@ void KernelGenerator::visit(const ir::operation::Transpose &node)
 namespace onert::backend::cpu::ops
 {
 
-TransposeLayer::TransposeLayer() : _input(nullptr), _perm(nullptr), _output(nullptr)
+TransposeLayer::TransposeLayer()
+  : _input(nullptr), _perm(nullptr), _output(nullptr), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -79,7 +80,7 @@ template <typename T> void TransposeLayer::transpose()
   }
 
   nnfw::cker::Transpose(param, getShape(_input), getBuffer<T>(_input), getShape(_output),
-                        getBuffer<T>(_output));
+                        getBuffer<T>(_output), _external_context->ruy_context());
 }
 
 void TransposeLayer::transposeQuant8()
@@ -98,11 +99,13 @@ void TransposeLayer::transposeQuant8()
 }
 
 void TransposeLayer::configure(const IPortableTensor *input, const IPortableTensor *perm,
-                               IPortableTensor *output)
+                               IPortableTensor *output,
+                               const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _perm = perm;
   _output = output;
+  _external_context = external_context;
 }
 
 void TransposeLayer::run()
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_TRANSPOSELAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -34,8 +35,8 @@ public:
 
   void transposeQuant8();
 
-  void configure(const IPortableTensor *input, const IPortableTensor *perm,
-                 IPortableTensor *output);
+  void configure(const IPortableTensor *input, const IPortableTensor *perm, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -43,6 +44,7 @@ private:
   const IPortableTensor *_input;
   const IPortableTensor *_perm;
   IPortableTensor *_output;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace onert::backend::cpu::ops
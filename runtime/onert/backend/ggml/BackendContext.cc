@@ -18,6 +18,7 @@
 
 #include "TensorBuilder.h"
 #include "KernelGenerator.h"
+#include "ops/GGMLLayer.h"
 #include "util/logging.h"
 #include "ir/Index.h"
 #include "ir/OperandIndexMap.h"
@@ -39,6 +40,29 @@ FunctionMap BackendContext::genKernels()
     ret.emplace(op_ind, std::move(fn_seq));
   }
 
+  // Fuse layers which run one after another, e.g. ops of a transformer block, to compute them as
+  // one ggml graph. Only linear executor runs operations in a fixed order.
+  if (_data.is_linear_executor)
+  {
+    ops::GGMLLayer *leader = nullptr;
+    for (auto &&op_ind : _data.whole_op_order)
+    {
+      ops::GGMLLayer *layer = nullptr;
+      if (auto it = ret.find(op_ind); it != ret.end())
+      {
+        it->second->iterate([&](exec::IFunction &ifunc) {
+          if (auto ggml_layer = dynamic_cast<ops::GGMLLayer *>(&ifunc))
+            layer = ggml_layer;
+        });
+      }
+
+      if (layer != nullptr && leader != nullptr)
+        leader->fuse(layer);
+      else
+        leader = layer;
+    }
+  }
+
   basic::initConsts(*this);
 
   // NOTE For memory optimization, we want to free some operand data
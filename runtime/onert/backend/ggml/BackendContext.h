@@ -37,6 +37,8 @@ public:
     : onert::backend::BackendContext(backend, std::move(data), tensor_registry),
       tensor_builder{tensor_builder}, kernel_gen{kernel_gen}, _external_context(new ExternalContext)
   {
+    if (_data.thread_budget)
+      _external_context->setThreadBudget(*_data.thread_budget, _data.num_threads);
   }
 
   ITensorRegistry *genTensors() override;
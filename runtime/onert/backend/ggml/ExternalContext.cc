@@ -16,46 +16,6 @@
 
 #include "ExternalContext.h"
 
-#include <fstream>
-#include <string>
-#include <thread>
-#include <unordered_set>
-
-namespace
-{
-
-int32_t countPhysicalCores()
-{
-#ifdef __linux__
-  // Count physical cores, not threads by checking thread_siblings.
-  std::unordered_set<std::string> siblings;
-  for (uint32_t cpu = 0; cpu < UINT32_MAX; ++cpu)
-  {
-    std::ifstream thread_siblings("/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
-                                  "/topology/thread_siblings");
-    if (!thread_siblings.is_open())
-    {
-      break;
-    }
-
-    std::string line;
-    if (std::getline(thread_siblings, line))
-    {
-      siblings.insert(line);
-    }
-  }
-  if (!siblings.empty())
-  {
-    return static_cast<int32_t>(siblings.size());
-  }
-#endif
-
-  unsigned int n_threads = std::thread::hardware_concurrency();
-  return n_threads > 0 ? (n_threads <= 4 ? n_threads : n_threads / 2) : 1;
-}
-
-} // namespace
-
 namespace onert::backend::ggml
 {
 
@@ -65,7 +25,13 @@ ExternalContext::ExternalContext()
       ggml_init({.mem_size = 0, .mem_buffer = nullptr, .no_alloc = true}), &ggml_free))
 {
   if (_max_num_threads <= -1)
-    countPhysicalCores();
+    _max_num_threads = util::ThreadBudget::defaultNumThreads();
+}
+
+void ExternalContext::setThreadBudget(util::ThreadBudget &budget, int32_t num_threads)
+{
+  _max_num_threads = num_threads;
+  _counter = budget.addPool("ggml", num_threads);
 }
 
 } // namespace onert::backend::ggml
@@ -18,9 +18,11 @@
 #define __ONERT_BACKEND_GGML_EXTERNAL_CONTEXT_H__
 
 #include <util/ConfigSource.h>
+#include <util/ThreadBudget.h>
 #include <ggml.h>
 
 #include <memory>
+#include <vector>
 
 namespace onert::backend::ggml
 {
@@ -33,10 +35,33 @@ public:
 public:
   void setMaxNumThreads(int max_num_threads);
 
+  /**
+   * @brief Take num_threads threads from the thread budget of session, instead of NUM_THREADS
+   */
+  void setThreadBudget(util::ThreadBudget &budget, int32_t num_threads);
+
   int32_t maxNumThreads() const { return _max_num_threads; }
 
+  /**
+   * @brief Counter of threads running ggml graphs, or nullptr if there is no thread budget
+   */
+  util::ThreadPoolCounter *counter() const { return _counter.get(); }
+
+  /**
+   * @brief Get work buffer for ggml graph computation of at least @c size bytes
+   * @note  The buffer is shared by kernels of a backend context, which run one at a time
+   */
+  uint8_t *workBuffer(size_t size)
+  {
+    if (_work_buffer.size() < size)
+      _work_buffer.resize(size);
+    return _work_buffer.data();
+  }
+
 private:
   int32_t _max_num_threads;
+  std::shared_ptr<util::ThreadPoolCounter> _counter;
+  std::vector<uint8_t> _work_buffer;
   std::unique_ptr<ggml_context, decltype(&ggml_free)> _ggml_context{nullptr, &ggml_free};
 };
 
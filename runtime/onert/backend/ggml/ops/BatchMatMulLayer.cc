@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BatchMatMulLayer.h"
+
+#include "OperationUtils.h"
+#include "../KernelGenerator.h"
+#include "../Validator.h"
+
+#include <algorithm>
+
+namespace onert::backend::ggml
+{
+
+void Validator::visit(const ir::operation::BatchMatMul &node)
+{
+  using ir::operation::BatchMatMul;
+
+  const auto &output = _graph.operands().at(node.getOutputs().at(0));
+  const auto &lhs = _graph.operands().at(node.getInputs().at(BatchMatMul::Input::LHS));
+  const auto &rhs = _graph.operands().at(node.getInputs().at(BatchMatMul::Input::RHS));
+
+  _supported = false;
+
+  if (output.typeInfo().type() != ir::DataType::FLOAT32 ||
+      lhs.typeInfo().type() != ir::DataType::FLOAT32 ||
+      rhs.typeInfo().type() != ir::DataType::FLOAT32)
+    return;
+
+  const auto lhs_rank = lhs.shape().rank();
+  const auto rhs_rank = rhs.shape().rank();
+  if (lhs_rank < 2 || lhs_rank > GGML_MAX_DIMS || rhs_rank < 2 || rhs_rank > GGML_MAX_DIMS)
+    return;
+
+  // ggml broadcasts batches of rhs to batches of lhs only
+  ir::Shape lhs_batch, rhs_batch;
+  for (int i = 0; i < lhs_rank - 2; ++i)
+    lhs_batch.append(lhs.shape().dim(i));
+  for (int i = 0; i < rhs_rank - 2; ++i)
+    rhs_batch.append(rhs.shape().dim(i));
+  if (!ops::canRepeat(rhs_batch, lhs_batch))
+    return;
+
+  _supported = true;
+}
+
+void KernelGenerator::visit(const ir::operation::BatchMatMul &node)
+{
+  using ir::operation::BatchMatMul;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto lhs_index{node.getInputs().at(BatchMatMul::Input::LHS)};
+  const auto rhs_index{node.getInputs().at(BatchMatMul::Input::RHS)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto lhs_tensor = _tensor_reg->getPortableTensor(lhs_index);
+  auto rhs_tensor = _tensor_reg->getPortableTensor(rhs_index);
+
+  const auto adj_x = node.param().adj_x;
+  const auto adj_y = node.param().adj_y;
+
+  auto fn = std::make_unique<ops::BatchMatMulLayer>();
+
+  fn->configure(lhs_tensor, rhs_tensor, adj_x, adj_y, output_tensor, _external_context.get());
+
+  _return_fn = std::move(fn);
+}
+
+} // namespace onert::backend::ggml
+
+namespace onert::backend::ggml::ops
+{
+
+namespace
+{
+
+// Transpose the first two dimensions of contiguous float tensor, split by rows of dst
+void transpose(struct ggml_tensor *dst, const struct ggml_tensor *a, const struct ggml_tensor *,
+               const struct ggml_tensor *, int ith, int nth, void *)
+{
+  const int64_t cols = a->ne[0];
+  const int64_t rows = a->ne[1];
+  const int64_t nrows = ggml_nrows(dst);
+  const int64_t rows_per_thread = (nrows + nth - 1) / nth;
+  const int64_t row_begin = std::min(nrows, rows_per_thread * ith);
+  const int64_t row_end = std::min(nrows, row_begin + rows_per_thread);
+
+  const float *src_data = static_cast<const float *>(a->data);
+  float *dst_data = static_cast<float *>(dst->data);
+
+  for (int64_t row = row_begin; row < row_end; ++row)
+  {
+    // row of dst is column of src
+    const int64_t mat = row / cols;
+    const int64_t col = row % cols;
+    const float *x = src_data + mat * rows * cols + col;
+    float *y = dst_data + row * rows;
+    for (int64_t i = 0; i < rows; ++i)
+      y[i] = x[i * cols];
+  }
+}
+
+struct ggml_tensor getTransposeNode(struct ggml_tensor *src, std::vector<float> &buffer)
+{
+  const int64_t ne[GGML_MAX_DIMS] = {src->ne[1], src->ne[0], src->ne[2], src->ne[3]};
+  buffer.resize(ggml_nelements(src));
+
+  auto node = getGGMLTensor(GGML_TYPE_F32, ne, buffer.data());
+  setGGMLCustomOp(&node, transpose, nullptr, src);
+  return node;
+}
+
+} // namespace
+
+void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
+                                 bool adj_x, bool adj_y, IPortableTensor *output,
+                                 ExternalContext *ctx)
+{
+  _lhs = lhs;
+  _rhs = rhs;
+  _adj_x = adj_x;
+  _adj_y = adj_y;
+  _output = output;
+
+  configureGGML({_lhs, _rhs, _output}, ctx);
+}
+
+void BatchMatMulLayer::updateNodes()
+{
+  if (_lhs->getShape().rank() > GGML_MAX_DIMS || _rhs->getShape().rank() > GGML_MAX_DIMS ||
+      _output->getShape().rank() > GGML_MAX_DIMS)
+    throw std::runtime_error("BatchMatMul: rank of tensors must be 4 or less");
+
+  _ggml_lhs = getGGMLTensor(_lhs);
+  _ggml_rhs = getGGMLTensor(_rhs);
+  _ggml_output = getGGMLTensor(_output);
+
+  // ggml_mul_mat(a, b) takes a of ne [K, N] and b of ne [K, M], and gives ne [N, M]
+  struct ggml_tensor *a = &_ggml_rhs;
+  struct ggml_tensor *b = &_ggml_lhs;
+  if (!_adj_y)
+  {
+    _ggml_rhs_t = getTransposeNode(&_ggml_rhs, _rhs_t_buffer);
+    a = &_ggml_rhs_t;
+  }
+  if (_adj_x)
+  {
+    _ggml_lhs_t = getTransposeNode(&_ggml_lhs, _lhs_t_buffer);
+    b = &_ggml_lhs_t;
+  }
+
+  if (a->ne[0] != b->ne[0])
+    throw std::runtime_error("BatchMatMul: inner dimensions of lhs and rhs do not match");
+
+  if (b->ne[2] % a->ne[2] != 0 || b->ne[3] % a->ne[3] != 0)
+    throw std::runtime_error("BatchMatMul: batches of rhs cannot be broadcast to lhs");
+
+  if (_ggml_output.ne[0] != a->ne[1] || _ggml_output.ne[1] != b->ne[1] ||
+      _ggml_output.ne[2] != b->ne[2] || _ggml_output.ne[3] != b->ne[3])
+    throw std::runtime_error("BatchMatMul: invalid output shape");
+
+  _ggml_output.op = GGML_OP_MUL_MAT;
+  _ggml_output.src[0] = a;
+  _ggml_output.src[1] = b;
+}
+
+void BatchMatMulLayer::addNodes(GGMLGraph &graph)
+{
+  if (!_adj_y)
+    graph.addNode(&_ggml_rhs_t);
+  if (_adj_x)
+    graph.addNode(&_ggml_lhs_t);
+  graph.addNode(&_ggml_output);
+}
+
+} // namespace onert::backend::ggml::ops
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_GGML_OPS_BATCHMATMULLAYER_H__
+#define __ONERT_BACKEND_GGML_OPS_BATCHMATMULLAYER_H__
+
+#include "GGMLLayer.h"
+#include "../ExternalContext.h"
+
+#include <backend/IPortableTensor.h>
+
+#include <vector>
+
+namespace onert::backend::ggml::ops
+{
+
+/**
+ * @brief BatchMatMul by ggml_mul_mat, which multiplies rows of rhs by rows of lhs
+ *
+ * Operands not in that layout are transposed into buffers of this layer by custom nodes
+ */
+class BatchMatMulLayer : public GGMLLayer
+{
+public:
+  BatchMatMulLayer()
+    : _lhs{nullptr}, _rhs{nullptr}, _output{nullptr}, _adj_x{false}, _adj_y{false}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x, bool adj_y,
+                 IPortableTensor *output, ExternalContext *ctx);
+
+protected:
+  void updateNodes() override;
+  void addNodes(GGMLGraph &graph) override;
+
+private:
+  const IPortableTensor *_lhs;
+  const IPortableTensor *_rhs;
+  IPortableTensor *_output;
+
+  bool _adj_x;
+  bool _adj_y;
+
+  struct ggml_tensor _ggml_lhs;
+  struct ggml_tensor _ggml_rhs;
+  struct ggml_tensor _ggml_lhs_t;
+  struct ggml_tensor _ggml_rhs_t;
+  struct ggml_tensor _ggml_output;
+
+  std::vector<float> _lhs_t_buffer;
+  std::vector<float> _rhs_t_buffer;
+};
+
+} // namespace onert::backend::ggml::ops
+
+#endif // __ONERT_BACKEND_GGML_OPS_BATCHMATMULLAYER_H__
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BinaryArithmeticLayer.h"
+
+#include "OperationUtils.h"
+#include "../KernelGenerator.h"
+#include "../Validator.h"
+
+namespace onert::backend::ggml
+{
+
+void Validator::visit(const ir::operation::BinaryArithmetic &node)
+{
+  using ir::operation::BinaryArithmetic;
+
+  const auto &output = _graph.operands().at(node.getOutputs().at(0));
+  const auto &lhs = _graph.operands().at(node.getInputs().at(BinaryArithmetic::Input::LHS));
+  const auto &rhs = _graph.operands().at(node.getInputs().at(BinaryArithmetic::Input::RHS));
+
+  _supported = false;
+
+  if (output.typeInfo().type() != ir::DataType::FLOAT32 ||
+      lhs.typeInfo().type() != ir::DataType::FLOAT32 ||
+      rhs.typeInfo().type() != ir::DataType::FLOAT32)
+    return;
+
+  if (node.param().activation != ir::Activation::NONE)
+    return;
+
+  // ggml broadcasts rhs to lhs only, and lhs of ADD and MUL can be swapped with rhs
+  const auto type = node.param().arithmetic_type;
+  const bool commutative = type == BinaryArithmetic::ArithmeticType::ADD ||
+                           type == BinaryArithmetic::ArithmeticType::MUL;
+  if (type == BinaryArithmetic::ArithmeticType::SUB)
+  {
+    if (lhs.shape() != output.shape() || rhs.shape() != output.shape())
+      return;
+  }
+  else if (!(lhs.shape() == output.shape() && ops::canRepeat(rhs.shape(), output.shape())) &&
+           !(commutative && rhs.shape() == output.shape() &&
+             ops::canRepeat(lhs.shape(), output.shape())))
+    return;
+
+  _supported = true;
+}
+
+void KernelGenerator::visit(const ir::operation::BinaryArithmetic &node)
+{
+  using ir::operation::BinaryArithmetic;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto lhs_index{node.getInputs().at(BinaryArithmetic::Input::LHS)};
+  const auto rhs_index{node.getInputs().at(BinaryArithmetic::Input::RHS)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto lhs_tensor = _tensor_reg->getPortableTensor(lhs_index);
+  auto rhs_tensor = _tensor_reg->getPortableTensor(rhs_index);
+
+  ggml_op op = GGML_OP_NONE;
+  switch (node.param().arithmetic_type)
+  {
+    case BinaryArithmetic::ArithmeticType::ADD:
+      op = GGML_OP_ADD;
+      break;
+    case BinaryArithmetic::ArithmeticType::SUB:
+      op = GGML_OP_SUB;
+      break;
+    case BinaryArithmetic::ArithmeticType::MUL:
+      op = GGML_OP_MUL;
+      break;
+    case BinaryArithmetic::ArithmeticType::DIV:
+      op = GGML_OP_DIV;
+      break;
+    default:
+      throw std::runtime_error("BinaryArithmetic: unsupported arithmetic type");
+  }
+
+  auto fn = std::make_unique<ops::BinaryArithmeticLayer>();
+
+  fn->configure(lhs_tensor, rhs_tensor, output_tensor, op, _external_context.get());
+
+  _return_fn = std::move(fn);
+}
+
+} // namespace onert::backend::ggml
+
+namespace onert::backend::ggml::ops
+{
+
+void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
+                                      IPortableTensor *output, ggml_op op, ExternalContext *ctx)
+{
+  _lhs = lhs;
+  _rhs = rhs;
+  _output = output;
+  _op = op;
+
+  configureGGML({_lhs, _rhs, _output}, ctx);
+}
+
+void BinaryArithmeticLayer::updateNodes()
+{
+  _ggml_lhs = getGGMLTensor(_lhs);
+  _ggml_rhs = getGGMLTensor(_rhs);
+  _ggml_output = getGGMLTensor(_output);
+
+  // Broadcast lhs by swapping operands of commutative ops
+  const bool commutative = _op == GGML_OP_ADD || _op == GGML_OP_MUL;
+  if (commutative && !ggml_are_same_shape(&_ggml_lhs, &_ggml_output))
+    std::swap(_ggml_lhs, _ggml_rhs);
+
+  if (!ggml_are_same_shape(&_ggml_lhs, &_ggml_output) || !ggml_can_repeat(&_ggml_rhs, &_ggml_lhs))
+    throw std::runtime_error("BinaryArithmetic: unsupported broadcasting");
+
+  if (_op == GGML_OP_SUB && !ggml_are_same_shape(&_ggml_rhs, &_ggml_output))
+    throw std::runtime_error("BinaryArithmetic: broadcasting of SUB is not supported");
+
+  _ggml_output.op = _op;
+  _ggml_output.src[0] = &_ggml_lhs;
+  _ggml_output.src[1] = &_ggml_rhs;
+}
+
+void BinaryArithmeticLayer::addNodes(GGMLGraph &graph) { graph.addNode(&_ggml_output); }
+
+} // namespace onert::backend::ggml::ops
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_GGML_OPS_BINARYARITHMETICLAYER_H__
+#define __ONERT_BACKEND_GGML_OPS_BINARYARITHMETICLAYER_H__
+
+#include "GGMLLayer.h"
+#include "../ExternalContext.h"
+
+#include <backend/IPortableTensor.h>
+
+namespace onert::backend::ggml::ops
+{
+
+class BinaryArithmeticLayer : public GGMLLayer
+{
+public:
+  BinaryArithmeticLayer() : _lhs{nullptr}, _rhs{nullptr}, _output{nullptr}, _op{GGML_OP_NONE}
+  {
+    // DO NOTHING
+  }
+
+public:
+  /**
+   * @param op GGML_OP_ADD, GGML_OP_SUB, GGML_OP_MUL or GGML_OP_DIV
+   */
+  void configure(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
+                 ggml_op op, ExternalContext *ctx);
+
+protected:
+  void updateNodes() override;
+  void addNodes(GGMLGraph &graph) override;
+
+private:
+  const IPortableTensor *_lhs;
+  const IPortableTensor *_rhs;
+  IPortableTensor *_output;
+
+  ggml_op _op;
+
+  struct ggml_tensor _ggml_lhs;
+  struct ggml_tensor _ggml_rhs;
+  struct ggml_tensor _ggml_output;
+};
+
+} // namespace onert::backend::ggml::ops
+
+#endif // __ONERT_BACKEND_GGML_OPS_BINARYARITHMETICLAYER_H__
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ElementwiseActivationLayer.h"
+
+#include "../KernelGenerator.h"
+#include "../Validator.h"
+
+namespace onert::backend::ggml
+{
+
+namespace
+{
+
+// Return GGML_UNARY_OP_COUNT if the activation is not supported by ggml
+ggml_unary_op getUnaryOp(const ir::operation::ElementwiseActivation::Param &param)
+{
+  using ir::operation::ElementwiseActivation;
+
+  switch (param.op_type)
+  {
+    case ElementwiseActivation::Type::LOGISTIC:
+      return GGML_UNARY_OP_SIGMOID;
+    case ElementwiseActivation::Type::TANH:
+      return GGML_UNARY_OP_TANH;
+    case ElementwiseActivation::Type::RELU:
+      // Only plain ReLU, not ReLU6 or ReLU1
+      if (param.alpha == ElementwiseActivation::infinity && param.beta == 0.f)
+        return GGML_UNARY_OP_RELU;
+      return GGML_UNARY_OP_COUNT;
+    case ElementwiseActivation::Type::GELU:
+      // ggml computes GELU with tanh approximation
+      if (param.approximate)
+        return GGML_UNARY_OP_GELU;
+      return GGML_UNARY_OP_COUNT;
+    default:
+      return GGML_UNARY_OP_COUNT;
+  }
+}
+
+} // namespace
+
+void Validator::visit(const ir::operation::ElementwiseActivation &node)
+{
+  using ir::operation::ElementwiseActivation;
+
+  const auto input_index{node.getInputs().at(ElementwiseActivation::Input::INPUT)};
+  const auto &output = _graph.operands().at(node.getOutputs().at(0));
+  const auto &input = _graph.operands().at(input_index);
+
+  _supported = false;
+
+  if (input.typeInfo().type() != ir::DataType::FLOAT32 ||
+      output.typeInfo().type() != ir::DataType::FLOAT32)
+    return;
+
+  if (getUnaryOp(node.param()) == GGML_UNARY_OP_COUNT)
+    return;
+
+  _supported = true;
+}
+
+void KernelGenerator::visit(const ir::operation::ElementwiseActivation &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::ElementwiseActivation::Input::INPUT)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+
+  const auto op = getUnaryOp(node.param());
+  if (op == GGML_UNARY_OP_COUNT)
+    throw std::runtime_error("ElementwiseActivation: unsupported activation type");
+
+  auto fn = std::make_unique<ops::ElementwiseActivationLayer>();
+
+  fn->configure(input_tensor, output_tensor, op, _external_context.get());
+
+  _return_fn = std::move(fn);
+}
+
+} // namespace onert::backend::ggml
+
+namespace onert::backend::ggml::ops
+{
+
+void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortableTensor *output,
+                                           ggml_unary_op op, ExternalContext *ctx)
+{
+  _input = input;
+  _output = output;
+  _op = op;
+
+  configureGGML({_input, _output}, ctx);
+}
+
+void ElementwiseActivationLayer::updateNodes()
+{
+  _ggml_input = getGGMLTensor(_input);
+  _ggml_output = getGGMLTensor(_output);
+
+  if (!ggml_are_same_shape(&_ggml_input, &_ggml_output))
+    throw std::runtime_error("ElementwiseActivation: input and output shapes must be the same");
+
+  _ggml_output.op = GGML_OP_UNARY;
+  _ggml_output.op_params[0] = static_cast<int32_t>(_op);
+  _ggml_output.src[0] = &_ggml_input;
+}
+
+void ElementwiseActivationLayer::addNodes(GGMLGraph &graph) { graph.addNode(&_ggml_output); }
+
+} // namespace onert::backend::ggml::ops
@@ -20,6 +20,8 @@
 #include "../KernelGenerator.h"
 #include "../Validator.h"
 
+#include <cstring>
+
 namespace onert::backend::ggml
 {
 
@@ -39,6 +41,11 @@ void Validator::visit(const ir::operation::FullyConnected &node)
   if (node.param().activation != ir::Activation::NONE)
     return;
 
+  const auto bias_index{node.getInputs().at(FullyConnected::Input::BIAS)};
+  if (!bias_index.undefined() &&
+      _graph.operands().at(bias_index).typeInfo().type() != ir::DataType::FLOAT32)
+    return;
+
   _supported = true;
 }
 
@@ -77,42 +84,52 @@ FullyConnectedLayer::FullyConnectedLayer()
   : _input(nullptr), _weights(nullptr), _bias(nullptr), _output(nullptr),
     _activation(ir::Activation::NONE), _external_context(nullptr)
 {
-  // DO NOTHING
+  memset(&_ggml_input, 0, sizeof(_ggml_input));
+  memset(&_ggml_weights, 0, sizeof(_ggml_weights));
+  memset(&_ggml_bias, 0, sizeof(_ggml_bias));
+  memset(&_ggml_output, 0, sizeof(_ggml_output));
+  memset(&_ggml_output_bias, 0, sizeof(_ggml_output_bias));
 }
 
 FullyConnectedLayer::~FullyConnectedLayer() = default;
 
-void FullyConnectedLayer::fullyConnectedGGMLWeight()
+void FullyConnectedLayer::updateNodes()
 {
-  if (_bias)
-    throw std::runtime_error{"FullyConnected: GGML weights format does not support bias yet."};
+  if (_weights->data_type() != ir::DataType::QUANT_GGML_Q4_0 &&
+      _weights->data_type() != ir::DataType::QUANT_GGML_Q8_0)
+    throw std::runtime_error{"FullyConnected: unsupported data type"};
 
-  // convert tensor
-  auto input = getGGMLTensor(_input);
-  auto weights = getGGMLTensor(_weights);
-  auto output = getGGMLTensor(_output);
+  // Buffers of tensors may be changed between runs, e.g. model inputs and outputs
+  _ggml_input = getGGMLTensor(_input);
+  _ggml_weights = getGGMLTensor(_weights);
+  _ggml_output = getGGMLTensor(_output);
   {
-    output.op = GGML_OP_MUL_MAT;
-    output.src[0] = &weights;
-    output.src[1] = &input;
+    _ggml_output.op = GGML_OP_MUL_MAT;
+    _ggml_output.src[0] = &_ggml_weights;
+    _ggml_output.src[1] = &_ggml_input;
   }
-  auto *nodes = &output;
 
-  // create graph
-  struct ggml_cgraph graph;
+  if (_bias)
   {
-    memset(&graph, 0, sizeof(graph));
-    graph.n_nodes = 1;
-    graph.nodes = &nodes;
+    if (_bias->data_type() != ir::DataType::FLOAT32)
+      throw std::runtime_error{"FullyConnected: bias must be float32 type"};
+
+    // Add bias in place of output
+    _ggml_bias = getGGMLTensor(_bias);
+    _ggml_output_bias = getGGMLTensor(_output);
+    {
+      _ggml_output_bias.op = GGML_OP_ADD;
+      _ggml_output_bias.src[0] = &_ggml_output;
+      _ggml_output_bias.src[1] = &_ggml_bias;
+    }
   }
+}
 
-  // get cplan
-  auto cplan = ggml_graph_plan(&graph, _external_context->maxNumThreads());
-  std::vector<uint8_t> buf(cplan.work_size);
-  cplan.work_data = buf.data();
-
-  // compute
-  ggml_graph_compute(&graph, &cplan);
+void FullyConnectedLayer::addNodes(GGMLGraph &graph)
+{
+  graph.addNode(&_ggml_output);
+  if (_bias)
+    graph.addNode(&_ggml_output_bias);
 }
 
 void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
@@ -126,19 +143,11 @@ void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortabl
   _activation = activation;
   _output = output;
   _external_context = external_context;
-}
 
-void FullyConnectedLayer::run()
-{
-  if (_weights->data_type() == ir::DataType::QUANT_GGML_Q4_0 ||
-      _weights->data_type() == ir::DataType::QUANT_GGML_Q8_0)
-  {
-    fullyConnectedGGMLWeight();
-  }
-  else
-  {
-    throw std::runtime_error{"FullyConnected: unsupported data type"};
-  }
+  std::vector<const IPortableTensor *> tensors{_input, _weights, _output};
+  if (_bias)
+    tensors.emplace_back(_bias);
+  configureGGML(tensors, _external_context.get());
 }
 
 void FullyConnectedLayer::prepare()
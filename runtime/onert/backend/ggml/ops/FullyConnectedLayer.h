@@ -17,32 +17,32 @@
 #ifndef __ONERT_BACKEND_GGML_OPS_FULLYCONNECTEDLAYER_H__
 #define __ONERT_BACKEND_GGML_OPS_FULLYCONNECTEDLAYER_H__
 
+#include "GGMLLayer.h"
 #include "../ExternalContext.h"
 
 #include <backend/IPortableTensor.h>
-#include <exec/IFunction.h>
 #include <ir/InternalType.h>
 
 namespace onert::backend::ggml::ops
 {
 
-class FullyConnectedLayer : public ::onert::exec::IFunction
+class FullyConnectedLayer : public GGMLLayer
 {
 public:
   FullyConnectedLayer();
   ~FullyConnectedLayer();
 
 public:
-  void fullyConnectedGGMLWeight();
-
   void configure(const IPortableTensor *input, const IPortableTensor *weights,
                  const IPortableTensor *bias, ir::Activation activation, IPortableTensor *output,
                  const std::shared_ptr<ExternalContext> &external_context);
 
-  void run() override;
-
   void prepare() override;
 
+protected:
+  void updateNodes() override;
+  void addNodes(GGMLGraph &graph) override;
+
 protected:
   const IPortableTensor *_input;
   const IPortableTensor *_weights;
@@ -51,6 +51,14 @@ protected:
   ir::Activation _activation;
 
   std::shared_ptr<ExternalContext> _external_context;
+
+private:
+  // ggml tensors are kept over runs to reuse the compute plan
+  struct ggml_tensor _ggml_input;
+  struct ggml_tensor _ggml_weights;
+  struct ggml_tensor _ggml_bias;
+  struct ggml_tensor _ggml_output;
+  struct ggml_tensor _ggml_output_bias;
 };
 
 } // namespace onert::backend::ggml::ops
@@ -16,6 +16,11 @@
 
 #include "GGMLHelper.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
 namespace onert::backend::ggml::ops
 {
 
@@ -38,19 +43,13 @@ ggml_type getGGMLType(ir::DataType type)
   }
 }
 
-struct ggml_tensor getGGMLTensor(const IPortableTensor *tensor)
+struct ggml_tensor getGGMLTensor(ggml_type type, const int64_t (&ne)[GGML_MAX_DIMS], void *data)
 {
   struct ggml_tensor res;
+  memset(&res, 0, sizeof(res));
 
-  res.type = getGGMLType(tensor->data_type());
-  const auto rank = tensor->getShape().rank();
-  for (int i = 0; i < GGML_MAX_DIMS; ++i)
-  {
-    if (i >= rank)
-      res.ne[i] = 1;
-    else
-      res.ne[i] = tensor->getShape().dim(rank - i - 1);
-  }
+  res.type = type;
+  std::copy(ne, ne + GGML_MAX_DIMS, res.ne);
 
   res.nb[0] = ggml_type_size(res.type);
   res.nb[1] = res.nb[0] * (res.ne[0] / ggml_blck_size(res.type));
@@ -58,10 +57,75 @@ struct ggml_tensor getGGMLTensor(const IPortableTensor *tensor)
     res.nb[i] = res.nb[i - 1] * res.ne[i - 1];
 
   res.op = GGML_OP_NONE;
-  res.grad = nullptr;
-  res.data = (void *)(tensor->buffer());
+  res.data = data;
 
   return res;
 }
 
+struct ggml_tensor getGGMLTensor(const IPortableTensor *tensor)
+{
+  int64_t ne[GGML_MAX_DIMS];
+  const auto &shape = tensor->get_info().shape();
+  const auto rank = shape.rank();
+  for (int i = 0; i < GGML_MAX_DIMS; ++i)
+  {
+    if (i >= rank)
+      ne[i] = 1;
+    else
+      ne[i] = shape.dim(rank - i - 1);
+  }
+
+  return getGGMLTensor(getGGMLType(tensor->data_type()), ne, (void *)(tensor->buffer()));
+}
+
+void setGGMLCustomOp(struct ggml_tensor *node, ggml_custom3_op_t fun, void *userdata,
+                     struct ggml_tensor *a, struct ggml_tensor *b, struct ggml_tensor *c)
+{
+  // ggml_map_custom3() makes a new node in a context, so make it in a context on the stack
+  // holding one tensor without data, and take its op and op params
+  alignas(GGML_MEM_ALIGN) uint8_t mem[GGML_OBJECT_SIZE + GGML_TENSOR_SIZE + GGML_MEM_ALIGN];
+  struct ggml_context *ctx = ggml_init({sizeof(mem), mem, true});
+  if (ctx == nullptr)
+    throw std::runtime_error("Failed to init ggml context for custom op");
+
+  // All sources are required, while unused ones are not read by fun
+  const auto custom = ggml_map_custom3(ctx, a, b ? b : a, c ? c : a, fun, GGML_N_TASKS_MAX,
+                                       userdata);
+  node->op = custom->op;
+  memcpy(node->op_params, custom->op_params, sizeof(node->op_params));
+  ggml_free(ctx);
+
+  node->src[0] = a;
+  node->src[1] = b;
+  node->src[2] = c;
+}
+
+void GGMLGraph::compute(ExternalContext *ctx)
+{
+  struct ggml_cgraph graph;
+  {
+    memset(&graph, 0, sizeof(graph));
+    graph.n_nodes = static_cast<int>(_nodes.size());
+    graph.nodes = _nodes.data();
+  }
+
+  if (!_planned)
+  {
+    _cplan = ggml_graph_plan(&graph, ctx->maxNumThreads());
+    _planned = true;
+  }
+  _cplan.work_data = ctx->workBuffer(_cplan.work_size);
+
+  auto counter = ctx->counter();
+  if (counter == nullptr || !counter->timed())
+  {
+    ggml_graph_compute(&graph, &_cplan);
+    return;
+  }
+
+  const auto begin = std::chrono::steady_clock::now();
+  ggml_graph_compute(&graph, &_cplan);
+  counter->record(std::chrono::steady_clock::now() - begin, _cplan.n_threads);
+}
+
 } // namespace onert::backend::ggml::ops
@@ -17,15 +17,73 @@
 #ifndef __ONERT_BACKEND_GGML_GGML_HELPER_H__
 #define __ONERT_BACKEND_GGML_GGML_HELPER_H__
 
+#include "../ExternalContext.h"
+
 #include <backend/IPortableTensor.h>
 
 #include <ggml.h>
 
+#include <vector>
+
 namespace onert::backend::ggml::ops
 {
 
+/**
+ * @brief Get ggml tensor without op of contiguous @c data
+ */
+struct ggml_tensor getGGMLTensor(ggml_type type, const int64_t (&ne)[GGML_MAX_DIMS], void *data);
 struct ggml_tensor getGGMLTensor(const IPortableTensor *tensor);
 
+/**
+ * @brief Make @c node a GGML_OP_MAP_CUSTOM3 node which calls @c fun on each thread, with op params
+ *        made by ggml_map_custom3()
+ *
+ * @c fun gets @c ith and @c nth to split its work, and null srcs are passed for unused sources
+ */
+void setGGMLCustomOp(struct ggml_tensor *node, ggml_custom3_op_t fun, void *userdata,
+                     struct ggml_tensor *a, struct ggml_tensor *b = nullptr,
+                     struct ggml_tensor *c = nullptr);
+
+/**
+ * @brief ggml graph which keeps its compute plan over runs
+ */
+class GGMLGraph
+{
+public:
+  void clear()
+  {
+    _nodes.clear();
+    _planned = false;
+  }
+  void addNode(struct ggml_tensor *node)
+  {
+    _nodes.emplace_back(node);
+    _planned = false;
+  }
+  size_t size() const { return _nodes.size(); }
+  /**
+   * @brief Whether the compute plan of current nodes is made and reused by later computes
+   */
+  bool planned() const { return _planned; }
+  /**
+   * @brief Work buffer size of the compute plan
+   */
+  size_t workSize() const { return _planned ? _cplan.work_size : 0; }
+
+  /**
+   * @brief Compute nodes in order with the work buffer of @c ctx
+   *
+   * The plan is made by the first compute after nodes are changed, so call clear() and addNode()
+   * again when shapes of nodes are changed
+   */
+  void compute(ExternalContext *ctx);
+
+private:
+  std::vector<struct ggml_tensor *> _nodes;
+  struct ggml_cplan _cplan;
+  bool _planned = false;
+};
+
 } // namespace onert::backend::ggml::ops
 
 #endif
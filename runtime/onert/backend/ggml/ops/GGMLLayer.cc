@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GGMLLayer.h"
+
+#include <algorithm>
+
+namespace onert::backend::ggml::ops
+{
+
+void GGMLLayer::configureGGML(const std::vector<const IPortableTensor *> &tensors,
+                              ExternalContext *ctx)
+{
+  _tensors = tensors;
+  _shapes.assign(_tensors.size(), ir::Shape{});
+  _ctx = ctx;
+}
+
+bool GGMLLayer::updateShapes()
+{
+  bool changed = false;
+  for (size_t i = 0; i < _tensors.size(); ++i)
+  {
+    const auto &shape = _tensors[i]->get_info().shape();
+    if (shape != _shapes[i])
+    {
+      _shapes[i] = shape;
+      changed = true;
+    }
+  }
+  return changed;
+}
+
+bool GGMLLayer::isStatic() const
+{
+  return std::none_of(_tensors.begin(), _tensors.end(),
+                      [](const IPortableTensor *tensor) { return tensor->is_dynamic(); });
+}
+
+void GGMLLayer::run()
+{
+  if (_computed)
+  {
+    _computed = false;
+    return;
+  }
+
+  bool changed = updateShapes();
+  updateNodes();
+
+  // Fused layers are computed here only if their shapes are static, i.e. not to be changed by
+  // shape inference before their turns. The rest are computed by their own run().
+  size_t n_fused = 0;
+  for (auto &&layer : _fused_layers)
+  {
+    if (!layer->isStatic())
+      break;
+    changed |= layer->updateShapes();
+    layer->updateNodes();
+    ++n_fused;
+  }
+
+  if (changed || n_fused + 1 != _num_graph_layers)
+  {
+    _graph.clear();
+    addNodes(_graph);
+    for (size_t i = 0; i < n_fused; ++i)
+      _fused_layers[i]->addNodes(_graph);
+    _num_graph_layers = n_fused + 1;
+  }
+
+  _graph.compute(_ctx);
+
+  for (size_t i = 0; i < n_fused; ++i)
+    _fused_layers[i]->_computed = true;
+}
+
+void GGMLLayer::fuse(GGMLLayer *next) { _fused_layers.emplace_back(next); }
+
+} // namespace onert::backend::ggml::ops
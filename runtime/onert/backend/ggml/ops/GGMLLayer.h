@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_GGML_OPS_GGMLLAYER_H__
+#define __ONERT_BACKEND_GGML_OPS_GGMLLAYER_H__
+
+#include "GGMLHelper.h"
+#include "../ExternalContext.h"
+
+#include <backend/IPortableTensor.h>
+#include <exec/IFunction.h>
+#include <ir/Shape.h>
+
+#include <vector>
+
+namespace onert::backend::ggml::ops
+{
+
+/**
+ * @brief Base of layers computed as ggml nodes
+ *
+ * Layers fused into a layer are computed by one ggml graph in run() of the layer. Then ggml
+ * starts worker threads once for the graph, not for each layer.
+ */
+class GGMLLayer : public ::onert::exec::IFunction
+{
+public:
+  GGMLLayer() = default;
+  virtual ~GGMLLayer() = default;
+
+public:
+  void run() final;
+
+  /**
+   * @brief Compute @c next together in run() of this layer, and make run() of @c next do nothing
+   *
+   * @note  @c next should run right after this layer or the last fused layer, without layers of
+   *        other backends between them
+   */
+  void fuse(GGMLLayer *next);
+
+protected:
+  /**
+   * @brief Set tensors read or written by ggml nodes of this layer, and context to compute with
+   */
+  void configureGGML(const std::vector<const IPortableTensor *> &tensors, ExternalContext *ctx);
+
+  /**
+   * @brief Refresh ggml nodes from tensors, e.g. buffers of model inputs and outputs
+   *
+   * It is called before every computation, and should throw if shapes are not supported.
+   */
+  virtual void updateNodes() = 0;
+
+  /**
+   * @brief Add ggml nodes of this layer to @c graph in compute order
+   */
+  virtual void addNodes(GGMLGraph &graph) = 0;
+
+private:
+  // Return true if shapes of tensors are changed since the last call
+  bool updateShapes();
+  // Return true if no tensor has dynamic shape, i.e. this layer does not need shape inference
+  bool isStatic() const;
+
+private:
+  std::vector<const IPortableTensor *> _tensors;
+  std::vector<ir::Shape> _shapes;
+  ExternalContext *_ctx = nullptr;
+
+  // ggml graph is kept over runs to reuse the compute plan
+  GGMLGraph _graph;
+  size_t _num_graph_layers = 0;
+
+  std::vector<GGMLLayer *> _fused_layers;
+  // Whether this layer is computed by the layer it is fused into
+  bool _computed = false;
+};
+
+} // namespace onert::backend::ggml::ops
+
+#endif // __ONERT_BACKEND_GGML_OPS_GGMLLAYER_H__
@@ -71,11 +71,15 @@ void GatherLayer::configure(const IPortableTensor *input, const IPortableTensor
   _indices = indices;
   _axis = axis;
   _output = output;
-  _ctx = ctx;
+
+  configureGGML({_input, _indices, _output}, ctx);
 }
 
-void GatherLayer::runByGGMLQuantInputType()
+void GatherLayer::updateNodes()
 {
+  if (_input->data_type() != ir::DataType::QUANT_GGML_Q4_0)
+    throw std::runtime_error("Gather: unsupported input data type");
+
   // Supporting condition
   // Input: rank 2
   // Indice: rank < 4 or rank 4 with dim(0) = 1, INT32
@@ -94,43 +98,16 @@ void GatherLayer::runByGGMLQuantInputType()
     throw std::runtime_error("Gather: axis must be 0");
 
   // convert tensor
-  auto input = getGGMLTensor(_input);
-  auto indices = getGGMLTensor(_indices);
-  auto output = getGGMLTensor(_output);
-  {
-    output.op = GGML_OP_GET_ROWS;
-    output.src[0] = &input;
-    output.src[1] = &indices;
-  }
-  auto *nodes = &output;
-
-  // create graph
-  struct ggml_cgraph graph;
+  _ggml_input = getGGMLTensor(_input);
+  _ggml_indices = getGGMLTensor(_indices);
+  _ggml_output = getGGMLTensor(_output);
   {
-    memset(&graph, 0, sizeof(graph));
-    graph.n_nodes = 1;
-    graph.nodes = &nodes;
+    _ggml_output.op = GGML_OP_GET_ROWS;
+    _ggml_output.src[0] = &_ggml_input;
+    _ggml_output.src[1] = &_ggml_indices;
   }
-
-  // get cplan
-  auto cplan = ggml_graph_plan(&graph, _ctx->maxNumThreads());
-  std::vector<uint8_t> buf(cplan.work_size);
-  cplan.work_data = buf.data();
-
-  // compute
-  ggml_graph_compute(&graph, &cplan);
 }
 
-void GatherLayer::run()
-{
-  switch (_input->data_type())
-  {
-    case ir::DataType::QUANT_GGML_Q4_0:
-      runByGGMLQuantInputType();
-      break;
-    default:
-      throw std::runtime_error("Gather: unsupported input data type");
-  }
-}
+void GatherLayer::addNodes(GGMLGraph &graph) { graph.addNode(&_ggml_output); }
 
 } // namespace onert::backend::ggml::ops
@@ -17,19 +17,18 @@
 #ifndef __ONERT_BACKEND_GGML_OPS_GATHERLAYER_H__
 #define __ONERT_BACKEND_GGML_OPS_GATHERLAYER_H__
 
+#include "GGMLLayer.h"
 #include "../ExternalContext.h"
 
 #include <backend/IPortableTensor.h>
 
-#include <exec/IFunction.h>
-
 namespace onert::backend::ggml::ops
 {
 
-class GatherLayer : public ::onert::exec::IFunction
+class GatherLayer : public GGMLLayer
 {
 public:
-  GatherLayer() : _input{nullptr}, _indices{nullptr}, _output{nullptr}, _axis{-1}, _ctx{nullptr}
+  GatherLayer() : _input{nullptr}, _indices{nullptr}, _output{nullptr}, _axis{-1}
   {
     // DO NOTHING
   }
@@ -38,11 +37,9 @@ public:
   void configure(const IPortableTensor *input, const IPortableTensor *indices,
                  IPortableTensor *output, int32_t axis, ExternalContext *ctx);
 
-  void run() override;
-
-private:
-  template <typename OpType> void runByInputType();
-  void runByGGMLQuantInputType();
+protected:
+  void updateNodes() override;
+  void addNodes(GGMLGraph &graph) override;
 
 private:
   const IPortableTensor *_input;
@@ -50,7 +47,10 @@ private:
   IPortableTensor *_output;
 
   int32_t _axis;
-  ExternalContext *_ctx;
+
+  struct ggml_tensor _ggml_input;
+  struct ggml_tensor _ggml_indices;
+  struct ggml_tensor _ggml_output;
 };
 
 } // namespace onert::backend::ggml::ops
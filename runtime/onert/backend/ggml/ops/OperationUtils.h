@@ -17,6 +17,10 @@
 #ifndef __ONERT_BACKEND_GGML_OPS_OPERATION_UTILS_H__
 #define __ONERT_BACKEND_GGML_OPS_OPERATION_UTILS_H__
 
+#include <ir/Shape.h>
+
+#include <ggml.h>
+
 #include <cstdint>
 
 namespace onert::backend::ggml::ops
@@ -34,6 +38,24 @@ inline int32_t getAxis(uint32_t rank, int32_t axis)
   return ret;
 }
 
+/**
+ * @brief Whether @c from can be broadcast to @c to by repeating, like ggml_can_repeat()
+ */
+inline bool canRepeat(const ir::Shape &from, const ir::Shape &to)
+{
+  if (from.rank() > to.rank() || to.rank() > GGML_MAX_DIMS)
+    return false;
+
+  for (int i = 1; i <= from.rank(); ++i)
+  {
+    const auto from_dim = from.dim(from.rank() - i);
+    const auto to_dim = to.dim(to.rank() - i);
+    if (from_dim <= 0 || to_dim % from_dim != 0)
+      return false;
+  }
+  return true;
+}
+
 } // namespace onert::backend::ggml::ops
 
 #endif // __ONERT_BACKEND_GGML_OPS_OPERATION_UTILS_H__
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RmsNormLayer.h"
+
+#include "../KernelGenerator.h"
+#include "../Validator.h"
+
+#include <cstring>
+
+namespace onert::backend::ggml
+{
+
+void Validator::visit(const ir::operation::RmsNorm &node)
+{
+  using ir::operation::RmsNorm;
+
+  const auto &output = _graph.operands().at(node.getOutputs().at(0));
+  const auto &input = _graph.operands().at(node.getInputs().at(RmsNorm::Input::INPUT));
+  const auto &gamma = _graph.operands().at(node.getInputs().at(RmsNorm::Input::GAMMA));
+
+  _supported = false;
+
+  if (input.typeInfo().type() != ir::DataType::FLOAT32 ||
+      gamma.typeInfo().type() != ir::DataType::FLOAT32 ||
+      output.typeInfo().type() != ir::DataType::FLOAT32)
+    return;
+
+  if (input.shape().rank() > GGML_MAX_DIMS || gamma.shape().rank() != 1)
+    return;
+
+  // ggml does not allow zero epsilon
+  if (!(node.param().epsilon > 0.0f))
+    return;
+
+  _supported = true;
+}
+
+void KernelGenerator::visit(const ir::operation::RmsNorm &node)
+{
+  using ir::operation::RmsNorm;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(RmsNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(RmsNorm::Input::GAMMA)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto gamma_tensor = _tensor_reg->getPortableTensor(gamma_index);
+
+  auto fn = std::make_unique<ops::RmsNormLayer>();
+
+  fn->configure(input_tensor, gamma_tensor, node.param().epsilon, output_tensor,
+                _external_context.get());
+
+  _return_fn = std::move(fn);
+}
+
+} // namespace onert::backend::ggml
+
+namespace onert::backend::ggml::ops
+{
+
+void RmsNormLayer::configure(const IPortableTensor *input, const IPortableTensor *gamma,
+                             float epsilon, IPortableTensor *output, ExternalContext *ctx)
+{
+  _input = input;
+  _gamma = gamma;
+  _epsilon = epsilon;
+  _output = output;
+
+  configureGGML({_input, _gamma, _output}, ctx);
+}
+
+void RmsNormLayer::updateNodes()
+{
+  _ggml_input = getGGMLTensor(_input);
+  _ggml_gamma = getGGMLTensor(_gamma);
+  _ggml_output = getGGMLTensor(_output);
+
+  if (!ggml_are_same_shape(&_ggml_input, &_ggml_output))
+    throw std::runtime_error("RmsNorm: input and output shapes must be the same");
+
+  // gamma has one value or one value per element of the last axis
+  if (ggml_nelements(&_ggml_gamma) != 1 && ggml_nelements(&_ggml_gamma) != _ggml_input.ne[0])
+    throw std::runtime_error("RmsNorm: invalid gamma shape");
+
+  _ggml_norm = _ggml_output;
+  {
+    _ggml_norm.op = GGML_OP_RMS_NORM;
+    memcpy(_ggml_norm.op_params, &_epsilon, sizeof(_epsilon));
+    _ggml_norm.src[0] = &_ggml_input;
+  }
+
+  _ggml_output.op = GGML_OP_MUL;
+  _ggml_output.src[0] = &_ggml_norm;
+  _ggml_output.src[1] = &_ggml_gamma;
+}
+
+void RmsNormLayer::addNodes(GGMLGraph &graph)
+{
+  graph.addNode(&_ggml_norm);
+  graph.addNode(&_ggml_output);
+}
+
+} // namespace onert::backend::ggml::ops
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RoPELayer.h"
+
+#include "../KernelGenerator.h"
+#include "../Validator.h"
+
+#include <algorithm>
+
+namespace onert::backend::ggml
+{
+
+void Validator::visit(const ir::operation::RoPE &node)
+{
+  using ir::operation::RoPE;
+
+  const auto &output = _graph.operands().at(node.getOutputs().at(0));
+  const auto &input = _graph.operands().at(node.getInputs().at(RoPE::Input::INPUT));
+  const auto &sin = _graph.operands().at(node.getInputs().at(RoPE::Input::SIN_TABLE));
+  const auto &cos = _graph.operands().at(node.getInputs().at(RoPE::Input::COS_TABLE));
+
+  _supported = false;
+
+  if (node.param().mode != RoPE::RoPEMode::GPT_NEOX)
+    return;
+
+  if (input.typeInfo().type() != ir::DataType::FLOAT32 ||
+      sin.typeInfo().type() != ir::DataType::FLOAT32 ||
+      cos.typeInfo().type() != ir::DataType::FLOAT32 ||
+      output.typeInfo().type() != ir::DataType::FLOAT32)
+    return;
+
+  if (input.shape().rank() != 4 || sin.shape().rank() != 4 || cos.shape().rank() != 4)
+    return;
+
+  _supported = true;
+}
+
+void KernelGenerator::visit(const ir::operation::RoPE &node)
+{
+  using ir::operation::RoPE;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(RoPE::Input::INPUT)};
+  const auto sin_index{node.getInputs().at(RoPE::Input::SIN_TABLE)};
+  const auto cos_index{node.getInputs().at(RoPE::Input::COS_TABLE)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto sin_tensor = _tensor_reg->getPortableTensor(sin_index);
+  auto cos_tensor = _tensor_reg->getPortableTensor(cos_index);
+
+  auto fn = std::make_unique<ops::RoPELayer>();
+
+  fn->configure(input_tensor, sin_tensor, cos_tensor, output_tensor, _external_context.get());
+
+  _return_fn = std::move(fn);
+}
+
+} // namespace onert::backend::ggml
+
+namespace onert::backend::ggml::ops
+{
+
+namespace
+{
+
+// Rotate two halves of each row, with the first row of sin and cos tables like cker::RoPE
+void ropeNeox(struct ggml_tensor *dst, const struct ggml_tensor *a, const struct ggml_tensor *sin,
+              const struct ggml_tensor *cos, int ith, int nth, void *)
+{
+  const int64_t d = a->ne[0];
+  const int64_t half = d / 2;
+  const int64_t nrows = ggml_nrows(a);
+  const int64_t rows_per_thread = (nrows + nth - 1) / nth;
+  const int64_t row_begin = std::min(nrows, rows_per_thread * ith);
+  const int64_t row_end = std::min(nrows, row_begin + rows_per_thread);
+
+  const float *sin_data = static_cast<const float *>(sin->data);
+  const float *cos_data = static_cast<const float *>(cos->data);
+
+  for (int64_t row = row_begin; row < row_end; ++row)
+  {
+    const float *x = static_cast<const float *>(a->data) + row * d;
+    float *y = static_cast<float *>(dst->data) + row * d;
+    for (int64_t i = 0; i < half; ++i)
+    {
+      const float x0 = x[i];
+      const float x1 = x[i + half];
+      y[i] = x0 * cos_data[i] - x1 * sin_data[i];
+      y[i + half] = x0 * sin_data[i + half] + x1 * cos_data[i + half];
+    }
+  }
+}
+
+} // namespace
+
+void RoPELayer::configure(const IPortableTensor *input, const IPortableTensor *sin,
+                          const IPortableTensor *cos, IPortableTensor *output,
+                          ExternalContext *ctx)
+{
+  _input = input;
+  _sin = sin;
+  _cos = cos;
+  _output = output;
+
+  configureGGML({_input, _sin, _cos, _output}, ctx);
+}
+
+void RoPELayer::updateNodes()
+{
+  _ggml_input = getGGMLTensor(_input);
+  _ggml_sin = getGGMLTensor(_sin);
+  _ggml_cos = getGGMLTensor(_cos);
+  _ggml_output = getGGMLTensor(_output);
+
+  if (!ggml_are_same_shape(&_ggml_input, &_ggml_output))
+    throw std::runtime_error("RoPE: input and output shapes must be the same");
+
+  if (_ggml_input.ne[0] % 2 != 0)
+    throw std::runtime_error("RoPE: the last dimension of input must be even");
+
+  if (_ggml_sin.ne[0] != _ggml_input.ne[0] || _ggml_cos.ne[0] != _ggml_input.ne[0])
+    throw std::runtime_error("RoPE: the last dimension of input and tables do not match");
+
+  setGGMLCustomOp(&_ggml_output, ropeNeox, nullptr, &_ggml_input, &_ggml_sin, &_ggml_cos);
+}
+
+void RoPELayer::addNodes(GGMLGraph &graph) { graph.addNode(&_ggml_output); }
+
+} // namespace onert::backend::ggml::ops
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_GGML_OPS_ROPELAYER_H__
+#define __ONERT_BACKEND_GGML_OPS_ROPELAYER_H__
+
+#include "GGMLLayer.h"
+#include "../ExternalContext.h"
+
+#include <backend/IPortableTensor.h>
+
+namespace onert::backend::ggml::ops
+{
+
+/**
+ * @brief RoPE of GPT-NeoX mode with sin and cos tables given as tensors
+ *
+ * ggml_rope computes its own tables from positions, so this is a custom node
+ */
+class RoPELayer : public GGMLLayer
+{
+public:
+  RoPELayer() : _input{nullptr}, _sin{nullptr}, _cos{nullptr}, _output{nullptr}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void configure(const IPortableTensor *input, const IPortableTensor *sin,
+                 const IPortableTensor *cos, IPortableTensor *output, ExternalContext *ctx);
+
+protected:
+  void updateNodes() override;
+  void addNodes(GGMLGraph &graph) override;
+
+private:
+  const IPortableTensor *_input;
+  const IPortableTensor *_sin;
+  const IPortableTensor *_cos;
+  IPortableTensor *_output;
+
+  struct ggml_tensor _ggml_input;
+  struct ggml_tensor _ggml_sin;
+  struct ggml_tensor _ggml_cos;
+  struct ggml_tensor _ggml_output;
+};
+
+} // namespace onert::backend::ggml::ops
+
+#endif // __ONERT_BACKEND_GGML_OPS_ROPELAYER_H__
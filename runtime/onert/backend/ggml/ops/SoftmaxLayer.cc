@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SoftmaxLayer.h"
+
+#include "../KernelGenerator.h"
+#include "../Validator.h"
+
+#include <cstring>
+
+namespace onert::backend::ggml
+{
+
+void Validator::visit(const ir::operation::Softmax &node)
+{
+  const auto &output = _graph.operands().at(node.getOutputs().at(0));
+  const auto input_index{node.getInputs().at(ir::operation::Softmax::Input::INPUT)};
+  const auto &input = _graph.operands().at(input_index);
+
+  _supported = false;
+
+  if (input.typeInfo().type() != ir::DataType::FLOAT32 ||
+      output.typeInfo().type() != ir::DataType::FLOAT32)
+    return;
+
+  if (input.shape().rank() > GGML_MAX_DIMS)
+    return;
+
+  _supported = true;
+}
+
+void KernelGenerator::visit(const ir::operation::Softmax &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::Softmax::Input::INPUT)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+
+  auto fn = std::make_unique<ops::SoftmaxLayer>();
+
+  fn->configure(input_tensor, node.param().beta, output_tensor, _external_context.get());
+
+  _return_fn = std::move(fn);
+}
+
+} // namespace onert::backend::ggml
+
+namespace onert::backend::ggml::ops
+{
+
+void SoftmaxLayer::configure(const IPortableTensor *input, float beta, IPortableTensor *output,
+                             ExternalContext *ctx)
+{
+  _input = input;
+  _beta = beta;
+  _output = output;
+
+  configureGGML({_input, _output}, ctx);
+}
+
+void SoftmaxLayer::updateNodes()
+{
+  if (_input->getShape().rank() > GGML_MAX_DIMS)
+    throw std::runtime_error("Softmax: rank of input must be 4 or less");
+
+  _ggml_input = getGGMLTensor(_input);
+  _ggml_output = getGGMLTensor(_output);
+
+  if (!ggml_are_same_shape(&_ggml_input, &_ggml_output))
+    throw std::runtime_error("Softmax: input and output shapes must be the same");
+
+  // softmax(x * beta) over the last axis, without mask and ALiBi bias
+  const float params[] = {_beta, 0.0f};
+  _ggml_output.op = GGML_OP_SOFT_MAX;
+  memcpy(_ggml_output.op_params, params, sizeof(params));
+  _ggml_output.src[0] = &_ggml_input;
+}
+
+void SoftmaxLayer::addNodes(GGMLGraph &graph) { graph.addNode(&_ggml_output); }
+
+} // namespace onert::backend::ggml::ops
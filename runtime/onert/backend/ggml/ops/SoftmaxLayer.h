@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_GGML_OPS_SOFTMAXLAYER_H__
+#define __ONERT_BACKEND_GGML_OPS_SOFTMAXLAYER_H__
+
+#include "GGMLLayer.h"
+#include "../ExternalContext.h"
+
+#include <backend/IPortableTensor.h>
+
+namespace onert::backend::ggml::ops
+{
+
+class SoftmaxLayer : public GGMLLayer
+{
+public:
+  SoftmaxLayer() : _input{nullptr}, _output{nullptr}, _beta{0.0f}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void configure(const IPortableTensor *input, float beta, IPortableTensor *output,
+                 ExternalContext *ctx);
+
+protected:
+  void updateNodes() override;
+  void addNodes(GGMLGraph &graph) override;
+
+private:
+  const IPortableTensor *_input;
+  IPortableTensor *_output;
+
+  float _beta;
+
+  struct ggml_tensor _ggml_input;
+  struct ggml_tensor _ggml_output;
+};
+
+} // namespace onert::backend::ggml::ops
+
+#endif // __ONERT_BACKEND_GGML_OPS_SOFTMAXLAYER_H__
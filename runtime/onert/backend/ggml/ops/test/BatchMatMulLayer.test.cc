@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestHelper.h"
+
+#include "../BatchMatMulLayer.h"
+
+#include <cker/operation/BatchMatMul.h>
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::backend::ggml;
+using namespace onert::backend::ggml::test;
+
+namespace
+{
+
+// Shape of a matrix operand of M x N, transposed if adj
+ir::Shape operandShape(int32_t batch0, int32_t batch1, int32_t m, int32_t n, bool adj)
+{
+  return adj ? ir::Shape{batch0, batch1, n, m} : ir::Shape{batch0, batch1, m, n};
+}
+
+void testBatchMatMul(int32_t rhs_batch0, bool adj_x, bool adj_y)
+{
+  constexpr int32_t kBatch0 = 2, kBatch1 = 3, kM = 4, kK = 32, kN = 5;
+  const auto lhs_shape = operandShape(kBatch0, kBatch1, kM, kK, adj_x);
+  const auto rhs_shape = operandShape(rhs_batch0, kBatch1, kK, kN, adj_y);
+  auto lhs = makeFloatTensor(lhs_shape, randomValues(lhs_shape.num_elements(), 1));
+  auto rhs = makeFloatTensor(rhs_shape, randomValues(rhs_shape.num_elements(), 2));
+  auto output = makeFloatTensor({kBatch0, kBatch1, kM, kN});
+  auto expected = makeFloatTensor({kBatch0, kBatch1, kM, kN});
+
+  ExternalContext ctx;
+  ops::BatchMatMulLayer layer;
+  layer.configure(lhs->tensor.get(), rhs->tensor.get(), adj_x, adj_y, output->tensor.get(), &ctx);
+  layer.run();
+
+  nnfw::cker::BatchMatMul kernel;
+  kernel.prepare(getShape(*lhs), getShape(*rhs), adj_x, adj_y, false);
+  kernel(getShape(*lhs), lhs->floats(), getShape(*rhs), rhs->floats(), adj_x, adj_y,
+         getShape(*expected), expected->floats());
+
+  expectNear(output->values(), expected->values(), 1e-4f);
+}
+
+} // namespace
+
+TEST(BatchMatMulLayer, CompareWithCpu)
+{
+  for (const bool adj_x : {false, true})
+    for (const bool adj_y : {false, true})
+    {
+      SCOPED_TRACE(testing::Message() << "adj_x " << adj_x << ", adj_y " << adj_y);
+      testBatchMatMul(2, adj_x, adj_y);
+    }
+}
+
+TEST(BatchMatMulLayer, BroadcastRhs)
+{
+  testBatchMatMul(1, false, false);
+  testBatchMatMul(1, true, true);
+}
+
+TEST(BatchMatMulLayer, neg_InnerDimensions)
+{
+  auto lhs = makeFloatTensor({1, 1, 4, 8});
+  auto rhs = makeFloatTensor({1, 1, 6, 5});
+  auto output = makeFloatTensor({1, 1, 4, 5});
+
+  ExternalContext ctx;
+  ops::BatchMatMulLayer layer;
+  layer.configure(lhs->tensor.get(), rhs->tensor.get(), false, false, output->tensor.get(), &ctx);
+  EXPECT_ANY_THROW(layer.run());
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestHelper.h"
+
+#include "../BinaryArithmeticLayer.h"
+
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <gtest/gtest.h>
+
+#include <limits>
+
+using namespace onert;
+using namespace onert::backend::ggml;
+using namespace onert::backend::ggml::test;
+
+namespace
+{
+
+using nnfw::cker::BinaryArithmeticOpType;
+
+template <BinaryArithmeticOpType op_type>
+void compute(TestTensor &lhs, TestTensor &rhs, TestTensor &output)
+{
+  nnfw::cker::BinaryArithmeticOpParam params;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  const auto lhs_shape = getShape(lhs);
+  const auto rhs_shape = getShape(rhs);
+  const auto output_shape = getShape(output);
+  if (nnfw::cker::ProcessBroadcastShapes(lhs_shape, rhs_shape, &params))
+    nnfw::cker::BroadcastBinaryArithmeticOp<op_type>(params, lhs_shape, lhs.floats(), rhs_shape,
+                                                     rhs.floats(), output_shape, output.floats());
+  else
+    nnfw::cker::BinaryArithmeticOp<op_type>(params, lhs_shape, lhs.floats(), rhs_shape,
+                                            rhs.floats(), output_shape, output.floats());
+}
+
+// Compare ggml op with cker kernel of op_type, which cpu backend runs
+template <BinaryArithmeticOpType op_type>
+void testBinaryArithmetic(ggml_op op, const ir::Shape &lhs_shape, const ir::Shape &rhs_shape,
+                          const ir::Shape &output_shape)
+{
+  // Divisors are away from zero
+  auto lhs = makeFloatTensor(lhs_shape, randomValues(lhs_shape.num_elements(), 1));
+  auto rhs = makeFloatTensor(rhs_shape, randomValues(rhs_shape.num_elements(), 2, 0.5f, 2.0f));
+  auto output = makeFloatTensor(output_shape);
+  auto expected = makeFloatTensor(output_shape);
+
+  ExternalContext ctx;
+  ops::BinaryArithmeticLayer layer;
+  layer.configure(lhs->tensor.get(), rhs->tensor.get(), output->tensor.get(), op, &ctx);
+  layer.run();
+
+  compute<op_type>(*lhs, *rhs, *expected);
+
+  expectNear(output->values(), expected->values(), 1e-6f);
+}
+
+} // namespace
+
+TEST(BinaryArithmeticLayer, SameShape)
+{
+  const ir::Shape shape{2, 3, 16};
+  testBinaryArithmetic<BinaryArithmeticOpType::ADD>(GGML_OP_ADD, shape, shape, shape);
+  testBinaryArithmetic<BinaryArithmeticOpType::SUB>(GGML_OP_SUB, shape, shape, shape);
+  testBinaryArithmetic<BinaryArithmeticOpType::MUL>(GGML_OP_MUL, shape, shape, shape);
+  testBinaryArithmetic<BinaryArithmeticOpType::DIV>(GGML_OP_DIV, shape, shape, shape);
+}
+
+TEST(BinaryArithmeticLayer, BroadcastRhs)
+{
+  const ir::Shape shape{2, 3, 16};
+  for (const auto &rhs_shape : {ir::Shape{16}, ir::Shape{1, 3, 1}})
+  {
+    testBinaryArithmetic<BinaryArithmeticOpType::ADD>(GGML_OP_ADD, shape, rhs_shape, shape);
+    testBinaryArithmetic<BinaryArithmeticOpType::MUL>(GGML_OP_MUL, shape, rhs_shape, shape);
+    testBinaryArithmetic<BinaryArithmeticOpType::DIV>(GGML_OP_DIV, shape, rhs_shape, shape);
+  }
+}
+
+TEST(BinaryArithmeticLayer, BroadcastLhs)
+{
+  const ir::Shape shape{2, 3, 16};
+  const ir::Shape lhs_shape{3, 1};
+  testBinaryArithmetic<BinaryArithmeticOpType::ADD>(GGML_OP_ADD, lhs_shape, shape, shape);
+  testBinaryArithmetic<BinaryArithmeticOpType::MUL>(GGML_OP_MUL, lhs_shape, shape, shape);
+}
+
+TEST(BinaryArithmeticLayer, neg_BroadcastSub)
+{
+  auto lhs = makeFloatTensor({2, 16});
+  auto rhs = makeFloatTensor({16});
+  auto output = makeFloatTensor({2, 16});
+
+  ExternalContext ctx;
+  ops::BinaryArithmeticLayer layer;
+  layer.configure(lhs->tensor.get(), rhs->tensor.get(), output->tensor.get(), GGML_OP_SUB, &ctx);
+  EXPECT_ANY_THROW(layer.run());
+}
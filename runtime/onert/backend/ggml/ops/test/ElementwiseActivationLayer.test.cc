@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestHelper.h"
+
+#include "../ElementwiseActivationLayer.h"
+
+#include <cker/operation/GELU.h>
+#include <cker/operation/Logistic.h>
+#include <cker/operation/ReLU.h>
+#include <cker/operation/Tanh.h>
+#include <gtest/gtest.h>
+
+#include <functional>
+
+using namespace onert;
+using namespace onert::backend::ggml;
+using namespace onert::backend::ggml::test;
+
+namespace
+{
+
+using CpuKernel = std::function<void(const nnfw::cker::Shape &, const float *,
+                                     const nnfw::cker::Shape &, float *)>;
+
+// Compare ggml unary op with cker kernel, which cpu backend runs
+void testActivation(ggml_unary_op op, const CpuKernel &kernel, float tolerance)
+{
+  const ir::Shape shape{2, 3, 40};
+  auto input = makeFloatTensor(shape, randomValues(shape.num_elements(), 1, -4.0f, 4.0f));
+  auto output = makeFloatTensor(shape);
+  auto expected = makeFloatTensor(shape);
+
+  ExternalContext ctx;
+  ops::ElementwiseActivationLayer layer;
+  layer.configure(input->tensor.get(), output->tensor.get(), op, &ctx);
+  layer.run();
+
+  kernel(getShape(*input), input->floats(), getShape(*expected), expected->floats());
+
+  expectNear(output->values(), expected->values(), tolerance);
+}
+
+} // namespace
+
+TEST(ElementwiseActivationLayer, Logistic)
+{
+  testActivation(
+    GGML_UNARY_OP_SIGMOID,
+    [](const nnfw::cker::Shape &input_shape, const float *input,
+       const nnfw::cker::Shape &output_shape,
+       float *output) { nnfw::cker::Logistic(input_shape, input, output_shape, output); },
+    1e-6f);
+}
+
+TEST(ElementwiseActivationLayer, Tanh)
+{
+  testActivation(
+    GGML_UNARY_OP_TANH,
+    [](const nnfw::cker::Shape &input_shape, const float *input,
+       const nnfw::cker::Shape &output_shape,
+       float *output) { nnfw::cker::Tanh(input_shape, input, output_shape, output); },
+    1e-6f);
+}
+
+TEST(ElementwiseActivationLayer, ReLU)
+{
+  testActivation(
+    GGML_UNARY_OP_RELU,
+    [](const nnfw::cker::Shape &input_shape, const float *input,
+       const nnfw::cker::Shape &output_shape,
+       float *output) { nnfw::cker::ReLU(input_shape, input, output_shape, output); },
+    0.0f);
+}
+
+TEST(ElementwiseActivationLayer, GELU)
+{
+  // ggml looks up GELU of inputs rounded to fp16
+  testActivation(
+    GGML_UNARY_OP_GELU,
+    [](const nnfw::cker::Shape &input_shape, const float *input,
+       const nnfw::cker::Shape &output_shape, float *output) {
+      nnfw::cker::GELU(nnfw::cker::GELUParams{true}, input_shape, input, output_shape, output);
+    },
+    1e-2f);
+}
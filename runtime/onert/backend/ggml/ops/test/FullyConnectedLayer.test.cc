@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestHelper.h"
+
+#include "../FullyConnectedLayer.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::backend::ggml;
+using namespace onert::backend::ggml::test;
+
+namespace
+{
+
+constexpr int32_t kBatch = 3;
+constexpr int32_t kInput = 64;
+
+/**
+ * @brief FullyConnected of Q8_0 weights reading an input shared with other layers
+ */
+struct FullyConnected
+{
+  FullyConnected(const TestTensor &input, int32_t num_outputs, bool has_bias, uint32_t seed,
+                 const std::shared_ptr<ExternalContext> &ctx)
+    : float_weights{randomValues(num_outputs * kInput, seed)},
+      weights{makeQuantTensor(num_outputs, kInput, GGML_TYPE_Q8_0, float_weights)},
+      bias{has_bias ? makeFloatTensor({num_outputs}, randomValues(num_outputs, seed + 1))
+                    : nullptr},
+      output{makeFloatTensor({kBatch, num_outputs})}
+  {
+    layer.configure(input.tensor.get(), weights->tensor.get(),
+                    bias ? bias->tensor.get() : nullptr, ir::Activation::NONE,
+                    output->tensor.get(), ctx);
+  }
+
+  // Weights before quantization times input, plus bias
+  std::vector<float> expected(const TestTensor &input) const
+  {
+    const auto &w = float_weights;
+    const auto x = input.values();
+    const auto num_outputs = output->tensor->getShape().dim(1);
+    std::vector<float> y(kBatch * num_outputs);
+    for (int32_t b = 0; b < kBatch; ++b)
+      for (int32_t o = 0; o < num_outputs; ++o)
+      {
+        float sum = bias ? bias->values()[o] : 0.0f;
+        for (int32_t i = 0; i < kInput; ++i)
+          sum += w[o * kInput + i] * x[b * kInput + i];
+        y[b * num_outputs + o] = sum;
+      }
+    return y;
+  }
+
+  std::vector<float> float_weights;
+  std::unique_ptr<TestTensor> weights;
+  std::unique_ptr<TestTensor> bias;
+  std::unique_ptr<TestTensor> output;
+  ops::FullyConnectedLayer layer;
+};
+
+} // namespace
+
+TEST(FullyConnectedLayer, Run)
+{
+  auto ctx = std::make_shared<ExternalContext>();
+  auto input = makeFloatTensor({kBatch, kInput}, randomValues(kBatch * kInput, 1));
+  FullyConnected fc{*input, 32, true, 10, ctx};
+
+  // Results of runs reusing the plan are the same
+  fc.layer.run();
+  const auto first = fc.output->values();
+  fc.layer.run();
+  ASSERT_EQ(fc.output->values(), first);
+
+  // Weights and input are quantized to Q8_0
+  expectNear(first, fc.expected(*input), 0.1f);
+}
+
+TEST(FullyConnectedLayer, FusedSiblings)
+{
+  auto ctx = std::make_shared<ExternalContext>();
+  auto input = makeFloatTensor({kBatch, kInput}, randomValues(kBatch * kInput, 1));
+
+  // Q/K/V like projections of the same input, computed by separate layers
+  FullyConnected q{*input, 32, true, 10, ctx};
+  FullyConnected k{*input, 48, false, 20, ctx};
+  FullyConnected v{*input, 32, true, 30, ctx};
+  for (auto fc : {&q, &k, &v})
+    fc->layer.run();
+
+  // The same projections, computed by the first layer
+  FullyConnected fused_q{*input, 32, true, 10, ctx};
+  FullyConnected fused_k{*input, 48, false, 20, ctx};
+  FullyConnected fused_v{*input, 32, true, 30, ctx};
+  fused_q.layer.fuse(&fused_k.layer);
+  fused_q.layer.fuse(&fused_v.layer);
+
+  for (int run = 0; run < 2; ++run)
+  {
+    for (auto fc : {&fused_q, &fused_k, &fused_v})
+      std::fill(fc->output->buffer.begin(), fc->output->buffer.end(), 0);
+
+    fused_q.layer.run();
+    ASSERT_EQ(fused_q.output->values(), q.output->values());
+    ASSERT_EQ(fused_k.output->values(), k.output->values());
+    ASSERT_EQ(fused_v.output->values(), v.output->values());
+
+    // Fused layers are already computed
+    fused_k.layer.run();
+    fused_v.layer.run();
+    ASSERT_EQ(fused_k.output->values(), k.output->values());
+    ASSERT_EQ(fused_v.output->values(), v.output->values());
+  }
+
+  // Next input
+  const auto next = randomValues(kBatch * kInput, 2);
+  std::copy(next.begin(), next.end(), input->floats());
+  for (auto fc : {&q, &k, &v, &fused_q, &fused_k, &fused_v})
+    fc->layer.run();
+  ASSERT_EQ(fused_q.output->values(), q.output->values());
+  ASSERT_EQ(fused_k.output->values(), k.output->values());
+  ASSERT_EQ(fused_v.output->values(), v.output->values());
+}
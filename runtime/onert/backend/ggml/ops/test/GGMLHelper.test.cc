@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestHelper.h"
+
+#include "../GGMLHelper.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+using namespace onert;
+using namespace onert::backend::ggml;
+using namespace onert::backend::ggml::test;
+
+namespace
+{
+
+constexpr int64_t kBatch = 3;
+constexpr int64_t kInput = 64;
+
+struct CustomOpCalls
+{
+  std::atomic<int> num_calls{0};
+  std::atomic<int> num_threads{0};
+};
+
+// Negate a into dst, split by rows between threads
+void negate(struct ggml_tensor *dst, const struct ggml_tensor *a, const struct ggml_tensor *b,
+            const struct ggml_tensor *c, int ith, int nth, void *userdata)
+{
+  auto calls = static_cast<CustomOpCalls *>(userdata);
+  ++calls->num_calls;
+  calls->num_threads = nth;
+  EXPECT_EQ(b, nullptr);
+  EXPECT_EQ(c, nullptr);
+
+  const int64_t nrows = ggml_nrows(dst);
+  for (int64_t row = ith; row < nrows; row += nth)
+  {
+    const float *x = static_cast<const float *>(a->data) + row * a->ne[0];
+    float *y = static_cast<float *>(dst->data) + row * dst->ne[0];
+    for (int64_t i = 0; i < dst->ne[0]; ++i)
+      y[i] = -x[i];
+  }
+}
+
+} // namespace
+
+TEST(GGMLGraph, ReusePlanAndWorkBuffer)
+{
+  auto ctx = std::make_shared<ExternalContext>();
+  auto input = makeFloatTensor({kBatch, kInput}, randomValues(kBatch * kInput, 1));
+  auto weights =
+    makeQuantTensor(32, kInput, GGML_TYPE_Q8_0, randomValues(32 * kInput, 2));
+  auto output = makeFloatTensor({kBatch, 32});
+
+  auto ggml_input = ops::getGGMLTensor(input->tensor.get());
+  auto ggml_weights = ops::getGGMLTensor(weights->tensor.get());
+  auto ggml_output = ops::getGGMLTensor(output->tensor.get());
+  ggml_output.op = GGML_OP_MUL_MAT;
+  ggml_output.src[0] = &ggml_weights;
+  ggml_output.src[1] = &ggml_input;
+
+  ops::GGMLGraph graph;
+  graph.addNode(&ggml_output);
+  ASSERT_FALSE(graph.planned());
+
+  // Input is quantized into the work buffer
+  graph.compute(ctx.get());
+  ASSERT_TRUE(graph.planned());
+  ASSERT_GT(graph.workSize(), 0u);
+  const auto work_buffer = ctx->workBuffer(0);
+  const auto first = output->values();
+
+  // Later computes keep the plan and the work buffer
+  std::fill(output->buffer.begin(), output->buffer.end(), 0);
+  graph.compute(ctx.get());
+  ASSERT_TRUE(graph.planned());
+  ASSERT_EQ(ctx->workBuffer(0), work_buffer);
+  ASSERT_EQ(output->values(), first);
+
+  // Changing nodes needs a new plan
+  graph.clear();
+  graph.addNode(&ggml_output);
+  ASSERT_FALSE(graph.planned());
+  graph.compute(ctx.get());
+  ASSERT_EQ(output->values(), first);
+}
+
+TEST(GGMLGraph, GrowWorkBuffer)
+{
+  ExternalContext ctx;
+  ctx.workBuffer(16);
+  const auto small = ctx.workBuffer(0);
+  ASSERT_EQ(ctx.workBuffer(16), small);
+  ASSERT_NE(ctx.workBuffer(1 << 20), nullptr);
+}
+
+TEST(GGMLHelper, CustomOp)
+{
+  auto ctx = std::make_shared<ExternalContext>();
+  const auto values = randomValues(kBatch * kInput, 1);
+  auto input = makeFloatTensor({kBatch, kInput}, values);
+  auto output = makeFloatTensor({kBatch, kInput});
+
+  auto ggml_input = ops::getGGMLTensor(input->tensor.get());
+  auto ggml_output = ops::getGGMLTensor(output->tensor.get());
+  CustomOpCalls calls;
+  ops::setGGMLCustomOp(&ggml_output, negate, &calls, &ggml_input);
+  ASSERT_EQ(ggml_output.op, GGML_OP_MAP_CUSTOM3);
+  ASSERT_EQ(ggml_output.src[0], &ggml_input);
+  ASSERT_EQ(ggml_output.src[1], nullptr);
+  ASSERT_EQ(ggml_output.src[2], nullptr);
+
+  ops::GGMLGraph graph;
+  graph.addNode(&ggml_output);
+  graph.compute(ctx.get());
+
+  // Called once on each thread
+  ASSERT_EQ(calls.num_calls, calls.num_threads);
+  const auto result = output->values();
+  for (size_t i = 0; i < values.size(); ++i)
+    ASSERT_EQ(result[i], -values[i]);
+}
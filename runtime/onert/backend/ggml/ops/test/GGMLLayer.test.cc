@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestHelper.h"
+
+#include "../BinaryArithmeticLayer.h"
+#include "../ElementwiseActivationLayer.h"
+#include "../RmsNormLayer.h"
+#include "../SoftmaxLayer.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::backend::ggml;
+using namespace onert::backend::ggml::test;
+
+namespace
+{
+
+const ir::Shape kShape{2, 3, 32};
+
+/**
+ * @brief softmax(gelu(rms_norm(input) + bias)) by layers, each reading the output of the previous
+ */
+struct Block
+{
+  Block(const TestTensor &input, const TestTensor &gamma, const TestTensor &bias,
+        ExternalContext *ctx)
+    : norm_output{makeFloatTensor(kShape)}, add_output{makeFloatTensor(kShape)},
+      gelu_output{makeFloatTensor(kShape)}, output{makeFloatTensor(kShape)}
+  {
+    norm.configure(input.tensor.get(), gamma.tensor.get(), 1e-5f, norm_output->tensor.get(), ctx);
+    add.configure(norm_output->tensor.get(), bias.tensor.get(), add_output->tensor.get(),
+                  GGML_OP_ADD, ctx);
+    gelu.configure(add_output->tensor.get(), gelu_output->tensor.get(), GGML_UNARY_OP_GELU, ctx);
+    softmax.configure(gelu_output->tensor.get(), 1.0f, output->tensor.get(), ctx);
+  }
+
+  std::vector<ops::GGMLLayer *> layers() { return {&norm, &add, &gelu, &softmax}; }
+
+  void run()
+  {
+    for (auto layer : layers())
+      layer->run();
+  }
+
+  std::unique_ptr<TestTensor> norm_output;
+  std::unique_ptr<TestTensor> add_output;
+  std::unique_ptr<TestTensor> gelu_output;
+  std::unique_ptr<TestTensor> output;
+  ops::RmsNormLayer norm;
+  ops::BinaryArithmeticLayer add;
+  ops::ElementwiseActivationLayer gelu;
+  ops::SoftmaxLayer softmax;
+};
+
+} // namespace
+
+TEST(GGMLLayer, FusedLayers)
+{
+  ExternalContext ctx;
+  auto input = makeFloatTensor(kShape, randomValues(kShape.num_elements(), 1, -2.0f, 2.0f));
+  auto gamma = makeFloatTensor({32}, randomValues(32, 2));
+  auto bias = makeFloatTensor({32}, randomValues(32, 3));
+
+  // Each layer computes its own graph
+  Block separate{*input, *gamma, *bias, &ctx};
+  separate.run();
+
+  // The first layer computes all layers as one graph
+  Block fused{*input, *gamma, *bias, &ctx};
+  for (auto layer : fused.layers())
+    if (layer != &fused.norm)
+      fused.norm.fuse(layer);
+
+  fused.norm.run();
+  ASSERT_EQ(fused.norm_output->values(), separate.norm_output->values());
+  ASSERT_EQ(fused.add_output->values(), separate.add_output->values());
+  ASSERT_EQ(fused.gelu_output->values(), separate.gelu_output->values());
+  ASSERT_EQ(fused.output->values(), separate.output->values());
+
+  // Fused layers are already computed
+  std::fill(fused.output->buffer.begin(), fused.output->buffer.end(), 0);
+  fused.softmax.run();
+  ASSERT_EQ(fused.output->values(), std::vector<float>(kShape.num_elements(), 0.0f));
+
+  // Next input
+  const auto next = randomValues(kShape.num_elements(), 4, -2.0f, 2.0f);
+  std::copy(next.begin(), next.end(), input->floats());
+  separate.run();
+  fused.run();
+  ASSERT_EQ(fused.output->values(), separate.output->values());
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestHelper.h"
+
+#include "../RmsNormLayer.h"
+
+#include <cker/operation/RmsNorm.h>
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::backend::ggml;
+using namespace onert::backend::ggml::test;
+
+namespace
+{
+
+// Compare ggml nodes with cker kernel, which cpu backend runs
+void testRmsNorm(const ir::Shape &shape, const ir::Shape &gamma_shape)
+{
+  constexpr float kEpsilon = 1e-5f;
+  auto input = makeFloatTensor(shape, randomValues(shape.num_elements(), 1, -2.0f, 2.0f));
+  auto gamma = makeFloatTensor(gamma_shape, randomValues(gamma_shape.num_elements(), 2));
+  auto output = makeFloatTensor(shape);
+  auto expected = makeFloatTensor(shape);
+
+  ExternalContext ctx;
+  ops::RmsNormLayer layer;
+  layer.configure(input->tensor.get(), gamma->tensor.get(), kEpsilon, output->tensor.get(), &ctx);
+  layer.run();
+
+  nnfw::cker::RmsNormParams params;
+  params.epsilon = kEpsilon;
+  nnfw::cker::RmsNorm(params, getShape(*input), input->floats(), getShape(*gamma),
+                      gamma->floats(), getShape(*expected), expected->floats());
+
+  expectNear(output->values(), expected->values(), 1e-5f);
+}
+
+} // namespace
+
+TEST(RmsNormLayer, CompareWithCpu)
+{
+  testRmsNorm({2, 3, 64}, {64});
+  testRmsNorm({1, 2, 4, 32}, {32});
+  testRmsNorm({2, 3, 64}, {1});
+}
+
+TEST(RmsNormLayer, neg_GammaShape)
+{
+  auto input = makeFloatTensor({2, 16});
+  auto gamma = makeFloatTensor({8});
+  auto output = makeFloatTensor({2, 16});
+
+  ExternalContext ctx;
+  ops::RmsNormLayer layer;
+  layer.configure(input->tensor.get(), gamma->tensor.get(), 1e-5f, output->tensor.get(), &ctx);
+  EXPECT_ANY_THROW(layer.run());
+}
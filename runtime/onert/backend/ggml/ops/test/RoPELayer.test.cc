@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestHelper.h"
+
+#include "../RoPELayer.h"
+
+#include <cker/operation/RoPE.h>
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::backend::ggml;
+using namespace onert::backend::ggml::test;
+
+TEST(RoPELayer, CompareWithCpu)
+{
+  // Input of [batch, heads, tokens, head dim], and tables of one row
+  const ir::Shape shape{1, 4, 3, 16};
+  const ir::Shape table_shape{1, 1, 1, 16};
+  auto input = makeFloatTensor(shape, randomValues(shape.num_elements(), 1));
+  auto sin = makeFloatTensor(table_shape, randomValues(table_shape.num_elements(), 2));
+  auto cos = makeFloatTensor(table_shape, randomValues(table_shape.num_elements(), 3));
+  auto output = makeFloatTensor(shape);
+  auto expected = makeFloatTensor(shape);
+
+  ExternalContext ctx;
+  ops::RoPELayer layer;
+  layer.configure(input->tensor.get(), sin->tensor.get(), cos->tensor.get(),
+                  output->tensor.get(), &ctx);
+  layer.run();
+
+  nnfw::cker::RoPE(nnfw::cker::RoPEMode::kGptNeox, getShape(*input), input->floats(),
+                   getShape(*sin), sin->floats(), getShape(*cos), cos->floats(),
+                   getShape(*expected), expected->floats());
+
+  expectNear(output->values(), expected->values(), 1e-6f);
+}
+
+TEST(RoPELayer, neg_TableShape)
+{
+  auto input = makeFloatTensor({1, 1, 2, 16});
+  auto sin = makeFloatTensor({1, 1, 1, 8});
+  auto cos = makeFloatTensor({1, 1, 1, 8});
+  auto output = makeFloatTensor({1, 1, 2, 16});
+
+  ExternalContext ctx;
+  ops::RoPELayer layer;
+  layer.configure(input->tensor.get(), sin->tensor.get(), cos->tensor.get(),
+                  output->tensor.get(), &ctx);
+  EXPECT_ANY_THROW(layer.run());
+}
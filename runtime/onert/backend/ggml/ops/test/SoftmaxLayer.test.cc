@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TestHelper.h"
+
+#include "../SoftmaxLayer.h"
+
+#include <cker/operation/SoftMax.h>
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::backend::ggml;
+using namespace onert::backend::ggml::test;
+
+namespace
+{
+
+// Compare ggml op with cker kernel of the rank, which cpu backend runs
+void testSoftmax(const ir::Shape &shape, float beta)
+{
+  auto input = makeFloatTensor(shape, randomValues(shape.num_elements(), 1, -5.0f, 5.0f));
+  auto output = makeFloatTensor(shape);
+  auto expected = makeFloatTensor(shape);
+
+  ExternalContext ctx;
+  ops::SoftmaxLayer layer;
+  layer.configure(input->tensor.get(), beta, output->tensor.get(), &ctx);
+  layer.run();
+
+  if (shape.rank() == 2)
+  {
+    const auto batch_size = shape.dim(0);
+    nnfw::cker::Softmax(input->floats(), shape.num_elements() / batch_size, batch_size, beta,
+                        expected->floats());
+  }
+  else
+  {
+    nnfw::cker::SoftmaxParams params;
+    params.beta = beta;
+    nnfw::cker::Softmax(params, getShape(*input), input->floats(), getShape(*expected),
+                        expected->floats());
+  }
+
+  expectNear(output->values(), expected->values(), 1e-6f);
+}
+
+} // namespace
+
+TEST(SoftmaxLayer, CompareWithCpu)
+{
+  testSoftmax({3, 40}, 1.0f);
+  testSoftmax({1, 2, 3, 40}, 1.0f);
+}
+
+TEST(SoftmaxLayer, Beta)
+{
+  testSoftmax({3, 40}, 0.5f);
+  testSoftmax({1, 2, 3, 40}, 0.125f);
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_GGML_OPS_TEST_TEST_HELPER_H__
+#define __ONERT_BACKEND_GGML_OPS_TEST_TEST_HELPER_H__
+
+#include "../../Tensor.h"
+
+#include <cker/Shape.h>
+#include <ggml.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace onert::backend::ggml::test
+{
+
+/**
+ * @brief Tensor on a buffer owned by the test
+ */
+struct TestTensor
+{
+  TestTensor(const ir::Shape &shape, ir::DataType type, size_t size)
+    : buffer(size),
+      tensor{std::make_unique<Tensor>(
+        ir::OperandInfo::createStaticInfo(shape, ir::TypeInfo{type}), nullptr)}
+  {
+    tensor->setBuffer(buffer.data());
+  }
+
+  float *floats() { return reinterpret_cast<float *>(buffer.data()); }
+  std::vector<float> values() const
+  {
+    const auto data = reinterpret_cast<const float *>(buffer.data());
+    return std::vector<float>(data, data + buffer.size() / sizeof(float));
+  }
+
+  std::vector<uint8_t> buffer;
+  std::unique_ptr<Tensor> tensor;
+};
+
+inline std::vector<float> randomValues(size_t size, uint32_t seed, float min = -1.0f,
+                                       float max = 1.0f)
+{
+  std::mt19937 gen{seed};
+  std::uniform_real_distribution<float> dist{min, max};
+  std::vector<float> values(size);
+  for (auto &&value : values)
+    value = dist(gen);
+  return values;
+}
+
+inline std::unique_ptr<TestTensor> makeFloatTensor(const ir::Shape &shape,
+                                                   const std::vector<float> &values = {})
+{
+  auto tensor = std::make_unique<TestTensor>(shape, ir::DataType::FLOAT32,
+                                             shape.num_elements() * sizeof(float));
+  std::copy(values.begin(), values.end(), tensor->floats());
+  return tensor;
+}
+
+/**
+ * @brief Weights of [rows, cols] quantized to @c type, e.g. GGML_TYPE_Q8_0
+ */
+inline std::unique_ptr<TestTensor> makeQuantTensor(int32_t rows, int32_t cols, ggml_type type,
+                                                   const std::vector<float> &values)
+{
+  const auto data_type =
+    type == GGML_TYPE_Q4_0 ? ir::DataType::QUANT_GGML_Q4_0 : ir::DataType::QUANT_GGML_Q8_0;
+  auto tensor = std::make_unique<TestTensor>(ir::Shape{rows, cols}, data_type,
+                                             ggml_row_size(type, cols) * rows);
+  ggml_quantize_chunk(type, values.data(), tensor->buffer.data(), 0, rows, cols, nullptr);
+  return tensor;
+}
+
+/**
+ * @brief Shape of @c tensor for cker kernels, which compute the results of cpu backend
+ */
+inline nnfw::cker::Shape getShape(const TestTensor &tensor)
+{
+  const auto &shape = tensor.tensor->getShape();
+  nnfw::cker::Shape cker_shape(shape.rank());
+  for (int i = 0; i < shape.rank(); ++i)
+    cker_shape.SetDim(i, shape.dim(i));
+  return cker_shape;
+}
+
+inline void expectNear(const std::vector<float> &actual, const std::vector<float> &expected,
+                       float tolerance)
+{
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_NEAR(actual[i], expected[i], tolerance) << "element " << i;
+}
+
+} // namespace onert::backend::ggml::test
+
+#endif // __ONERT_BACKEND_GGML_OPS_TEST_TEST_HELPER_H__
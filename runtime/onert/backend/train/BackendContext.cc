@@ -20,10 +20,13 @@
 #include "TensorPlanner.h"
 #include "KernelGenerator.h"
 #include "ops/BackPropInitializer.h"
+#include "ops/RecomputeLayer.h"
 
 #include <backend/basic/train/TrainableBackendContextHelpers.h>
 #include <misc/polymorphic_downcast.h>
+#include <util/ConfigSource.h>
 
+#include <algorithm>
 #include <cassert>
 
 namespace onert::backend::train
@@ -128,6 +131,19 @@ getDisposableBackPropTensorList(const ir::train::TrainableGraph &tgraph,
 
   return ret;
 }
+
+// Global norm to clip gradients by, or 0 if gradients are not clipped
+double getClipNorm()
+{
+  const auto clip_norm = util::getConfigString(util::config::TRAINING_CLIP_NORM);
+  return clip_norm.empty() ? 0.0 : std::stod(clip_norm);
+}
+
+// Clipping gradients by global norm needs all gradients before updating any trainable tensor
+bool isOptimizerFused()
+{
+  return util::getConfigBool(util::config::TRAINING_FUSE_OPTIMIZER) || getClipNorm() > 0.0;
+}
 } // namespace
 
 FunctionMap BackendContext::gen()
@@ -137,8 +153,11 @@ FunctionMap BackendContext::gen()
 
   _tensor_builder->allocate();
   _tensor_builder->allocateBackward();
+  if (!_recompute_segments.empty())
+    _tensor_builder->allocateRecompute();
 
   auto fn_map = generateFunctionMap();
+  addRecomputeLayers(fn_map);
 
   // Initialize TrainableTensors
   trainable_graph()->operands().iterate(
@@ -197,7 +216,14 @@ void BackendContext::planForwardTensors()
   const auto ctx_data = data();
   TensorPlanner tensor_planner{*ctx_data->tgraph.get(), ctx_data->external_operands};
   tensor_planner.planTrainableTensors(_tensor_builder.get());
-  tensor_planner.planNonConstTensors(_tensor_builder.get());
+
+  // Keep only checkpoints of activations, and recompute the others in backwarding
+  if (util::getConfigBool(util::config::TRAINING_RECOMPUTE))
+    _recompute_segments = tensor_planner.planRecomputeSegments(_tensor_builder.get());
+
+  tensor_planner.planNonConstTensors(_tensor_builder.get(), _recompute_segments);
+  if (!_recompute_segments.empty())
+    tensor_planner.planRecomputedTensors(_tensor_builder.get(), _recompute_segments);
 }
 
 void BackendContext::planBackwardTensors()
@@ -231,7 +257,7 @@ void BackendContext::planBackwardTensors()
   // Plan tensors only in backwarding to reduce peak memory usage
   const auto ctx_data = data();
   TensorPlanner tensor_planner{*ctx_data->tgraph.get(), ctx_data->external_operands};
-  tensor_planner.planGradientTensors(tensor_builder.get());
+  tensor_planner.planGradientTensors(tensor_builder.get(), isOptimizerFused());
   tensor_planner.planBackPropTensors(tensor_builder.get());
   tensor_planner.planDisposableBackPropTensors(tensor_builder.get());
 }
@@ -240,20 +266,85 @@ FunctionMap BackendContext::generateFunctionMap()
 {
   train::FunctionMap ret;
 
+  std::unique_ptr<ops::FusedGradientApplier> fused_applier;
+  if (isOptimizerFused())
+    fused_applier = std::make_unique<ops::FusedGradientApplier>(_optimizer.get(), getClipNorm());
+  kernel_gen->setFusedGradientApplier(fused_applier.get());
+
   for (const auto &op_ind : _tdata->op_order)
   {
     auto fn_seq = kernel_gen->generate(op_ind);
     ret.emplace(op_ind, std::move(fn_seq));
   }
+  kernel_gen->setFusedGradientApplier(nullptr);
 
-  // NOTE Each BackPropInitializer should be called first in each op node during backwarding
   const auto &tgraph = *_tdata->tgraph;
+  if (fused_applier && !fused_applier->empty())
+  {
+    // Gradients are applied after the last operation updating weights computes its gradients
+    const auto border = tgraph.essentialBackwardOrder();
+    const auto last = std::find_if(border.rbegin(), border.rend(), [&](const auto &op_index) {
+      return tgraph.operation(op_index).isWeightsUpdateEnabled();
+    });
+    assert(last != border.rend());
+    ret.at(*last)->append(std::move(fused_applier));
+  }
+
+  // NOTE Each BackPropInitializer should be called first in each op node during backwarding
   auto tensor_reg = nnfw::misc::polymorphic_downcast<TensorRegistry *>(_tensor_registry.get());
   AddBackPropInitializers(tgraph, *tensor_reg, ret);
 
   return ret;
 }
 
+void BackendContext::addRecomputeLayers(FunctionMap &fn_map)
+{
+  const auto &tgraph = *trainable_graph();
+  const auto border = tgraph.essentialBackwardOrder();
+  auto tensor_reg = nnfw::misc::polymorphic_downcast<TensorRegistry *>(_tensor_registry.get());
+
+  for (const auto &segment : _recompute_segments)
+  {
+    std::vector<Tensor *> outputs;
+    std::vector<uint8_t *> recompute_buffers;
+    for (const auto &output : segment.outputs)
+    {
+      outputs.emplace_back(tensor_reg->getNonConstTensor(output));
+      recompute_buffers.emplace_back(_tensor_builder->getRecomputeBuffer(output));
+    }
+
+    std::vector<ops::SegmentRecomputer::Operation> operations;
+    for (const auto &op_index : segment.operations)
+    {
+      assert(fn_map.find(op_index) != fn_map.end());
+      operations.emplace_back(ops::SegmentRecomputer::Operation{
+        fn_map.at(op_index).get(), tgraph.operation(op_index).isRequiredForBackward()});
+    }
+
+    auto recomputer =
+      std::make_shared<ops::SegmentRecomputer>(outputs, recompute_buffers, operations);
+
+    // Outputs are back in forward buffers before their operations run in forwarding
+    for (const auto &op_index : segment.operations)
+    {
+      std::vector<Tensor *> op_outputs;
+      for (const auto &output : tgraph.operation(op_index).getUsedOutputSet())
+      {
+        if (segment.outputs.contains(output))
+          op_outputs.emplace_back(tensor_reg->getNonConstTensor(output));
+      }
+
+      if (!op_outputs.empty())
+        fn_map.at(op_index)->prepend(
+          std::make_unique<ops::RecomputeRestorer>(recomputer, op_outputs));
+    }
+
+    // The function added latest is executed first in a sequence during backwarding
+    assert(segment.position < border.size());
+    fn_map.at(border[segment.position])->append(std::make_unique<ops::RecomputeLayer>(recomputer));
+  }
+}
+
 void BackendContext::planLayerScopeTensors([[maybe_unused]] const FunctionMap &fn_map)
 {
   const auto &ops = trainable_graph()->operations();
@@ -22,6 +22,7 @@
 #include "ExternalContext.h"
 #include "KernelGenerator.h"
 #include "TensorBuilder.h"
+#include "TensorPlanner.h"
 
 namespace onert::backend::train
 {
@@ -56,6 +57,8 @@ public:
       kernel_gen{kernel_gen}, _external_context(new ExternalContext),
       _tensor_builder{tensor_builder}, _optimizer{std::move(optimizer)}
   {
+    if (_tdata->thread_budget)
+      _external_context->setThreadBudget(*_tdata->thread_budget, _tdata->num_threads);
   }
   BackendContext(const BackendContext &) = delete;
   ~BackendContext() = default;
@@ -70,6 +73,7 @@ private:
   void planForwardTensors();
   void planBackwardTensors();
   void planLayerScopeTensors(const FunctionMap &fn_map);
+  void addRecomputeLayers(FunctionMap &fn_map);
 
 public:
   std::shared_ptr<ExternalContext> external_context() { return _external_context; }
@@ -91,6 +95,8 @@ private:
 
 private:
   std::shared_ptr<TensorBuilder> _tensor_builder;
+  // Forward operations recomputed in backwarding instead of keeping their outputs
+  std::vector<RecomputeSegment> _recompute_segments;
 
 private:
   std::unique_ptr<exec::train::optimizer::Optimizer> _optimizer;
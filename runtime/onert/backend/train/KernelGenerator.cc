@@ -124,9 +124,14 @@ std::unique_ptr<exec::train::TrainableFnSequence> KernelGenerator::generate(ir::
   assert(_return_fn);
   ret->append(std::move(_return_fn));
 
-  for (auto &&update_fn : _update_funcs)
-    ret->append(std::move(update_fn));
-  _update_funcs.clear();
+  for (const auto &[gradient, trainable] : _update_tensors)
+  {
+    if (_fused_applier == nullptr)
+      ret->append(generateGradientApplier(_optimizer, gradient, trainable));
+    else if (op.isWeightsUpdateEnabled() && op.isRequiredForBackward())
+      _fused_applier->append(gradient, trainable);
+  }
+  _update_tensors.clear();
 
   for (auto &&ind : (op.getInputs() | ir::Remove::UNDEFINED) + op.getOutputs())
   {
@@ -144,7 +149,8 @@ KernelGenerator::KernelGenerator(const ir::train::TrainableGraph &tgraph,
                                  const std::shared_ptr<ExternalContext> &external_context,
                                  const exec::train::optimizer::Optimizer *optimizer)
   : backend::train::KernelGeneratorBase{tgraph}, _tensor_reg{tensor_reg},
-    _external_context(external_context), _optimizer{optimizer}, _update_funcs{}, _node_to_idx{}
+    _external_context(external_context), _optimizer{optimizer}, _fused_applier{nullptr},
+    _update_tensors{}, _node_to_idx{}
 {
   tgraph.operations().iterate(
     [&](const onert::ir::OperationIndex &idx, const onert::ir::IOperation &op) {
@@ -170,7 +176,7 @@ void KernelGenerator::visit(const ir::train::operation::BinaryArithmetic &node)
 
   auto fn = std::make_unique<ops::BinaryArithmeticLayer>();
   fn->configure(lhs_tensor, rhs_tensor, output_tensor, activation,
-                static_cast<cpu::ops::ArithmeticType>(arithmetic_type));
+                static_cast<cpu::ops::ArithmeticType>(arithmetic_type), _external_context);
 
   if (node.isRequiredForBackward())
   {
@@ -237,9 +243,8 @@ void KernelGenerator::visit(const ir::train::operation::Conv2D &node)
 
     // Generate GradientApplier
     if (bias_tensor)
-      _update_funcs.emplace_back(
-        generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor));
-    _update_funcs.emplace_back(generateGradientApplier(_optimizer, ker_grad_tensor, ker_tensor));
+      _update_tensors.emplace_back(bias_grad_tensor, bias_tensor);
+    _update_tensors.emplace_back(ker_grad_tensor, ker_tensor);
   }
 
   _return_fn = std::move(fn);
@@ -293,9 +298,8 @@ void KernelGenerator::visit(const ir::train::operation::DepthwiseConv2D &node)
 
     // Generate GradientApplier
     if (bias_tensor)
-      _update_funcs.emplace_back(
-        generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor));
-    _update_funcs.emplace_back(generateGradientApplier(_optimizer, ker_grad_tensor, ker_tensor));
+      _update_tensors.emplace_back(bias_grad_tensor, bias_tensor);
+    _update_tensors.emplace_back(ker_grad_tensor, ker_tensor);
   }
 
   _return_fn = std::move(fn);
@@ -375,10 +379,8 @@ void KernelGenerator::visit(const ir::train::operation::FullyConnected &node)
 
     // Generate GradientAppliers
     if (bias_tensor)
-      _update_funcs.emplace_back(
-        generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor));
-    _update_funcs.emplace_back(
-      generateGradientApplier(_optimizer, weights_grad_tensor, weights_tensor));
+      _update_tensors.emplace_back(bias_grad_tensor, bias_tensor);
+    _update_tensors.emplace_back(weights_grad_tensor, weights_tensor);
   }
 
   _return_fn = std::move(fn);
@@ -601,7 +603,7 @@ void KernelGenerator::visit(const ir::train::operation::Softmax &node)
 
   auto fn = std::make_unique<ops::SoftMaxLayer>();
 
-  fn->configure(input_tensor, beta, output_tensor);
+  fn->configure(input_tensor, beta, output_tensor, _external_context);
 
   if (node.isRequiredForBackward())
   {
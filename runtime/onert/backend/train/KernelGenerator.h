@@ -21,6 +21,7 @@
 #include "backend/basic/TensorRegistry.h"
 #include "TensorBuilder.h"
 #include "Tensor.h"
+#include "ops/GradientApplier.h"
 
 #include <backend/train/KernelGeneratorBase.h>
 #include <exec/train/IGradientApplier.h>
@@ -42,6 +43,12 @@ public:
 
   std::unique_ptr<exec::train::TrainableFnSequence> generate(ir::OperationIndex op_ind) override;
 
+  /**
+   * @brief Let gradients of operations generated later be applied by applier at once instead of
+   *        applying them in each operation
+   */
+  void setFusedGradientApplier(ops::FusedGradientApplier *applier) { _fused_applier = applier; }
+
   void visit(const ir::train::operation::BinaryArithmetic &) override;
   void visit(const ir::train::operation::Conv2D &) override;
   void visit(const ir::train::operation::DepthwiseConv2D &) override;
@@ -62,7 +69,9 @@ private:
   std::shared_ptr<TensorRegistry> _tensor_reg;
   const std::shared_ptr<ExternalContext> _external_context;
   const exec::train::optimizer::Optimizer *_optimizer;
-  std::vector<std::unique_ptr<exec::train::IGradientApplier>> _update_funcs;
+  ops::FusedGradientApplier *_fused_applier;
+  // Gradient and trainable tensors of the operation being generated
+  std::vector<std::pair<const IPortableTensor *, ITrainableTensor *>> _update_tensors;
   std::unordered_map<const ir::IOperation *, ir::OperationIndex> _node_to_idx;
 };
 
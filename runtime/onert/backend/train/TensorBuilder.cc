@@ -182,6 +182,18 @@ void TensorBuilder::notifyLayerScopeLastUse(const LayerScopeTensorIndex &index)
   _tensor_mgr->releaseLayerScopePlan(index);
 }
 
+void TensorBuilder::notifyRecomputeFirstUse(const ir::OperandIndex &index)
+{
+  assert(!_as_constants.at(index));
+  _tensor_mgr->claimRecomputePlan(index);
+}
+
+void TensorBuilder::notifyRecomputeLastUse(const ir::OperandIndex &index)
+{
+  assert(!_as_constants.at(index));
+  _tensor_mgr->releaseRecomputePlan(index);
+}
+
 bool TensorBuilder::isRegistered(const ir::OperandIndex &index) const
 {
   return _tensor_info_map.find(index) != _tensor_info_map.end();
@@ -235,4 +247,11 @@ void TensorBuilder::allocateBackward(void)
 
 void TensorBuilder::allocateLayerScope(void) { _tensor_mgr->allocateLayerScopeTensors(); }
 
+void TensorBuilder::allocateRecompute(void) { _tensor_mgr->allocateRecomputeBuffers(); }
+
+uint8_t *TensorBuilder::getRecomputeBuffer(const ir::OperandIndex &index) const
+{
+  return _tensor_mgr->getRecomputeBuffer(index);
+}
+
 } // namespace onert::backend::train
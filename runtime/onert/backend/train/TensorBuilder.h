@@ -65,6 +65,8 @@ public:
   void notifyDisposableBackPropLastUse(const DisposableTensorIndex &);
   void notifyLayerScopeFirstUse(const LayerScopeTensorIndex &);
   void notifyLayerScopeLastUse(const LayerScopeTensorIndex &);
+  void notifyRecomputeFirstUse(const ir::OperandIndex &);
+  void notifyRecomputeLastUse(const ir::OperandIndex &);
 
   bool isRegistered(const ir::OperandIndex &) const;
   bool isRegisteredBackward(const ir::OperandIndex &) const;
@@ -78,6 +80,9 @@ public:
   void allocate(void);
   void allocateBackward(void);
   void allocateLayerScope(void);
+  void allocateRecompute(void);
+
+  uint8_t *getRecomputeBuffer(const ir::OperandIndex &) const;
 
 private:
   const std::shared_ptr<TensorRegistry> _tensor_reg;
@@ -55,7 +55,8 @@ TensorManager::TensorManager(const std::shared_ptr<TensorRegistry> &reg, uint32_
     _back_prop_mgr{new MemoryManager()}, _gradient_mgr{new MemoryManager()},
     // TODO Find a suitable planner of disposable tensors to reduce peak memory usage
     _disposable_back_prop_mgr{new DisposableMemoryManager()},
-    _layer_scope_mgr{new LayerScopeMemoryManager()}, _tensors{reg}
+    _layer_scope_mgr{new LayerScopeMemoryManager()}, _recompute_mgr{new MemoryManager()},
+    _tensors{reg}
 {
   // DO NOTHING
 }
@@ -109,6 +110,12 @@ void TensorManager::allocateLayerScopeTensors()
                  std::string{"   LAYERSCOPE TENSOR "});
 }
 
+void TensorManager::allocateRecomputeBuffers()
+{
+  // Tensors keep forward buffers, and they are switched to recompute buffers in backwarding
+  _recompute_mgr->allocate();
+}
+
 void TensorManager::claimNonConstPlan(const ir::OperandIndex &index)
 {
   auto tensor = _tensors->getNonConstTensor(index);
@@ -204,4 +211,25 @@ void TensorManager::releaseLayerScopePlan(const LayerScopeTensorIndex &index)
   _layer_scope_mgr->releasePlan(index);
 }
 
+void TensorManager::claimRecomputePlan(const ir::OperandIndex &index)
+{
+  auto tensor = _tensors->getNonConstTensor(index);
+  assert(tensor && !tensor->is_dynamic());
+
+  auto size = alignedSize(tensor->total_size(), _align);
+  _recompute_mgr->claimPlan(index, size);
+}
+
+void TensorManager::releaseRecomputePlan(const ir::OperandIndex &index)
+{
+  assert(_tensors->getNonConstTensor(index) && !_tensors->getNonConstTensor(index)->is_dynamic());
+
+  _recompute_mgr->releasePlan(index);
+}
+
+uint8_t *TensorManager::getRecomputeBuffer(const ir::OperandIndex &index) const
+{
+  return _recompute_mgr->getBuffer(index);
+}
+
 } // namespace onert::backend::train
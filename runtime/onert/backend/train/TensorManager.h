@@ -46,6 +46,7 @@ public:
   void allocateGradientTensors();
   void allocateDisposableBackPropTensors();
   void allocateLayerScopeTensors();
+  void allocateRecomputeBuffers();
   // TODO Add member functions to deallocate tensors
 
   void claimNonConstPlan(const ir::OperandIndex &ind);
@@ -60,6 +61,11 @@ public:
   void releaseDisposableBackPropPlan(const DisposableTensorIndex &ind);
   void claimLayerScopePlan(const LayerScopeTensorIndex &ind);
   void releaseLayerScopePlan(const LayerScopeTensorIndex &ind);
+  void claimRecomputePlan(const ir::OperandIndex &ind);
+  void releaseRecomputePlan(const ir::OperandIndex &ind);
+
+  // Buffer of a non-constant tensor used while its operation is recomputed in backwarding
+  uint8_t *getRecomputeBuffer(const ir::OperandIndex &ind) const;
 
 private:
   std::unique_ptr<MemoryManager> _nonconst_mgr;
@@ -68,6 +74,7 @@ private:
   std::unique_ptr<MemoryManager> _gradient_mgr;
   std::unique_ptr<DisposableMemoryManager> _disposable_back_prop_mgr;
   std::unique_ptr<LayerScopeMemoryManager> _layer_scope_mgr;
+  std::unique_ptr<MemoryManager> _recompute_mgr;
   const std::shared_ptr<TensorRegistry> _tensors;
 };
 
@@ -18,6 +18,9 @@
 
 #include <util/logging.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace onert::backend::train
 {
 
@@ -28,11 +31,73 @@ TensorPlanner::TensorPlanner(const ir::train::TrainableGraph &tgraph,
   // DO NOTHING
 }
 
-void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
+namespace
+{
+
+std::unordered_map<ir::OperationIndex, uint32_t>
+getBackwardPositions(const std::vector<ir::OperationIndex> &border)
+{
+  std::unordered_map<ir::OperationIndex, uint32_t> ret;
+  for (uint32_t pos = 0; pos < border.size(); ++pos)
+    ret[border[pos]] = pos;
+  return ret;
+}
+
+// Position in backwarding from which each output of segments is in a recompute buffer
+std::unordered_map<ir::OperandIndex, uint32_t>
+getRecomputePositions(const std::vector<RecomputeSegment> &segments)
+{
+  std::unordered_map<ir::OperandIndex, uint32_t> ret;
+  for (const auto &segment : segments)
+  {
+    for (const auto &output : segment.outputs)
+      ret[output] = segment.position;
+  }
+  return ret;
+}
+
+std::unordered_map<uint32_t, const RecomputeSegment *>
+getSegmentsByPosition(const std::vector<RecomputeSegment> &segments)
+{
+  std::unordered_map<uint32_t, const RecomputeSegment *> ret;
+  for (const auto &segment : segments)
+  {
+    assert(ret.find(segment.position) == ret.end());
+    ret[segment.position] = &segment;
+  }
+  return ret;
+}
+
+} // namespace
+
+void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder,
+                                        const std::vector<RecomputeSegment> &segments)
 {
   VERBOSE(TensorPlanner) << "Start planning non-constant tensors" << std::endl;
 
+  scanNonConstTensors(
+    tensor_builder, segments,
+    [&](const ir::OperandIndex &index) { tensor_builder->notifyFirstUse(index); },
+    [&](const ir::OperandIndex &index) { tensor_builder->notifyLastUse(index); });
+
+  VERBOSE(TensorPlanner) << "Finish planning non-constant tensors" << std::endl;
+}
+
+void TensorPlanner::scanNonConstTensors(const TensorBuilder *tensor_builder,
+                                        const std::vector<RecomputeSegment> &segments,
+                                        const PlanFn &claim, const PlanFn &release)
+{
   const auto &training_usedefs = _tgraph.trainingUseDefs();
+  const auto border = _tgraph.essentialBackwardOrder();
+  const auto backward_positions = getBackwardPositions(border);
+  const auto recompute_positions = getRecomputePositions(segments);
+  const auto segments_by_position = getSegmentsByPosition(segments);
+
+  // Outputs of segments are read from recompute buffers after they are recomputed
+  auto in_forward_buffer = [&](const ir::OperandIndex &index, uint32_t pos) {
+    const auto it = recompute_positions.find(index);
+    return it == recompute_positions.end() || pos < it->second;
+  };
 
   // NOTE The uses_map and defs_map must have the size of only registered tensors
   std::unordered_map<ir::train::TrainingOperandIndex, uint32_t> uses_map;
@@ -50,10 +115,29 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
     if (!operand_index.is_forward() || operand.isConstant())
       continue;
 
-    uses_map[operand_index] = operand_usedefs.getTrainingUses().size();
+    uses_map[operand_index] = std::count_if(
+      operand_usedefs.getTrainingUses().begin(), operand_usedefs.getTrainingUses().end(),
+      [&](const ir::train::TrainingOperationIndex &use) {
+        if (use.is_forward())
+          return true;
+        const auto it = backward_positions.find(use.index());
+        return it == backward_positions.end() ||
+               in_forward_buffer(operand_index.index(), it->second);
+      });
     defs_map[operand_index] = operand_usedefs.getTrainingDefs().size();
   }
 
+  // Inputs of segments are kept until the segments are recomputed
+  for (const auto &[pos, segment] : segments_by_position)
+  {
+    for (const auto &input : segment->inputs)
+    {
+      const auto input_index = ir::train::TrainingOperandIndex{input, true};
+      if (uses_map.find(input_index) != uses_map.end() && in_forward_buffer(input, pos))
+        uses_map[input_index]++;
+    }
+  }
+
   // Start scanning to do notify{First|Last}Use for each tensor
   // TODO Remove this or find the reason why it is needed
   // Q. Why is notifyFirstUse() called if operand's def count is 0?
@@ -63,7 +147,7 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
   for (const auto &[operand_index, def_count] : defs_map)
   {
     if (def_count == 0)
-      tensor_builder->notifyFirstUse(operand_index.index());
+      claim(operand_index.index());
   }
 
   // This is a workaround to keep the operands over the execution
@@ -71,7 +155,7 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
   std::vector<ir::train::TrainingOperandIndex> operands_last_until_end;
   for (const auto &[operand_index, use_count] : uses_map)
   {
-    if (use_count == 0)
+    if (training_usedefs.at(operand_index).getTrainingUses().empty())
       operands_last_until_end.push_back(operand_index);
   }
 
@@ -99,7 +183,7 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
       assert(defs_map.find(output_index) != defs_map.end());
       assert(defs_map.at(output_index) == 1);
       defs_map[output_index] = 0;
-      tensor_builder->notifyFirstUse(output_index.index());
+      claim(output_index.index());
     }
 
     // Scan variable tensors
@@ -141,15 +225,30 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
       if (uses_map[input_index] == 0)
       {
         // plan for deallocation of static tensor node
-        tensor_builder->notifyLastUse(input_index.index());
+        release(input_index.index());
       }
     }
+
+    // Outputs used only from recompute buffers are not kept after forwarding
+    for (const auto &output : op_outputs)
+    {
+      if (_external_operands.contains(output))
+        continue;
+      if (!tensor_builder->isRegistered(output))
+        continue;
+
+      const auto output_index = ir::train::TrainingOperandIndex{output, true};
+      const auto it = uses_map.find(output_index);
+      if (it != uses_map.end() && it->second == 0 &&
+          !training_usedefs.at(output_index).getTrainingUses().empty())
+        release(output);
+    }
   }
 
   // Plan used tensors in backwarding nodes
-  const auto border = _tgraph.essentialBackwardOrder();
-  for (const auto &op_index : border)
+  for (uint32_t pos = 0; pos < border.size(); ++pos)
   {
+    const auto &op_index = border[pos];
     const auto &op = _tgraph.operations().at(op_index);
     auto op_inputs = op.getUsedInputSet();
     auto op_outputs = op.getUsedOutputSet();
@@ -173,7 +272,7 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
              operand_usedefs.getTrainingDefs().end());
 
       const auto &uses = operand_usedefs.getTrainingUses();
-      if (uses.find(training_op_index) != uses.end())
+      if (uses.find(training_op_index) != uses.end() && in_forward_buffer(index, pos))
       {
         assert(uses_map.find(operand_index) != uses_map.end());
         assert(uses_map[operand_index] > 0);
@@ -181,15 +280,31 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
         if (uses_map[operand_index] == 0)
         {
           // plan for deallocation of static tensor node
-          tensor_builder->notifyLastUse(operand_index.index());
+          release(operand_index.index());
         }
       }
     }
+
+    const auto it = segments_by_position.find(pos);
+    if (it == segments_by_position.end())
+      continue;
+
+    for (const auto &input : it->second->inputs)
+    {
+      const auto input_index = ir::train::TrainingOperandIndex{input, true};
+      if (uses_map.find(input_index) == uses_map.end() || !in_forward_buffer(input, pos))
+        continue;
+
+      assert(uses_map[input_index] > 0);
+      uses_map[input_index]--;
+      if (uses_map[input_index] == 0)
+        release(input);
+    }
   }
 
   for (const auto &operand_index : operands_last_until_end)
   {
-    tensor_builder->notifyLastUse(operand_index.index());
+    release(operand_index.index());
   }
 
   assert(std::all_of(
@@ -199,8 +314,297 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
   assert(std::all_of(
     defs_map.begin(), defs_map.end(),
     [](std::pair<const ir::train::TrainingOperandIndex, uint32_t> it) { return it.second == 0; }));
+}
 
-  VERBOSE(TensorPlanner) << "Finish planning non-constant tensors" << std::endl;
+void TensorPlanner::planRecomputedTensors(TensorBuilder *tensor_builder,
+                                          const std::vector<RecomputeSegment> &segments)
+{
+  VERBOSE(TensorPlanner) << "Start planning recomputed tensors" << std::endl;
+
+  scanRecomputedTensors(
+    segments,
+    [&](const ir::OperandIndex &index) { tensor_builder->notifyRecomputeFirstUse(index); },
+    [&](const ir::OperandIndex &index) { tensor_builder->notifyRecomputeLastUse(index); });
+
+  VERBOSE(TensorPlanner) << "Finish planning recomputed tensors" << std::endl;
+}
+
+void TensorPlanner::scanRecomputedTensors(const std::vector<RecomputeSegment> &segments,
+                                          const PlanFn &claim, const PlanFn &release)
+{
+  const auto &training_usedefs = _tgraph.trainingUseDefs();
+  const auto border = _tgraph.essentialBackwardOrder();
+  const auto backward_positions = getBackwardPositions(border);
+  const auto recompute_positions = getRecomputePositions(segments);
+  const auto segments_by_position = getSegmentsByPosition(segments);
+
+  // Count uses of outputs from the position where they are recomputed
+  std::unordered_map<ir::OperandIndex, uint32_t> uses_map;
+  for (const auto &segment : segments)
+  {
+    for (const auto &output : segment.outputs)
+    {
+      const auto &uses =
+        training_usedefs.at(ir::train::TrainingOperandIndex{output, true}).getTrainingUses();
+      uses_map[output] =
+        std::count_if(uses.begin(), uses.end(), [&](const ir::train::TrainingOperationIndex &use) {
+          if (use.is_forward())
+            return false;
+          const auto it = backward_positions.find(use.index());
+          return it != backward_positions.end() && it->second >= segment.position;
+        });
+    }
+
+    for (const auto &op_index : segment.operations)
+    {
+      for (const auto &input : _tgraph.operations().at(op_index).getUsedInputSet())
+      {
+        if (segment.outputs.contains(input))
+          uses_map[input]++;
+      }
+    }
+
+    for (const auto &input : segment.inputs)
+    {
+      const auto it = recompute_positions.find(input);
+      if (it != recompute_positions.end() && it->second < segment.position)
+        uses_map[input]++;
+    }
+  }
+
+  auto use = [&](const ir::OperandIndex &index) {
+    assert(uses_map.at(index) > 0);
+    if (--uses_map.at(index) == 0)
+      release(index);
+  };
+
+  for (uint32_t pos = 0; pos < border.size(); ++pos)
+  {
+    // Recompute the segment before the first backwarding of its operations
+    const auto it = segments_by_position.find(pos);
+    if (it != segments_by_position.end())
+    {
+      const auto &segment = *it->second;
+      for (const auto &op_index : segment.operations)
+      {
+        const auto &op = _tgraph.operations().at(op_index);
+        for (const auto &output : op.getUsedOutputSet())
+        {
+          if (segment.outputs.contains(output))
+            claim(output);
+        }
+
+        for (const auto &input : op.getUsedInputSet())
+        {
+          if (segment.outputs.contains(input))
+            use(input);
+        }
+
+        // Outputs which are not used anymore are only needed to run the operation
+        for (const auto &output : op.getUsedOutputSet())
+        {
+          if (segment.outputs.contains(output) && uses_map.at(output) == 0)
+            release(output);
+        }
+      }
+
+      for (const auto &input : segment.inputs)
+      {
+        const auto input_it = recompute_positions.find(input);
+        if (input_it != recompute_positions.end() && input_it->second < pos)
+          use(input);
+      }
+    }
+
+    const auto &op_index = border[pos];
+    const auto &op = _tgraph.operations().at(op_index);
+    const auto training_op_index = ir::train::TrainingOperationIndex{op_index, false};
+    for (const auto &index : op.getUsedInputSet() + op.getUsedOutputSet())
+    {
+      const auto index_it = recompute_positions.find(index);
+      if (index_it == recompute_positions.end() || index_it->second > pos)
+        continue;
+
+      const auto &uses =
+        training_usedefs.at(ir::train::TrainingOperandIndex{index, true}).getTrainingUses();
+      if (uses.find(training_op_index) != uses.end())
+        use(index);
+    }
+  }
+
+  assert(std::all_of(
+    uses_map.begin(), uses_map.end(),
+    [](std::pair<const ir::OperandIndex, uint32_t> it) { return it.second == 0; }));
+}
+
+std::vector<RecomputeSegment>
+TensorPlanner::makeRecomputeSegments(const TensorBuilder *tensor_builder,
+                                     const std::vector<std::vector<ir::OperationIndex>> &chunks)
+{
+  const auto &training_usedefs = _tgraph.trainingUseDefs();
+  const auto border = _tgraph.essentialBackwardOrder();
+  const auto backward_positions = getBackwardPositions(border);
+
+  auto is_planned = [&](const ir::OperandIndex &index) {
+    return !_external_operands.contains(index) && tensor_builder->isRegistered(index) &&
+           !_tgraph.operands().at(index).isConstant();
+  };
+
+  std::vector<RecomputeSegment> ret;
+  for (const auto &chunk : chunks)
+  {
+    RecomputeSegment segment;
+    segment.operations = chunk;
+    segment.position = border.size();
+    for (const auto &op_index : chunk)
+    {
+      const auto it = backward_positions.find(op_index);
+      if (it != backward_positions.end())
+        segment.position = std::min(segment.position, it->second);
+
+      for (const auto &output : _tgraph.operations().at(op_index).getUsedOutputSet())
+      {
+        // Operands never used are kept until the end, so they are not recomputed
+        if (is_planned(output) &&
+            !training_usedefs.at(ir::train::TrainingOperandIndex{output, true})
+               .getTrainingUses()
+               .empty())
+          segment.outputs.add(output);
+      }
+    }
+
+    // Nothing of the segment is backwarded or kept, so there is nothing to recompute
+    if (segment.position == border.size() || segment.outputs.empty())
+      continue;
+
+    for (const auto &op_index : chunk)
+    {
+      for (const auto &input : _tgraph.operations().at(op_index).getUsedInputSet())
+      {
+        if (is_planned(input) && !segment.outputs.contains(input))
+          segment.inputs.add(input);
+      }
+    }
+
+    ret.emplace_back(std::move(segment));
+  }
+
+  return ret;
+}
+
+uint64_t TensorPlanner::estimatePeak(const TensorBuilder *tensor_builder,
+                                     const std::vector<RecomputeSegment> &segments,
+                                     const ir::OperandIndexMap<uint64_t> &sizes)
+{
+  // Sum of live tensors, which does not count fragmentation of memory planners
+  uint64_t live_size = 0;
+  uint64_t peak_size = 0;
+  auto claim = [&](const ir::OperandIndex &index) {
+    live_size += sizes.at(index);
+    peak_size = std::max(peak_size, live_size);
+  };
+  auto release = [&](const ir::OperandIndex &index) { live_size -= sizes.at(index); };
+
+  scanNonConstTensors(tensor_builder, segments, claim, release);
+  const auto nonconst_peak_size = peak_size;
+
+  live_size = 0;
+  peak_size = 0;
+  scanRecomputedTensors(segments, claim, release);
+
+  // Non-constant and recompute buffers are allocated at once
+  return nonconst_peak_size + peak_size;
+}
+
+std::vector<RecomputeSegment>
+TensorPlanner::planRecomputeSegments(const TensorBuilder *tensor_builder)
+{
+  VERBOSE(TensorPlanner) << "Start planning recompute segments" << std::endl;
+
+  const auto &training_usedefs = _tgraph.trainingUseDefs();
+  const auto order = _tgraph.topolSortOperations();
+
+  // Size of outputs of each operation kept for backwarding
+  std::vector<uint64_t> kept_sizes;
+  uint64_t total_kept_size = 0;
+  for (const auto &op_index : order)
+  {
+    uint64_t kept_size = 0;
+    for (const auto &output : _tgraph.operations().at(op_index).getUsedOutputSet())
+    {
+      if (_external_operands.contains(output) || !tensor_builder->isRegistered(output))
+        continue;
+
+      const auto &usedefs = training_usedefs.at(ir::train::TrainingOperandIndex{output, true});
+      const auto &uses = usedefs.getTrainingUses();
+      const bool is_backwarded =
+        std::any_of(uses.begin(), uses.end(),
+                    [](const ir::train::TrainingOperationIndex &use) { return !use.is_forward(); });
+      if (is_backwarded)
+        kept_size += usedefs.operand().info().total_size();
+    }
+    kept_sizes.emplace_back(kept_size);
+    total_kept_size += kept_size;
+  }
+
+  // Sizes are looked up for every candidate, so they are computed once
+  ir::OperandIndexMap<uint64_t> sizes;
+  _tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &operand) {
+    sizes[index] = operand.info().total_size();
+  });
+
+  std::vector<RecomputeSegment> best_segments;
+  const auto baseline_peak_size = estimatePeak(tensor_builder, best_segments, sizes);
+  auto best_peak_size = baseline_peak_size;
+
+  // Try segments of the same kept size for each number of segments and take the lowest peak.
+  // Fewer segments keep fewer checkpoints, but more outputs are alive at once in recomputing.
+  // The peak is lowest around sqrt(n) segments for n operations of similar sizes, so candidates
+  // are bounded to twice of it rather than estimating all n of them over the whole graph.
+  const uint64_t max_segments = std::min<uint64_t>(
+    order.size(), 2 * static_cast<uint64_t>(std::ceil(std::sqrt(order.size()))));
+  std::vector<size_t> prev_boundaries;
+  for (uint64_t num_segments = 1; total_kept_size > 0 && num_segments <= max_segments;
+       ++num_segments)
+  {
+    const auto segment_size = (total_kept_size + num_segments - 1) / num_segments;
+
+    std::vector<std::vector<ir::OperationIndex>> chunks(1);
+    std::vector<size_t> boundaries;
+    uint64_t accumulated_size = 0;
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+      chunks.back().emplace_back(order[i]);
+      accumulated_size += kept_sizes[i];
+      if (accumulated_size >= segment_size && i + 1 < order.size())
+      {
+        chunks.emplace_back();
+        boundaries.emplace_back(i);
+        accumulated_size = 0;
+      }
+    }
+
+    if (boundaries == prev_boundaries && num_segments > 1)
+      continue;
+    prev_boundaries = boundaries;
+
+    auto segments = makeRecomputeSegments(tensor_builder, chunks);
+    if (segments.empty())
+      continue;
+
+    const auto peak_size = estimatePeak(tensor_builder, segments, sizes);
+    if (peak_size < best_peak_size)
+    {
+      best_peak_size = peak_size;
+      best_segments = std::move(segments);
+    }
+  }
+
+  VERBOSE(TensorPlanner) << "Finish planning recompute segments: " << best_segments.size()
+                         << " segments, estimated peak " << baseline_peak_size << " -> "
+                         << best_peak_size << " bytes" << std::endl;
+
+  return best_segments;
 }
 
 void TensorPlanner::planTrainableTensors(TensorBuilder *tensor_builder)
@@ -403,13 +807,14 @@ void TensorPlanner::planBackPropTensors(TensorBuilder *tensor_builder)
   VERBOSE(TensorPlanner) << "Finish planning back-propagated tensors" << std::endl;
 }
 
-void TensorPlanner::planGradientTensors(TensorBuilder *tensor_builder)
+void TensorPlanner::planGradientTensors(TensorBuilder *tensor_builder, bool keep_all)
 {
   VERBOSE(TensorPlanner) << "Start planning gradient tensors" << std::endl;
 
   // TODO Use DisposableTensor instead of GradientTensor to plan them together if possible
   //      Backward layers and the corresponding GradientApplier exist in the same back-propagated
   //      operation sequence. So we can use DisposableTensors to plan GradientTensors.
+  std::vector<ir::train::TrainingOperandIndex> kept;
   for (const auto &op_index : _tgraph.essentialBackwardOrder())
   {
     std::vector<ir::train::TrainingOperandIndex> cur_seq;
@@ -438,12 +843,24 @@ void TensorPlanner::planGradientTensors(TensorBuilder *tensor_builder)
       }
     }
 
+    if (keep_all)
+    {
+      kept.insert(kept.end(), cur_seq.begin(), cur_seq.end());
+      continue;
+    }
+
     for (const auto &operand_index : cur_seq)
     {
       tensor_builder->notifyBackwardLastUse(operand_index.index());
     }
   }
 
+  // Gradients applied at once are used until the end of backwarding
+  for (const auto &operand_index : kept)
+  {
+    tensor_builder->notifyBackwardLastUse(operand_index.index());
+  }
+
   VERBOSE(TensorPlanner) << "Finish planning gradient tensors" << std::endl;
 }
 
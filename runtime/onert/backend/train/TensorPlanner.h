@@ -19,12 +19,35 @@
 
 #include "TensorBuilder.h"
 
+#include <ir/OperandIndexMap.h>
 #include <ir/train/TrainableGraph.h>
 #include <util/Set.h>
 
+#include <functional>
+#include <vector>
+
 namespace onert::backend::train
 {
 
+/**
+ * @brief Forward operations run again in backwarding instead of keeping their outputs
+ *
+ * Outputs of the segment are released after forwarding and computed again into recompute buffers
+ * right before the first backwarding of the segment. Inputs from other operations are kept in
+ * forward buffers until then, i.e. they are checkpoints.
+ */
+struct RecomputeSegment
+{
+  // Operations in forward order
+  std::vector<ir::OperationIndex> operations;
+  // Position in essentialBackwardOrder() before which the segment is recomputed
+  uint32_t position;
+  // Outputs moved to recompute buffers from the position until the next forwarding
+  util::Set<ir::OperandIndex> outputs;
+  // Inputs defined outside of the segment, kept in forward buffers until the position
+  util::Set<ir::OperandIndex> inputs;
+};
+
 class TensorPlanner
 {
 public:
@@ -36,13 +59,41 @@ public:
   TensorPlanner &operator=(TensorPlanner &&) = delete;
   ~TensorPlanner() = default;
 
-  void planNonConstTensors(TensorBuilder *tensor_builder);
+  /**
+   * @brief Split forward operations into segments to recompute in backwarding
+   *
+   * Segments are chosen to minimize the estimated peak of non-constant and recompute buffers.
+   * It returns no segment if recomputing does not reduce the peak.
+   */
+  std::vector<RecomputeSegment> planRecomputeSegments(const TensorBuilder *tensor_builder);
+  void planNonConstTensors(TensorBuilder *tensor_builder,
+                           const std::vector<RecomputeSegment> &segments = {});
+  void planRecomputedTensors(TensorBuilder *tensor_builder,
+                             const std::vector<RecomputeSegment> &segments);
   void planTrainableTensors(TensorBuilder *tensor_builder);
   void planBackPropTensors(TensorBuilder *tensor_builder);
-  void planGradientTensors(TensorBuilder *tensor_builder);
+  /**
+   * @brief Plan gradient tensors, which are kept until the end of backwarding if keep_all is true
+   */
+  void planGradientTensors(TensorBuilder *tensor_builder, bool keep_all = false);
   void planDisposableBackPropTensors(TensorBuilder *tensor_builder);
   void planLayerScopeTensors(TensorBuilder *tensor_builder);
 
+private:
+  using PlanFn = std::function<void(const ir::OperandIndex &)>;
+
+  void scanNonConstTensors(const TensorBuilder *tensor_builder,
+                           const std::vector<RecomputeSegment> &segments, const PlanFn &claim,
+                           const PlanFn &release);
+  void scanRecomputedTensors(const std::vector<RecomputeSegment> &segments, const PlanFn &claim,
+                             const PlanFn &release);
+  std::vector<RecomputeSegment>
+  makeRecomputeSegments(const TensorBuilder *tensor_builder,
+                        const std::vector<std::vector<ir::OperationIndex>> &chunks);
+  uint64_t estimatePeak(const TensorBuilder *tensor_builder,
+                        const std::vector<RecomputeSegment> &segments,
+                        const ir::OperandIndexMap<uint64_t> &sizes);
+
 private:
   ir::OperandIndexSequence getOutgoingBackPropSeq(const ir::OperationIndex &op_index,
                                                   const TensorBuilder *tensor_builder);
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TensorPlanner.h"
+
+#include <ir/train/operation/BinaryArithmetic.h>
+#include <ir/train/operation/ElementwiseActivation.h>
+#include <ir/train/operation/FullyConnected.h>
+#include <ir/train/operation/Loss.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+
+using namespace onert;
+using namespace onert::backend::train;
+
+namespace
+{
+
+class DummyOptimizer : public exec::train::optimizer::Optimizer
+{
+public:
+  double getLearningRate(uint32_t) const override { return 0.0; }
+  uint32_t getVarCount() const override { return 0; }
+  void applyGradient(const exec::train::optimizer::UpdateFactors &) const override {}
+};
+
+// FullyConnected and ReLU layers with a residual Add over each two layers, followed by a Loss
+void buildResidualGraph(ir::train::TrainableGraph &tgraph, util::Set<ir::OperandIndex> &externals,
+                        uint32_t num_layers)
+{
+  const ir::Shape shape{64, 64};
+  const ir::TypeInfo type{ir::DataType::FLOAT32};
+
+  auto add_input = [&](const ir::Shape &input_shape) {
+    auto index = tgraph.addOperand(input_shape, type);
+    tgraph.addInput(index);
+    externals.add(index);
+    return index;
+  };
+
+  auto input = add_input(shape);
+  auto residual = input;
+  for (uint32_t i = 0; i < num_layers; ++i)
+  {
+    auto weight = add_input(shape);
+    auto bias = add_input(ir::Shape{64});
+    auto fc_out = tgraph.addOperand(shape, type);
+    ir::operation::FullyConnected::Param fc_param;
+    fc_param.weights_format = ir::FullyConnectedWeightsFormat::Default;
+    fc_param.activation = ir::Activation::NONE;
+    tgraph.addOperation(std::make_unique<ir::train::operation::FullyConnected>(
+      ir::operation::FullyConnected({input, weight, bias}, {fc_out}, fc_param)));
+
+    auto relu_out = tgraph.addOperand(shape, type);
+    ir::operation::ElementwiseActivation::Param relu_param;
+    relu_param.op_type = ir::operation::ElementwiseActivation::Type::RELU;
+    relu_param.alpha = std::numeric_limits<float>::infinity();
+    relu_param.beta = 0.f;
+    tgraph.addOperation(std::make_unique<ir::train::operation::ElementwiseActivation>(
+      ir::operation::ElementwiseActivation({fc_out}, {relu_out}, relu_param)));
+    input = relu_out;
+
+    if (i % 2 == 1)
+    {
+      auto add_out = tgraph.addOperand(shape, type);
+      ir::operation::BinaryArithmetic::Param add_param;
+      add_param.arithmetic_type = ir::operation::BinaryArithmetic::ArithmeticType::ADD;
+      add_param.activation = ir::Activation::NONE;
+      tgraph.addOperation(std::make_unique<ir::train::operation::BinaryArithmetic>(
+        ir::operation::BinaryArithmetic({relu_out, residual}, {add_out}, add_param)));
+      input = add_out;
+      residual = add_out;
+    }
+  }
+
+  auto y_true = add_input(shape);
+  auto output = tgraph.addOperand(ir::Shape{1}, type);
+  tgraph.addOutput(output);
+  externals.add(output);
+  const auto y_pred_op_code =
+    tgraph.operations().at(tgraph.operands().at(input).getDef()).opcode();
+  tgraph.addOperation(std::make_unique<ir::train::operation::Loss>(
+    ir::operation::Loss({input, y_true}, {output}), ir::train::LossInfo{}, y_pred_op_code));
+
+  tgraph.operations().iterate(
+    [&](const ir::OperationIndex &index, const ir::IOperation &) { tgraph.enableBackward(index); });
+  tgraph.updateGraphDependency();
+}
+
+// Bytes between the first and the end of the last buffer allocated from one block
+uint64_t allocatedSpan(const std::vector<std::pair<const uint8_t *, uint64_t>> &buffers)
+{
+  if (buffers.empty())
+    return 0;
+
+  auto begin = buffers.front().first;
+  auto end = buffers.front().first + buffers.front().second;
+  for (const auto &[buffer, size] : buffers)
+  {
+    begin = std::min(begin, buffer);
+    end = std::max(end, buffer + size);
+  }
+  return end - begin;
+}
+
+// Allocated size of non-constant tensors and recompute buffers of the residual graph
+uint64_t plannedPeak(uint32_t num_layers, bool recompute)
+{
+  ir::train::TrainableGraph tgraph;
+  util::Set<ir::OperandIndex> externals;
+  buildResidualGraph(tgraph, externals, num_layers);
+
+  auto tensor_reg = std::make_shared<TensorRegistry>();
+  DummyOptimizer optimizer;
+  TensorBuilder tensor_builder{tensor_reg, &optimizer};
+  tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &operand) {
+    if (!externals.contains(index))
+      tensor_builder.registerTensorInfo(index, operand.info());
+  });
+
+  TensorPlanner planner{tgraph, externals};
+  std::vector<RecomputeSegment> segments;
+  if (recompute)
+  {
+    segments = planner.planRecomputeSegments(&tensor_builder);
+    EXPECT_FALSE(segments.empty());
+  }
+  planner.planNonConstTensors(&tensor_builder, segments);
+  planner.planRecomputedTensors(&tensor_builder, segments);
+  tensor_builder.allocate();
+  tensor_builder.allocateRecompute();
+
+  std::vector<std::pair<const uint8_t *, uint64_t>> nonconst_buffers;
+  std::vector<std::pair<const uint8_t *, uint64_t>> recompute_buffers;
+  tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &operand) {
+    if (externals.contains(index) || operand.isConstant())
+      return;
+    const auto size = operand.info().total_size();
+    nonconst_buffers.emplace_back(tensor_reg->getNonConstTensor(index)->buffer(), size);
+  });
+  for (const auto &segment : segments)
+    for (const auto &output : segment.outputs)
+      recompute_buffers.emplace_back(tensor_builder.getRecomputeBuffer(output),
+                                     tgraph.operands().at(output).info().total_size());
+
+  return allocatedSpan(nonconst_buffers) + allocatedSpan(recompute_buffers);
+}
+
+} // namespace
+
+TEST(TensorPlanner, RecomputeSegments)
+{
+  ir::train::TrainableGraph tgraph;
+  util::Set<ir::OperandIndex> externals;
+  buildResidualGraph(tgraph, externals, 24);
+
+  auto tensor_reg = std::make_shared<TensorRegistry>();
+  DummyOptimizer optimizer;
+  TensorBuilder tensor_builder{tensor_reg, &optimizer};
+  tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &operand) {
+    if (!externals.contains(index))
+      tensor_builder.registerTensorInfo(index, operand.info());
+  });
+
+  TensorPlanner planner{tgraph, externals};
+  const auto segments = planner.planRecomputeSegments(&tensor_builder);
+  ASSERT_GT(segments.size(), 1u);
+
+  const auto border = tgraph.essentialBackwardOrder();
+  util::Set<ir::OperationIndex> segment_ops;
+  for (const auto &segment : segments)
+  {
+    ASSERT_LT(segment.position, border.size());
+    ASSERT_FALSE(segment.outputs.empty());
+    for (const auto &op_index : segment.operations)
+    {
+      ASSERT_FALSE(segment_ops.contains(op_index));
+      segment_ops.add(op_index);
+    }
+
+    // Checkpoints are defined outside of the segment
+    for (const auto &input : segment.inputs)
+      ASSERT_FALSE(segment.outputs.contains(input));
+  }
+
+  EXPECT_NO_THROW(planner.planNonConstTensors(&tensor_builder, segments));
+  EXPECT_NO_THROW(planner.planRecomputedTensors(&tensor_builder, segments));
+  EXPECT_NO_THROW(tensor_builder.allocate());
+  EXPECT_NO_THROW(tensor_builder.allocateRecompute());
+
+  for (const auto &segment : segments)
+  {
+    for (const auto &output : segment.outputs)
+    {
+      EXPECT_NE(tensor_reg->getNonConstTensor(output)->buffer(), nullptr);
+      EXPECT_NE(tensor_builder.getRecomputeBuffer(output), nullptr);
+    }
+  }
+}
+
+TEST(TensorPlanner, RecomputeReducesPeak)
+{
+  const auto baseline = plannedPeak(24, false);
+  const auto recomputed = plannedPeak(24, true);
+  EXPECT_LT(recomputed, baseline);
+}
+
+TEST(TensorPlanner, NoRecomputeSegmentsForSmallGraph)
+{
+  ir::train::TrainableGraph tgraph;
+  util::Set<ir::OperandIndex> externals;
+  buildResidualGraph(tgraph, externals, 1);
+
+  auto tensor_reg = std::make_shared<TensorRegistry>();
+  DummyOptimizer optimizer;
+  TensorBuilder tensor_builder{tensor_reg, &optimizer};
+  tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &operand) {
+    if (!externals.contains(index))
+      tensor_builder.registerTensorInfo(index, operand.info());
+  });
+
+  TensorPlanner planner{tgraph, externals};
+  ASSERT_TRUE(planner.planRecomputeSegments(&tensor_builder).empty());
+}
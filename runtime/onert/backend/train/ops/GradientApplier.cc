@@ -40,4 +40,26 @@ void GradientApplier::applyGradient(uint32_t training_step)
     std::forward_as_tuple(*_gradient_tensor, *_trainable_tensor, training_step));
 }
 
+FusedGradientApplier::FusedGradientApplier(const exec::train::optimizer::Optimizer *optimizer,
+                                           double clip_norm)
+  : _optimizer{optimizer}, _clip_norm{clip_norm}, _tensors{}
+{
+  // DO NOTHING
+}
+
+void FusedGradientApplier::append(const IPortableTensor *gradient, ITrainableTensor *trainable)
+{
+  _tensors.emplace_back(gradient, trainable);
+}
+
+void FusedGradientApplier::applyGradient(uint32_t training_step)
+{
+  std::vector<exec::train::optimizer::UpdateFactors> factors;
+  factors.reserve(_tensors.size());
+  for (const auto &[gradient, trainable] : _tensors)
+    factors.emplace_back(*gradient, *trainable, training_step);
+
+  _optimizer->applyGradients(factors, _clip_norm);
+}
+
 } // namespace onert::backend::train::ops
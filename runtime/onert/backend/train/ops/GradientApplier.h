@@ -21,6 +21,9 @@
 
 #include <exec/train/optimizer/Optimizer.h>
 
+#include <utility>
+#include <vector>
+
 namespace onert::backend::train::ops
 {
 
@@ -40,6 +43,27 @@ private:
   ITrainableTensor *_trainable_tensor;
 };
 
+/**
+ * @brief Apply gradients of all trainable tensors at once with an optimizer
+ *
+ * It runs after all gradients of the trainable tensors are computed in backwarding.
+ */
+class FusedGradientApplier : public ::onert::exec::train::IGradientApplier
+{
+public:
+  FusedGradientApplier(const exec::train::optimizer::Optimizer *optimizer, double clip_norm);
+  ~FusedGradientApplier() = default;
+
+  void append(const IPortableTensor *gradient, ITrainableTensor *trainable);
+  bool empty() const { return _tensors.empty(); }
+  void applyGradient(uint32_t training_step) override;
+
+private:
+  const exec::train::optimizer::Optimizer *_optimizer;
+  const double _clip_norm;
+  std::vector<std::pair<const IPortableTensor *, ITrainableTensor *>> _tensors;
+};
+
 } // namespace onert::backend::train::ops
 
 #endif // __ONERT_BACKEND_TRAIN_OPS_GRADIENT_APPLIER_H__
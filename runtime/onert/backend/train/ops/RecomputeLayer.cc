@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RecomputeLayer.h"
+
+#include <cassert>
+
+namespace onert::backend::train::ops
+{
+
+SegmentRecomputer::SegmentRecomputer(const std::vector<Tensor *> &outputs,
+                                     const std::vector<uint8_t *> &recompute_buffers,
+                                     const std::vector<Operation> &operations)
+  : _outputs{outputs}, _recompute_buffers{recompute_buffers}, _operations{operations}
+{
+  assert(outputs.size() == recompute_buffers.size());
+}
+
+void SegmentRecomputer::recompute()
+{
+  for (size_t i = 0; i < _outputs.size(); ++i)
+    _outputs[i]->setBuffer(_recompute_buffers[i]);
+
+  _recomputing = true;
+  for (const auto &operation : _operations)
+    operation.fn_seq->forward(operation.training);
+  _recomputing = false;
+}
+
+RecomputeRestorer::RecomputeRestorer(const std::shared_ptr<SegmentRecomputer> &recomputer,
+                                     const std::vector<Tensor *> &outputs)
+  : _recomputer{recomputer}, _outputs{outputs}
+{
+  assert(recomputer != nullptr);
+  for (const auto &output : _outputs)
+  {
+    assert(output != nullptr && output->buffer() != nullptr);
+    _forward_buffers.emplace_back(output->buffer());
+  }
+}
+
+void RecomputeRestorer::forward(bool)
+{
+  // Operations run through this function while they are recomputed
+  if (_recomputer->recomputing())
+    return;
+
+  for (size_t i = 0; i < _outputs.size(); ++i)
+    _outputs[i]->setBuffer(_forward_buffers[i]);
+}
+
+void RecomputeRestorer::backward()
+{
+  // DO NOTHING
+}
+
+RecomputeLayer::RecomputeLayer(const std::shared_ptr<SegmentRecomputer> &recomputer)
+  : _recomputer{recomputer}
+{
+  assert(recomputer != nullptr);
+}
+
+void RecomputeLayer::forward(bool)
+{
+  // DO NOTHING
+}
+
+void RecomputeLayer::backward() { _recomputer->recompute(); }
+
+} // namespace onert::backend::train::ops
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_TRAIN_OPS_RECOMPUTE_LAYER_H__
+#define __ONERT_BACKEND_TRAIN_OPS_RECOMPUTE_LAYER_H__
+
+#include <exec/train/ITrainableFunction.h>
+#include <exec/train/TrainableFnSequence.h>
+
+#include "../Tensor.h"
+
+#include <memory>
+#include <vector>
+
+namespace onert::backend::train::ops
+{
+
+/**
+ * @brief Forward operations which are run again in backwarding
+ *
+ * Outputs of operations are switched to recompute buffers, and the operations run again to fill
+ * them. RecomputeRestorer switches them back to forward buffers in the next forwarding.
+ */
+class SegmentRecomputer
+{
+public:
+  struct Operation
+  {
+    exec::train::TrainableFnSequence *fn_seq;
+    bool training;
+  };
+
+public:
+  SegmentRecomputer(const std::vector<Tensor *> &outputs,
+                    const std::vector<uint8_t *> &recompute_buffers,
+                    const std::vector<Operation> &operations);
+
+public:
+  void recompute();
+  bool recomputing() const { return _recomputing; }
+
+private:
+  const std::vector<Tensor *> _outputs;
+  const std::vector<uint8_t *> _recompute_buffers;
+  const std::vector<Operation> _operations;
+  bool _recomputing = false;
+};
+
+// TODO Introduce IFunction for only forwarding
+// Switches outputs of an operation back to forward buffers before the operation runs
+class RecomputeRestorer : public exec::train::ITrainableFunction
+{
+public:
+  RecomputeRestorer(const std::shared_ptr<SegmentRecomputer> &recomputer,
+                    const std::vector<Tensor *> &outputs);
+
+public:
+  void forward(bool training) override;
+  void backward() override;
+
+private:
+  const std::shared_ptr<SegmentRecomputer> _recomputer;
+  const std::vector<Tensor *> _outputs;
+  std::vector<uint8_t *> _forward_buffers;
+};
+
+// TODO Introduce IFunction for only backwarding
+// Recomputes a segment before the first backwarding of its operations
+class RecomputeLayer : public exec::train::ITrainableFunction
+{
+public:
+  RecomputeLayer(const std::shared_ptr<SegmentRecomputer> &recomputer);
+
+public:
+  void forward(bool training) override;
+  void backward() override;
+
+private:
+  const std::shared_ptr<SegmentRecomputer> _recomputer;
+};
+
+} // namespace onert::backend::train::ops
+
+#endif // __ONERT_BACKEND_TRAIN_OPS_RECOMPUTE_LAYER_H__
@@ -18,6 +18,7 @@
 
 #include "../ops/OperationUtils.h"
 #include <cker/train/optimizer/Adam.h>
+#include <cker/train/optimizer/FusedOptimizer.h>
 #include <cmath>
 #include <misc/polymorphic_downcast.h>
 
@@ -67,4 +68,47 @@ void Adam::applyGradient(const UpdateFactors &factors) const
   }
 }
 
+void Adam::applyGradients(const std::vector<UpdateFactors> &factors, double clip_norm) const
+{
+  if (factors.empty())
+    return;
+
+  const auto training_step = std::get<2>(factors.front());
+  std::vector<nnfw::cker::train::TrainableChunk> chunks;
+  chunks.reserve(factors.size());
+  for (const auto &f : factors)
+  {
+    [[maybe_unused]] auto [grad_tensor, trainable_tensor, step] = f;
+    assert(step == training_step);
+
+    const auto opt_vars = trainable_tensor.optVars();
+    assert(opt_vars.size() == 2);
+    auto m_tensor = nnfw::misc::polymorphic_downcast<IPortableTensor *>(opt_vars.at(0));
+    auto v_tensor = nnfw::misc::polymorphic_downcast<IPortableTensor *>(opt_vars.at(1));
+
+    if (trainable_tensor.getShape() != grad_tensor.getShape() ||
+        trainable_tensor.getShape() != m_tensor->getShape() ||
+        trainable_tensor.getShape() != v_tensor->getShape())
+    {
+      throw std::runtime_error("Adam: Invalid gradient tensor");
+    }
+
+    if (trainable_tensor.data_type() != ir::DataType::FLOAT32 ||
+        grad_tensor.data_type() != ir::DataType::FLOAT32)
+    {
+      throw std::runtime_error("Adam: Not supported data type");
+    }
+
+    chunks.emplace_back(nnfw::cker::train::TrainableChunk{
+      ops::getBuffer<float>(&trainable_tensor), ops::getBuffer<float>(&grad_tensor),
+      ops::getBuffer<float>(m_tensor), ops::getBuffer<float>(v_tensor),
+      static_cast<int64_t>(trainable_tensor.getShape().num_elements())});
+  }
+
+  const auto beta1_power = std::pow(_props.beta1, training_step + 1);
+  const auto beta2_power = std::pow(_props.beta2, training_step + 1);
+  nnfw::cker::train::FusedAdam(chunks, beta1_power, beta2_power, _learning_rate, _props.beta1,
+                               _props.beta2, _props.epsilon, clip_norm);
+}
+
 } // namespace onert::backend::train::optimizer
@@ -294,6 +294,13 @@ private:
   std::vector<T> _expected_v;
 };
 
+// Fill buffer with float values as they are, unlike setData which narrows them into bytes
+template <typename Tensor> void setFloatData(Tensor &tensor, const std::vector<float> &data)
+{
+  tensor.setData(std::vector<uint8_t>(data.size() * sizeof(float)));
+  memcpy(tensor.buffer(), data.data(), data.size() * sizeof(float));
+}
+
 } // namespace
 
 TEST(Optimizer, SGDValueValidation)
@@ -570,6 +577,148 @@ TEST(Optimizer, neg_AdamUnsupportedType)
   }
 }
 
+TEST(Optimizer, SGDFusedValueValidation)
+{
+  const auto type_info = ir::TypeInfo{ir::DataType::FLOAT32};
+  const std::vector<ir::Shape> shapes = {{1, 3, 3}, {4}};
+  const std::vector<std::vector<float>> trainable_data = {{-1, 2, -3, -4, 5, -6, 7, -8, 9},
+                                                          {0.5, -0.5, 1.5, -1.5}};
+  const std::vector<std::vector<float>> gradient_data = {{-1, -2, -3, 4, 5, -6, 7, 8, -9},
+                                                         {0.1, 0.2, -0.3, 0.4}};
+
+  std::vector<std::unique_ptr<MockUpTrainableTensor>> expected_trainables, actual_trainables;
+  std::vector<std::unique_ptr<MockUpTensor>> gradients;
+  for (size_t i = 0; i < shapes.size(); ++i)
+  {
+    expected_trainables.emplace_back(std::make_unique<MockUpTrainableTensor>(shapes[i], type_info));
+    actual_trainables.emplace_back(std::make_unique<MockUpTrainableTensor>(shapes[i], type_info));
+    gradients.emplace_back(std::make_unique<MockUpTensor>(shapes[i], type_info));
+    setFloatData(*expected_trainables[i], trainable_data[i]);
+    setFloatData(*actual_trainables[i], trainable_data[i]);
+    setFloatData(*gradients[i], gradient_data[i]);
+  }
+
+  backend::train::optimizer::SGD sgd{0.001};
+  for (uint32_t step = 0; step < 10; ++step)
+  {
+    std::vector<exec::train::optimizer::UpdateFactors> factors;
+    for (size_t i = 0; i < shapes.size(); ++i)
+    {
+      sgd.applyGradient({*gradients[i], *expected_trainables[i], step});
+      factors.emplace_back(*gradients[i], *actual_trainables[i], step);
+    }
+    sgd.applyGradients(factors, 0.0);
+
+    for (size_t i = 0; i < shapes.size(); ++i)
+    {
+      for (size_t j = 0; j < trainable_data[i].size(); ++j)
+        EXPECT_NEAR(reinterpret_cast<float *>(actual_trainables[i]->buffer())[j],
+                    reinterpret_cast<float *>(expected_trainables[i]->buffer())[j], 1e-07f);
+    }
+  }
+}
+
+TEST(Optimizer, SGDFusedClipNorm)
+{
+  const auto shape = ir::Shape{2, 2};
+  const auto type_info = ir::TypeInfo{ir::DataType::FLOAT32};
+  MockUpTrainableTensor trainable{shape, type_info};
+  MockUpTensor gradient{shape, type_info};
+
+  // Global norm of gradients is 10
+  setFloatData(trainable, {1, 2, 3, 4});
+  setFloatData(gradient, {6, 0, -8, 0});
+
+  backend::train::optimizer::SGD sgd{0.1};
+  sgd.applyGradients({{gradient, trainable, 0}}, 5.0);
+
+  // Gradients are scaled to have global norm of 5
+  const std::vector<float> expected = {1 - 0.1 * 3, 2, 3 + 0.1 * 4, 4};
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_NEAR(reinterpret_cast<float *>(trainable.buffer())[i], expected[i], 1e-06f);
+}
+
+TEST(Optimizer, AdamFusedValueValidation)
+{
+  const auto type_info = ir::TypeInfo{ir::DataType::FLOAT32};
+  const std::vector<ir::Shape> shapes = {{1, 3, 3}, {4}};
+  const std::vector<std::vector<float>> trainable_data = {{-1, 2, -3, -4, 5, -6, 7, -8, 9},
+                                                          {0.5, -0.5, 1.5, -1.5}};
+  const std::vector<std::vector<float>> gradient_data = {{-1, -2, -3, 4, 5, -6, 7, 8, -9},
+                                                         {0.1, 0.2, -0.3, 0.4}};
+
+  std::vector<std::unique_ptr<MockUpTrainableTensor>> expected_trainables, actual_trainables;
+  std::vector<std::unique_ptr<MockUpTensor>> gradients, opt_vars;
+  for (size_t i = 0; i < shapes.size(); ++i)
+  {
+    expected_trainables.emplace_back(std::make_unique<MockUpTrainableTensor>(shapes[i], type_info));
+    actual_trainables.emplace_back(std::make_unique<MockUpTrainableTensor>(shapes[i], type_info));
+    gradients.emplace_back(std::make_unique<MockUpTensor>(shapes[i], type_info));
+    setFloatData(*expected_trainables[i], trainable_data[i]);
+    setFloatData(*actual_trainables[i], trainable_data[i]);
+    setFloatData(*gradients[i], gradient_data[i]);
+
+    // m and v of both trainable tensors
+    for (auto &&trainable : {expected_trainables[i].get(), actual_trainables[i].get()})
+    {
+      for (int var = 0; var < 2; ++var)
+      {
+        opt_vars.emplace_back(std::make_unique<MockUpTensor>(shapes[i], type_info));
+        setFloatData(*opt_vars.back(), std::vector<float>(trainable_data[i].size(), 0.0f));
+        trainable->appendOptVar(opt_vars.back().get());
+      }
+    }
+  }
+
+  backend::train::optimizer::Adam adam{0.01};
+  for (uint32_t step = 0; step < 10; ++step)
+  {
+    std::vector<exec::train::optimizer::UpdateFactors> factors;
+    for (size_t i = 0; i < shapes.size(); ++i)
+    {
+      adam.applyGradient({*gradients[i], *expected_trainables[i], step});
+      factors.emplace_back(*gradients[i], *actual_trainables[i], step);
+    }
+    adam.applyGradients(factors, 0.0);
+
+    for (size_t i = 0; i < shapes.size(); ++i)
+    {
+      const auto expected_vars = expected_trainables[i]->optVars();
+      const auto actual_vars = actual_trainables[i]->optVars();
+      for (size_t j = 0; j < trainable_data[i].size(); ++j)
+      {
+        EXPECT_NEAR(reinterpret_cast<float *>(actual_trainables[i]->buffer())[j],
+                    reinterpret_cast<float *>(expected_trainables[i]->buffer())[j], 1e-06f);
+        EXPECT_NEAR(reinterpret_cast<float *>(actual_vars[0]->buffer())[j],
+                    reinterpret_cast<float *>(expected_vars[0]->buffer())[j], 1e-06f);
+        EXPECT_NEAR(reinterpret_cast<float *>(actual_vars[1]->buffer())[j],
+                    reinterpret_cast<float *>(expected_vars[1]->buffer())[j], 1e-06f);
+      }
+    }
+  }
+}
+
+TEST(Optimizer, neg_AdamFusedUnmatchedGradientShape)
+{
+  const auto shape = ir::Shape{1, 3, 3};
+  const auto type_info = ir::TypeInfo{ir::DataType::FLOAT32};
+  MockUpTrainableTensor trainable{shape, type_info};
+  MockUpTensor gradient{ir::Shape{2, 2, 2}, type_info};
+  MockUpTensor m{shape, type_info};
+  MockUpTensor v{shape, type_info};
+
+  setFloatData(trainable, std::vector<float>(9, 1.0f));
+  setFloatData(gradient, std::vector<float>(8, 1.0f));
+  setFloatData(m, std::vector<float>(9, 0.0f));
+  setFloatData(v, std::vector<float>(9, 0.0f));
+
+  trainable.appendOptVar(&m);
+  trainable.appendOptVar(&v);
+
+  backend::train::optimizer::Adam adam{};
+  EXPECT_ANY_THROW(adam.applyGradients({{gradient, trainable, 0}}, 0.0));
+}
+
 TEST(Optimizer, CreateOptimizer)
 {
   // SGD
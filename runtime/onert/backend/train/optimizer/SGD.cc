@@ -18,6 +18,7 @@
 
 #include "../ops/OperationUtils.h"
 
+#include <cker/train/optimizer/FusedOptimizer.h>
 #include <cker/train/optimizer/SGD.h>
 
 namespace onert::backend::train::optimizer
@@ -52,4 +53,36 @@ void SGD::applyGradient(const UpdateFactors &factors) const
   }
 }
 
+void SGD::applyGradients(const std::vector<UpdateFactors> &factors, double clip_norm) const
+{
+  if (factors.empty())
+    return;
+
+  const auto training_step = std::get<2>(factors.front());
+  std::vector<nnfw::cker::train::TrainableChunk> chunks;
+  chunks.reserve(factors.size());
+  for (const auto &f : factors)
+  {
+    [[maybe_unused]] auto [grad_tensor, trainable_tensor, step] = f;
+    assert(step == training_step);
+
+    if (trainable_tensor.getShape() != grad_tensor.getShape())
+    {
+      throw std::runtime_error("SGD: Invalid gradient tensor");
+    }
+
+    if (trainable_tensor.data_type() != ir::DataType::FLOAT32 ||
+        grad_tensor.data_type() != ir::DataType::FLOAT32)
+    {
+      throw std::runtime_error("SGD: Not supported data type");
+    }
+
+    chunks.emplace_back(nnfw::cker::train::TrainableChunk{
+      ops::getBuffer<float>(&trainable_tensor), ops::getBuffer<float>(&grad_tensor), nullptr,
+      nullptr, static_cast<int64_t>(trainable_tensor.getShape().num_elements())});
+  }
+
+  nnfw::cker::train::FusedGradientDescent(chunks, getLearningRate(training_step), clip_norm);
+}
+
 } // namespace onert::backend::train::optimizer
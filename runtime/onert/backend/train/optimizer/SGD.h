@@ -74,6 +74,14 @@ public:
    */
   void applyGradient(const UpdateFactors &factors) const override;
 
+  /**
+   * @brief Apply gradients to trainable tensors in a sweep over all of them
+   *
+   * @param factors   UpdateFactors of trainable tensors in the same training step
+   * @param clip_norm Global norm to clip gradients by, which is not applied if not positive
+   */
+  void applyGradients(const std::vector<UpdateFactors> &factors, double clip_norm) const override;
+
 private:
   Property _props;
   double _learning_rate;
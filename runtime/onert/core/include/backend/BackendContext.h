@@ -23,6 +23,7 @@
 #include "ir/OperandIndexMap.h"
 #include "exec/FunctionSequence.h"
 #include "util/Set.h"
+#include "util/ThreadBudget.h"
 
 namespace onert::backend
 {
@@ -42,6 +43,12 @@ struct ContextData
   util::Set<ir::OperandIndex> external_operands;
   /* Is linear executor or not */
   bool is_linear_executor;
+  /* A linear order of operations of the whole graph, which linear executor runs in */
+  std::vector<onert::ir::OperationIndex> whole_op_order;
+  /* Threads of the session. Thread pools of the context register their usage here */
+  std::shared_ptr<util::ThreadBudget> thread_budget;
+  /* Number of threads the context may run kernels with, taken from thread_budget */
+  int32_t num_threads = -1;
 };
 
 class BackendContext
@@ -63,6 +70,11 @@ public:
   virtual ITensorRegistry *genTensors() = 0;
   virtual FunctionMap genKernels() = 0;
 
+  /**
+   * @brief Get runtime statistics of this context as (name, value) to be recorded by tracing
+   */
+  virtual std::vector<std::pair<std::string, uint64_t>> counters() const { return {}; }
+
 protected:
   const Backend *_backend{nullptr};
   ContextData _data;
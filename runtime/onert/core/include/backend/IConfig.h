@@ -59,6 +59,11 @@ struct IConfig
   virtual bool supportPermutation() = 0;
   virtual bool supportDynamicTensor() = 0;
   virtual bool supportFP16() = 0;
+  /**
+   * @brief Returns whether kernels of this backend can run at the same time on different threads,
+   *        e.g. on workers of ParallelExecutor. Otherwise they run one at a time.
+   */
+  virtual bool supportConcurrentKernels() { return false; }
 };
 
 } // namespace onert::backend
@@ -23,6 +23,7 @@
 #define __ONERT_BACKEND_BASIC_ALLOCATOR_H__
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 
 namespace onert::backend::basic
@@ -35,6 +36,12 @@ class Allocator
 {
 public:
   Allocator(uint32_t capacity);
+  /**
+   * @brief Construct with a buffer allocated by others, e.g. MemoryPool
+   * @param[in] base    Buffer to own
+   * @param[in] free_fn Function to give the buffer back on release
+   */
+  Allocator(uint8_t *base, std::function<void(uint8_t *)> free_fn);
   /**
    * @brief Get memory base pointer
    * @return base pointer
@@ -43,7 +50,7 @@ public:
   void release() { _base.reset(); }
 
 private:
-  std::unique_ptr<uint8_t[]> _base;
+  std::unique_ptr<uint8_t[], std::function<void(uint8_t *)>> _base;
 };
 
 } // namespace onert::backend::basic
@@ -20,6 +20,7 @@
 #include "Allocator.h"
 #include "ir/Index.h"
 #include "IMemoryPlanner.h"
+#include "MemoryPool.h"
 
 namespace onert::backend
 {
@@ -56,15 +57,19 @@ protected:
 class DynamicMemoryManager
 {
 public:
-  DynamicMemoryManager() = default;
+  DynamicMemoryManager();
   virtual ~DynamicMemoryManager() = default;
 
   std::shared_ptr<Allocator> allocate(const ITensor *tensor, uint32_t capacity);
   void deallocate(const ITensor *tensor);
   void deallocate(void);
 
+  MemoryPool::Stats stats() const { return _mem_pool->stats(); }
+
 private:
   std::unordered_map<const ITensor *, std::shared_ptr<Allocator>> _mem_alloc_map;
+  // Buffers of dynamic tensors are recycled across operations and runs
+  std::shared_ptr<MemoryPool> _mem_pool;
 };
 
 } // namespace basic
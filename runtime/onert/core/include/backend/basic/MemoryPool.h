@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_BASIC_MEMORY_POOL_H__
+#define __ONERT_BACKEND_BASIC_MEMORY_POOL_H__
+
+#include "Allocator.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace onert::backend::basic
+{
+
+/**
+ * @brief Pool of memory buffers recycled by size class
+ *
+ * Released buffers are kept in a free list of their size class and reused by later allocations
+ * of the same class. Free buffers are kept up to the peak size of buffers in use at once, and
+ * buffers over it are returned to the system.
+ */
+class MemoryPool : public std::enable_shared_from_this<MemoryPool>
+{
+public:
+  struct Stats
+  {
+    uint64_t hits = 0;           //< Allocations served from free lists
+    uint64_t misses = 0;         //< Allocations served by the system
+    uint64_t footprint = 0;      //< Bytes held by the pool, in use or free
+    uint64_t peak_footprint = 0; //< Maximum footprint so far
+  };
+
+public:
+  MemoryPool() = default;
+  ~MemoryPool();
+
+  /**
+   * @brief  Allocate a buffer of at least @c size bytes, whose first @c size bytes are zero
+   * @return Allocator which gives the buffer back to this pool on release
+   */
+  std::shared_ptr<Allocator> allocate(uint32_t size);
+  /**
+   * @brief Return all free buffers to the system
+   */
+  void trim();
+  Stats stats() const;
+
+  /**
+   * @brief Get the size class of @c size
+   *
+   * Size classes split each range between powers of two into 4, so at most 25% of a buffer is
+   * wasted
+   */
+  static size_t sizeClass(size_t size);
+
+private:
+  void release(uint8_t *buffer, size_t size_class);
+
+private:
+  mutable std::mutex _mutex;
+  std::unordered_map<size_t, std::vector<uint8_t *>> _free_lists;
+  size_t _free_size = 0;
+  size_t _used_size = 0;
+  size_t _peak_used_size = 0;
+  Stats _stats;
+};
+
+} // namespace onert::backend::basic
+
+#endif // __ONERT_BACKEND_BASIC_MEMORY_POOL_H__
@@ -25,6 +25,7 @@
 #include "ir/train/OptimizerInfo.h"
 #include "ir/train/TrainableGraph.h"
 #include "util/Set.h"
+#include "util/ThreadBudget.h"
 
 namespace onert::backend::train
 {
@@ -44,6 +45,10 @@ struct TrainableContextData
   bool is_linear_executor;
   /* Optimizer information */
   ir::train::OptimizerInfo optim_info;
+  /* Threads of the session. Thread pools of the context register their usage here */
+  std::shared_ptr<util::ThreadBudget> thread_budget;
+  /* Number of threads the context may run kernels with, taken from thread_budget */
+  int32_t num_threads = -1;
 };
 
 class TrainableBackendContext
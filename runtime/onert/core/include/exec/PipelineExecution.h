@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  PipelineExecution.h
+ * @brief This file defines execution of nnpackage models as pipeline stages
+ */
+#ifndef __ONERT_EXEC_PIPELINE_EXECUTION_H__
+#define __ONERT_EXEC_PIPELINE_EXECUTION_H__
+
+#include "exec/IExecutors.h"
+#include "ExecutionContext.h"
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace onert::exec
+{
+
+/**
+ * @brief Class to run models of multi-model nnpackage as stages of pipeline
+ *
+ * Each model runs on its own thread in model index order. Model k can run frame t + 1 while
+ * model k + 1 runs frame t, so frames are produced at the rate of the slowest stage rather than
+ * at the sum of all stages. Frames are passed between stages through bounded queues.
+ */
+class PipelineExecution
+{
+public:
+  struct StageStats
+  {
+    uint32_t frames = 0;
+    // Time of running model, waiting for a frame, and waiting for room in the next queue
+    double busy_ms = 0;
+    double input_wait_ms = 0;
+    double output_wait_ms = 0;
+  };
+
+  struct Stats
+  {
+    uint32_t pushed_frames = 0;
+    uint32_t popped_frames = 0;
+    // From the first pushInput() to the last popOutput() which returns outputs
+    double elapsed_ms = 0;
+    double frames_per_second = 0;
+    std::vector<StageStats> stages;
+  };
+
+public:
+  /**
+   * @brief     Construct a new PipelineExecution object and start threads of stages
+   * @param[in] executors  Executors of multi-model nnpackage
+   * @param[in] queue_size Maximum number of frames waiting for each stage
+   */
+  PipelineExecution(const std::shared_ptr<IExecutors> &executors, uint32_t queue_size);
+  PipelineExecution(const PipelineExecution &) = delete;
+  PipelineExecution &operator=(const PipelineExecution &) = delete;
+  /**
+   * @brief Stop threads of stages, dropping frames not popped yet
+   */
+  ~PipelineExecution();
+
+public:
+  uint32_t inputSize() const;
+  uint32_t outputSize() const;
+
+  /**
+   * @brief     Copy inputs into a new frame, and push it to the first stage
+   * @param[in] buffers Buffers of all nnpackage inputs
+   * @param[in] lengths Sizes of @c buffers in bytes
+   *
+   * It blocks while the queue of the first stage is full. Buffers can be reused after return.
+   */
+  void pushInput(const std::vector<const void *> &buffers, const std::vector<size_t> &lengths);
+
+  /**
+   * @brief Notify that no more frame is pushed
+   *
+   * Stages finish frames pushed already, and their threads end after the frames are popped.
+   */
+  void finish();
+
+  /**
+   * @brief      Pop outputs of the oldest frame, waiting for it to be computed
+   * @param[out] buffers Buffers of all nnpackage outputs, allocated by @c malloc(). Caller should
+   *                     release them by @c free().
+   * @return     @c false if finish() was called and all frames are popped already
+   *
+   * It rethrows the exception if a stage failed.
+   */
+  bool popOutput(std::vector<void *> &buffers);
+
+  Stats stats() const;
+
+private:
+  class Queue;
+  struct Frame;
+  struct Stage;
+
+  void runStage(Stage &stage);
+  void abort(std::exception_ptr error);
+  void join();
+
+private:
+  std::shared_ptr<IExecutors> _executors;
+  ExecutionOptions _options;
+
+  std::vector<std::unique_ptr<Stage>> _stages;
+  // Queue i is input of stage i, and the last queue is for outputs of the last stage
+  std::vector<std::unique_ptr<Queue>> _queues;
+  std::vector<std::thread> _threads;
+
+  mutable std::mutex _mutex;
+  std::exception_ptr _error;
+  Stats _stats;
+  std::chrono::steady_clock::time_point _start_time;
+};
+
+} // namespace onert::exec
+
+#endif // __ONERT_EXEC_PIPELINE_EXECUTION_H__
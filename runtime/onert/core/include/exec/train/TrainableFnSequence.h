@@ -33,6 +33,7 @@ public:
   void backward(uint32_t training_step, bool weight_update_enabled);
 
   void append(std::unique_ptr<ITrainableFunction> &&fn);
+  void prepend(std::unique_ptr<ITrainableFunction> &&fn);
   void append(std::unique_ptr<IGradientApplier> &&applier);
   void iterate(const std::function<void(ITrainableFunction &)> &fn);
 
@@ -20,7 +20,9 @@
 #include "backend/IPortableTensor.h"
 #include "backend/train/ITrainableTensor.h"
 
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace onert::exec::train::optimizer
 {
@@ -67,6 +69,22 @@ public:
    */
   virtual void applyGradient(const UpdateFactors &factors) const = 0;
 
+  /**
+   * @brief Apply gradients to trainable tensors at once
+   *
+   * @param factors   UpdateFactors of trainable tensors in the same training step
+   * @param clip_norm Gradients are scaled down to have this global norm if they have larger one,
+   *                  which is not applied if it is not positive
+   */
+  virtual void applyGradients(const std::vector<UpdateFactors> &factors, double clip_norm) const
+  {
+    if (clip_norm > 0)
+      throw std::runtime_error{name() + ": Gradient clipping is not supported"};
+
+    for (const auto &f : factors)
+      applyGradient(f);
+  }
+
   // TODO Add member functions for exporting optimizer information
 };
 
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_THREAD_BUDGET_H__
+#define __ONERT_UTIL_THREAD_BUDGET_H__
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace onert::util
+{
+
+/**
+ * @brief Usage of a thread pool running on ThreadBudget
+ */
+class ThreadPoolCounter
+{
+public:
+  ThreadPoolCounter(const std::string &name, int32_t num_threads)
+    : _name{name}, _num_threads{num_threads}
+  {
+  }
+
+public:
+  const std::string &name() const { return _name; }
+  int32_t numThreads() const { return _num_threads; }
+  uint64_t numTasks() const { return _num_tasks; }
+  uint64_t busyNanoseconds() const { return _busy_ns; }
+
+  /**
+   * @brief Whether tasks should be timed and recorded, which is only while a traced execution
+   *        runs not to add clock reads to every task otherwise
+   */
+  bool timed() const { return _timed.load(std::memory_order_relaxed); }
+  void timed(bool timed) { _timed.store(timed, std::memory_order_relaxed); }
+
+  /**
+   * @brief Record a task which kept num_threads threads of the pool busy for elapsed time
+   */
+  void record(std::chrono::nanoseconds elapsed, int32_t num_threads = 1)
+  {
+    ++_num_tasks;
+    _busy_ns += static_cast<uint64_t>(elapsed.count()) * num_threads;
+  }
+
+private:
+  const std::string _name;
+  const int32_t _num_threads;
+  std::atomic<uint64_t> _num_tasks{0};
+  std::atomic<uint64_t> _busy_ns{0};
+  std::atomic<bool> _timed{false};
+};
+
+/**
+ * @brief Threads of a session, from which thread pools of backends and executors take theirs
+ *
+ * Pools are sized from one budget instead of reading NUM_THREADS each, so that threads running
+ * at once in a session do not exceed it. Pools running at the same time, e.g. kernels on workers
+ * of ParallelExecutor, split the budget.
+ *
+ * NOTE ruy and ggml still spawn worker threads of their own, as neither runs on an external pool.
+ *      Only their thread counts are taken from the budget.
+ */
+class ThreadBudget
+{
+public:
+  /**
+   * @brief Construct ThreadBudget object
+   *
+   * @param num_threads Number of threads, or the number of physical cores if negative.
+   *                    It is bounded by the number of hardware threads.
+   */
+  explicit ThreadBudget(int32_t num_threads);
+
+public:
+  /**
+   * @brief Number of physical cores, which is the default of NUM_THREADS
+   */
+  static int32_t defaultNumThreads();
+
+  int32_t numThreads() const { return _num_threads; }
+
+  /**
+   * @brief Number of threads for each of num_lanes pools running at the same time
+   */
+  int32_t numThreadsPerLane(uint32_t num_lanes) const;
+
+  /**
+   * @brief Register a pool of num_threads threads to count its usage
+   */
+  std::shared_ptr<ThreadPoolCounter> addPool(const std::string &name, int32_t num_threads);
+
+  /**
+   * @brief Start to time tasks of pools for a traced execution
+   *
+   * Executions may be nested, e.g. subgraphs of control flow operations, or run at the same time.
+   * Pools are timed until the last of them ends.
+   */
+  void beginExecution();
+  void endExecution();
+
+  /**
+   * @brief Get usage of pools as (name, value), summed up by pool name
+   *
+   * For each pool name, "threads" is the largest pool, "busy_us" is the sum of thread time spent
+   * on tasks, and "utilization" is busy time over capacity during traced executions, in percent.
+   */
+  std::vector<std::pair<std::string, uint64_t>> counters() const;
+
+private:
+  int32_t _num_threads;
+  mutable std::mutex _mu;
+  std::vector<std::shared_ptr<ThreadPoolCounter>> _pools;
+  uint32_t _num_executions = 0;
+  std::chrono::steady_clock::time_point _execution_begin;
+  // Time of executions which have ended
+  std::chrono::nanoseconds _execution_time{0};
+};
+
+} // namespace onert::util
+
+#endif // __ONERT_UTIL_THREAD_BUDGET_H__
@@ -22,11 +22,16 @@ namespace onert::backend::basic
 {
 
 Allocator::Allocator(uint32_t capacity)
+  : _base{new uint8_t[capacity](), [](uint8_t *base) { delete[] base; }}
 {
-  _base = std::make_unique<uint8_t[]>(capacity);
-
   VERBOSE(ALLOC) << "allocation capacity: " << capacity << std::endl;
   VERBOSE(ALLOC) << "base pointer: " << static_cast<void *>(_base.get()) << std::endl;
 }
 
+Allocator::Allocator(uint8_t *base, std::function<void(uint8_t *)> free_fn)
+  : _base{base, std::move(free_fn)}
+{
+  // DO NOTHING
+}
+
 } // namespace onert::backend::basic
@@ -68,6 +68,11 @@ uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
   return _mem_alloc->base() + mem_blk.offset;
 }
 
+DynamicMemoryManager::DynamicMemoryManager() : _mem_pool{std::make_shared<MemoryPool>()}
+{
+  // DO NOTHING
+}
+
 std::shared_ptr<basic::Allocator> DynamicMemoryManager::allocate(const ITensor *tensor,
                                                                  uint32_t capacity)
 {
@@ -75,7 +80,7 @@ std::shared_ptr<basic::Allocator> DynamicMemoryManager::allocate(const ITensor *
   if (find != _mem_alloc_map.end())
     throw std::runtime_error("Cannot allocate memory for a tensor. It was already allocated.");
 
-  _mem_alloc_map[tensor] = std::make_shared<basic::Allocator>(capacity);
+  _mem_alloc_map[tensor] = _mem_pool->allocate(capacity);
   return _mem_alloc_map[tensor];
 }
 
@@ -85,7 +90,7 @@ void DynamicMemoryManager::deallocate(const ITensor *tensor)
   if (find == _mem_alloc_map.end())
     throw std::runtime_error("Cannot find Allocator for the requested index");
 
-  find->second->release();    // explicitly erase memory
+  find->second->release();    // explicitly give memory back to the pool
   _mem_alloc_map.erase(find); // remove tensor and alloc
 }
 
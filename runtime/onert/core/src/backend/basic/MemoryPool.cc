@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/basic/MemoryPool.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace onert::backend::basic
+{
+
+MemoryPool::~MemoryPool() { trim(); }
+
+size_t MemoryPool::sizeClass(size_t size)
+{
+  constexpr size_t kMinSizeClass = 64;
+  if (size <= kMinSizeClass)
+    return kMinSizeClass;
+
+  size_t pow2 = kMinSizeClass;
+  while (pow2 * 2 < size)
+    pow2 *= 2;
+  const size_t step = pow2 / 4;
+  return (size + step - 1) / step * step;
+}
+
+std::shared_ptr<Allocator> MemoryPool::allocate(uint32_t size)
+{
+  const size_t size_class = sizeClass(size);
+  uint8_t *buffer = nullptr;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    auto &free_list = _free_lists[size_class];
+    if (!free_list.empty())
+    {
+      buffer = free_list.back();
+      free_list.pop_back();
+      _free_size -= size_class;
+      _stats.hits++;
+    }
+    else
+    {
+      _stats.misses++;
+      _stats.footprint += size_class;
+      _stats.peak_footprint = std::max(_stats.peak_footprint, _stats.footprint);
+    }
+    _used_size += size_class;
+    _peak_used_size = std::max(_peak_used_size, _used_size);
+  }
+
+  // Zeroed like a fresh buffer, as kernels may rely on it
+  if (buffer == nullptr)
+  {
+    buffer = new uint8_t[size_class]();
+    VERBOSE(ALLOC) << "pool allocation capacity: " << size_class << std::endl;
+  }
+  else
+  {
+    std::memset(buffer, 0, size);
+  }
+
+  // Free function holds the pool to give the buffer back even if the owner of the pool is gone
+  auto pool = shared_from_this();
+  return std::make_shared<Allocator>(
+    buffer, [pool, size_class](uint8_t *base) { pool->release(base, size_class); });
+}
+
+void MemoryPool::release(uint8_t *buffer, size_t size_class)
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    _used_size -= size_class;
+    if (_free_size + size_class <= _peak_used_size)
+    {
+      _free_lists[size_class].push_back(buffer);
+      _free_size += size_class;
+      return;
+    }
+    _stats.footprint -= size_class;
+  }
+
+  delete[] buffer;
+}
+
+void MemoryPool::trim()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  for (auto &&[size_class, free_list] : _free_lists)
+  {
+    for (auto buffer : free_list)
+      delete[] buffer;
+    _stats.footprint -= size_class * free_list.size();
+  }
+  _free_lists.clear();
+  _free_size = 0;
+}
+
+MemoryPool::Stats MemoryPool::stats() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _stats;
+}
+
+} // namespace onert::backend::basic
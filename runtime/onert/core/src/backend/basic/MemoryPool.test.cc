@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/basic/MemoryPool.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using onert::backend::basic::MemoryPool;
+
+TEST(MemoryPool, size_class)
+{
+  ASSERT_EQ(MemoryPool::sizeClass(0), 64u);
+  ASSERT_EQ(MemoryPool::sizeClass(64), 64u);
+  ASSERT_EQ(MemoryPool::sizeClass(65), 80u);
+  ASSERT_EQ(MemoryPool::sizeClass(128), 128u);
+  ASSERT_EQ(MemoryPool::sizeClass(129), 160u);
+  ASSERT_EQ(MemoryPool::sizeClass(1000), 1024u);
+  ASSERT_EQ(MemoryPool::sizeClass(1025), 1280u);
+}
+
+TEST(MemoryPool, reuse_released_buffer)
+{
+  auto pool = std::make_shared<MemoryPool>();
+
+  auto alloc1 = pool->allocate(1000);
+  auto alloc2 = pool->allocate(100);
+  ASSERT_NE(alloc1->base(), nullptr);
+  ASSERT_NE(alloc2->base(), nullptr);
+  const auto base1 = alloc1->base();
+  alloc1->release();
+
+  // Same size class
+  auto alloc3 = pool->allocate(900);
+  ASSERT_EQ(alloc3->base(), base1);
+
+  auto stats = pool->stats();
+  ASSERT_EQ(stats.hits, 1u);
+  ASSERT_EQ(stats.misses, 2u);
+  ASSERT_EQ(stats.footprint, 1024u + 112u);
+  ASSERT_EQ(stats.peak_footprint, 1024u + 112u);
+
+  // Released by destruction of allocators
+  alloc2.reset();
+  alloc3.reset();
+  pool->trim();
+  stats = pool->stats();
+  ASSERT_EQ(stats.footprint, 0u);
+  ASSERT_EQ(stats.peak_footprint, 1024u + 112u);
+}
+
+TEST(MemoryPool, zero_reused_buffer)
+{
+  auto pool = std::make_shared<MemoryPool>();
+
+  auto alloc1 = pool->allocate(1000);
+  for (int i = 0; i < 1000; ++i)
+    ASSERT_EQ(alloc1->base()[i], 0);
+  std::fill(alloc1->base(), alloc1->base() + 1000, 0xFF);
+  alloc1.reset();
+
+  auto alloc2 = pool->allocate(1000);
+  ASSERT_EQ(pool->stats().hits, 1u);
+  for (int i = 0; i < 1000; ++i)
+    ASSERT_EQ(alloc2->base()[i], 0);
+}
+
+TEST(MemoryPool, free_buffers_up_to_peak_usage)
+{
+  auto pool = std::make_shared<MemoryPool>();
+
+  // Peak usage is 2048 bytes
+  auto alloc1 = pool->allocate(1024);
+  auto alloc2 = pool->allocate(1024);
+  alloc1.reset();
+  alloc2.reset();
+  ASSERT_EQ(pool->stats().footprint, 2048u);
+
+  // Buffers of other classes are not kept over the peak usage
+  auto alloc3 = pool->allocate(512);
+  alloc3.reset();
+  ASSERT_EQ(pool->stats().footprint, 2048u);
+  ASSERT_EQ(pool->stats().peak_footprint, 2048u + 512u);
+}
+
+TEST(MemoryPool, allocator_outlives_pool_owner)
+{
+  auto pool = std::make_shared<MemoryPool>();
+  auto alloc = pool->allocate(256);
+  pool.reset();
+
+  alloc->base()[255] = 1;
+  alloc->release();
+  ASSERT_EQ(alloc->base(), nullptr);
+}
@@ -31,6 +31,8 @@
 #include "../ir/verifier/Verifier.h"
 
 #include "compiler/StaticShapeInferer.h"
+#include "util/ConfigSource.h"
+#include "util/ThreadBudget.h"
 
 #include <misc/string_helpers.h>
 #include <misc/polymorphic_downcast.h>
@@ -222,6 +224,10 @@ std::unique_ptr<CompilerArtifact> Compiler::compile(void)
   else
     executors = std::make_shared<exec::MultiModelExecutors>(std::move(model_edges));
 
+  // All executors of the session take threads from one budget
+  auto thread_budget =
+    std::make_shared<util::ThreadBudget>(util::getConfigInt(util::config::NUM_THREADS));
+
   for (auto &&pair : lowered_subgs)
   {
     auto const &model_index = pair.first;
@@ -243,6 +249,7 @@ std::unique_ptr<CompilerArtifact> Compiler::compile(void)
       args.options = _options;
       args.model_index = model_index;
       args.custom_kernel_builder = custom_kernel_builders[model_index];
+      args.thread_budget = thread_budget;
       if (_options->internal_output_alloc)
       {
         for (const auto &desc : pkg_outputs)
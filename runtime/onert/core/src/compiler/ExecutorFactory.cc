@@ -145,7 +145,8 @@ void initializeSubgraphIOTensors(compiler::ILoweredGraph &lowered_graph,
 
 backend::BackendContexts
 createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
-                      const util::Set<ir::OperandIndex> &internal_io_indexes)
+                      const util::Set<ir::OperandIndex> &internal_io_indexes,
+                      const std::shared_ptr<util::ThreadBudget> &thread_budget, bool parallel)
 {
   backend::BackendContexts contexts;
   std::unordered_map<const backend::Backend *, backend::ContextData> context_data_map;
@@ -217,6 +218,10 @@ createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
       }
     });
 
+  // Kernels on workers of ParallelExecutor run at the same time, so they split the budget
+  const auto num_lanes = parallel ? exec::ParallelScheduler::numWorkers(thread_budget.get()) : 1;
+  const auto num_threads = thread_budget ? thread_budget->numThreadsPerLane(num_lanes) : -1;
+
   // Create contexts
   auto whole_op_order = lgraph.graph().topolSortOperations();
   for (auto &&[backend, data] : context_data_map)
@@ -250,6 +255,9 @@ createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
     std::copy_if(whole_op_order.begin(), whole_op_order.end(), std::back_inserter(op_order),
                  [&](const auto &ind) { return graph->operations().exist(ind); });
     data.is_linear_executor = linear_executor;
+    data.whole_op_order = whole_op_order;
+    data.thread_budget = thread_budget;
+    data.num_threads = num_threads;
     contexts.emplace(backend, backend->newContext(std::move(data)));
   }
   return contexts;
@@ -422,7 +430,8 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
   auto &graph = lowered_graph->graph();
 
   backend::BackendContexts backend_contexts =
-    createBackendContexts(*lowered_graph, options->executor == "Linear", args.internal_io_indexes);
+    createBackendContexts(*lowered_graph, options->executor == "Linear", args.internal_io_indexes,
+                          args.thread_budget, false);
 
   TensorRegistries tensor_regs{backend_contexts, true};
 
@@ -534,8 +543,10 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
 
   if (!options->workspace_dir.empty())
   {
-    exec->addObserver(
-      std::make_unique<exec::TracingObserver>(options->workspace_dir, exec->graph(), tracing_ctx));
+    exec->addObserver(std::make_unique<exec::TracingObserver>(options->workspace_dir,
+                                                              exec->graph(), tracing_ctx,
+                                                              &exec->getBackendContexts(),
+                                                              args.thread_budget.get()));
     exec->addObserver(std::make_unique<exec::MinMaxRecorder>(options->workspace_dir, exec->graph(),
                                                              exec->getBackendContexts()));
   }
@@ -554,7 +565,8 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
   auto custom_kernel_builder = args.custom_kernel_builder;
 
   backend::BackendContexts backend_contexts =
-    createBackendContexts(*lowered_graph, options->executor == "Linear", args.internal_io_indexes);
+    createBackendContexts(*lowered_graph, options->executor == "Linear", args.internal_io_indexes,
+                          args.thread_budget, parallel);
 
   TensorRegistries tensor_regs{backend_contexts, true};
 
@@ -601,8 +613,9 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
   exec::ExecutorBase *exec = nullptr;
   if (parallel)
   {
-    exec = new exec::ParallelExecutor{std::move(lowered_graph), std::move(backend_contexts),
-                                      tensor_regs, std::move(code_map), tracing_ctx};
+    exec =
+      new exec::ParallelExecutor{std::move(lowered_graph), std::move(backend_contexts), tensor_regs,
+                                 std::move(code_map), tracing_ctx, args.thread_budget};
   }
   else
   {
@@ -626,8 +639,10 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
 
   if (!options->workspace_dir.empty())
   {
-    exec->addObserver(
-      std::make_unique<exec::TracingObserver>(options->workspace_dir, exec->graph(), tracing_ctx));
+    exec->addObserver(std::make_unique<exec::TracingObserver>(options->workspace_dir,
+                                                              exec->graph(), tracing_ctx,
+                                                              &exec->getBackendContexts(),
+                                                              args.thread_budget.get()));
   }
 
   return exec;
@@ -701,8 +716,8 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
 
   // TODO Create context only once instead of replacing
   backend::train::TrainableBackendContexts tbackend_contexts;
-  backend::BackendContexts base_backend_contexts =
-    createBackendContexts(*lowered_graph, true, args.internal_io_indexes);
+  backend::BackendContexts base_backend_contexts = createBackendContexts(
+    *lowered_graph, true, args.internal_io_indexes, args.thread_budget, false);
 
   // Replace BackendContext with TrainbleBackendContext
   for (auto &&[backend, ctx] : base_backend_contexts)
@@ -750,6 +765,8 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
     tdata.external_operands = std::move(data.external_operands);
     tdata.is_linear_executor = data.is_linear_executor;
     tdata.optim_info = training_info.optimizerInfo();
+    tdata.thread_budget = data.thread_budget;
+    tdata.num_threads = data.num_threads;
 
     // TODO Remove dynamic_cast
     const auto tbackend = dynamic_cast<const backend::train::ITrainableBackend *>(backend);
@@ -913,8 +930,8 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
 
   if (!options->workspace_dir.empty())
   {
-    exec->addObserver(
-      std::make_unique<exec::TracingObserver>(options->workspace_dir, exec->graph(), tracing_ctx));
+    exec->addObserver(std::make_unique<exec::TracingObserver>(
+      options->workspace_dir, exec->graph(), tracing_ctx, nullptr, args.thread_budget.get()));
   }
   // TODO Support MINMAX_DUMPER
 
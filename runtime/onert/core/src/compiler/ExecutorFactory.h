@@ -25,6 +25,7 @@
 #include "compiler/train/LoweredTrainableGraph.h"
 #include "exec/IExecutors.h"
 #include "ir/train/TrainingInfo.h"
+#include "util/ThreadBudget.h"
 #include "util/TracingCtx.h"
 
 #include <deque>
@@ -41,6 +42,7 @@ struct ExecutorFactoryArgs
   ir::ModelIndex model_index;
   std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder;
   util::Set<ir::OperandIndex> internal_io_indexes;
+  std::shared_ptr<util::ThreadBudget> thread_budget;
 };
 
 class ExecutorFactory
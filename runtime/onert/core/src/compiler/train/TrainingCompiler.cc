@@ -34,6 +34,8 @@
 #include <compiler/StaticShapeInferer.h>
 #include <compiler/train/LoweredTrainableGraph.h>
 #include <ir/train/TrainableGraph.h>
+#include <util/ConfigSource.h>
+#include <util/ThreadBudget.h>
 
 #include <misc/polymorphic_downcast.h>
 #include <misc/string_helpers.h>
@@ -270,6 +272,9 @@ std::unique_ptr<CompilerArtifact> TrainingCompiler::compile(void)
    *  Backend independent analysis & optimization phase finished
    *************************************************************/
   auto executors = std::make_shared<exec::train::TrainableExecutors>();
+  // All executors of the session take threads from one budget
+  auto thread_budget =
+    std::make_shared<util::ThreadBudget>(util::getConfigInt(util::config::NUM_THREADS));
   for (auto &&[subg_index, lowered_subg] : lowered_subgs)
   {
     auto const model_index = ir::ModelIndex{0};
@@ -285,6 +290,7 @@ std::unique_ptr<CompilerArtifact> TrainingCompiler::compile(void)
     args.options = _options;
     args.model_index = model_index;
     args.custom_kernel_builder = custom_kernel_builder;
+    args.thread_budget = thread_budget;
     // TODO: Support internal io if necessary
     auto executor = std::unique_ptr<exec::IExecutor>{
       ExecutorFactory::get().create(std::move(lowered_subg), executors, args, _training_info)};
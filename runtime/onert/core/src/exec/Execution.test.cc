@@ -15,6 +15,7 @@
  */
 
 #include "exec/Execution.h"
+#include "exec/PipelineExecution.h"
 
 #include "compiler/CompilerFactory.h"
 #include "ir/Graph.h"
@@ -915,6 +916,73 @@ TEST(ExecInstance, multi_model_dequant_input_quant_output)
   }
 }
 
+TEST(ExecInstance, multi_model_pipeline)
+{
+  auto mockup = MockUpMultiModel();
+  mockup.compile();
+  auto executors = mockup.artifact->_executors;
+
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  const float rhs1[4] = {3, 1, -1, 5};
+  const uint32_t frames = 10;
+
+  onert::exec::PipelineExecution pipeline{executors, 2};
+
+  // Push and pop concurrently, since pushInput() blocks while queues are full
+  std::thread producer{[&]() {
+    for (uint32_t f = 0; f < frames; f++)
+    {
+      const float input1_buffer[4] = {1.0f + f, 0, -1, -2.0f - f};
+      pipeline.pushInput({input1_buffer, input2_buffer}, {16, 16});
+    }
+    pipeline.finish();
+  }};
+
+  uint32_t popped = 0;
+  std::vector<void *> outputs;
+  while (pipeline.popOutput(outputs))
+  {
+    ASSERT_EQ(outputs.size(), 1u);
+    const float input1_buffer[4] = {1.0f + popped, 0, -1, -2.0f - popped};
+    const auto output_buffer = static_cast<const float *>(outputs[0]);
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(output_buffer[i], 2 * (input1_buffer[i] + input2_buffer[i]) + rhs1[i]);
+    }
+    free(outputs[0]);
+    popped++;
+  }
+  producer.join();
+
+  EXPECT_EQ(popped, frames);
+  const auto stats = pipeline.stats();
+  EXPECT_EQ(stats.popped_frames, frames);
+  ASSERT_EQ(stats.stages.size(), 3u);
+  for (const auto &stage : stats.stages)
+    EXPECT_EQ(stage.frames, frames);
+}
+
+TEST(ExecInstance, neg_pipeline_single_model)
+{
+  auto mockup = MockUpModel();
+  mockup.compile();
+  auto executors = mockup.artifact->_executors;
+
+  EXPECT_ANY_THROW(onert::exec::PipelineExecution(executors, 2));
+}
+
+TEST(ExecInstance, neg_pipeline_small_input)
+{
+  auto mockup = MockUpMultiModel();
+  mockup.compile();
+  auto executors = mockup.artifact->_executors;
+
+  const float input_buffer[4] = {};
+  onert::exec::PipelineExecution pipeline{executors, 2};
+  EXPECT_ANY_THROW(pipeline.pushInput({input_buffer, input_buffer}, {16, 8}));
+  EXPECT_ANY_THROW(pipeline.pushInput({input_buffer}, {16}));
+}
+
 // TODO Add an unittest multi_model_quant_input_dequant_output
 
 } // namespace
@@ -115,9 +115,12 @@ void ProfileObserver::handleJobEnd(IExecutor *exec, std::pair<ir::ModelIndex, ir
 };
 
 TracingObserver::TracingObserver(const std::string &workspace_dir, const ir::Graph &graph,
-                                 const util::TracingCtx *tracing_ctx)
+                                 const util::TracingCtx *tracing_ctx,
+                                 const backend::BackendContexts *backend_contexts,
+                                 util::ThreadBudget *thread_budget)
   : _recorder{std::make_unique<EventRecorder>()}, _collector{_recorder.get()}, _graph{graph},
-    _workspace_dir{workspace_dir}, _tracing_ctx{tracing_ctx}, _triggered{false}
+    _workspace_dir{workspace_dir}, _tracing_ctx{tracing_ctx}, _backend_contexts{backend_contexts},
+    _thread_budget{thread_budget}, _triggered{false}
 {
   // DO NOTHING
 }
@@ -146,6 +149,9 @@ void TracingObserver::handleSubgraphBegin(std::pair<ir::ModelIndex, ir::Subgraph
 
   _collector.onEvent(EventCollector::SubgEvent{_tracing_ctx, EventCollector::Edge::BEGIN,
                                                ind.first.value(), ind.second.value()});
+
+  if (_thread_budget != nullptr)
+    _thread_budget->beginExecution();
 }
 
 void TracingObserver::handleJobBegin(IExecutor *, std::pair<ir::ModelIndex, ir::SubgraphIndex> ind,
@@ -175,6 +181,22 @@ void TracingObserver::handleSubgraphEnd(std::pair<ir::ModelIndex, ir::SubgraphIn
 {
   _collector.onEvent(EventCollector::SubgEvent{_tracing_ctx, EventCollector::Edge::END,
                                                ind.first.value(), ind.second.value()});
+
+  if (_thread_budget != nullptr)
+  {
+    _thread_budget->endExecution();
+    for (const auto &[name, value] : _thread_budget->counters())
+      _collector.onCounter(_tracing_ctx, name, value);
+  }
+
+  if (_backend_contexts == nullptr)
+    return;
+
+  for (const auto &[backend, bctx] : *_backend_contexts)
+  {
+    for (const auto &[name, value] : bctx->counters())
+      _collector.onCounter(_tracing_ctx, backend->config()->id() + "." + name, value);
+  }
 }
 
 } // namespace exec
@@ -22,10 +22,12 @@
 #include "../util/EventRecorder.h"
 #include "../util/EventWriter.h"
 
+#include "backend/BackendContext.h"
 #include "exec/IExecutor.h"
 #include "ir/Index.h"
 #include "ir/IOperation.h"
 #include "util/ITimer.h"
+#include "util/ThreadBudget.h"
 #include "util/TracingCtx.h"
 
 namespace onert::exec
@@ -105,7 +107,9 @@ class TracingObserver : public IExecutionObserver
 {
 public:
   TracingObserver(const std::string &workspace_dir, const ir::Graph &graph,
-                  const util::TracingCtx *tracing_ctx);
+                  const util::TracingCtx *tracing_ctx,
+                  const backend::BackendContexts *backend_contexts = nullptr,
+                  util::ThreadBudget *thread_budget = nullptr);
   ~TracingObserver();
   void handleSubgraphBegin(std::pair<ir::ModelIndex, ir::SubgraphIndex>) override;
   void handleJobBegin(IExecutor *, std::pair<ir::ModelIndex, ir::SubgraphIndex>, ir::OperationIndex,
@@ -121,6 +125,10 @@ private:
   const ir::Graph &_graph;
   std::string _workspace_dir;
   const util::TracingCtx *_tracing_ctx;
+  // Backend contexts whose counters are recorded at the end of subgraph
+  const backend::BackendContexts *_backend_contexts;
+  // Thread budget whose pools are timed during subgraphs, and whose usage is recorded at the end
+  util::ThreadBudget *_thread_budget;
   bool _triggered;
 };
 
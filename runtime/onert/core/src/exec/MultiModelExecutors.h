@@ -82,11 +82,16 @@ public:
 
   void execute(ExecutionContext &ctx) override;
 
-private:
+  /**
+   * @brief Throw if edges between models cannot be run in model index order
+   */
   void checkSupportedMultimodel() const;
+  uint16_t modelCount() const;
+  const ir::ModelEdges &modelEdges() const { return *_model_edges; }
+
+private:
   void createEdgeTensors();
   void CreatePkgIOTensors(const IODescription &desc);
-  uint16_t modelCount() const;
 
 private:
   std::unordered_map<std::pair<ir::ModelIndex, ir::SubgraphIndex>, std::unique_ptr<IExecutor>>
@@ -16,6 +16,7 @@
 
 #include "ParallelExecutor.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include "util/logging.h"
@@ -49,109 +50,116 @@ private:
 
 void ParallelExecutor::notify(uint32_t finished_job_id)
 {
-  std::unique_lock<std::mutex> lock{_mu_jobs};
+  // Jobs readied by this job are pushed in increasing rank order. The worker pops its
+  // own queue from the back, so it continues with the highest ranked one.
+  std::vector<uint32_t> ready_jobs;
+  for (auto &&id : _output_info[finished_job_id])
+  {
+    assert(_num_pending_inputs[id] > 0);
+    if (--_num_pending_inputs[id] == 0) // No dependent jobs left, ready for execution
+      ready_jobs.push_back(id);
+  }
 
-  DataflowExecutor::notify(finished_job_id);
+  std::sort(ready_jobs.begin(), ready_jobs.end(),
+            [this](uint32_t lhs, uint32_t rhs) { return _job_ranks[lhs] < _job_ranks[rhs]; });
+  for (auto &&id : ready_jobs)
+    schedule(id);
+}
 
-  lock.unlock();
-  _cv_jobs.notify_all();
+void ParallelExecutor::schedule(uint32_t job_index)
+{
+  auto &job = _waiting_jobs[job_index];
+  assert(job != nullptr);
+
+  VERBOSE(ParallelExecutor) << "Assigning fn " << job_index << std::endl;
+
+  auto op_ind = _job_to_op.at(job_index);
+  const auto backend = _lowered_graph->lower_info().operation.at(op_ind);
+  auto setup = [this, op_ind, backend]() {
+    _subject->notifyJobBegin(this, _profiling_subg_index, op_ind, backend);
+  };
+  auto teardown = [this, job_index, op_ind, backend]() {
+    _subject->notifyJobEnd(this, _profiling_subg_index, op_ind, backend);
+    notify(job_index);
+  };
+
+  job->fn_seq()->initRunning();
+
+  // dynamic tensor setting
+  bool handle_dynamic_tensor = _lowered_graph->getHasDynamicTensor(op_ind) || _dynamic_input_exists;
+  job->fn_seq()->enableDynamicShapeInferer(handle_dynamic_tensor);
+
+  // Kernels handling dynamic tensors share the dynamic tensor manager of their backend
+  auto fn = std::make_unique<HookFunction>(job->fn_seq(), setup, teardown);
+  _finished_jobs[job_index] = std::move(job);
+  _scheduler->assign(std::move(fn), backend, handle_dynamic_tensor);
 }
 
 ParallelExecutor::ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
                                    backend::BackendContexts &&backend_contexts,
                                    const compiler::TensorRegistries &tensor_regs,
                                    compiler::CodeMap &&code_map,
-                                   const util::TracingCtx *tracing_ctx)
+                                   const util::TracingCtx *tracing_ctx,
+                                   const std::shared_ptr<util::ThreadBudget> &thread_budget)
   : DataflowExecutor{std::move(lowered_graph), std::move(backend_contexts), tensor_regs,
-                     std::move(code_map), tracing_ctx}
+                     std::move(code_map), tracing_ctx},
+    _num_pending_inputs{std::make_unique<std::atomic<uint32_t>[]>(_initial_input_info.size())}
 {
   VERBOSE(ParallelExecutor) << "Constructing Parallel Executor" << std::endl;
-}
 
-void ParallelExecutor::executeImpl(const ExecutionObservee &subject)
-{
-  bool dynamic_input_exists = hasDynamicInput();
-
-  // Init scheduler
+  // Init scheduler once. Its threads are reused by all executions.
   // TODO Consider to have distinct backend set in GraphLowerInfo
   BackendSet backends;
   for (const auto &[idx, backend] : _lowered_graph->lower_info().operation)
     backends.add(backend);
 
-  _scheduler = std::make_unique<ParallelScheduler>(backends);
+  _scheduler = std::make_unique<ParallelScheduler>(
+    backends, ParallelScheduler::numWorkers(thread_budget.get()), thread_budget.get());
+
+  // Ranks do not change between executions
+  _job_ranks.resize(_finished_jobs.size());
+  for (uint32_t i = 0; i < _job_ranks.size(); ++i)
+    _job_ranks[i] = calculateRank({_job_to_op.at(i)});
+}
+
+void ParallelExecutor::executeImpl(const ExecutionObservee &subject)
+{
+  _subject = &subject;
+  _dynamic_input_exists = hasDynamicInput();
+  _profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_graph);
 
   assert(noWaitingJobs());
 
   // Execution setup
   _waiting_jobs.swap(_finished_jobs); // Move finished jobs to waiting jobs
 
-  for (uint32_t i = 0; i < _waiting_jobs.size(); ++i)
+  const uint32_t num_jobs = _waiting_jobs.size();
+  std::vector<uint32_t> initial_jobs;
+  for (uint32_t i = 0; i < num_jobs; ++i)
   {
-    VERBOSE(ParallelExecutor) << i << ": " << _input_info[i] << std::endl;
-    if (_input_info[i] == 0)
-    {
-      emplaceToReadyJobs(i);
-    }
+    VERBOSE(ParallelExecutor) << i << ": " << _initial_input_info[i] << std::endl;
+    _num_pending_inputs[i] = _initial_input_info[i];
+    if (_initial_input_info[i] == 0)
+      initial_jobs.push_back(i);
   }
-  assert(!_ready_jobs.empty()); // Cannot begin if there is no initial jobs
+  assert(!initial_jobs.empty()); // Cannot begin if there is no initial jobs
 
-  VERBOSE(ParallelExecutor) << "INITIAL JOBS : " << _ready_jobs.size() << std::endl;
+  VERBOSE(ParallelExecutor) << "INITIAL JOBS : " << initial_jobs.size() << std::endl;
 
-  auto profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_graph);
+  subject.notifySubgraphBegin(_profiling_subg_index);
 
-  subject.notifySubgraphBegin(profiling_subg_index);
-
-  while (true)
-  {
-    std::unique_lock<std::mutex> lock{_mu_jobs};
-
-    if (_ready_jobs.empty())
-    {
-      _cv_jobs.wait(lock, [this] { return !_ready_jobs.empty() || noWaitingJobs(); });
-      // Check finish condition
-      if (_ready_jobs.empty() && noWaitingJobs())
-      {
-        break;
-      }
-    }
-
-    auto job = std::move(_ready_jobs.begin()->second);
-    _ready_jobs.erase(_ready_jobs.begin());
-
-    lock.unlock();
-
-    VERBOSE(ParallelExecutor) << "Assigning fn " << job->index() << std::endl;
-
-    auto job_index = job->index();
-    auto op_ind = _job_to_op[job_index];
-    const auto backend = _lowered_graph->lower_info().operation.at(op_ind);
-    auto setup = [&, op_ind, backend]() {
-      subject.notifyJobBegin(this, profiling_subg_index, op_ind, backend);
-    };
-    auto teardown = [&, job_index, op_ind, backend]() {
-      subject.notifyJobEnd(this, profiling_subg_index, op_ind, backend);
-      notify(job_index);
-    };
-
-    job->fn_seq()->initRunning();
-
-    // dynamic tensor setting
-    bool handle_dynamic_tensor =
-      _lowered_graph->getHasDynamicTensor(op_ind) || dynamic_input_exists;
-    job->fn_seq()->enableDynamicShapeInferer(handle_dynamic_tensor);
-
-    _scheduler->assign(std::make_unique<HookFunction>(job->fn_seq(), setup, teardown), backend);
-    _finished_jobs[job_index] = std::move(job);
-  }
-
-  assert(noWaitingJobs());
+  // Higher ranked jobs first. Later jobs are scheduled by workers as their inputs finish.
+  std::sort(initial_jobs.begin(), initial_jobs.end(),
+            [this](uint32_t lhs, uint32_t rhs) { return _job_ranks[lhs] > _job_ranks[rhs]; });
+  for (auto &&id : initial_jobs)
+    schedule(id);
 
   // Wait for all the jobs done
   _scheduler->finish();
-  subject.notifySubgraphEnd(profiling_subg_index);
+  assert(noWaitingJobs());
 
-  // Reset input info for the next execution
-  _input_info = _initial_input_info;
+  subject.notifySubgraphEnd(_profiling_subg_index);
+  _subject = nullptr;
 }
 
 } // namespace onert::exec
@@ -20,8 +20,10 @@
 #include "DataflowExecutor.h"
 #include "ParallelScheduler.h"
 
+#include "util/ThreadBudget.h"
 #include "util/TracingCtx.h"
 
+#include <atomic>
 #include <memory>
 
 namespace onert::exec
@@ -46,14 +48,28 @@ public:
   ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
                    backend::BackendContexts &&backend_contexts,
                    const compiler::TensorRegistries &tensor_regs, compiler::CodeMap &&code_map,
-                   const util::TracingCtx *tracing_ctx);
+                   const util::TracingCtx *tracing_ctx,
+                   const std::shared_ptr<util::ThreadBudget> &thread_budget = nullptr);
 
   void executeImpl(const ExecutionObservee &subject) override;
 
 private:
-  std::condition_variable _cv_jobs;
-  std::mutex _mu_jobs;
+  void schedule(uint32_t job_index);
+
+private:
   std::unique_ptr<ParallelScheduler> _scheduler;
+  /**
+   * @brief Number of unfinished input jobs of each job for current execution
+   *        Updated by worker threads without lock. A job is scheduled by the worker that
+   *        finishes its last input job.
+   */
+  std::unique_ptr<std::atomic<uint32_t>[]> _num_pending_inputs;
+  std::vector<int64_t> _job_ranks; // Rank of each job, to run higher ranked ready jobs first
+
+  // Context of current execution, used by worker threads to schedule jobs
+  const ExecutionObservee *_subject = nullptr;
+  std::pair<ir::ModelIndex, ir::SubgraphIndex> _profiling_subg_index;
+  bool _dynamic_input_exists = false;
 };
 
 } // namespace onert::exec
@@ -16,6 +16,9 @@
 
 #include "ParallelScheduler.h"
 
+#include "backend/Backend.h"
+
+#include <algorithm>
 #include <cassert>
 
 #include <memory>
@@ -24,29 +27,83 @@
 namespace onert::exec
 {
 
-ParallelScheduler::ParallelScheduler(const BackendSet &backends)
+/**
+ * @brief Pool job running functions of a lane until it has none
+ */
+class ParallelScheduler::LaneRunner : public IFunction
 {
-  assert(!backends.empty());
+public:
+  LaneRunner(Lane &lane) : _lane{lane} {}
 
-  for (auto &&backend : backends)
+public:
+  void run() override
   {
-    _thread_pools[backend] = std::make_unique<ThreadPool>();
+    do
+    {
+      std::unique_ptr<IFunction> fn;
+      {
+        std::lock_guard<std::mutex> lock{_lane.mu};
+        fn = std::move(_lane.functions.front());
+        _lane.functions.pop();
+      }
+      fn->run();
+    } while (--_lane.num_pending > 0);
   }
+
+private:
+  Lane &_lane;
+};
+
+uint32_t ParallelScheduler::numWorkers(const util::ThreadBudget *thread_budget)
+{
+  const auto num_threads =
+    thread_budget ? thread_budget->numThreads() : util::ThreadBudget::defaultNumThreads();
+  return static_cast<uint32_t>(std::max(num_threads, 1));
 }
 
-void ParallelScheduler::assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend)
+ParallelScheduler::ParallelScheduler(const BackendSet &backends, uint32_t num_workers,
+                                     util::ThreadBudget *thread_budget)
 {
-  assert(!_thread_pools.empty());
+  assert(!backends.empty());
+  assert(num_workers > 0);
+
+  for (auto &&backend : backends)
+  {
+    auto lane = std::make_unique<Lane>();
+    lane->concurrent = backend->config()->supportConcurrentKernels();
+    _lanes[backend] = std::move(lane);
+  }
 
-  _thread_pools.at(backend)->enqueue(std::move(fn));
+  // Kernels running on the workers take threads from their share of the budget, including the
+  // worker thread itself.
+  std::shared_ptr<util::ThreadPoolCounter> counter;
+  if (thread_budget)
+    counter = thread_budget->addPool("executor", num_workers);
+  _thread_pool = std::make_unique<ThreadPool>(num_workers, false, counter);
 }
 
-void ParallelScheduler::finish()
+void ParallelScheduler::assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend,
+                               bool exclusive)
 {
-  for (auto &&itr : _thread_pools)
+  assert(!_lanes.empty());
+
+  auto &lane = *_lanes.at(backend);
+  if (lane.concurrent && !exclusive)
   {
-    itr.second->finish();
+    _thread_pool->enqueue(std::move(fn));
+    return;
   }
+
+  {
+    std::lock_guard<std::mutex> lock{lane.mu};
+    lane.functions.emplace(std::move(fn));
+  }
+
+  // Start a runner if the lane was idle. Otherwise the running one picks it up.
+  if (lane.num_pending++ == 0)
+    _thread_pool->enqueue(std::make_unique<LaneRunner>(lane));
 }
 
+void ParallelScheduler::finish() { _thread_pool->wait(); }
+
 } // namespace onert::exec
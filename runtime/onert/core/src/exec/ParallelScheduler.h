@@ -17,39 +17,79 @@
 #ifndef __ONERT_EXEC_PARALLEL_SCHEDULER_H__
 #define __ONERT_EXEC_PARALLEL_SCHEDULER_H__
 
-#include <unordered_map>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <queue>
+#include <unordered_map>
 
 #include "exec/IFunction.h"
 #include "BackendSet.h"
 #include "ThreadPool.h"
+#include "util/ThreadBudget.h"
 
 namespace onert::exec
 {
 
+/**
+ * @brief Scheduler running functions of all backends on one work-stealing ThreadPool
+ *
+ * Assigned functions run on any of the workers, so independent functions run in parallel even
+ * when they are of the same backend. Functions of a backend not supporting concurrent kernels,
+ * and exclusive ones, run one at a time in assigned order with the other such functions of
+ * their backend, as they may share non-thread-safe contexts.
+ */
 class ParallelScheduler
 {
 public:
+  /**
+   * @brief Get number of worker threads of a scheduler
+   *
+   * @param thread_budget Thread budget the scheduler takes its threads from, or null
+   * @return Number of threads of the budget, or of physical cores if thread_budget is null
+   */
+  static uint32_t numWorkers(const util::ThreadBudget *thread_budget);
+
   /**
    * @brief Constructs ParallelScheduler object
    *
-   * @param backends Backend set
+   * @param backends      Backend set
+   * @param num_workers   Number of worker threads
+   * @param thread_budget Thread budget to count usage of the pool on, if not null
    */
-  ParallelScheduler(const BackendSet &backends);
+  ParallelScheduler(const BackendSet &backends, uint32_t num_workers,
+                    util::ThreadBudget *thread_budget = nullptr);
   /**
    * @brief Assign a task to the given backend
    *
-   * @param[in] fn Function to be assigned
-   * @param[in] fn Target backend
+   * @param[in] fn        Function to be assigned
+   * @param[in] backend   Target backend
+   * @param[in] exclusive Run one at a time with other exclusive functions of the backend even if
+   *                      it supports concurrent kernels
    */
-  void assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend);
+  void assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend,
+              bool exclusive = false);
   /**
-   * @brief Block until all jobs are finished
+   * @brief Block until all jobs are finished. Threads are kept for later jobs.
    */
   void finish();
 
 private:
-  std::unordered_map<const backend::Backend *, std::unique_ptr<ThreadPool>> _thread_pools;
+  /**
+   * @brief Functions of a backend which run one at a time, drained by one pool job at a time
+   */
+  struct Lane
+  {
+    std::mutex mu;
+    std::queue<std::unique_ptr<IFunction>> functions;
+    std::atomic<uint32_t> num_pending{0};
+    bool concurrent = false; // Whether the backend supports concurrent kernels
+  };
+  class LaneRunner;
+
+private:
+  std::unordered_map<const backend::Backend *, std::unique_ptr<Lane>> _lanes;
+  std::unique_ptr<ThreadPool> _thread_pool;
 };
 
 } // namespace onert::exec
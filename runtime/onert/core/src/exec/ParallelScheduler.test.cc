@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ParallelScheduler.h"
+
+#include "backend/Backend.h"
+#include "backend/BackendContext.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <initializer_list>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using namespace onert;
+using namespace onert::exec;
+
+struct MockConfig : public backend::IConfig
+{
+  MockConfig(bool concurrent) : _concurrent{concurrent} {}
+
+  std::string id() override { return "mock"; }
+  bool initialize() override { return true; };
+  bool supportPermutation() override { return false; }
+  bool supportDynamicTensor() override { return false; }
+  bool supportFP16() override { return false; }
+  bool supportConcurrentKernels() override { return _concurrent; }
+
+private:
+  bool _concurrent;
+};
+
+struct MockBackend : public backend::Backend
+{
+  MockBackend(bool concurrent) : _concurrent{concurrent} {}
+
+  std::shared_ptr<backend::IConfig> config() const override
+  {
+    return std::make_shared<MockConfig>(_concurrent);
+  }
+  std::unique_ptr<backend::BackendContext> newContext(backend::ContextData &&) const override
+  {
+    return nullptr;
+  }
+
+private:
+  bool _concurrent;
+};
+
+class LambdaFunction : public IFunction
+{
+public:
+  LambdaFunction(std::function<void()> fn) : _fn{std::move(fn)} {}
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+std::unique_ptr<IFunction> makeFunction(std::function<void()> fn)
+{
+  return std::make_unique<LambdaFunction>(std::move(fn));
+}
+
+BackendSet makeBackendSet(std::initializer_list<const backend::Backend *> backends)
+{
+  BackendSet set;
+  for (auto &&backend : backends)
+    set.add(backend);
+  return set;
+}
+
+/**
+ * @brief Number of functions running at once, and the largest number seen
+ */
+struct Overlap
+{
+  std::atomic<int> running{0};
+  std::atomic<int> max_running{0};
+
+  void run(std::chrono::milliseconds duration)
+  {
+    const int now = ++running;
+    int max = max_running;
+    while (now > max && !max_running.compare_exchange_weak(max, now))
+      ;
+    std::this_thread::sleep_for(duration);
+    --running;
+  }
+};
+
+} // namespace
+
+TEST(ExecParallelScheduler, RunSameBackendConcurrently)
+{
+  MockBackend backend{true};
+  ParallelScheduler scheduler{makeBackendSet({&backend}), 4};
+
+  // Each function waits for all of them to start, which needs a worker for each
+  std::atomic<int> started{0};
+  std::atomic<int> met{0};
+  for (int i = 0; i < 4; ++i)
+  {
+    scheduler.assign(makeFunction([&] {
+                       ++started;
+                       const auto deadline =
+                         std::chrono::steady_clock::now() + std::chrono::seconds(10);
+                       while (started < 4 && std::chrono::steady_clock::now() < deadline)
+                         std::this_thread::yield();
+                       if (started == 4)
+                         ++met;
+                     }),
+                     &backend);
+  }
+  scheduler.finish();
+
+  ASSERT_EQ(met, 4);
+}
+
+TEST(ExecParallelScheduler, RunNonConcurrentBackendInOrder)
+{
+  MockBackend serial{false};
+  MockBackend concurrent{true};
+  ParallelScheduler scheduler{makeBackendSet({&serial, &concurrent}), 4};
+
+  // Functions of a backend not supporting concurrent kernels, and exclusive ones
+  for (const auto &[backend, exclusive] :
+       {std::make_pair(&serial, false), std::make_pair(&concurrent, true)})
+  {
+    Overlap overlap;
+    std::vector<int> order;
+    for (int i = 0; i < 8; ++i)
+    {
+      scheduler.assign(makeFunction([&, i] {
+                         overlap.run(std::chrono::milliseconds(2));
+                         order.push_back(i);
+                       }),
+                       backend, exclusive);
+    }
+    scheduler.finish();
+
+    ASSERT_EQ(overlap.max_running, 1);
+    ASSERT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}));
+  }
+}
+
+TEST(ExecParallelScheduler, ReuseWorkers)
+{
+  MockBackend backend{true};
+  ParallelScheduler scheduler{makeBackendSet({&backend}), 2};
+  std::atomic<int> count{0};
+
+  for (int run = 1; run <= 3; ++run)
+  {
+    for (int i = 0; i < 100; ++i)
+      scheduler.assign(makeFunction([&] { ++count; }), &backend);
+    scheduler.finish();
+    ASSERT_EQ(count, run * 100);
+  }
+}
@@ -0,0 +1,422 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/PipelineExecution.h"
+
+#include "EdgeTensor.h"
+#include "MultiModelExecutors.h"
+#include "../backend/builtin/IOTensor.h"
+#include "../backend/builtin/UserTensor.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <unordered_map>
+
+namespace
+{
+
+using namespace onert;
+
+double elapsedMs(std::chrono::steady_clock::time_point begin,
+                 std::chrono::steady_clock::time_point end)
+{
+  return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+} // namespace
+
+namespace onert::exec
+{
+
+/**
+ * @brief Bounded FIFO of frames between two stages
+ */
+class PipelineExecution::Queue
+{
+public:
+  Queue(size_t capacity) : _capacity{capacity} {}
+
+  // Return false if the queue is closed or aborted
+  bool push(std::unique_ptr<Frame> frame)
+  {
+    std::unique_lock<std::mutex> lock{_mutex};
+    _cv.wait(lock, [&] { return _closed || _aborted || _frames.size() < _capacity; });
+    if (_closed || _aborted)
+      return false;
+
+    _frames.emplace_back(std::move(frame));
+    _cv.notify_all();
+    return true;
+  }
+
+  // Return nullptr if the queue is closed and empty, or aborted
+  std::unique_ptr<Frame> pop()
+  {
+    std::unique_lock<std::mutex> lock{_mutex};
+    _cv.wait(lock, [&] { return _closed || _aborted || !_frames.empty(); });
+    if (_aborted || _frames.empty())
+      return nullptr;
+
+    auto frame = std::move(_frames.front());
+    _frames.pop_front();
+    _cv.notify_all();
+    return frame;
+  }
+
+  // Frames pushed already can still be popped
+  void close()
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _closed = true;
+    _cv.notify_all();
+  }
+
+  // Frames pushed already are dropped
+  void abort()
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _aborted = true;
+    _frames.clear();
+    _cv.notify_all();
+  }
+
+private:
+  const size_t _capacity;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::deque<std::unique_ptr<Frame>> _frames;
+  bool _closed = false;
+  bool _aborted = false;
+};
+
+/**
+ * @brief Tensors of one inference, which are passed from stage to stage
+ */
+struct PipelineExecution::Frame
+{
+  ~Frame()
+  {
+    for (auto &&buffer : outputs)
+      free(buffer);
+  }
+
+  // nnpackage inputs and edges between models, keyed by IODesc of nnpackage input and `from`
+  std::unordered_map<ir::IODesc, std::unique_ptr<EdgeTensor>> tensors;
+
+  // Buffers of nnpackage outputs, which are handed over to user by popOutput()
+  std::vector<void *> outputs;
+  std::vector<std::unique_ptr<backend::builtin::UserTensor>> output_tensors;
+};
+
+/**
+ * @brief Model run by a thread, with keys of frame tensors for its inputs and outputs
+ */
+struct PipelineExecution::Stage
+{
+  uint32_t index = 0;
+  IExecutor *executor = nullptr;
+
+  std::vector<ir::IODesc> inputs;
+  std::vector<ir::IODesc> outputs;
+  // Index of nnpackage output, or -1 if output is not nnpackage output
+  std::vector<int32_t> pkg_outputs;
+  // Number of models reading output
+  std::vector<uint32_t> consumers;
+  // Whether output is kept in backend tensor, which should be copied to frame
+  std::vector<bool> internal_outputs;
+};
+
+PipelineExecution::PipelineExecution(const std::shared_ptr<IExecutors> &executors,
+                                     uint32_t queue_size)
+  : _executors{executors}
+{
+  const auto multi_model = std::dynamic_pointer_cast<MultiModelExecutors>(executors);
+  if (multi_model == nullptr)
+    throw std::runtime_error{"Pipeline execution needs nnpackage of multiple models"};
+  if (queue_size == 0)
+    throw std::runtime_error{"Pipeline execution needs queue size greater than 0"};
+
+  multi_model->checkSupportedMultimodel();
+  const auto &model_edges = multi_model->modelEdges();
+  const auto &pkg_inputs = model_edges.pkg_inputs;
+  const auto &pkg_outputs = model_edges.pkg_outputs;
+
+  // Models are run in model index order, as `from` of edge always has lower model index
+  for (uint16_t m = 0; m < multi_model->modelCount(); ++m)
+  {
+    const auto model_index = ir::ModelIndex{m};
+    auto stage = std::make_unique<Stage>();
+    stage->index = m;
+    stage->executor = multi_model->at(model_index, ir::SubgraphIndex{0});
+
+    for (uint32_t i = 0; i < stage->executor->inputSize(); ++i)
+    {
+      const auto desc = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
+      if (stage->executor->inputInfo(i).isDynamic())
+        throw std::runtime_error{"NYI: Pipeline execution of models with dynamic input"};
+
+      if (std::find(pkg_inputs.begin(), pkg_inputs.end(), desc) != pkg_inputs.end())
+      {
+        stage->inputs.emplace_back(desc);
+        continue;
+      }
+
+      auto edge = std::find_if(model_edges.edges.begin(), model_edges.edges.end(),
+                               [&](const ir::ModelEdge &edge) { return edge.to == desc; });
+      if (edge == model_edges.edges.end())
+        throw std::runtime_error{"Cannot find edge for model input"};
+      stage->inputs.emplace_back(edge->from);
+    }
+
+    for (uint32_t i = 0; i < stage->executor->outputSize(); ++i)
+    {
+      const auto desc = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
+      if (stage->executor->outputInfo(i).isDynamic())
+        throw std::runtime_error{"NYI: Pipeline execution of models with dynamic output"};
+
+      const auto pkg_output = std::find(pkg_outputs.begin(), pkg_outputs.end(), desc);
+      const auto io_tensor =
+        dynamic_cast<const backend::builtin::IOTensor *>(stage->executor->outputTensor(i));
+      if (!io_tensor)
+        throw std::runtime_error{"Output tensor must be IOTensor"};
+
+      stage->outputs.emplace_back(desc);
+      stage->pkg_outputs.emplace_back(
+        pkg_output == pkg_outputs.end() ? -1 : std::distance(pkg_outputs.begin(), pkg_output));
+      stage->consumers.emplace_back(
+        std::count_if(model_edges.edges.begin(), model_edges.edges.end(),
+                      [&](const ir::ModelEdge &edge) { return edge.from == desc; }));
+      stage->internal_outputs.emplace_back(io_tensor->hasBackendTensor());
+    }
+
+    _stages.emplace_back(std::move(stage));
+  }
+
+  ExecutionOptions::fromGlobalConfig(_options);
+
+  for (size_t i = 0; i <= _stages.size(); ++i)
+    _queues.emplace_back(std::make_unique<Queue>(queue_size));
+  _stats.stages.resize(_stages.size());
+
+  for (auto &&stage : _stages)
+    _threads.emplace_back([this, stage = stage.get()] { runStage(*stage); });
+}
+
+PipelineExecution::~PipelineExecution()
+{
+  abort(nullptr);
+  join();
+}
+
+uint32_t PipelineExecution::inputSize() const { return _executors->inputSize(); }
+
+uint32_t PipelineExecution::outputSize() const { return _executors->outputSize(); }
+
+void PipelineExecution::pushInput(const std::vector<const void *> &buffers,
+                                  const std::vector<size_t> &lengths)
+{
+  if (buffers.size() != inputSize() || lengths.size() != inputSize())
+    throw std::runtime_error{"Pipeline input count mismatch"};
+
+  const auto &pkg_inputs =
+    std::static_pointer_cast<MultiModelExecutors>(_executors)->modelEdges().pkg_inputs;
+
+  auto frame = std::make_unique<Frame>();
+  for (uint32_t i = 0; i < inputSize(); ++i)
+  {
+    const auto &info = _executors->inputInfo(ir::IOIndex{i});
+    if (lengths[i] < info.total_size())
+      throw std::runtime_error{"Too small length of input " + std::to_string(i)};
+
+    auto tensor = std::make_unique<EdgeTensor>(info);
+    tensor->allocate_buffer();
+    memcpy(tensor->buffer(), buffers[i], info.total_size());
+    frame->tensors.emplace(pkg_inputs[i], std::move(tensor));
+  }
+  frame->outputs.resize(outputSize(), nullptr);
+  frame->output_tensors.resize(outputSize());
+
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (_stats.pushed_frames == 0)
+      _start_time = std::chrono::steady_clock::now();
+    _stats.pushed_frames++;
+  }
+
+  if (!_queues.front()->push(std::move(frame)))
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (_error)
+      std::rethrow_exception(_error);
+    throw std::runtime_error{"Pipeline input is pushed after finish"};
+  }
+}
+
+void PipelineExecution::finish() { _queues.front()->close(); }
+
+bool PipelineExecution::popOutput(std::vector<void *> &buffers)
+{
+  auto frame = _queues.back()->pop();
+  if (!frame)
+  {
+    join();
+
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (_error)
+      std::rethrow_exception(_error);
+
+    VERBOSE(PipelineExecution) << _stats.popped_frames << " frames in " << _stats.elapsed_ms
+                               << " ms (" << _stats.frames_per_second << " fps)" << std::endl;
+    for (size_t i = 0; i < _stats.stages.size(); ++i)
+    {
+      const auto &stage = _stats.stages[i];
+      VERBOSE(PipelineExecution) << "Stage " << i << ": busy " << stage.busy_ms
+                                 << " ms, waiting input " << stage.input_wait_ms
+                                 << " ms, waiting output " << stage.output_wait_ms << " ms"
+                                 << std::endl;
+    }
+    return false;
+  }
+
+  buffers = std::move(frame->outputs);
+  frame->outputs.clear();
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  _stats.popped_frames++;
+  _stats.elapsed_ms = elapsedMs(_start_time, std::chrono::steady_clock::now());
+  _stats.frames_per_second = _stats.popped_frames * 1000.0 / _stats.elapsed_ms;
+  return true;
+}
+
+PipelineExecution::Stats PipelineExecution::stats() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _stats;
+}
+
+void PipelineExecution::runStage(Stage &stage)
+{
+  auto &input_queue = *_queues.at(stage.index);
+  auto &output_queue = *_queues.at(stage.index + 1);
+  auto executor = stage.executor;
+
+  std::vector<backend::IPortableTensor *> inputs(stage.inputs.size());
+  std::vector<backend::IPortableTensor *> outputs(stage.outputs.size());
+
+  try
+  {
+    while (true)
+    {
+      const auto wait_begin = std::chrono::steady_clock::now();
+      auto frame = input_queue.pop();
+      const auto run_begin = std::chrono::steady_clock::now();
+      if (!frame)
+        break;
+
+      for (size_t i = 0; i < inputs.size(); ++i)
+        inputs[i] = frame->tensors.at(stage.inputs[i]).get();
+
+      for (uint32_t i = 0; i < outputs.size(); ++i)
+      {
+        const auto &info = executor->outputInfo(i);
+        const auto pkg_output = stage.pkg_outputs[i];
+        if (pkg_output != -1)
+        {
+          const auto size = info.total_size();
+          auto buffer = malloc(std::max<size_t>(size, 1));
+          if (buffer == nullptr)
+            throw std::bad_alloc{};
+          frame->outputs[pkg_output] = buffer;
+          frame->output_tensors[pkg_output] = std::make_unique<backend::builtin::UserTensor>(
+            info, static_cast<uint8_t *>(buffer), size);
+          outputs[i] = frame->output_tensors[pkg_output].get();
+        }
+        else
+        {
+          // Buffer is released when all models reading it are run
+          auto tensor = std::make_unique<EdgeTensor>(info);
+          tensor->allocate_buffer();
+          for (uint32_t c = 1; c < stage.consumers[i]; ++c)
+            tensor->increase_ref();
+          outputs[i] = tensor.get();
+          frame->tensors[stage.outputs[i]] = std::move(tensor);
+        }
+      }
+
+      executor->execute(inputs, outputs, _options);
+
+      for (uint32_t i = 0; i < outputs.size(); ++i)
+      {
+        if (stage.internal_outputs[i])
+          memcpy(outputs[i]->buffer(), executor->outputBuffer(i), outputs[i]->total_size());
+        if (stage.pkg_outputs[i] == -1 && stage.consumers[i] == 0)
+          frame->tensors.erase(stage.outputs[i]);
+      }
+
+      for (const auto &input : stage.inputs)
+        frame->tensors.at(input)->decrease_ref();
+
+      const auto run_end = std::chrono::steady_clock::now();
+      const bool pushed = output_queue.push(std::move(frame));
+      const auto push_end = std::chrono::steady_clock::now();
+
+      {
+        std::lock_guard<std::mutex> lock{_mutex};
+        auto &stats = _stats.stages[stage.index];
+        stats.frames++;
+        stats.input_wait_ms += elapsedMs(wait_begin, run_begin);
+        stats.busy_ms += elapsedMs(run_begin, run_end);
+        stats.output_wait_ms += elapsedMs(run_end, push_end);
+      }
+
+      if (!pushed)
+        break;
+    }
+
+    output_queue.close();
+  }
+  catch (...)
+  {
+    abort(std::current_exception());
+  }
+}
+
+void PipelineExecution::abort(std::exception_ptr error)
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (error && !_error)
+      _error = error;
+  }
+
+  for (auto &&queue : _queues)
+    queue->abort();
+}
+
+void PipelineExecution::join()
+{
+  for (auto &&thread : _threads)
+  {
+    if (thread.joinable())
+      thread.join();
+  }
+}
+
+} // namespace onert::exec
@@ -17,35 +17,146 @@
 #include "ThreadPool.h"
 
 #include <cassert>
+#include <chrono>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
 
 namespace onert::exec
 {
 
-ThreadPool::ThreadPool(uint32_t num_threads)
+namespace
+{
+
+// Worker of the running thread, to keep jobs enqueued by a job on the same worker
+thread_local const ThreadPool *current_pool = nullptr;
+thread_local uint32_t current_worker = 0;
+
+} // namespace
+
+ThreadPool::ThreadPool(uint32_t num_threads, bool pin_threads,
+                       std::shared_ptr<util::ThreadPoolCounter> counter)
+  : _counter{std::move(counter)}
 {
   assert(num_threads >= 1);
 
   for (uint32_t i = 0; i < num_threads; i++)
-  {
-    _threads.emplace_back(std::ref(_worker));
-  }
+    _queues.emplace_back(std::make_unique<WorkQueue>());
+
+  for (uint32_t i = 0; i < num_threads; i++)
+    _threads.emplace_back(&ThreadPool::worker, this, i, pin_threads);
 }
 
 ThreadPool::~ThreadPool()
 {
   if (!_threads.empty())
   {
-    _worker.terminate();
+    assert(_num_queued == 0 && "Terminating with unfinished jobs");
     join();
   }
 }
 
-void ThreadPool::enqueue(std::unique_ptr<IFunction> &&fn) { _worker.enqueue(std::move(fn)); }
+void ThreadPool::enqueue(std::unique_ptr<IFunction> &&fn)
+{
+  ++_num_unfinished;
+
+  const uint32_t target =
+    (current_pool == this) ? current_worker : _next_queue.fetch_add(1) % _queues.size();
+  _queues[target]->push(std::move(fn));
+  ++_num_queued;
 
-uint32_t ThreadPool::numJobsInQueue() { return _worker.numJobsInQueue(); }
+  if (_num_sleeping > 0)
+  {
+    // Lock to not notify between a sleeper's check and its wait
+    {
+      std::lock_guard<std::mutex> lock{_mu};
+    }
+    _cv_work.notify_one();
+  }
+}
+
+uint32_t ThreadPool::numJobsInQueue() { return _num_queued; }
+
+void ThreadPool::worker(uint32_t index, bool pin)
+{
+  current_pool = this;
+  current_worker = index;
+
+#ifdef __linux__
+  if (pin)
+  {
+    const auto num_cores = std::thread::hardware_concurrency();
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(index % (num_cores > 0 ? num_cores : 1), &cpu_set);
+    // Best effort. Placement may be restricted, e.g. by cgroups.
+    sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+  }
+#else
+  (void)pin;
+#endif
+
+  while (true)
+  {
+    auto fn = take(index);
+    if (fn)
+    {
+      if (_counter && _counter->timed())
+      {
+        const auto begin = std::chrono::steady_clock::now();
+        fn->run();
+        _counter->record(std::chrono::steady_clock::now() - begin);
+      }
+      else
+      {
+        fn->run();
+      }
+      if (--_num_unfinished == 0)
+      {
+        {
+          std::lock_guard<std::mutex> lock{_mu};
+        }
+        _cv_done.notify_all();
+      }
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock{_mu};
+    ++_num_sleeping;
+    _cv_work.wait(lock, [this] { return _num_queued > 0 || _stop; });
+    --_num_sleeping;
+    if (_stop)
+      return;
+  }
+}
+
+std::unique_ptr<IFunction> ThreadPool::take(uint32_t index)
+{
+  const uint32_t n = _queues.size();
+  auto fn = _queues[index]->pop();
+  for (uint32_t i = 1; fn == nullptr && i < n; ++i)
+    fn = _queues[(index + i) % n]->steal();
+
+  if (fn)
+    --_num_queued;
+  return fn;
+}
+
+void ThreadPool::wait()
+{
+  std::unique_lock<std::mutex> lock{_mu};
+  _cv_done.wait(lock, [this] { return _num_unfinished == 0; });
+}
 
 void ThreadPool::join()
 {
+  {
+    std::lock_guard<std::mutex> lock{_mu};
+    _stop = true;
+  }
+  _cv_work.notify_all();
+
   for (auto &&thread : _threads)
   {
     thread.join();
@@ -55,7 +166,7 @@ void ThreadPool::join()
 
 void ThreadPool::finish()
 {
-  _worker.finish();
+  wait();
   join();
 }
 
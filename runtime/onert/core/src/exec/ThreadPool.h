@@ -17,15 +17,26 @@
 #ifndef __ONERT_EXEC_THREAD_POOL_H__
 #define __ONERT_EXEC_THREAD_POOL_H__
 
-#include <thread>
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "WorkQueue.h"
+#include "util/ThreadBudget.h"
 
 namespace onert::exec
 {
 
+/**
+ * @brief Work-stealing thread pool
+ *
+ * Each worker has its own WorkQueue. A function enqueued from a worker goes to that worker's
+ * queue, and one enqueued from outside is distributed round-robin. An idle worker runs jobs
+ * of its own queue first, then steals from the others, and sleeps only when all are empty.
+ */
 class ThreadPool
 {
 public:
@@ -33,8 +44,11 @@ public:
    * @brief Coustruct ThreadPool object
    *
    * @param num_threads Number of threads
+   * @param pin_threads Pin worker i to core (i % number of cores) if true
+   * @param counter     Counter to record running time of jobs on while it is timed, if not null
    */
-  ThreadPool(uint32_t num_threads = 1);
+  ThreadPool(uint32_t num_threads = 1, bool pin_threads = false,
+             std::shared_ptr<util::ThreadPoolCounter> counter = nullptr);
   /**
    * @brief Destroy ThreadPool object
    */
@@ -51,6 +65,18 @@ public:
    * @return Number of jobs
    */
   uint32_t numJobsInQueue();
+  /**
+   * @brief Get number of worker threads
+   *
+   * @return Number of threads
+   */
+  uint32_t numThreads() const { return _queues.size(); }
+
+  /**
+   * @brief Block until all jobs are finished, including jobs enqueued by running jobs.
+   *        Workers stay alive for later jobs.
+   */
+  void wait();
 
   /**
    * @brief Block until all jobs are finished
@@ -58,11 +84,25 @@ public:
   void finish();
 
 private:
+  void worker(uint32_t index, bool pin);
+  std::unique_ptr<IFunction> take(uint32_t index);
   void join();
 
 private:
-  WorkQueue _worker;
+  std::vector<std::unique_ptr<WorkQueue>> _queues;
   std::vector<std::thread> _threads;
+
+  std::atomic<uint32_t> _num_queued{0};     // Jobs in queues
+  std::atomic<uint32_t> _num_unfinished{0}; // Jobs enqueued but not finished
+  std::atomic<uint32_t> _num_sleeping{0};
+  std::atomic<uint32_t> _next_queue{0};
+  std::atomic<bool> _stop{false};
+
+  std::shared_ptr<util::ThreadPoolCounter> _counter;
+
+  std::mutex _mu;
+  std::condition_variable _cv_work;
+  std::condition_variable _cv_done;
 };
 
 } // namespace onert::exec
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <functional>
+
+namespace
+{
+
+using namespace onert::exec;
+
+class LambdaFunction : public IFunction
+{
+public:
+  LambdaFunction(std::function<void()> fn) : _fn{std::move(fn)} {}
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+std::unique_ptr<IFunction> makeFunction(std::function<void()> fn)
+{
+  return std::make_unique<LambdaFunction>(std::move(fn));
+}
+
+} // namespace
+
+TEST(ExecThreadPool, RunAllJobs)
+{
+  ThreadPool pool{4};
+  std::atomic<int> count{0};
+
+  for (int i = 0; i < 1000; ++i)
+    pool.enqueue(makeFunction([&] { ++count; }));
+  pool.finish();
+
+  ASSERT_EQ(count, 1000);
+  ASSERT_EQ(pool.numJobsInQueue(), 0u);
+}
+
+TEST(ExecThreadPool, WaitForJobsEnqueuedByJobs)
+{
+  ThreadPool pool{3};
+  std::atomic<int> count{0};
+
+  // Binary tree of jobs: each job enqueues two children until depth 10
+  std::function<void(int)> spawn = [&](int depth) {
+    ++count;
+    if (depth == 0)
+      return;
+    pool.enqueue(makeFunction([&, depth] { spawn(depth - 1); }));
+    pool.enqueue(makeFunction([&, depth] { spawn(depth - 1); }));
+  };
+
+  // Workers are reused across waits
+  for (int run = 1; run <= 3; ++run)
+  {
+    pool.enqueue(makeFunction([&] { spawn(10); }));
+    pool.wait();
+    ASSERT_EQ(count, run * ((1 << 11) - 1));
+  }
+
+  pool.finish();
+}
+
+TEST(ExecThreadPool, PinnedThreads)
+{
+  ThreadPool pool{2, /*pin_threads=*/true};
+  std::atomic<int> count{0};
+
+  for (int i = 0; i < 100; ++i)
+    pool.enqueue(makeFunction([&] { ++count; }));
+  pool.finish();
+
+  ASSERT_EQ(pool.numThreads(), 2u);
+  ASSERT_EQ(count, 100);
+}
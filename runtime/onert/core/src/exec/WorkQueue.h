@@ -17,66 +17,53 @@
 #ifndef __ONERT_EXEC_WORK_QUEUE_H__
 #define __ONERT_EXEC_WORK_QUEUE_H__
 
-#include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
-#include <queue>
 
 #include "exec/IFunction.h"
 
 namespace onert::exec
 {
 
+/**
+ * @brief Job queue owned by one ThreadPool worker
+ *
+ * The owner pushes and pops jobs at the back, so that a job readied by the job it just ran
+ * runs next on the same core while its inputs are still in cache. Other workers steal from
+ * the front. Each queue has its own lock, so workers only contend when stealing.
+ */
 class WorkQueue
 {
 public:
-  enum class State
-  {
-    ONLINE,
-    FINISHING,
-    FORCE_FINISHING
-  };
-
-public:
-  /**
-   * @brief Create WorkQueue object
-   */
-  WorkQueue() = default;
   /**
-   * @brief Destroy WorkQueue object
-   */
-  ~WorkQueue();
-  /**
-   * @brief Thread entry function
-   */
-  void operator()();
-  /**
-   * @brief Push the given Task to the job queue
+   * @brief Push the given function at the back
    *
    * @param fn Function to be executed(a job)
    */
-  void enqueue(std::unique_ptr<IFunction> &&fn);
+  void push(std::unique_ptr<IFunction> &&fn);
   /**
-   * @brief Flag as terminating so all the worker threads can terminate
+   * @brief Pop the most recently pushed function, for the owner worker
+   *
+   * @return Function, or nullptr if the queue is empty
    */
-  void terminate();
+  std::unique_ptr<IFunction> pop();
   /**
-   * @brief Flag as terminating so all the worker threads can terminate
+   * @brief Pop the least recently pushed function, for other workers
+   *
+   * @return Function, or nullptr if the queue is empty
    */
-  void finish();
+  std::unique_ptr<IFunction> steal();
   /**
-   * @brief Check if it has pending jobs. Even if this returns fals, WorkQueue threads may be still
-   * running
+   * @brief Get number of jobs in the queue
    *
-   * @return true if the job queue not empty otherwise false
+   * @return Number of jobs
    */
   uint32_t numJobsInQueue();
 
 private:
-  State _state{State::ONLINE};
-  std::queue<std::unique_ptr<IFunction>> _functions;
+  std::deque<std::unique_ptr<IFunction>> _functions;
   std::mutex _mu;
-  std::condition_variable _cv;
 };
 
 } // namespace onert::exec
@@ -47,6 +47,11 @@ void TrainableFnSequence::append(std::unique_ptr<ITrainableFunction> &&function)
   _functions.push_back(std::move(function));
 }
 
+void TrainableFnSequence::prepend(std::unique_ptr<ITrainableFunction> &&function)
+{
+  _functions.insert(_functions.begin(), std::move(function));
+}
+
 void TrainableFnSequence::append(std::unique_ptr<IGradientApplier> &&applier)
 {
   _appliers.push_back(std::move(applier));
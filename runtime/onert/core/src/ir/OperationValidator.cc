@@ -115,10 +115,11 @@ void OperationValidator::visit(const operation::Attention &node)
   const auto input_idx = node.getInputs().at(operation::Attention::Input::INPUT);
   const auto &input_shape = _operands.at(input_idx).shape();
 
-  // Check if input's seq_len is 1
   // Assuming input shape is [batch_size, seq_len, embedding_dim]
+  // Each batch is a sequence with its own KV cache, decoding seq_len tokens
   OP_REQUIRES(input_shape.rank() == 3);
-  OP_REQUIRES(input_shape.dim(1) == 1);
+  const auto batch_size = input_shape.dim(0);
+  const auto seq_len = input_shape.dim(1);
 
   const auto cos_idx = node.getInputs().at(operation::Attention::Input::COS);
   const auto sin_idx = node.getInputs().at(operation::Attention::Input::SIN);
@@ -126,23 +127,23 @@ void OperationValidator::visit(const operation::Attention &node)
   const auto &sin_shape = _operands.at(sin_idx).shape();
 
   // Check _cos and _sin shapes
-  // Assuming shape is [batch_size, seq_len, d_head]
-  // batch_size = 1, seq_len = 1
+  // Assuming shape is [batch_size, seq_len, d_head], one row per token
   OP_REQUIRES(cos_shape.rank() == 3);
-  OP_REQUIRES(cos_shape.dim(0) == 1); // batch_size
-  OP_REQUIRES(cos_shape.dim(1) == 1); // seq_len
+  OP_REQUIRES(cos_shape.dim(0) == batch_size);
+  OP_REQUIRES(cos_shape.dim(1) == seq_len);
 
   OP_REQUIRES(sin_shape.rank() == 3);
-  OP_REQUIRES(sin_shape.dim(0) == 1); // batch_size
-  OP_REQUIRES(sin_shape.dim(1) == 1); // seq_len
+  OP_REQUIRES(sin_shape.dim(0) == batch_size);
+  OP_REQUIRES(sin_shape.dim(1) == seq_len);
 
   const auto pos_idx = node.getInputs().at(operation::Attention::Input::POS);
   const auto &pos_shape = _operands.at(pos_idx).shape();
 
   // Check pos tensor type and shape
+  // One position shared by all batches, or one position per batch
   OP_REQUIRES(isValidType(pos_idx, DataType::INT64));
   OP_REQUIRES(pos_shape.rank() == 1);
-  OP_REQUIRES(pos_shape.dim(0) == 1);
+  OP_REQUIRES(pos_shape.dim(0) == 1 || pos_shape.dim(0) == batch_size);
 }
 
 void OperationValidator::visit(const operation::BatchMatMul &node)
@@ -156,6 +156,20 @@ template <typename EventT> void EventCollector::onEvent(const EventT &event)
 #endif
 }
 
+void EventCollector::onCounter(const onert::util::TracingCtx *tracing_ctx,
+                               const std::string &name, uint64_t value)
+{
+  CounterEvent evt;
+
+  evt.tracing_ctx = tracing_ctx;
+  evt.name = name;
+  evt.ph = "C";
+  evt.ts = timestamp();
+  evt.values["value"] = std::to_string(value);
+
+  _rec->emit(evt);
+}
+
 // template instantiation
 template void EventCollector::onEvent<EventCollector::SubgEvent>(const SubgEvent &event);
 template void EventCollector::onEvent<EventCollector::OpSeqEvent>(const OpSeqEvent &event);
@@ -111,6 +111,8 @@ public:
 
 public:
   template <typename EventT> void onEvent(const EventT &event);
+  void onCounter(const onert::util::TracingCtx *tracing_ctx, const std::string &name,
+                 uint64_t value);
 
 protected:
   EventRecorder *_rec;
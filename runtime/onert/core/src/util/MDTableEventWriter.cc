@@ -202,7 +202,8 @@ struct MDTableBuilder
     {
       uint64_t ts = std::stoull(evt.ts);
       auto &name = evt.name;
-      assert(name.compare("maxrss") == 0 || name.compare("minflt") == 0);
+      if (name.compare("maxrss") != 0 && name.compare("minflt") != 0)
+        continue;
       assert(evt.values.size() == 1);
       auto &val = evt.values.begin()->second;
       if (_ts_to_values.find(ts) == _ts_to_values.end())
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ThreadBudget.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <thread>
+#include <unordered_set>
+
+namespace
+{
+
+int32_t countPhysicalCores()
+{
+#ifdef __linux__
+  // Count physical cores, not threads by checking thread_siblings.
+  std::unordered_set<std::string> siblings;
+  for (uint32_t cpu = 0; cpu < UINT32_MAX; ++cpu)
+  {
+    std::ifstream thread_siblings("/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+                                  "/topology/thread_siblings");
+    if (!thread_siblings.is_open())
+    {
+      break;
+    }
+
+    std::string line;
+    if (std::getline(thread_siblings, line))
+    {
+      siblings.insert(line);
+    }
+  }
+  if (!siblings.empty())
+  {
+    return static_cast<int32_t>(siblings.size());
+  }
+#endif
+
+  unsigned int n_threads = std::thread::hardware_concurrency();
+  return n_threads > 0 ? (n_threads <= 4 ? n_threads : n_threads / 2) : 1;
+}
+
+} // namespace
+
+namespace onert::util
+{
+
+ThreadBudget::ThreadBudget(int32_t num_threads)
+{
+  _num_threads = num_threads < 0 ? defaultNumThreads() : std::max(num_threads, 1);
+
+  const auto num_hw_threads = static_cast<int32_t>(std::thread::hardware_concurrency());
+  if (num_hw_threads > 0)
+    _num_threads = std::min(_num_threads, num_hw_threads);
+}
+
+int32_t ThreadBudget::defaultNumThreads()
+{
+  static const int32_t num_cores = countPhysicalCores();
+  return num_cores;
+}
+
+int32_t ThreadBudget::numThreadsPerLane(uint32_t num_lanes) const
+{
+  if (num_lanes <= 1)
+    return _num_threads;
+  return std::max<int32_t>(_num_threads / static_cast<int32_t>(num_lanes), 1);
+}
+
+std::shared_ptr<ThreadPoolCounter> ThreadBudget::addPool(const std::string &name,
+                                                          int32_t num_threads)
+{
+  auto counter = std::make_shared<ThreadPoolCounter>(name, num_threads);
+  std::lock_guard<std::mutex> lock{_mu};
+  counter->timed(_num_executions > 0);
+  _pools.emplace_back(counter);
+  return counter;
+}
+
+void ThreadBudget::beginExecution()
+{
+  std::lock_guard<std::mutex> lock{_mu};
+  if (_num_executions++ > 0)
+    return;
+
+  _execution_begin = std::chrono::steady_clock::now();
+  for (const auto &pool : _pools)
+    pool->timed(true);
+}
+
+void ThreadBudget::endExecution()
+{
+  std::lock_guard<std::mutex> lock{_mu};
+  if (_num_executions == 0 || --_num_executions > 0)
+    return;
+
+  _execution_time += std::chrono::steady_clock::now() - _execution_begin;
+  for (const auto &pool : _pools)
+    pool->timed(false);
+}
+
+std::vector<std::pair<std::string, uint64_t>> ThreadBudget::counters() const
+{
+  struct Usage
+  {
+    uint64_t threads = 0;
+    uint64_t tasks = 0;
+    uint64_t busy_ns = 0;
+  };
+
+  std::map<std::string, Usage> usages;
+  std::chrono::nanoseconds elapsed;
+  {
+    std::lock_guard<std::mutex> lock{_mu};
+    for (const auto &pool : _pools)
+    {
+      auto &usage = usages[pool->name()];
+      usage.threads = std::max<uint64_t>(usage.threads, pool->numThreads());
+      usage.tasks += pool->numTasks();
+      usage.busy_ns += pool->busyNanoseconds();
+    }
+
+    // Include the execution running now
+    elapsed = _execution_time;
+    if (_num_executions > 0)
+      elapsed += std::chrono::steady_clock::now() - _execution_begin;
+  }
+
+  const auto elapsed_ns = static_cast<uint64_t>(elapsed.count());
+
+  std::vector<std::pair<std::string, uint64_t>> ret;
+  for (const auto &[name, usage] : usages)
+  {
+    const auto capacity_ns = usage.threads * elapsed_ns;
+    const std::string prefix = "threadpool." + name + ".";
+    ret.emplace_back(prefix + "threads", usage.threads);
+    ret.emplace_back(prefix + "tasks", usage.tasks);
+    ret.emplace_back(prefix + "busy_us", usage.busy_ns / 1000);
+    ret.emplace_back(prefix + "utilization",
+                     capacity_ns > 0 ? usage.busy_ns * 100 / capacity_ns : 0);
+  }
+  return ret;
+}
+
+} // namespace onert::util
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ThreadBudget.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <thread>
+
+using namespace onert::util;
+
+TEST(ThreadBudget, NumThreads)
+{
+  const auto num_hw_threads = static_cast<int32_t>(std::thread::hardware_concurrency());
+
+  ThreadBudget single{1};
+  ASSERT_EQ(single.numThreads(), 1);
+  ASSERT_EQ(single.numThreadsPerLane(4), 1);
+
+  ThreadBudget defaults{-1};
+  ASSERT_EQ(defaults.numThreads(), ThreadBudget::defaultNumThreads());
+
+  // Not more than hardware threads
+  ThreadBudget many{1024};
+  if (num_hw_threads > 0)
+    ASSERT_EQ(many.numThreads(), num_hw_threads);
+  ASSERT_EQ(many.numThreadsPerLane(1), many.numThreads());
+  ASSERT_EQ(many.numThreadsPerLane(2), std::max(many.numThreads() / 2, 1));
+}
+
+TEST(ThreadBudget, Counters)
+{
+  ThreadBudget budget{1};
+
+  auto first = budget.addPool("pool", 2);
+  auto second = budget.addPool("pool", 4);
+  first->record(std::chrono::microseconds{10}, 2);
+  second->record(std::chrono::microseconds{5});
+
+  std::map<std::string, uint64_t> counters;
+  for (const auto &[name, value] : budget.counters())
+    counters[name] = value;
+
+  ASSERT_EQ(counters.at("threadpool.pool.threads"), 4u);
+  ASSERT_EQ(counters.at("threadpool.pool.tasks"), 2u);
+  ASSERT_EQ(counters.at("threadpool.pool.busy_us"), 25u);
+  // No execution has run
+  ASSERT_EQ(counters.at("threadpool.pool.utilization"), 0u);
+}
+
+TEST(ThreadBudget, TimedDuringExecutions)
+{
+  ThreadBudget budget{1};
+
+  auto before = budget.addPool("pool", 1);
+  ASSERT_FALSE(before->timed());
+
+  budget.beginExecution();
+  auto during = budget.addPool("pool", 1);
+  ASSERT_TRUE(before->timed());
+  ASSERT_TRUE(during->timed());
+
+  // Nested execution, e.g. a subgraph of If
+  budget.beginExecution();
+  budget.endExecution();
+  ASSERT_TRUE(before->timed());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds{2});
+  before->record(std::chrono::milliseconds{1});
+  budget.endExecution();
+  ASSERT_FALSE(before->timed());
+  ASSERT_FALSE(during->timed());
+
+  // Time out of executions is not counted
+  std::this_thread::sleep_for(std::chrono::milliseconds{200});
+
+  std::map<std::string, uint64_t> counters;
+  for (const auto &[name, value] : budget.counters())
+    counters[name] = value;
+
+  ASSERT_GE(counters.at("threadpool.pool.utilization"), 1u);
+  ASSERT_LE(counters.at("threadpool.pool.utilization"), 50u);
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTrain.h"
+
+#include <cmath>
+
+namespace
+{
+
+constexpr int32_t kWidth = 16;
+
+// FullyConnected layers with ReLU, whose weights and biases are all trained
+CircleBuffer genChainModel(uint32_t num_layers)
+{
+  CircleGen cgen;
+  const auto type = circle::TensorType::TensorType_FLOAT32;
+
+  const int model_input = cgen.addTensor({{1, kWidth}, type});
+  int input = model_input;
+  for (uint32_t l = 0; l < num_layers; ++l)
+  {
+    std::vector<float> weight_data(kWidth * kWidth);
+    for (size_t i = 0; i < weight_data.size(); ++i)
+      weight_data[i] = 0.05f * static_cast<float>(static_cast<int>((i * 7 + l * 3) % 11) - 5);
+    const uint32_t weight_buf = cgen.addBuffer(weight_data);
+    const uint32_t bias_buf = cgen.addBuffer(std::vector<float>(kWidth, 0.1f));
+    const int weight = cgen.addTensor({{kWidth, kWidth}, type, weight_buf});
+    const int bias = cgen.addTensor({{kWidth}, type, bias_buf});
+    const int fc_out = cgen.addTensor({{1, kWidth}, type});
+    const int relu_out = cgen.addTensor({{1, kWidth}, type});
+    cgen.addOperatorFullyConnected({{input, weight, bias}, {fc_out}});
+    cgen.addOperatorRelu({{fc_out}, {relu_out}});
+    input = relu_out;
+  }
+  cgen.setInputsAndOutputs({model_input}, {input});
+
+  return cgen.finish();
+}
+
+struct TrainResult
+{
+  std::vector<float> losses;
+  // Outputs of the trained model for fixed inputs, which depend on all trained weights
+  std::vector<float> outputs;
+};
+
+// Train the model on train backend with the given optimizer configs
+void train(const CircleBuffer &cbuf, NNFW_TRAIN_OPTIMIZER opt, const char *fuse_optimizer,
+           const char *clip_norm, TrainResult &result)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "train"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(session, "TRAINING_FUSE_OPTIMIZER", fuse_optimizer));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(session, "TRAINING_CLIP_NORM", clip_norm));
+
+  nnfw_train_info tri;
+  tri.learning_rate = 0.01f;
+  tri.opt = opt;
+  tri.num_of_trainable_ops = NNFW_TRAIN_TRAINABLE_ALL;
+  NNFW_ENSURE_SUCCESS(nnfw_train_set_traininfo(session, &tri));
+  NNFW_ENSURE_SUCCESS(nnfw_train_prepare(session));
+
+  std::vector<float> input(kWidth);
+  std::vector<float> expected(kWidth);
+  std::vector<float> output(kWidth);
+  nnfw_tensorinfo ti;
+  NNFW_ENSURE_SUCCESS(nnfw_input_tensorinfo(session, 0, &ti));
+  NNFW_ENSURE_SUCCESS(nnfw_train_set_input(session, 0, input.data(), &ti));
+  NNFW_ENSURE_SUCCESS(nnfw_output_tensorinfo(session, 0, &ti));
+  NNFW_ENSURE_SUCCESS(nnfw_train_set_expected(session, 0, expected.data(), &ti));
+  NNFW_ENSURE_SUCCESS(nnfw_train_set_output(session, 0, NNFW_TYPE_TENSOR_FLOAT32, output.data(),
+                                            output.size() * sizeof(float)));
+
+  const int num_step = 8;
+  for (int step = 0; step < num_step; ++step)
+  {
+    for (int i = 0; i < kWidth; ++i)
+    {
+      input[i] = 0.1f * static_cast<float>((i + step) % 5);
+      expected[i] = 0.2f * static_cast<float>((i * 3 + step) % 4);
+    }
+
+    NNFW_ENSURE_SUCCESS(nnfw_train(session, true));
+
+    float loss = 0.f;
+    NNFW_ENSURE_SUCCESS(nnfw_train_get_loss(session, 0, &loss));
+    result.losses.emplace_back(loss);
+  }
+
+  const int num_probe = 3;
+  for (int probe = 0; probe < num_probe; ++probe)
+  {
+    for (int i = 0; i < kWidth; ++i)
+      input[i] = 0.05f * static_cast<float>((i * 5 + probe) % 7);
+
+    NNFW_ENSURE_SUCCESS(nnfw_train(session, false));
+    result.outputs.insert(result.outputs.end(), output.begin(), output.end());
+  }
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+// Train with per-op and fused updates, and check that they give the same losses and weights
+void expectSameTraining(NNFW_TRAIN_OPTIMIZER opt, const char *clip_norm)
+{
+  const auto cbuf = genChainModel(4);
+
+  // Fused mode is turned off last, since the configs are kept for the rest of tests
+  TrainResult fused;
+  ASSERT_NO_FATAL_FAILURE(train(cbuf, opt, "1", clip_norm, fused));
+  TrainResult per_op;
+  ASSERT_NO_FATAL_FAILURE(train(cbuf, opt, "0", "0", per_op));
+
+  ASSERT_EQ(fused.losses.size(), per_op.losses.size());
+  EXPECT_NE(per_op.losses.front(), per_op.losses.back());
+  for (size_t i = 0; i < per_op.losses.size(); ++i)
+    EXPECT_NEAR(fused.losses[i], per_op.losses[i], 1e-5f) << "Step " << i;
+
+  ASSERT_EQ(fused.outputs.size(), per_op.outputs.size());
+  for (size_t i = 0; i < per_op.outputs.size(); ++i)
+    EXPECT_NEAR(fused.outputs[i], per_op.outputs[i], 1e-5f) << "Output " << i;
+}
+
+} // namespace
+
+TEST(GenModelTrainFusedOptimizer, SGD_SameTraining)
+{
+  ASSERT_NO_FATAL_FAILURE(expectSameTraining(NNFW_TRAIN_OPTIMIZER_SGD, "0"));
+}
+
+TEST(GenModelTrainFusedOptimizer, Adam_SameTraining)
+{
+  ASSERT_NO_FATAL_FAILURE(expectSameTraining(NNFW_TRAIN_OPTIMIZER_ADAM, "0"));
+}
+
+// Clipping runs in the fused mode only. A clip norm larger than the norm of gradients does not
+// change the updates, so they must be the same as per-op updates.
+TEST(GenModelTrainFusedOptimizer, SGD_LargeClipNorm_SameTraining)
+{
+  ASSERT_NO_FATAL_FAILURE(expectSameTraining(NNFW_TRAIN_OPTIMIZER_SGD, "1000"));
+}
+
+TEST(GenModelTrainFusedOptimizer, Adam_LargeClipNorm_SameTraining)
+{
+  ASSERT_NO_FATAL_FAILURE(expectSameTraining(NNFW_TRAIN_OPTIMIZER_ADAM, "1000"));
+}
+
+TEST(GenModelTrainFusedOptimizer, ClipNorm_ChangesTraining)
+{
+  const auto cbuf = genChainModel(4);
+
+  for (const auto opt : {NNFW_TRAIN_OPTIMIZER_SGD, NNFW_TRAIN_OPTIMIZER_ADAM})
+  {
+    // Clipping is turned off last, since the configs are kept for the rest of tests
+    TrainResult clipped;
+    ASSERT_NO_FATAL_FAILURE(train(cbuf, opt, "0", "0.01", clipped));
+    TrainResult unclipped;
+    ASSERT_NO_FATAL_FAILURE(train(cbuf, opt, "0", "0", unclipped));
+
+    // The first loss is computed before any update
+    ASSERT_EQ(clipped.losses.size(), unclipped.losses.size());
+    EXPECT_FLOAT_EQ(clipped.losses.front(), unclipped.losses.front());
+    for (const auto loss : clipped.losses)
+      EXPECT_TRUE(std::isfinite(loss));
+    EXPECT_NE(clipped.outputs, unclipped.outputs);
+  }
+}
@@ -524,6 +524,85 @@ TEST(TestDynamicTensor, get_dynamic_output_buffer)
     ASSERT_FLOAT_EQ(expected[i], actual[i]);
   }
 
+  // The next run may free or reallocate the buffer
+  bool is_dynamic = false;
+  NNFW_ENSURE_SUCCESS(nnfw_output_is_dynamic(session, 0, &is_dynamic));
+  EXPECT_TRUE(is_dynamic);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST(TestDynamicTensor, get_static_output_buffer)
+{
+  nnfw_session *session = nullptr;
+
+  // Reshape to constant shape, whose output is static
+  CircleGen cgen;
+  auto f32 = circle::TensorType::TensorType_FLOAT32;
+  auto i32 = circle::TensorType::TensorType_INT32;
+  const std::vector<int32_t> new_shape_data{3, 2};
+  uint32_t new_shape_buf = cgen.addBuffer(new_shape_data);
+  int input = cgen.addTensor({{2, 3}, f32});
+  int new_shape = cgen.addTensor({{2}, i32, new_shape_buf});
+  int out = cgen.addTensor({{3, 2}, f32});
+  cgen.addOperatorReshape({{input, new_shape}, {out}}, &new_shape_data);
+  cgen.setInputsAndOutputs({input}, {out});
+  auto model_buf = cgen.finish();
+
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_prepare_config(session, NNFW_ENABLE_INTERNAL_OUTPUT_ALLOC, "true"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  const void *out_buffer = nullptr;
+  nnfw_tensorinfo info;
+  for (const float value : {1.0f, 2.0f})
+  {
+    std::vector<float> input_data(6, value);
+    NNFW_ENSURE_SUCCESS(nnfw_set_input(session, 0, NNFW_TYPE_TENSOR_FLOAT32, input_data.data(),
+                                       sizeof(float) * input_data.size()));
+    NNFW_ENSURE_SUCCESS(nnfw_run(session));
+
+    // The buffer is kept over runs
+    const void *buffer = nullptr;
+    NNFW_ENSURE_SUCCESS(nnfw_get_output(session, 0, &info, &buffer));
+    if (out_buffer != nullptr)
+      EXPECT_EQ(buffer, out_buffer);
+    out_buffer = buffer;
+    EXPECT_FLOAT_EQ(static_cast<const float *>(out_buffer)[5], value);
+
+    bool is_dynamic = true;
+    NNFW_ENSURE_SUCCESS(nnfw_output_is_dynamic(session, 0, &is_dynamic));
+    EXPECT_FALSE(is_dynamic);
+  }
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST(TestDynamicTensor, neg_output_is_dynamic)
+{
+  nnfw_session *session = nullptr;
+  auto model_buf = build_dynamic_Reshape();
+
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_prepare_config(session, NNFW_ENABLE_INTERNAL_OUTPUT_ALLOC, "true"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  // Before run
+  bool is_dynamic = false;
+  EXPECT_EQ(nnfw_output_is_dynamic(session, 0, &is_dynamic), NNFW_STATUS_INVALID_STATE);
+
+  std::vector<int> shape_dims = {3, 2};
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(session, 0, nnfw_type<int>::dtype, shape_dims.data(),
+                                     sizeof(int) * shape_dims.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_run(session));
+
+  EXPECT_EQ(nnfw_output_is_dynamic(session, 0, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+  EXPECT_EQ(nnfw_output_is_dynamic(session, 1, &is_dynamic), NNFW_STATUS_ERROR);
+
   NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
 }
 
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTrain.h"
+
+namespace
+{
+
+constexpr int32_t kWidth = 16;
+
+// FullyConnected and ReLU layers, which are deep enough to be split into recompute segments
+CircleBuffer genChainModel(uint32_t num_layers)
+{
+  CircleGen cgen;
+  const auto type = circle::TensorType::TensorType_FLOAT32;
+
+  const int model_input = cgen.addTensor({{1, kWidth}, type});
+  int input = model_input;
+  for (uint32_t l = 0; l < num_layers; ++l)
+  {
+    std::vector<float> weight_data(kWidth * kWidth);
+    for (size_t i = 0; i < weight_data.size(); ++i)
+      weight_data[i] = 0.05f * static_cast<float>(static_cast<int>((i * 7 + l * 3) % 11) - 5);
+    const uint32_t weight_buf = cgen.addBuffer(weight_data);
+    const uint32_t bias_buf = cgen.addBuffer(std::vector<float>(kWidth, 0.1f));
+    const int weight = cgen.addTensor({{kWidth, kWidth}, type, weight_buf});
+    const int bias = cgen.addTensor({{kWidth}, type, bias_buf});
+    const int fc_out = cgen.addTensor({{1, kWidth}, type});
+    const int relu_out = cgen.addTensor({{1, kWidth}, type});
+    cgen.addOperatorFullyConnected({{input, weight, bias}, {fc_out}});
+    cgen.addOperatorRelu({{fc_out}, {relu_out}});
+    input = relu_out;
+  }
+  cgen.setInputsAndOutputs({model_input}, {input});
+
+  return cgen.finish();
+}
+
+// Train the model on train backend and collect the loss of each step
+void train(const CircleBuffer &cbuf, const char *recompute, std::vector<float> &losses)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "train"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(session, "TRAINING_RECOMPUTE", recompute));
+
+  nnfw_train_info tri;
+  tri.learning_rate = 0.01f;
+  tri.num_of_trainable_ops = NNFW_TRAIN_TRAINABLE_ALL;
+  NNFW_ENSURE_SUCCESS(nnfw_train_set_traininfo(session, &tri));
+  NNFW_ENSURE_SUCCESS(nnfw_train_prepare(session));
+
+  std::vector<float> input(kWidth);
+  std::vector<float> expected(kWidth);
+  nnfw_tensorinfo ti;
+  NNFW_ENSURE_SUCCESS(nnfw_input_tensorinfo(session, 0, &ti));
+  NNFW_ENSURE_SUCCESS(nnfw_train_set_input(session, 0, input.data(), &ti));
+  NNFW_ENSURE_SUCCESS(nnfw_output_tensorinfo(session, 0, &ti));
+  NNFW_ENSURE_SUCCESS(nnfw_train_set_expected(session, 0, expected.data(), &ti));
+
+  const int num_epoch = 4;
+  const int num_step = 2;
+  for (int epoch = 0; epoch < num_epoch; ++epoch)
+  {
+    for (int step = 0; step < num_step; ++step)
+    {
+      for (int i = 0; i < kWidth; ++i)
+      {
+        input[i] = 0.1f * static_cast<float>((i + step) % 5);
+        expected[i] = 0.2f * static_cast<float>((i * 3 + step) % 4);
+      }
+
+      NNFW_ENSURE_SUCCESS(nnfw_train(session, true));
+
+      float loss = 0.f;
+      NNFW_ENSURE_SUCCESS(nnfw_train_get_loss(session, 0, &loss));
+      losses.emplace_back(loss);
+    }
+  }
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+} // namespace
+
+TEST(GenModelTrainRecompute, SameLosses)
+{
+  const auto cbuf = genChainModel(12);
+
+  // Recompute is turned off last, since the config is kept for the rest of tests
+  std::vector<float> recomputed_losses;
+  ASSERT_NO_FATAL_FAILURE(train(cbuf, "1", recomputed_losses));
+  std::vector<float> losses;
+  ASSERT_NO_FATAL_FAILURE(train(cbuf, "0", losses));
+
+  // Weights are updated, and recomputed activations give the same updates
+  ASSERT_EQ(recomputed_losses.size(), losses.size());
+  EXPECT_NE(losses.front(), losses.back());
+  for (size_t i = 0; i < losses.size(); ++i)
+    EXPECT_FLOAT_EQ(recomputed_losses[i], losses[i]) << "Step " << i;
+}
@@ -17,6 +17,8 @@
 #include "fixtures.h"
 #include "GenModelTests/one_op_tests/WhileTestModel.h"
 
+#include <thread>
+
 TEST_F(ValidationTestTwoSessions, neg_two_sessions_create)
 {
   ASSERT_EQ(nnfw_create_session(&_session1), NNFW_STATUS_NO_ERROR);
@@ -137,4 +139,70 @@ TEST_F(ValidationTestTwoSessionsCreated, two_sessions_run_simple_While_model)
   SUCCEED();
 }
 
+TEST_F(ValidationTestTwoSessions, instance_run_simple_AveragePool_model_by_threads)
+{
+  constexpr int N = 16, H = 32, W = 32, C = 3;
+  AveragePoolModel model(N, H, W, C);
+
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&_session1));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_load_circle_from_buffer(_session1, model.cbuf.buffer(), model.cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session1, "cpu"));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_prepare_config(_session1, NNFW_PREPARE_CONFIG_ENABLE_INSTANCES, nullptr));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session1));
+  NNFW_ENSURE_SUCCESS(nnfw_create_instance(_session1, &_session2));
+
+  constexpr int input_count = N * H * W * C;
+  constexpr int output_count = N * H / 2 * W / 2 * C;
+
+  std::vector<float> in_buf(input_count);
+  for (int i = 0; i < input_count; ++i)
+    in_buf[i] = static_cast<float>(i % 7);
+  std::vector<float> out_buf1(output_count);
+  std::vector<float> out_buf2(output_count);
+
+  auto run = [&](nnfw_session *session, std::vector<float> &out_buf) {
+    for (int i = 0; i < 10; ++i)
+    {
+      if (nnfw_set_input(session, 0, NNFW_TYPE_TENSOR_FLOAT32, in_buf.data(),
+                         in_buf.size() * sizeof(float)) != NNFW_STATUS_NO_ERROR ||
+          nnfw_set_output(session, 0, NNFW_TYPE_TENSOR_FLOAT32, out_buf.data(),
+                          out_buf.size() * sizeof(float)) != NNFW_STATUS_NO_ERROR ||
+          nnfw_run(session) != NNFW_STATUS_NO_ERROR)
+        return false;
+    }
+    return true;
+  };
+
+  bool ok1 = false, ok2 = false;
+  std::thread thread1([&] { ok1 = run(_session1, out_buf1); });
+  std::thread thread2([&] { ok2 = run(_session2, out_buf2); });
+  thread1.join();
+  thread2.join();
+
+  ASSERT_TRUE(ok1);
+  ASSERT_TRUE(ok2);
+  ASSERT_EQ(out_buf1, out_buf2);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(_session1));
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(_session2));
+}
+
+TEST_F(ValidationTestTwoSessions, neg_create_instance)
+{
+  AveragePoolModel model(1, 4, 4, 1);
+
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&_session1));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_load_circle_from_buffer(_session1, model.cbuf.buffer(), model.cbuf.size()));
+  ASSERT_EQ(nnfw_create_instance(_session1, &_session2), NNFW_STATUS_INVALID_STATE);
+
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session1));
+  ASSERT_EQ(nnfw_create_instance(_session1, &_session2), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_create_instance(_session1, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(_session1));
+}
+
 // TODO Write two-session-test with large models run by threads
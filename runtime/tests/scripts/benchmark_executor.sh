@@ -0,0 +1,109 @@
+#!/bin/bash
+#
+# Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Compare executors on models with parallel branches (e.g. inception-like models)
+#
+# Each model is run with EXECUTOR=Linear, Dataflow and Parallel, and the mean EXECUTE time
+# is reported. Give --baseline to run the same with another install, e.g. one built before
+# a ThreadPool or ParallelExecutor change, and compare both in one table.
+#
+# ```
+# $ ./benchmark_executor.sh --install=Product/out --baseline=/path/to/old/out \
+#     --backends="cpu;ruy" --num_runs=20 model1.tflite nnpkg2 ...
+# ```
+
+INSTALL_PATH=
+BASELINE_PATH=
+BACKENDS="cpu"
+NUM_RUNS=10
+EXECUTORS="Linear Dataflow Parallel"
+MODELS=()
+
+function Usage()
+{
+    echo "Usage: ${BASH_SOURCE[0]} [OPTIONS] MODEL..."
+    echo ""
+    echo "MODEL                     : tflite/circle model or nnpackage directory"
+    echo "Options:"
+    echo "      --install=DIR       : install directory with bin/onert_run (required)"
+    echo "      --baseline=DIR      : install directory to compare with"
+    echo "      --backends=STRING   : BACKENDS to use (default='$BACKENDS')"
+    echo "      --num_runs=N        : number of runs per measurement (default=$NUM_RUNS)"
+    echo "      --executors=STRING  : executors to compare (default='$EXECUTORS')"
+}
+
+for i in "$@"
+do
+    case $i in
+        -h|--help|help)
+            Usage
+            exit 1
+            ;;
+        --install=*)
+            INSTALL_PATH=${i#*=}
+            ;;
+        --baseline=*)
+            BASELINE_PATH=${i#*=}
+            ;;
+        --backends=*)
+            BACKENDS=${i#*=}
+            ;;
+        --num_runs=*)
+            NUM_RUNS=${i#*=}
+            ;;
+        --executors=*)
+            EXECUTORS=${i#*=}
+            ;;
+        *)
+            MODELS+=("$i")
+            ;;
+    esac
+done
+
+if [ -z "$INSTALL_PATH" ] || [ ${#MODELS[@]} -eq 0 ]; then
+    Usage
+    exit 1
+fi
+
+# Print mean EXECUTE time in ms of a model run with given install and executor
+function mean_execute_ms()
+{
+    local install=$1
+    local executor=$2
+    local model=$3
+
+    LD_LIBRARY_PATH=$install/lib BACKENDS="$BACKENDS" EXECUTOR=$executor \
+        $install/bin/onert_run -r $NUM_RUNS -w 1 "$model" 2>/dev/null \
+        | awk '/^- MEAN / { print $4 }'
+}
+
+printf "%-32s %-10s %12s" "MODEL" "EXECUTOR" "MEAN(ms)"
+[ -n "$BASELINE_PATH" ] && printf " %12s %8s" "BASELINE(ms)" "SPEEDUP"
+printf "\n"
+
+for model in "${MODELS[@]}"; do
+    for executor in $EXECUTORS; do
+        current=$(mean_execute_ms "$INSTALL_PATH" $executor "$model")
+        printf "%-32s %-10s %12s" "$(basename $model)" $executor "${current:-FAIL}"
+        if [ -n "$BASELINE_PATH" ]; then
+            baseline=$(mean_execute_ms "$BASELINE_PATH" $executor "$model")
+            speedup=$(awk -v b="$baseline" -v c="$current" \
+                'BEGIN { if (b > 0 && c > 0) printf "%.2fx", b / c; else print "-" }')
+            printf " %12s %8s" "${baseline:-FAIL}" $speedup
+        fi
+        printf "\n"
+    done
+done
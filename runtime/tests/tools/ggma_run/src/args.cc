@@ -54,6 +54,14 @@ void Args::initialize(void)
     .type(arser::DataType::STR)
     .default_value("Lily picked up a flower.")
     .help("input prompt text");
+  _arser.add_argument("--num_runs", "-r")
+    .type(arser::DataType::INT32)
+    .default_value(1)
+    .help("The number of generation runs to measure tokens/sec");
+  _arser.add_argument("--stream", "-s")
+    .nargs(0)
+    .default_value(false)
+    .help("Print generated text as each token is generated");
   arser::Helper::add_version(_arser, print_version);
 }
 
@@ -89,6 +97,18 @@ void Args::parse(const int argc, char **argv)
     {
       _prompt = _arser.get<std::string>("--prompt");
     }
+
+    _stream = _arser.get<bool>("--stream");
+
+    if (_arser["--num_runs"])
+    {
+      _num_runs = _arser.get<int32_t>("--num_runs");
+      if (_num_runs < 1)
+      {
+        std::cerr << "--num_runs should be greater than 0\n";
+        exit(1);
+      }
+    }
   }
   catch (const std::bad_cast &e)
   {
@@ -34,6 +34,8 @@ public:
 
   const std::string &packagePath() const { return _package_path; }
   const std::string &prompt() const { return _prompt; }
+  int32_t numRuns() const { return _num_runs; }
+  bool stream() const { return _stream; }
   bool printVersion() const { return _print_version; }
 
 private:
@@ -45,6 +47,8 @@ private:
 
   std::string _package_path;
   std::string _prompt;
+  int32_t _num_runs = 1;
+  bool _stream = false;
   bool _print_version = false;
 };
 
@@ -17,9 +17,11 @@
 #include "args.h"
 #include "ggma_api.h"
 
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 #include <stdexcept>
+#include <vector>
 
 #define GGMA_ENSURE(a)               \
   do                                 \
@@ -30,6 +32,40 @@
     }                                \
   } while (0)
 
+namespace
+{
+
+// State shared with the streaming callback
+struct StreamState
+{
+  ggma_tokenizer *tokenizer = nullptr;
+  bool print = false;
+  std::vector<ggma_token> generated;
+  ggma_detokenize_state text_state{};
+  std::chrono::steady_clock::time_point begin;
+  std::chrono::duration<double> first_token{0};
+};
+
+int on_token(ggma_token token, void *user_data)
+{
+  auto state = static_cast<StreamState *>(user_data);
+  if (state->generated.empty())
+    state->first_token = std::chrono::steady_clock::now() - state->begin;
+  state->generated.push_back(token);
+
+  if (state->print)
+  {
+    char text[64];
+    GGMA_ENSURE(ggma_detokenize_next(state->tokenizer, state->generated.data(),
+                                     state->generated.size(), &state->text_state, text,
+                                     sizeof(text)));
+    std::cout << text << std::flush;
+  }
+  return 0;
+}
+
+} // namespace
+
 int main(const int argc, char **argv)
 {
   using namespace ggma_run;
@@ -54,8 +90,48 @@ int main(const int argc, char **argv)
     ggma_context *context = nullptr;
     GGMA_ENSURE(ggma_create_context(&context, args.packagePath().c_str()));
 
-    size_t n_predict = 22;
-    GGMA_ENSURE(ggma_generate(context, tokens, n_tokens, n_tokens_max, &n_predict));
+    // Generate repeatedly on the same context to measure steady-state throughput.
+    // Each run overwrites the generated tokens after the prompt.
+    constexpr size_t n_predict_max = 22;
+    size_t n_predict = n_predict_max;
+    size_t n_generated_total = 0;
+    std::chrono::duration<double> elapsed{0};
+    std::chrono::duration<double> first_token{0};
+    StreamState state;
+    state.tokenizer = tokenizer;
+    for (int32_t run = 0; run < args.numRuns(); ++run)
+    {
+      // Stream text of the first run only
+      state.print = args.stream() && run == 0;
+      state.generated.clear();
+      state.text_state = {};
+      if (state.print)
+        std::cout << "streamed: " << std::flush;
+
+      n_predict = n_predict_max;
+      state.begin = std::chrono::steady_clock::now();
+      GGMA_ENSURE(ggma_generate_stream(context, tokens, n_tokens, n_tokens_max, &n_predict,
+                                       on_token, &state));
+      elapsed += std::chrono::steady_clock::now() - state.begin;
+      first_token += state.first_token;
+      n_generated_total += n_predict;
+
+      if (state.print)
+      {
+        // Print the text held back for a character which the last token did not complete
+        char text[64] = "";
+        do
+        {
+          if (state.generated.empty())
+            break;
+          GGMA_ENSURE(ggma_detokenize_flush(tokenizer, state.generated.data(),
+                                            state.generated.size(), &state.text_state, text,
+                                            sizeof(text)));
+          std::cout << text;
+        } while (text[0] != '\0');
+        std::cout << std::endl;
+      }
+    }
 
     // Output generated token IDs
     std::cout << "prompt: " << prompt << std::endl;
@@ -77,6 +153,15 @@ int main(const int argc, char **argv)
       ggma_detokenize(tokenizer, tokens + n_tokens, n_predict, detokenized, detokenize_max));
     std::cout << "detokenized: " << detokenized << std::endl;
 
+    // Output throughput
+    std::cout << "runs: " << args.numRuns() << ", generated tokens: " << n_generated_total
+              << ", elapsed: " << elapsed.count() * 1000 << " ms";
+    if (elapsed.count() > 0)
+      std::cout << ", tokens/sec: " << n_generated_total / elapsed.count();
+    std::cout << std::endl;
+    std::cout << "time to first token: " << first_token.count() * 1000 / args.numRuns() << " ms"
+              << std::endl;
+
     GGMA_ENSURE(ggma_free_context(context));
     GGMA_ENSURE(ggma_free_tokenizer(tokenizer));
   }
@@ -191,6 +191,23 @@ void Args::Initialize(void)
     .default_value(0.0f)
     .help("Float between 0 and 1(0 < float < 1). Fraction of the training data to be used as "
           "validation data.");
+  _arser.add_argument("--shuffle")
+    .nargs(0)
+    .default_value(false)
+    .help("Shuffle training data every epoch (default: false)");
+  _arser.add_argument("--seed")
+    .type(arser::DataType::INT32)
+    .default_value(0)
+    .help("Seed to shuffle training data (default: 0)");
+  _arser.add_argument("--num_loader_threads")
+    .type(arser::DataType::INT32)
+    .default_value(0)
+    .help({"Number of threads to load training data in background (default: 0)",
+           "\"0\" means that training data is loaded before each step on the training thread."});
+  _arser.add_argument("--prefetch")
+    .type(arser::DataType::INT32)
+    .default_value(2)
+    .help("Number of batches loaded ahead by loader threads (default: 2)");
   _arser.add_argument("--verbose_level", "-v")
     .type(arser::DataType::INT32)
     .default_value(0)
@@ -293,6 +310,19 @@ void Args::Parse(const int argc, char **argv)
       exit(1);
     }
 
+    _shuffle = _arser.get<bool>("--shuffle");
+    _seed = _arser.get<int32_t>("--seed");
+
+    _num_loader_threads = _arser.get<int32_t>("--num_loader_threads");
+    _prefetch = _arser.get<int32_t>("--prefetch");
+    if (_num_loader_threads < 0 || _prefetch < 1)
+    {
+      std::cerr << "Invalid num_loader_threads or prefetch. num_loader_threads must not be "
+                   "negative and prefetch must be positive."
+                << std::endl;
+      exit(1);
+    }
+
     _verbose_level = _arser.get<int32_t>("--verbose_level");
 
     if (_arser["--output_sizes"])
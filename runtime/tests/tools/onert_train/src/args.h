@@ -68,6 +68,10 @@ public:
   const std::optional<NNFW_TRAIN_OPTIMIZER> getOptimizerType(void) const { return _optimizer_type; }
   int32_t getMetricType(void) const { return _metric_type; }
   float getValidationSplit(void) const { return _validation_split; }
+  bool getShuffle(void) const { return _shuffle; }
+  int32_t getSeed(void) const { return _seed; }
+  int32_t getNumLoaderThreads(void) const { return _num_loader_threads; }
+  int32_t getPrefetch(void) const { return _prefetch; }
   bool printVersion(void) const { return _print_version; }
   int32_t getVerboseLevel(void) const { return _verbose_level; }
   std::unordered_map<uint32_t, uint32_t> getOutputSizes(void) const { return _output_sizes; }
@@ -117,6 +121,10 @@ private:
   std::optional<NNFW_TRAIN_OPTIMIZER> _optimizer_type;
   int32_t _metric_type;
   float _validation_split;
+  bool _shuffle;
+  int32_t _seed;
+  int32_t _num_loader_threads;
+  int32_t _prefetch;
   bool _print_version = false;
   int32_t _verbose_level;
   std::unordered_map<uint32_t, uint32_t> _output_sizes;
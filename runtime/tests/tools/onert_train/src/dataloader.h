@@ -23,7 +23,6 @@
 #include <functional>
 #include <vector>
 #include <tuple>
-#include <fstream>
 
 namespace onert_train
 {
@@ -32,6 +31,12 @@ using Generator = std::function<bool(uint32_t,                  /** index **/
                                      std::vector<Allocation> &, /** input **/
                                      std::vector<Allocation> & /** expected **/)>;
 
+// Copy a sample into the pos-th place of batch buffers. It may be called from several threads.
+using SampleLoader = std::function<void(uint32_t,                  /** sample index **/
+                                        uint32_t,                  /** position in batch **/
+                                        std::vector<Allocation> &, /** input **/
+                                        std::vector<Allocation> & /** expected **/)>;
+
 class DataLoader
 {
 public:
@@ -46,11 +51,12 @@ public:
   virtual std::tuple<Generator, uint32_t>
   loadData(const uint32_t batch_size, const float from = 0.0f, const float to = 1.0f) = 0;
 
+  virtual std::tuple<SampleLoader, uint32_t>
+  loadSamples(const uint32_t batch_size, const float from = 0.0f, const float to = 1.0f) = 0;
+
 protected:
   std::vector<nnfw_tensorinfo> _input_infos;
   std::vector<nnfw_tensorinfo> _expected_infos;
-  std::ifstream _input_file;
-  std::ifstream _expected_file;
   uint32_t _data_length;
 };
 
@@ -26,8 +26,10 @@
 #include "rawformatter.h"
 #include "dataloader.h"
 #include "rawdataloader.h"
+#include "prefetcher.h"
 #include "metrics.h"
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cstdlib>
@@ -202,7 +204,7 @@ int main(const int argc, char **argv)
     }
 
     uint32_t tdata_length;
-    Generator tdata_generator;
+    SampleLoader tdata_loader;
     uint32_t vdata_length;
     Generator vdata_generator;
     std::unique_ptr<DataLoader> dataLoader;
@@ -214,7 +216,7 @@ int main(const int argc, char **argv)
                                                    expected_infos);
 
       auto train_to = 1.0f - args.getValidationSplit();
-      std::tie(tdata_generator, tdata_length) = dataLoader->loadData(tri.batch_size, 0.f, train_to);
+      std::tie(tdata_loader, tdata_length) = dataLoader->loadSamples(tri.batch_size, 0.f, train_to);
       std::tie(vdata_generator, vdata_length) =
         dataLoader->loadData(tri.batch_size, train_to, 1.0f);
     }
@@ -244,10 +246,21 @@ int main(const int argc, char **argv)
       exit(-1);
     }
 
+    // Training batches are assembled ahead of training steps by loader threads
+    BatchPrefetcher::Options prefetch_options;
+    prefetch_options.batch_size = tri.batch_size;
+    prefetch_options.num_epochs = std::max(args.getEpoch(), 0);
+    prefetch_options.num_threads = args.getNumLoaderThreads();
+    prefetch_options.depth = args.getPrefetch();
+    prefetch_options.shuffle = args.getShuffle();
+    prefetch_options.seed = args.getSeed();
+    BatchPrefetcher tdata_prefetcher(tdata_loader, tdata_length, input_infos, expected_infos,
+                                     prefetch_options);
+
     std::vector<float> losses(num_expecteds);
     std::vector<float> metrics(num_expecteds);
     measure.run(PhaseType::EXECUTE, [&]() {
-      const auto num_step = tdata_length / tri.batch_size;
+      const auto num_step = tdata_prefetcher.numSteps();
       const auto num_epoch = args.getEpoch();
       measure.set(num_epoch, num_step);
       for (int32_t epoch = 0; epoch < num_epoch; ++epoch)
@@ -260,29 +273,28 @@ int main(const int argc, char **argv)
           std::fill(metrics.begin(), metrics.end(), 0);
           for (uint32_t n = 0; n < num_step; ++n)
           {
-            // get batchsize data
-            if (!tdata_generator(n, input_data, expected_data))
-              break;
+            // get batchsize data, which is valid until the next step
+            const auto &batch = tdata_prefetcher.next();
 
             // prepare input
             for (uint32_t i = 0; i < num_inputs; ++i)
             {
               NNPR_ENSURE_STATUS(
-                nnfw_train_set_input(session, i, input_data[i].data(), &input_infos[i]));
+                nnfw_train_set_input(session, i, batch.inputs[i].data(), &input_infos[i]));
             }
 
             // prepare output
             for (uint32_t i = 0; i < num_expecteds; ++i)
             {
               NNPR_ENSURE_STATUS(
-                nnfw_train_set_expected(session, i, expected_data[i].data(), &expected_infos[i]));
+                nnfw_train_set_expected(session, i, batch.expecteds[i].data(), &expected_infos[i]));
             }
 
             // train
             measure.run(epoch, n, [&]() { NNPR_ENSURE_STATUS(nnfw_train(session, true)); });
 
             // store loss
-            Metrics metric(output_data, expected_data, expected_infos);
+            Metrics metric(output_data, batch.expecteds, expected_infos);
             for (uint32_t i = 0; i < num_expecteds; ++i)
             {
               float temp = 0.f;
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "prefetcher.h"
+#include "nnfw_util.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+namespace onert_train
+{
+
+BatchPrefetcher::BatchPrefetcher(const SampleLoader &loader, uint32_t num_samples,
+                                 const std::vector<nnfw_tensorinfo> &input_infos,
+                                 const std::vector<nnfw_tensorinfo> &expected_infos,
+                                 const Options &options)
+  : _loader{loader}, _num_samples{num_samples},
+    _num_steps{options.batch_size > 0 ? num_samples / options.batch_size : 0},
+    _num_batches{static_cast<uint64_t>(_num_steps) * options.num_epochs}, _options{options}
+{
+  const auto depth = std::max<uint32_t>(_options.depth, 1);
+  _ring.resize(depth);
+  for (auto &batch : _ring)
+  {
+    batch.inputs = std::vector<Allocation>(input_infos.size());
+    for (uint32_t i = 0; i < input_infos.size(); ++i)
+      batch.inputs[i].alloc(bufsize_for(&input_infos[i]));
+
+    batch.expecteds = std::vector<Allocation>(expected_infos.size());
+    for (uint32_t i = 0; i < expected_infos.size(); ++i)
+      batch.expecteds[i].alloc(bufsize_for(&expected_infos[i]));
+  }
+  _filled.assign(depth, -1);
+
+  for (uint32_t i = 0; i < _options.num_threads; ++i)
+    _workers.emplace_back([this]() { work(); });
+}
+
+BatchPrefetcher::~BatchPrefetcher()
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _stop = true;
+  }
+  _cv.notify_all();
+
+  for (auto &worker : _workers)
+    worker.join();
+}
+
+const Batch &BatchPrefetcher::next()
+{
+  if (_next_read >= _num_batches)
+    throw std::runtime_error("No more batches to load");
+
+  const auto seq = _next_read++;
+  const auto slot = seq % _ring.size();
+
+  std::unique_lock<std::mutex> lock{_mutex};
+  // The batch returned by the previous call is not used anymore
+  _released = seq;
+
+  auto failed = [&]() { return _error && _error_seq <= seq; };
+  if (_workers.empty())
+  {
+    if (failed())
+      std::rethrow_exception(_error);
+    lock.unlock();
+    try
+    {
+      fill(seq);
+    }
+    catch (...)
+    {
+      lock.lock();
+      setError(seq);
+      throw;
+    }
+    return _ring[slot];
+  }
+
+  _cv.notify_all();
+  _cv.wait(lock, [&]() { return _filled[slot] == static_cast<int64_t>(seq) || failed(); });
+  if (failed())
+    std::rethrow_exception(_error);
+
+  return _ring[slot];
+}
+
+void BatchPrefetcher::setError(uint64_t seq)
+{
+  // Keep the error of the earliest batch, as batches are used in order
+  if (!_error || seq < _error_seq)
+  {
+    _error = std::current_exception();
+    _error_seq = seq;
+  }
+}
+
+void BatchPrefetcher::work()
+{
+  while (true)
+  {
+    uint64_t seq;
+    {
+      std::unique_lock<std::mutex> lock{_mutex};
+      _cv.wait(lock, [&]() {
+        return _stop || (_next_fill < _num_batches && _next_fill < _released + _ring.size());
+      });
+      if (_stop)
+        return;
+      seq = _next_fill++;
+    }
+
+    try
+    {
+      fill(seq);
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      setError(seq);
+      _cv.notify_all();
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      _filled[seq % _ring.size()] = static_cast<int64_t>(seq);
+    }
+    _cv.notify_all();
+  }
+}
+
+void BatchPrefetcher::fill(uint64_t seq)
+{
+  assert(_num_steps > 0);
+
+  const auto epoch = static_cast<uint32_t>(seq / _num_steps);
+  const auto step = static_cast<uint32_t>(seq % _num_steps);
+  const auto order = getOrder(epoch);
+  auto &batch = _ring[seq % _ring.size()];
+
+  const auto batch_size = _options.batch_size;
+  for (uint32_t pos = 0; pos < batch_size; ++pos)
+  {
+    const auto index = step * batch_size + pos;
+    _loader(order ? order->at(index) : index, pos, batch.inputs, batch.expecteds);
+  }
+}
+
+std::shared_ptr<const std::vector<uint32_t>> BatchPrefetcher::getOrder(uint32_t epoch)
+{
+  if (!_options.shuffle)
+    return nullptr;
+
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  // Orders of epochs before the batch in use are not needed anymore
+  const auto used_epoch = static_cast<uint32_t>(_released / _num_steps);
+  for (auto it = _orders.begin(); it != _orders.end();)
+    it = it->first < used_epoch ? _orders.erase(it) : std::next(it);
+
+  auto &order = _orders[epoch];
+  if (!order)
+  {
+    // Each epoch has its own order, which does not depend on the number of threads
+    auto indices = std::make_shared<std::vector<uint32_t>>(_num_samples);
+    std::iota(indices->begin(), indices->end(), 0);
+    std::mt19937 gen(_options.seed + epoch);
+    std::shuffle(indices->begin(), indices->end(), gen);
+    order = indices;
+  }
+  return order;
+}
+
+} // namespace onert_train
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_TRAIN_PREFETCHER_H__
+#define __ONERT_TRAIN_PREFETCHER_H__
+
+#include "allocation.h"
+#include "dataloader.h"
+#include "nnfw.h"
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace onert_train
+{
+
+struct Batch
+{
+  std::vector<Allocation> inputs;
+  std::vector<Allocation> expecteds;
+};
+
+/**
+ * @brief Assemble batches of samples on background threads ahead of training steps
+ *
+ * Batches of all epochs are filled in order into a ring of depth preallocated batches, while
+ * the caller trains on the previous one. Samples are visited in a permutation of each epoch if
+ * shuffle is on. If num_threads is 0, batches are filled on the calling thread.
+ */
+class BatchPrefetcher
+{
+public:
+  struct Options
+  {
+    uint32_t batch_size = 1;
+    uint32_t num_epochs = 1;
+    uint32_t num_threads = 1;
+    uint32_t depth = 2;
+    bool shuffle = false;
+    uint32_t seed = 0;
+  };
+
+public:
+  BatchPrefetcher(const SampleLoader &loader, uint32_t num_samples,
+                  const std::vector<nnfw_tensorinfo> &input_infos,
+                  const std::vector<nnfw_tensorinfo> &expected_infos, const Options &options);
+  ~BatchPrefetcher();
+
+  BatchPrefetcher(const BatchPrefetcher &) = delete;
+  BatchPrefetcher &operator=(const BatchPrefetcher &) = delete;
+
+public:
+  /**
+   * @brief Number of batches in an epoch, the remaining samples are dropped
+   */
+  uint32_t numSteps() const { return _num_steps; }
+
+  /**
+   * @brief Get the next batch, which is valid until the next call
+   */
+  const Batch &next();
+
+private:
+  void work();
+  void fill(uint64_t seq);
+  // Record the exception being handled as the error of the batch, with _mutex held
+  void setError(uint64_t seq);
+  std::shared_ptr<const std::vector<uint32_t>> getOrder(uint32_t epoch);
+
+private:
+  const SampleLoader _loader;
+  const uint32_t _num_samples;
+  const uint32_t _num_steps;
+  const uint64_t _num_batches;
+  const Options _options;
+
+  std::vector<Batch> _ring;
+  // Sequence number of the batch filled in each slot of ring, or -1 if not yet
+  std::vector<int64_t> _filled;
+  // Sample orders of epochs which are being filled
+  std::unordered_map<uint32_t, std::shared_ptr<const std::vector<uint32_t>>> _orders;
+
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  uint64_t _next_fill = 0;
+  uint64_t _next_read = 0;
+  // Batches before this sequence number are not used by the caller anymore
+  uint64_t _released = 0;
+  bool _stop = false;
+  // Error of loading, rethrown for the failed batch and all batches after it
+  std::exception_ptr _error;
+  uint64_t _error_seq = 0;
+  std::vector<std::thread> _workers;
+};
+
+} // namespace onert_train
+
+#endif // __ONERT_TRAIN_PREFETCHER_H__
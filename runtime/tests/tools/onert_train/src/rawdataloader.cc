@@ -17,10 +17,15 @@
 #include "rawdataloader.h"
 #include "nnfw_util.h"
 
+#include <cstring>
+#include <fcntl.h>
 #include <iostream>
 #include <stdexcept>
 #include <numeric>
 #include <cassert>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace onert_train
 {
@@ -38,24 +43,74 @@ uint64_t getRawTensorSize(const std::vector<nnfw_tensorinfo> &infos)
 }
 } // namespace onert_train
 
+namespace
+{
+
+using namespace onert_train;
+
+// Offsets of the first sample of split for each tensor, whose samples are stored sequentially
+std::vector<uint64_t> getSplitOrigins(const std::vector<nnfw_tensorinfo> &infos,
+                                      uint32_t batch_size, uint32_t data_length,
+                                      uint32_t split_start)
+{
+  std::vector<uint64_t> origins(infos.size());
+  uint64_t start = 0;
+  for (uint32_t i = 0; i < infos.size(); ++i)
+  {
+    auto hwc_size = bufsize_for(&infos[i]) / batch_size;
+    origins.at(i) = start + (hwc_size * split_start);
+    start += (hwc_size * data_length);
+  }
+  return origins;
+}
+
+} // namespace
+
 namespace onert_train
 {
 
+MappedFile::MappedFile(const std::string &path)
+{
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error("Failed to open " + path);
+
+  struct stat st;
+  if (fstat(fd, &st) != 0)
+  {
+    close(fd);
+    throw std::runtime_error("Failed to get the size of " + path);
+  }
+
+  _size = st.st_size;
+  if (_size > 0)
+  {
+    void *data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED)
+    {
+      close(fd);
+      throw std::runtime_error("Failed to map " + path);
+    }
+    _data = static_cast<uint8_t *>(data);
+  }
+  // The mapping is kept after closing the file
+  close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+  if (_data != nullptr)
+    munmap(_data, _size);
+}
+
 RawDataLoader::RawDataLoader(const std::string &input_file, const std::string &expected_file,
                              const std::vector<nnfw_tensorinfo> &input_infos,
                              const std::vector<nnfw_tensorinfo> &expected_infos)
-  : DataLoader(input_infos, expected_infos)
+  : DataLoader(input_infos, expected_infos), _input_file(input_file),
+    _expected_file(expected_file)
 {
-  _input_file = std::ifstream(input_file, std::ios::binary);
-  _expected_file = std::ifstream(expected_file, std::ios::binary);
-
-  _input_file.seekg(0, std::ios::end);
-  uint32_t input_file_size = _input_file.tellg();
-  uint32_t input_data_length = input_file_size / getRawTensorSize(_input_infos);
-
-  _expected_file.seekg(0, std::ios::end);
-  uint32_t expected_file_size = _expected_file.tellg();
-  uint32_t expected_data_length = expected_file_size / getRawTensorSize(_expected_infos);
+  uint32_t input_data_length = _input_file.size() / getRawTensorSize(_input_infos);
+  uint32_t expected_data_length = _expected_file.size() / getRawTensorSize(_expected_infos);
 
   if (input_data_length != expected_data_length)
   {
@@ -74,23 +129,8 @@ std::tuple<Generator, uint32_t> RawDataLoader::loadData(const uint32_t batch_siz
 
   int32_t split_size = _data_length * (to - from);
   int32_t split_start = _data_length * from;
-  std::vector<uint32_t> input_origins(_input_infos.size());
-  uint32_t start = 0;
-  for (uint32_t i = 0; i < _input_infos.size(); ++i)
-  {
-    auto hwc_size = bufsize_for(&_input_infos[i]) / batch_size;
-    input_origins.at(i) = start + (hwc_size * split_start);
-    start += (hwc_size * _data_length);
-  }
-
-  std::vector<uint32_t> expected_origins(_expected_infos.size());
-  start = 0;
-  for (uint32_t i = 0; i < _expected_infos.size(); ++i)
-  {
-    auto hwc_size = bufsize_for(&_expected_infos[i]) / batch_size;
-    expected_origins.at(i) = start + (hwc_size * split_start);
-    start += (hwc_size * _data_length);
-  }
+  auto input_origins = getSplitOrigins(_input_infos, batch_size, _data_length, split_start);
+  auto expected_origins = getSplitOrigins(_expected_infos, batch_size, _data_length, split_start);
 
   return std::make_tuple(
     [input_origins, expected_origins, this](uint32_t idx, std::vector<Allocation> &inputs,
@@ -98,18 +138,50 @@ std::tuple<Generator, uint32_t> RawDataLoader::loadData(const uint32_t batch_siz
       for (uint32_t i = 0; i < _input_infos.size(); ++i)
       {
         auto bufsz = bufsize_for(&_input_infos[i]);
-        _input_file.seekg(input_origins[i] + idx * bufsz, std::ios::beg);
-        _input_file.read(reinterpret_cast<char *>(inputs[i].data()), bufsz);
+        std::memcpy(inputs[i].data(), _input_file.data() + input_origins[i] + idx * bufsz, bufsz);
       }
       for (uint32_t i = 0; i < _expected_infos.size(); ++i)
       {
         auto bufsz = bufsize_for(&_expected_infos[i]);
-        _expected_file.seekg(expected_origins[i] + idx * bufsz, std::ios::beg);
-        _expected_file.read(reinterpret_cast<char *>(expecteds[i].data()), bufsz);
+        std::memcpy(expecteds[i].data(), _expected_file.data() + expected_origins[i] + idx * bufsz,
+                    bufsz);
       }
       return true;
     },
     split_size);
 }
 
+std::tuple<SampleLoader, uint32_t>
+RawDataLoader::loadSamples(const uint32_t batch_size, const float from, const float to)
+{
+  assert(from >= 0.f && from <= 1.f);
+  assert(to >= 0.f && to <= 1.f);
+  assert(from <= to);
+
+  int32_t split_size = _data_length * (to - from);
+  int32_t split_start = _data_length * from;
+  auto input_origins = getSplitOrigins(_input_infos, batch_size, _data_length, split_start);
+  auto expected_origins = getSplitOrigins(_expected_infos, batch_size, _data_length, split_start);
+
+  return std::make_tuple(
+    [input_origins, expected_origins, batch_size, this](uint32_t sample, uint32_t pos,
+                                                        std::vector<Allocation> &inputs,
+                                                        std::vector<Allocation> &expecteds) {
+      assert(pos < batch_size);
+      for (uint32_t i = 0; i < _input_infos.size(); ++i)
+      {
+        auto hwc_size = bufsize_for(&_input_infos[i]) / batch_size;
+        std::memcpy(static_cast<uint8_t *>(inputs[i].data()) + pos * hwc_size,
+                    _input_file.data() + input_origins[i] + sample * hwc_size, hwc_size);
+      }
+      for (uint32_t i = 0; i < _expected_infos.size(); ++i)
+      {
+        auto hwc_size = bufsize_for(&_expected_infos[i]) / batch_size;
+        std::memcpy(static_cast<uint8_t *>(expecteds[i].data()) + pos * hwc_size,
+                    _expected_file.data() + expected_origins[i] + sample * hwc_size, hwc_size);
+      }
+    },
+    split_size);
+}
+
 } // namespace onert_train
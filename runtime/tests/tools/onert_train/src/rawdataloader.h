@@ -19,9 +19,31 @@
 
 #include "dataloader.h"
 
+#include <string>
+
 namespace onert_train
 {
 
+/**
+ * @brief Read-only memory mapping of a whole file
+ */
+class MappedFile
+{
+public:
+  explicit MappedFile(const std::string &path);
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  const uint8_t *data() const { return _data; }
+  uint64_t size() const { return _size; }
+
+private:
+  uint8_t *_data = nullptr;
+  uint64_t _size = 0;
+};
+
 class RawDataLoader : public DataLoader
 {
 public:
@@ -31,6 +53,15 @@ public:
 
   std::tuple<Generator, uint32_t> loadData(const uint32_t batch_size, const float from = 0.0f,
                                            const float to = 1.0f) override;
+
+  std::tuple<SampleLoader, uint32_t> loadSamples(const uint32_t batch_size,
+                                                 const float from = 0.0f,
+                                                 const float to = 1.0f) override;
+
+private:
+  // Samples are copied from the mapped files, so that loaders can run on several threads
+  MappedFile _input_file;
+  MappedFile _expected_file;
 };
 
 } // namespace onert_train
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nnfw.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#include "../src/prefetcher.h"
+
+namespace
+{
+using namespace onert_train;
+
+constexpr uint32_t kBatchSize = 4;
+
+nnfw_tensorinfo makeInfo(int32_t size)
+{
+  nnfw_tensorinfo info = {
+    .dtype = NNFW_TYPE_TENSOR_INT32,
+    .rank = 2,
+    .dims = {kBatchSize, size},
+  };
+  return info;
+}
+
+// Input has the sample index for all elements, expected has its negative
+void loadSample(uint32_t sample, uint32_t pos, std::vector<Allocation> &inputs,
+                std::vector<Allocation> &expecteds)
+{
+  auto input = static_cast<int32_t *>(inputs[0].data()) + pos * 3;
+  std::fill(input, input + 3, static_cast<int32_t>(sample));
+  auto expected = static_cast<int32_t *>(expecteds[0].data()) + pos;
+  *expected = -static_cast<int32_t>(sample);
+}
+
+// Get samples of each batch of all epochs
+std::vector<std::vector<int32_t>> loadAll(uint32_t num_samples,
+                                          const BatchPrefetcher::Options &options)
+{
+  BatchPrefetcher prefetcher(loadSample, num_samples, {makeInfo(3)}, {makeInfo(1)}, options);
+
+  std::vector<std::vector<int32_t>> batches;
+  for (uint32_t i = 0; i < prefetcher.numSteps() * options.num_epochs; ++i)
+  {
+    const auto &batch = prefetcher.next();
+    auto input = static_cast<const int32_t *>(batch.inputs[0].data());
+    auto expected = static_cast<const int32_t *>(batch.expecteds[0].data());
+
+    std::vector<int32_t> samples;
+    for (uint32_t pos = 0; pos < kBatchSize; ++pos)
+    {
+      EXPECT_EQ(input[pos * 3], input[pos * 3 + 2]);
+      EXPECT_EQ(input[pos * 3], -expected[pos]);
+      samples.emplace_back(input[pos * 3]);
+    }
+    batches.emplace_back(samples);
+  }
+  return batches;
+}
+
+TEST(BatchPrefetcher, InOrder)
+{
+  BatchPrefetcher::Options options;
+  options.batch_size = kBatchSize;
+  options.num_epochs = 3;
+  options.num_threads = 2;
+  options.depth = 3;
+
+  // The last 2 samples are dropped
+  auto batches = loadAll(18, options);
+  ASSERT_EQ(batches.size(), 12u);
+  for (uint32_t i = 0; i < batches.size(); ++i)
+  {
+    std::vector<int32_t> expected(kBatchSize);
+    std::iota(expected.begin(), expected.end(), (i % 4) * kBatchSize);
+    ASSERT_EQ(batches[i], expected);
+  }
+}
+
+TEST(BatchPrefetcher, Shuffle)
+{
+  BatchPrefetcher::Options options;
+  options.batch_size = kBatchSize;
+  options.num_epochs = 2;
+  options.depth = 2;
+  options.shuffle = true;
+  options.seed = 7;
+
+  options.num_threads = 0;
+  auto batches = loadAll(16, options);
+  options.num_threads = 3;
+  ASSERT_EQ(loadAll(16, options), batches);
+
+  std::vector<int32_t> all(16);
+  std::iota(all.begin(), all.end(), 0);
+  for (uint32_t epoch = 0; epoch < 2; ++epoch)
+  {
+    std::vector<int32_t> samples;
+    for (uint32_t step = 0; step < 4; ++step)
+    {
+      const auto &batch = batches[epoch * 4 + step];
+      samples.insert(samples.end(), batch.begin(), batch.end());
+    }
+    ASSERT_NE(samples, all);
+    std::sort(samples.begin(), samples.end());
+    ASSERT_EQ(samples, all);
+  }
+  ASSERT_NE(std::vector<std::vector<int32_t>>(batches.begin(), batches.begin() + 4),
+            std::vector<std::vector<int32_t>>(batches.begin() + 4, batches.end()));
+}
+
+TEST(BatchPrefetcher, neg_LoaderError)
+{
+  auto loader = [](uint32_t sample, uint32_t, std::vector<Allocation> &,
+                   std::vector<Allocation> &) {
+    if (sample == 5)
+      throw std::runtime_error("Failed to load");
+  };
+
+  for (uint32_t num_threads : {0u, 2u})
+  {
+    BatchPrefetcher::Options options;
+    options.batch_size = kBatchSize;
+    options.num_threads = num_threads;
+    BatchPrefetcher prefetcher(loader, 16, {makeInfo(3)}, {makeInfo(1)}, options);
+
+    // The failed batch and all batches after it rethrow the error of the loader
+    EXPECT_NO_THROW(prefetcher.next());
+    for (uint32_t i = 1; i < prefetcher.numSteps(); ++i)
+    {
+      try
+      {
+        prefetcher.next();
+        ADD_FAILURE() << "Batch " << i << " is loaded";
+      }
+      catch (const std::runtime_error &e)
+      {
+        EXPECT_STREQ(e.what(), "Failed to load");
+      }
+    }
+  }
+}
+
+} // namespace
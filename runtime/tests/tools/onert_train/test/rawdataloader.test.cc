@@ -18,6 +18,7 @@
 
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <fstream>
 #include <numeric>
 
 #include "../src/rawdataloader.h"